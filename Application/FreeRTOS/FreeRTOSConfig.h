@@ -0,0 +1,33 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    FreeRTOSConfig.h
+  * @author  MCD Application Team
+  * @brief   FreeRTOS configuration used to compile the tickless idle of
+  *          app_freertos.c
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2019-2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/**
+ * The application runs on the sequencer and has no FreeRTOS configuration of its own. This one takes the template
+ * of the kernel and enables the application defined tickless idle, as a FreeRTOS build of the application shall do.
+ */
+#ifndef FREERTOS_CONFIG_WRAPPER_H
+#define FREERTOS_CONFIG_WRAPPER_H
+
+#include "FreeRTOSConfig_template.h"
+
+#define configUSE_TICKLESS_IDLE                  2
+
+#endif /* FREERTOS_CONFIG_WRAPPER_H */
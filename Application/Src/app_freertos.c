@@ -0,0 +1,335 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    app_freertos.c
+  * @author  MCD Application Team
+  * @brief   FreeRTOS tickless idle based on the Low Power Manager and the
+  *          Timer Server
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2019-2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+
+/**
+ * When the application runs on FreeRTOS, the idle task enters the low power mode selected by the Low Power Manager,
+ * as UTIL_SEQ_Idle() does with the sequencer. The SysTick is stopped for the expected idle time and the wakeup is
+ * programmed with a Timer Server timer on the RTC wakeup timer, so the device may stay in Stop2. On wakeup, the time
+ * spent in low power mode is read from the RTC sub-second counter and the kernel tick count is corrected.
+ *
+ * To use it, add this file to a FreeRTOS build and set in FreeRTOSConfig.h:
+ *  - configUSE_TICKLESS_IDLE to 2, so the kernel calls vPortSuppressTicksAndSleep() below instead of the port one
+ *  - INCLUDE_vTaskSuspend to 1, as required by the kernel for tickless idle
+ * The HAL time base shall not be the SysTick, as for any FreeRTOS application.
+ *
+ * The application itself runs on the sequencer, so Application/FreeRTOS/Makefile compiles this file on its own
+ * against the FreeRTOS configuration template with configUSE_TICKLESS_IDLE set to 2.
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "app_common.h"
+#include "main.h"
+#include "hw_if.h"
+#include "stm32_lpm.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+#if (configUSE_TICKLESS_IDLE == 2)
+
+/* Private includes -----------------------------------------------------------*/
+/* USER CODE BEGIN Includes */
+
+/* USER CODE END Includes */
+
+/* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  uint8_t  LpTimer_Id;         /**< Timer Server timer used to wake up the device */
+  uint8_t  LpTimer_Created;    /**< Set once the timer has been created */
+  uint32_t LpSubSecondOnEntry; /**< RTC sub-second counter when entering low power mode */
+} LpTimerContext_t;
+
+/* USER CODE BEGIN PTD */
+
+/* USER CODE END PTD */
+
+/* Private defines -----------------------------------------------------------*/
+/**
+ * Frequency of the RTC sub-second counter and number of values it counts before wrapping
+ */
+#define LP_SUBSECOND_FREQ_HZ      (LSE_VALUE / (CFG_RTC_ASYNCH_PRESCALER + 1))
+#define LP_SUBSECOND_PERIOD       (CFG_RTC_SYNCH_PRESCALER + 1)
+
+/**
+ * The time spent in low power mode is measured with the sub-second counter, so it shall not wrap more than once.
+ * The sleep is limited to half of its period, expressed in Timer Server ticks
+ */
+#define LP_MAX_SLEEP_TS_TICKS     (((uint64_t)LP_SUBSECOND_PERIOD * (CFG_RTC_ASYNCH_PRESCALER + 1)) / (2 * CFG_RTCCLK_DIV))
+
+/* USER CODE BEGIN PD */
+
+/* USER CODE END PD */
+
+/* Private variables ---------------------------------------------------------*/
+static LpTimerContext_t LpTimerContext;
+
+/* USER CODE BEGIN PV */
+
+/* USER CODE END PV */
+
+/* Private function prototypes -----------------------------------------------*/
+static void LpTimerCb( void );
+static uint8_t LpTimerStart( TickType_t xIdleTicks );
+static uint32_t LpGetElapsedTime( void );
+static uint32_t LpReadSubSecond( void );
+static void LpEnter( void );
+
+/* USER CODE BEGIN PFP */
+
+/* USER CODE END PFP */
+
+/* Functions Definition ------------------------------------------------------*/
+/**
+  * @brief  Stop the tick and enter low power mode for the expected idle time
+  * @note   Called by the idle task with the scheduler suspended
+  * @param  xExpectedIdleTime: Number of ticks before the next task is unblocked
+  * @retval None
+  */
+void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
+{
+#if (CFG_LPM_SUPPORTED == 1)
+  uint32_t tick_counts, elapsed, complete_ticks, reload;
+
+  /**
+   * Enter a critical section with PRIMASK rather than with taskENTER_CRITICAL(), as BASEPRI would mask
+   * the interrupts that shall wake up the device
+   */
+  __disable_irq();
+  __DSB();
+  __ISB();
+
+  /**
+   * Abandon the low power entry if a context switch is pending or a task was made ready meanwhile
+   */
+  if( eTaskConfirmSleepModeStatus() == eAbortSleep )
+  {
+    __enable_irq();
+    return;
+  }
+
+  /**
+   * Stop the SysTick. A tick that elapsed since the idle task decided to sleep is processed first
+   */
+  SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+
+  if( (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0 )
+  {
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+    __enable_irq();
+    return;
+  }
+
+  tick_counts = SysTick->LOAD + 1;
+
+  /**
+   * Part of the current tick period that has already elapsed, in sub-second counter ticks scaled by the tick rate
+   */
+  elapsed = ((tick_counts - SysTick->VAL) * LP_SUBSECOND_FREQ_HZ) / tick_counts;
+
+  /**
+   * Wake up one tick early, the SysTick counts the last tick period
+   */
+  if( LpTimerStart( xExpectedIdleTime - 1 ) != 0 )
+  {
+    LpEnter();
+
+    elapsed += LpGetElapsedTime() * configTICK_RATE_HZ;
+
+    HW_TS_Stop(LpTimerContext.LpTimer_Id);
+  }
+
+  complete_ticks = elapsed / LP_SUBSECOND_FREQ_HZ;
+
+  if( complete_ticks >= xExpectedIdleTime )
+  {
+    /**
+     * The device woke up late, the next tick is counted immediately
+     */
+    complete_ticks = xExpectedIdleTime - 1;
+    reload = 1;
+  }
+  else
+  {
+    /**
+     * The SysTick counts what remains of the current tick period
+     */
+    reload = ((LP_SUBSECOND_FREQ_HZ - (elapsed % LP_SUBSECOND_FREQ_HZ)) * tick_counts) / LP_SUBSECOND_FREQ_HZ;
+    if( reload == 0 )
+    {
+      reload = 1;
+    }
+  }
+
+  /**
+   * Restart the SysTick from the remaining counts, then restore its period that is reloaded at the next tick
+   */
+  SysTick->LOAD = reload - 1;
+  SysTick->VAL = 0;
+  SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+  vTaskStepTick( complete_ticks );
+  SysTick->LOAD = tick_counts - 1;
+
+  __enable_irq();
+#else
+  (void)xExpectedIdleTime;
+#endif /* CFG_LPM_SUPPORTED == 1 */
+
+  return;
+}
+
+/* USER CODE BEGIN FD */
+
+/* USER CODE END FD */
+
+/*************************************************************
+ *
+ * LOCAL FUNCTIONS
+ *
+ *************************************************************/
+/**
+  * @brief  Low power timer callback
+  * @note   The timer only wakes up the device, the tick count is corrected by vPortSuppressTicksAndSleep()
+  * @param  None
+  * @retval None
+  */
+static void LpTimerCb( void )
+{
+  return;
+}
+
+/**
+  * @brief  Start the Timer Server timer that wakes up the device after the idle time
+  * @param  xIdleTicks: Number of kernel ticks to sleep
+  * @retval 1 when the timer is started, 0 when the idle time is too short or no timer is available
+  */
+static uint8_t LpTimerStart( TickType_t xIdleTicks )
+{
+  uint64_t ts_ticks;
+
+  if( LpTimerContext.LpTimer_Created == 0 )
+  {
+    if( HW_TS_Create(CFG_TIM_PROC_ID_ISR, &(LpTimerContext.LpTimer_Id), hw_ts_SingleShot, LpTimerCb) != hw_ts_Successful )
+    {
+      return 0;
+    }
+    LpTimerContext.LpTimer_Created = 1;
+  }
+
+  /**
+   * Convert the kernel ticks into Timer Server ticks, rounded down so the device is not woken up late
+   */
+  ts_ticks = ((uint64_t)xIdleTicks * LSE_VALUE) / ((uint64_t)configTICK_RATE_HZ * CFG_RTCCLK_DIV);
+
+  if( ts_ticks > LP_MAX_SLEEP_TS_TICKS )
+  {
+    ts_ticks = LP_MAX_SLEEP_TS_TICKS;
+  }
+
+  if( ts_ticks == 0 )
+  {
+    return 0;
+  }
+
+  HW_TS_Start(LpTimerContext.LpTimer_Id, (uint32_t)ts_ticks);
+
+  LpTimerContext.LpSubSecondOnEntry = LpReadSubSecond();
+
+  return 1;
+}
+
+/**
+  * @brief  Return the time spent in low power mode
+  * @param  None
+  * @retval Number of sub-second counter ticks elapsed since the low power timer was started
+  */
+static uint32_t LpGetElapsedTime( void )
+{
+  uint32_t sub_second_on_exit;
+
+  sub_second_on_exit = LpReadSubSecond();
+
+  /**
+   * The sub-second counter is a down counter
+   */
+  if( LpTimerContext.LpSubSecondOnEntry >= sub_second_on_exit )
+  {
+    return (LpTimerContext.LpSubSecondOnEntry - sub_second_on_exit);
+  }
+  else
+  {
+    return (LpTimerContext.LpSubSecondOnEntry + LP_SUBSECOND_PERIOD - sub_second_on_exit);
+  }
+}
+
+/**
+  * @brief  Read the RTC sub-second counter
+  * @note   As described in the reference manual, the RTC_SSR shall be read twice to ensure reliability of the value
+  * @param  None
+  * @retval SSR value read
+  */
+static uint32_t LpReadSubSecond( void )
+{
+  uint32_t first_read;
+  uint32_t second_read;
+
+  first_read = (uint32_t)(READ_BIT(RTC->SSR, RTC_SSR_SS));
+
+  second_read = (uint32_t)(READ_BIT(RTC->SSR, RTC_SSR_SS));
+
+  while(first_read != second_read)
+  {
+    first_read = second_read;
+
+    second_read = (uint32_t)(READ_BIT(RTC->SSR, RTC_SSR_SS));
+  }
+
+  return second_read;
+}
+
+/**
+  * @brief  Enter the low power mode selected by the Low Power Manager
+  * @note   Called from critical section. The Off mode would lose the kernel context, Stop mode is entered instead
+  * @param  None
+  * @retval None
+  */
+static void LpEnter( void )
+{
+  if( UTIL_LPM_GetMode() == UTIL_LPM_SLEEPMODE )
+  {
+    UTIL_PowerDriver.EnterSleepMode();
+
+    UTIL_PowerDriver.ExitSleepMode();
+  }
+  else
+  {
+    UTIL_PowerDriver.EnterStopMode();
+
+    UTIL_PowerDriver.ExitStopMode();
+  }
+
+  return;
+}
+
+/* USER CODE BEGIN Private_Functions */
+
+/* USER CODE END Private_Functions */
+
+#endif /* configUSE_TICKLESS_IDLE == 2 */
@@ -873,6 +873,52 @@ otError otCoapStop(otInstance *aInstance)
   return rspData;
 }
 
+const otCoapResponseCacheCounters *otCoapGetResponseCacheCounters(otInstance *aInstance)
+{
+#if (OT_CPU2_API_VERSION < 423U)
+  /* The response cache counters are read from a CPU2 firmware of OpenThread API version 423 or later */
+  static const otCoapResponseCacheCounters noCounters = { 0U, 0U, 0U };
+
+  return &noCounters;
+#else
+  const otCoapResponseCacheCounters * rspData;
+  
+  Pre_OtCmdProcessing();
+  /* prepare buffer */
+  Thread_OT_Cmd_Request_t* p_ot_req = THREAD_Get_OTCmdPayloadBuffer();
+
+  p_ot_req->ID = MSG_M4TOM0_OT_COAP_GET_RESPONSE_CACHE_COUNTERS;
+
+  p_ot_req->Size=0;
+
+  Ot_Cmd_Transfer();
+
+  p_ot_req = THREAD_Get_OTCmdRspPayloadBuffer();
+  rspData = (const otCoapResponseCacheCounters *)p_ot_req->Data[0];
+  
+  Post_OtCmdProcessing();
+  
+  return rspData;
+#endif
+}
+
+void otCoapResetResponseCacheCounters(otInstance *aInstance)
+{
+#if (OT_CPU2_API_VERSION >= 423U)
+  Pre_OtCmdProcessing();
+  /* prepare buffer */
+  Thread_OT_Cmd_Request_t* p_ot_req = THREAD_Get_OTCmdPayloadBuffer();
+
+  p_ot_req->ID = MSG_M4TOM0_OT_COAP_RESET_RESPONSE_CACHE_COUNTERS;
+
+  p_ot_req->Size=0;
+
+  Ot_Cmd_Transfer();
+
+  Post_OtCmdProcessing();
+#endif
+}
+
 #if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
 void otCoapAddBlockWiseResource(otInstance *aInstance, otCoapBlockwiseResource *aResource)
 {
@@ -29,6 +29,7 @@
 
 #include "thread.h"
 #include "message.h"
+#include <string.h>
 
 
 void otMessageFree(otMessage *aMessage)
@@ -396,6 +397,11 @@ void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo)
 
   p_ot_req->ID = MSG_M4TOM0_OT_MESSAGE_BUFFER_INFO;
 
+#if (OT_CPU2_API_VERSION < 422U)
+  /* The priority level counters are written by a CPU2 firmware of OpenThread API version 422 or later */
+  memset(aBufferInfo->mPriorityLevels, 0, sizeof(aBufferInfo->mPriorityLevels));
+#endif
+
   p_ot_req->Size=1;
   p_ot_req->Data[0] = (uint32_t) aBufferInfo;
 
@@ -30,6 +30,7 @@
 #include "coap_secure.h"
 #include "udp.h"
 #include "tcp.h"
+#include "instance.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -95,6 +96,18 @@ typedef struct  {
   STTcpListenerHandlerContextType       mSpecificContext; /* Contains context and handler */
 } STTcpListenerType;
 
+/* OpenThread API version implemented by the CPU2 wireless firmware. The structures */
+/* filled by the M0 have the layout of this version: the fields added to them by a */
+/* later OPENTHREAD_API_VERSION are not written by the M0 and are cleared by the    */
+/* M4 wrappers. Define it to the version of a newer CPU2 firmware to get them.     */
+#ifndef OT_CPU2_API_VERSION
+#define OT_CPU2_API_VERSION 420U
+#endif
+
+#if (OT_CPU2_API_VERSION > OPENTHREAD_API_VERSION)
+#error "The CPU2 wireless firmware implements a newer OpenThread API than these headers"
+#endif
+
 /* Structure of the messages exchanged between M0 and M4 */
 #define OT_CMD_BUFFER_SIZE 20U
 typedef PACKED_STRUCT
@@ -944,6 +957,8 @@ typedef enum
   MSG_M4TOM0_OT_THREAD_GET_ADVERTISEMENT_TRICKLE_INTERVAL_MAX,
   MSG_M4TOM0_OT_NET_DATA_GET_COMMISSIONING_DATA_SET,
   MSG_M4TOM0_OT_LOGGING_GENERATE_NEXT_HEX_DUMP_LINE,
+  MSG_M4TOM0_OT_COAP_GET_RESPONSE_CACHE_COUNTERS,
+  MSG_M4TOM0_OT_COAP_RESET_RESPONSE_CACHE_COUNTERS,
 } MsgId_M4toM0_Enum_t;
 
 /* List of messages sent by the M0 to the M4 */
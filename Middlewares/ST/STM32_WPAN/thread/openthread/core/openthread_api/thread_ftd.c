@@ -28,6 +28,7 @@
 #include OPENTHREAD_CONFIG_FILE
 
 #include "thread_ftd.h"
+#include <string.h>
 
 #if OPENTHREAD_FTD
 
@@ -744,6 +745,12 @@ otError otThreadGetNextCacheEntry(otInstance *aInstance, otCacheEntryInfo *aEntr
 
   p_ot_req->ID = MSG_M4TOM0_OT_THREAD_FTD_GET_NEXT_CACHE_ENTRY;
 
+#if (OT_CPU2_API_VERSION < 421U)
+  /* The hit counters are written by a CPU2 firmware of OpenThread API version 421 or later */
+  aEntryInfo->mHits = 0;
+  memset(&aEntryInfo->mCounters, 0, sizeof(aEntryInfo->mCounters));
+#endif
+
   p_ot_req->Size=2;
   p_ot_req->Data[0] = (uint32_t)aEntryInfo;
   p_ot_req->Data[1] = (uint32_t)aIterator;
@@ -0,0 +1,1020 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file implements a throughput and latency benchmark of the OpenThread core on the simulation platform.
+ *
+ * Every test builds a network of simulated nodes, measures one kind of traffic or procedure and prints one CSV line.
+ * The simulated time is deterministic, it is the same on any host. The wall time gives the cost of the OpenThread
+ * core and the simulation on the host, per packet or per procedure.
+ *
+ */
+
+#include <malloc.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <openthread/coap.h>
+#include <openthread/dataset_ftd.h>
+#include <openthread/error.h>
+#include <openthread/instance.h>
+#include <openthread/ip6.h>
+#include <openthread/message.h>
+#include <openthread/tcp.h>
+#include <openthread/tcp_ext.h>
+#include <openthread/thread.h>
+#include <openthread/thread_ftd.h>
+#include <openthread/udp.h>
+#include <openthread/platform/toolchain.h>
+
+#include "simulation.h"
+#include "utils/code_utils.h"
+
+#define BENCH_SEED 1
+#define BENCH_MAX_NODES 32
+#define BENCH_US_PER_S 1000000ULL
+
+#define BENCH_LINE_SPACING 10 // Distance between the nodes of a line, each node only hears its neighbours
+#define BENCH_LINE_RANGE 15
+#define BENCH_GRID_WIDTH 6 // Nodes of a full mesh, all in the default radio range of each other
+#define BENCH_GRID_SPACING 10
+#define BENCH_GRID_RANGE 100
+#define BENCH_ROUTER_JITTER 1 // Seconds, to build the networks quickly
+
+#define BENCH_ATTACH_TIMEOUT (300 * BENCH_US_PER_S)
+#define BENCH_ROUTE_TIMEOUT (600 * BENCH_US_PER_S)
+#define BENCH_WARM_UP_TIME (2 * BENCH_US_PER_S)
+#define BENCH_LOSS_TIMEOUT (1 * BENCH_US_PER_S)
+#define BENCH_RUN_TIMEOUT (3600 * BENCH_US_PER_S)
+
+#define BENCH_UDP_PORT 5000
+#define BENCH_WARM_UP_PORT 5001
+#define BENCH_TCP_PORT 5002
+#define BENCH_COAP_URI "bench"
+#define BENCH_MAX_PAYLOAD 1024
+#define BENCH_TCP_SEND_BUFFER_SIZE 4096
+
+#define BENCH_CHECK(aCall)                                                              \
+    do                                                                                  \
+    {                                                                                   \
+        otError benchError = (aCall);                                                   \
+                                                                                        \
+        if (benchError != OT_ERROR_NONE)                                                \
+        {                                                                               \
+            benchFail(#aCall, otThreadErrorToString(benchError));                       \
+        }                                                                               \
+    } while (false)
+
+typedef struct benchResult
+{
+    const char *mTest;
+    uint16_t    mNodes;
+    uint32_t    mSize;
+    uint32_t    mCount;
+    uint32_t    mLost;
+    uint64_t    mSimTime;  // Microseconds
+    uint64_t    mBytes;    // Payload bytes delivered
+    uint64_t    mWallTime; // Nanoseconds
+    uint64_t    mLatencySum;
+    uint64_t    mLatencyMin;
+    uint64_t    mLatencyMax;
+    uint32_t    mLatencyCount;
+} benchResult;
+
+typedef struct benchMemory
+{
+    uint16_t mNodes;
+    size_t   mInstanceSize;
+    size_t   mNodeSize;
+    long     mRssPerNode;
+    uint16_t mTotalBuffers;
+    uint16_t mMaxUsedBuffers;
+} benchMemory;
+
+typedef struct udpBench
+{
+    otUdpSocket   mSenderSocket;
+    otUdpSocket   mReceiverSocket;
+    otInstance   *mSender;
+    otMessageInfo mMessageInfo;
+    uint16_t      mSize;
+    uint16_t      mWindow;
+    uint32_t      mCount;
+    uint32_t      mSent;
+    uint32_t      mReceived;
+    uint32_t      mLost;
+    uint32_t      mLostBefore; // Datagrams with a lower sequence number are already counted as lost
+    uint64_t      mLastProgress;
+    uint64_t      mDoneTime;
+    benchResult  *mResult;
+} udpBench;
+
+struct coapBench;
+
+typedef struct coapRequest
+{
+    struct coapBench *mBench;
+    uint64_t          mSendTime;
+} coapRequest;
+
+typedef struct coapBench
+{
+    otCoapResource mResource;
+    otInstance    *mClient;
+    otInstance    *mServer;
+    otMessageInfo  mMessageInfo;
+    coapRequest   *mRequests;
+    uint16_t       mSize;
+    uint32_t       mCount;
+    uint32_t       mSent;
+    uint32_t       mDone;
+    uint32_t       mLost;
+    uint64_t       mDoneTime;
+    benchResult   *mResult;
+} coapBench;
+
+typedef struct tcpBench
+{
+    otTcpListener           mListener;
+    otTcpEndpoint           mClient;
+    otTcpEndpoint           mServer;
+    otTcpCircularSendBuffer mSendBuffer;
+    uint8_t                 mSendStorage[BENCH_TCP_SEND_BUFFER_SIZE];
+    uint8_t                 mClientReceiveStorage[OT_TCP_RECEIVE_BUFFER_SIZE_FEW_HOPS];
+    uint8_t                 mServerReceiveStorage[OT_TCP_RECEIVE_BUFFER_SIZE_FEW_HOPS];
+    size_t                  mTotal;
+    size_t                  mWritten;
+    size_t                  mReceived;
+    uint64_t                mEstablishedTime;
+    uint64_t                mDoneTime;
+    bool                    mDisconnected;
+} tcpBench;
+
+typedef struct attachBench
+{
+    uint64_t mAttachTime[BENCH_MAX_NODES];
+    uint16_t mNumAttached;
+} attachBench;
+
+static otInstance          *sNodes[BENCH_MAX_NODES];
+static uint16_t             sNumNodes;
+static otOperationalDataset sDataset;
+static uint8_t              sPayload[BENCH_MAX_PAYLOAD];
+static benchMemory          sMemory[4];
+static uint16_t             sNumMemory;
+
+static void benchFail(const char *aWhat, const char *aWhy)
+{
+    fprintf(stderr, "%s: %s\n", aWhat, aWhy);
+    exit(EXIT_FAILURE);
+}
+
+static uint64_t getWallTime(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+static long getRss(void)
+{
+    FILE *file = fopen("/proc/self/statm", "r");
+    long  size = 0;
+    long  rss  = 0;
+
+    if (file != NULL)
+    {
+        if (fscanf(file, "%ld %ld", &size, &rss) != 2)
+        {
+            rss = 0;
+        }
+
+        fclose(file);
+    }
+
+    return rss * sysconf(_SC_PAGESIZE);
+}
+
+static void resultInit(benchResult *aResult, const char *aTest, uint16_t aNodes, uint32_t aSize, uint32_t aCount)
+{
+    memset(aResult, 0, sizeof(*aResult));
+    aResult->mTest       = aTest;
+    aResult->mNodes      = aNodes;
+    aResult->mSize       = aSize;
+    aResult->mCount      = aCount;
+    aResult->mLatencyMin = UINT64_MAX;
+}
+
+static void resultAddLatency(benchResult *aResult, uint64_t aLatency)
+{
+    aResult->mLatencySum += aLatency;
+    aResult->mLatencyCount++;
+
+    if (aLatency < aResult->mLatencyMin)
+    {
+        aResult->mLatencyMin = aLatency;
+    }
+
+    if (aLatency > aResult->mLatencyMax)
+    {
+        aResult->mLatencyMax = aLatency;
+    }
+}
+
+static void resultPrint(const benchResult *aResult)
+{
+    double simMs   = (double)aResult->mSimTime / 1000;
+    double simKbps = (aResult->mSimTime == 0) ? 0 : (double)aResult->mBytes * 8 * 1000 / aResult->mSimTime;
+    double avgMs   = 0;
+    double minMs   = 0;
+    double maxMs   = 0;
+
+    if (aResult->mLatencyCount > 0)
+    {
+        avgMs = (double)aResult->mLatencySum / aResult->mLatencyCount / 1000;
+        minMs = (double)aResult->mLatencyMin / 1000;
+        maxMs = (double)aResult->mLatencyMax / 1000;
+    }
+
+    printf("%s,%u,%lu,%lu,%lu,%.1f,%.1f,%.3f,%.3f,%.3f,%llu\n", aResult->mTest, aResult->mNodes,
+           (unsigned long)aResult->mSize, (unsigned long)aResult->mCount, (unsigned long)aResult->mLost, simMs, simKbps,
+           avgMs, minMs, maxMs,
+           (unsigned long long)((aResult->mCount == 0) ? 0 : aResult->mWallTime / aResult->mCount));
+    fflush(stdout);
+}
+
+static bool isRouter(void *aContext)
+{
+    otDeviceRole role = otThreadGetDeviceRole((otInstance *)aContext);
+
+    return (role == OT_DEVICE_ROLE_ROUTER) || (role == OT_DEVICE_ROLE_LEADER);
+}
+
+static bool hasRoute(otInstance *aInstance, otInstance *aDestination)
+{
+    uint16_t nextHop;
+
+    otThreadGetNextHopAndPathCost(aInstance, otThreadGetRloc16(aDestination), &nextHop, NULL);
+
+    return nextHop != 0xfffe;
+}
+
+static bool hasLineRoutes(void *aContext)
+{
+    otInstance *first = sNodes[0];
+    otInstance *last  = sNodes[sNumNodes - 1];
+    bool        found = true;
+
+    OT_UNUSED_VARIABLE(aContext);
+
+    for (uint16_t i = 0; i < sNumNodes && found; i++)
+    {
+        found = (sNodes[i] == first || hasRoute(sNodes[i], first)) && (sNodes[i] == last || hasRoute(sNodes[i], last));
+    }
+
+    return found;
+}
+
+static void waitFor(otSimCondition aCondition, void *aContext, uint64_t aTimeout, const char *aWhat)
+{
+    if (!otSimRunUntil(aCondition, aContext, aTimeout))
+    {
+        benchFail(aWhat, "timed out");
+    }
+}
+
+static otInstance *addNode(int32_t aX, int32_t aY)
+{
+    otInstance *instance = otSimNodeNew();
+
+    if (instance == NULL)
+    {
+        benchFail("otSimNodeNew()", "no more nodes");
+    }
+
+    otSimNodeSetPosition(instance, aX, aY);
+    otThreadSetRouterSelectionJitter(instance, BENCH_ROUTER_JITTER);
+    sNodes[sNumNodes++] = instance;
+
+    return instance;
+}
+
+static void startNode(otInstance *aInstance)
+{
+    BENCH_CHECK(otDatasetSetActive(aInstance, &sDataset));
+    BENCH_CHECK(otIp6SetEnabled(aInstance, true));
+    BENCH_CHECK(otThreadSetEnabled(aInstance, true));
+}
+
+static void startNetwork(uint32_t aRadioRange)
+{
+    otInstance *leader;
+
+    otSimInit(BENCH_SEED);
+    otSimSetRadioRange(aRadioRange);
+    sNumNodes = 0;
+
+    leader = addNode(0, 0);
+    BENCH_CHECK(otDatasetCreateNewNetwork(leader, &sDataset));
+    startNode(leader);
+    waitFor(isRouter, leader, BENCH_ATTACH_TIMEOUT, "leader");
+}
+
+static void buildLine(uint16_t aNumNodes)
+{
+    startNetwork(BENCH_LINE_RANGE);
+
+    // One node at a time, so that each one becomes a router before the next one attaches to it.
+    for (uint16_t i = 1; i < aNumNodes; i++)
+    {
+        otInstance *node = addNode(i * BENCH_LINE_SPACING, 0);
+
+        startNode(node);
+        waitFor(isRouter, node, BENCH_ATTACH_TIMEOUT, "router");
+    }
+
+    waitFor(hasLineRoutes, NULL, BENCH_ROUTE_TIMEOUT, "routes");
+}
+
+static void sendWarmUp(otInstance *aSender, otInstance *aReceiver)
+{
+    otUdpSocket   socket;
+    otMessageInfo messageInfo;
+    otMessage    *message;
+
+    memset(&messageInfo, 0, sizeof(messageInfo));
+    messageInfo.mPeerAddr = *otThreadGetMeshLocalEid(aReceiver);
+    messageInfo.mPeerPort = BENCH_WARM_UP_PORT;
+
+    BENCH_CHECK(otUdpOpen(aSender, &socket, NULL, NULL));
+    message = otUdpNewMessage(aSender, NULL);
+
+    if (message != NULL && (otMessageAppend(message, sPayload, 1) != OT_ERROR_NONE ||
+                            otUdpSend(aSender, &socket, message, &messageInfo) != OT_ERROR_NONE))
+    {
+        otMessageFree(message);
+    }
+
+    otUdpClose(aSender, &socket);
+}
+
+static void warmUp(otInstance *aNode, otInstance *aPeer)
+{
+    // Resolves the mesh-local EIDs of both nodes, so the address queries are not part of the measurements.
+    sendWarmUp(aNode, aPeer);
+    sendWarmUp(aPeer, aNode);
+    otSimRun(BENCH_WARM_UP_TIME);
+}
+
+static void udpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    udpBench *bench  = (udpBench *)aContext;
+    uint16_t  offset = otMessageGetOffset(aMessage);
+    uint64_t  now    = otSimGetNow();
+    uint32_t  sequence;
+    uint64_t  sendTime;
+
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    otEXPECT(otMessageRead(aMessage, offset, &sequence, sizeof(sequence)) == sizeof(sequence));
+    otEXPECT(otMessageRead(aMessage, offset + sizeof(sequence), &sendTime, sizeof(sendTime)) == sizeof(sendTime));
+    otEXPECT(sequence >= bench->mLostBefore);
+
+    bench->mReceived++;
+    bench->mLastProgress = now;
+    bench->mDoneTime     = now;
+
+    resultAddLatency(bench->mResult, now - sendTime);
+    bench->mResult->mBytes += otMessageGetLength(aMessage) - offset;
+
+exit:
+    return;
+}
+
+static otError udpSend(udpBench *aBench)
+{
+    otError    error   = OT_ERROR_NO_BUFS;
+    otMessage *message = otUdpNewMessage(aBench->mSender, NULL);
+    uint64_t   now     = otSimGetNow();
+
+    otEXPECT(message != NULL);
+
+    // Sequence number and send time first, then padding up to the payload size.
+    error = otMessageAppend(message, &aBench->mSent, sizeof(aBench->mSent));
+    otEXPECT(error == OT_ERROR_NONE);
+    error = otMessageAppend(message, &now, sizeof(now));
+    otEXPECT(error == OT_ERROR_NONE);
+    error = otMessageAppend(message, sPayload, (uint16_t)(aBench->mSize - sizeof(aBench->mSent) - sizeof(now)));
+    otEXPECT(error == OT_ERROR_NONE);
+
+    error = otUdpSend(aBench->mSender, &aBench->mSenderSocket, message, &aBench->mMessageInfo);
+    otEXPECT(error == OT_ERROR_NONE);
+
+    if (aBench->mSent == aBench->mReceived + aBench->mLost)
+    {
+        aBench->mLastProgress = now;
+    }
+
+    aBench->mSent++;
+    message = NULL;
+
+exit:
+    if (message != NULL)
+    {
+        otMessageFree(message);
+    }
+
+    return error;
+}
+
+static bool udpPump(void *aContext)
+{
+    udpBench *bench    = (udpBench *)aContext;
+    uint32_t  inFlight = bench->mSent - bench->mReceived - bench->mLost;
+
+    if (inFlight > 0 && otSimGetNow() - bench->mLastProgress >= BENCH_LOSS_TIMEOUT)
+    {
+        bench->mLost += inFlight;
+        bench->mLostBefore   = bench->mSent;
+        bench->mDoneTime     = bench->mLastProgress + BENCH_LOSS_TIMEOUT;
+        bench->mLastProgress = bench->mDoneTime;
+        inFlight             = 0;
+    }
+
+    while (inFlight < bench->mWindow && bench->mSent < bench->mCount && udpSend(bench) == OT_ERROR_NONE)
+    {
+        inFlight++;
+    }
+
+    return bench->mSent == bench->mCount && inFlight == 0;
+}
+
+static void runUdp(const char *aTest, uint16_t aHops, uint16_t aSize, uint16_t aWindow, uint32_t aCount)
+{
+    udpBench    bench;
+    benchResult result;
+    otInstance *receiver;
+    otSockAddr  sockName;
+    uint64_t    startTime;
+    uint64_t    wallTime;
+
+    buildLine(aHops + 1);
+    receiver = sNodes[aHops];
+
+    memset(&bench, 0, sizeof(bench));
+    bench.mSender                = sNodes[0];
+    bench.mSize                  = aSize;
+    bench.mWindow                = aWindow;
+    bench.mCount                 = aCount;
+    bench.mResult                = &result;
+    bench.mMessageInfo.mPeerAddr = *otThreadGetMeshLocalEid(receiver);
+    bench.mMessageInfo.mPeerPort = BENCH_UDP_PORT;
+    resultInit(&result, aTest, aHops + 1, aSize, aCount);
+
+    memset(&sockName, 0, sizeof(sockName));
+    sockName.mPort = BENCH_UDP_PORT;
+    BENCH_CHECK(otUdpOpen(receiver, &bench.mReceiverSocket, udpReceive, &bench));
+    BENCH_CHECK(otUdpBind(receiver, &bench.mReceiverSocket, &sockName, OT_NETIF_THREAD));
+    BENCH_CHECK(otUdpOpen(bench.mSender, &bench.mSenderSocket, NULL, NULL));
+    BENCH_CHECK(otUdpBind(bench.mSender, &bench.mSenderSocket, &sockName, OT_NETIF_THREAD));
+
+    warmUp(bench.mSender, receiver);
+
+    startTime       = otSimGetNow();
+    bench.mDoneTime = startTime;
+    wallTime        = getWallTime();
+
+    if (!otSimRunUntil(udpPump, &bench, BENCH_RUN_TIMEOUT))
+    {
+        bench.mLost     = aCount - bench.mReceived;
+        bench.mDoneTime = otSimGetNow();
+    }
+
+    result.mWallTime = getWallTime() - wallTime;
+    result.mSimTime  = bench.mDoneTime - startTime;
+    result.mLost     = bench.mLost;
+    resultPrint(&result);
+
+    otUdpClose(bench.mSender, &bench.mSenderSocket);
+    otUdpClose(receiver, &bench.mReceiverSocket);
+    otSimDeinit();
+}
+
+static void coapHandleRequest(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    coapBench *bench    = (coapBench *)aContext;
+    otMessage *response = otCoapNewMessage(bench->mServer, NULL);
+
+    otEXPECT(response != NULL);
+
+    if (otCoapMessageInitResponse(response, aMessage, OT_COAP_TYPE_ACKNOWLEDGMENT, OT_COAP_CODE_CHANGED) !=
+            OT_ERROR_NONE ||
+        otCoapSendResponse(bench->mServer, response, aMessageInfo) != OT_ERROR_NONE)
+    {
+        otMessageFree(response);
+    }
+
+exit:
+    return;
+}
+
+static void coapHandleResponse(void                *aContext,
+                               otMessage           *aMessage,
+                               const otMessageInfo *aMessageInfo,
+                               otError              aResult)
+{
+    coapRequest *request = (coapRequest *)aContext;
+    coapBench   *bench   = request->mBench;
+    uint64_t     now     = otSimGetNow();
+
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    bench->mDone++;
+    bench->mDoneTime = now;
+
+    if (aResult == OT_ERROR_NONE)
+    {
+        resultAddLatency(bench->mResult, now - request->mSendTime);
+        bench->mResult->mBytes += bench->mSize;
+    }
+    else
+    {
+        bench->mLost++;
+    }
+}
+
+static otError coapSend(coapBench *aBench)
+{
+    otError      error   = OT_ERROR_NO_BUFS;
+    otMessage   *message = otCoapNewMessage(aBench->mClient, NULL);
+    coapRequest *request = &aBench->mRequests[aBench->mSent];
+
+    otEXPECT(message != NULL);
+
+    otCoapMessageInit(message, OT_COAP_TYPE_CONFIRMABLE, OT_COAP_CODE_POST);
+    otCoapMessageGenerateToken(message, OT_COAP_DEFAULT_TOKEN_LENGTH);
+    error = otCoapMessageAppendUriPathOptions(message, BENCH_COAP_URI);
+    otEXPECT(error == OT_ERROR_NONE);
+    error = otCoapMessageSetPayloadMarker(message);
+    otEXPECT(error == OT_ERROR_NONE);
+    error = otMessageAppend(message, sPayload, aBench->mSize);
+    otEXPECT(error == OT_ERROR_NONE);
+
+    request->mBench    = aBench;
+    request->mSendTime = otSimGetNow();
+
+    error = otCoapSendRequest(aBench->mClient, message, &aBench->mMessageInfo, coapHandleResponse, request);
+    otEXPECT(error == OT_ERROR_NONE);
+
+    aBench->mSent++;
+    message = NULL;
+
+exit:
+    if (message != NULL)
+    {
+        otMessageFree(message);
+    }
+
+    return error;
+}
+
+static bool coapPump(void *aContext)
+{
+    coapBench *bench = (coapBench *)aContext;
+
+    // One request at a time, each one waits for the response of the previous one.
+    if (bench->mSent == bench->mDone && bench->mSent < bench->mCount)
+    {
+        (void)coapSend(bench);
+    }
+
+    return bench->mDone == bench->mCount;
+}
+
+static void runCoap(uint16_t aHops, uint16_t aSize, uint32_t aCount)
+{
+    coapBench   bench;
+    benchResult result;
+    uint64_t    startTime;
+    uint64_t    wallTime;
+
+    buildLine(aHops + 1);
+
+    memset(&bench, 0, sizeof(bench));
+    bench.mClient                = sNodes[0];
+    bench.mServer                = sNodes[aHops];
+    bench.mSize                  = aSize;
+    bench.mCount                 = aCount;
+    bench.mResult                = &result;
+    bench.mRequests              = (coapRequest *)calloc(aCount, sizeof(coapRequest));
+    bench.mResource.mUriPath     = BENCH_COAP_URI;
+    bench.mResource.mHandler     = coapHandleRequest;
+    bench.mResource.mContext     = &bench;
+    bench.mMessageInfo.mPeerAddr = *otThreadGetMeshLocalEid(bench.mServer);
+    bench.mMessageInfo.mPeerPort = OT_DEFAULT_COAP_PORT;
+    resultInit(&result, "coap", aHops + 1, aSize, aCount);
+
+    if (bench.mRequests == NULL)
+    {
+        benchFail("coap", "out of memory");
+    }
+
+    BENCH_CHECK(otCoapStart(bench.mServer, OT_DEFAULT_COAP_PORT));
+    BENCH_CHECK(otCoapStart(bench.mClient, OT_DEFAULT_COAP_PORT));
+    otCoapAddResource(bench.mServer, &bench.mResource);
+
+    warmUp(bench.mClient, bench.mServer);
+
+    startTime       = otSimGetNow();
+    bench.mDoneTime = startTime;
+    wallTime        = getWallTime();
+
+    if (!otSimRunUntil(coapPump, &bench, BENCH_RUN_TIMEOUT))
+    {
+        bench.mLost     = aCount - bench.mDone + bench.mLost;
+        bench.mDoneTime = otSimGetNow();
+    }
+
+    result.mWallTime = getWallTime() - wallTime;
+    result.mSimTime  = bench.mDoneTime - startTime;
+    result.mLost     = bench.mLost;
+    resultPrint(&result);
+
+    otCoapRemoveResource(bench.mServer, &bench.mResource);
+    otSimDeinit();
+    free(bench.mRequests);
+}
+
+static void tcpFill(tcpBench *aBench)
+{
+    while (aBench->mWritten < aBench->mTotal)
+    {
+        size_t length  = aBench->mTotal - aBench->mWritten;
+        size_t written = 0;
+
+        if (length > sizeof(sPayload))
+        {
+            length = sizeof(sPayload);
+        }
+
+        if (otTcpCircularSendBufferWrite(&aBench->mClient, &aBench->mSendBuffer, sPayload, length, &written, 0) !=
+                OT_ERROR_NONE ||
+            written == 0)
+        {
+            break;
+        }
+
+        aBench->mWritten += written;
+    }
+}
+
+static void tcpHandleEstablished(otTcpEndpoint *aEndpoint)
+{
+    tcpBench *bench = (tcpBench *)otTcpEndpointGetContext(aEndpoint);
+
+    bench->mEstablishedTime = otSimGetNow();
+    tcpFill(bench);
+}
+
+static void tcpHandleForwardProgress(otTcpEndpoint *aEndpoint, size_t aInSendBuffer, size_t aBacklog)
+{
+    tcpBench *bench = (tcpBench *)otTcpEndpointGetContext(aEndpoint);
+
+    OT_UNUSED_VARIABLE(aBacklog);
+
+    otTcpCircularSendBufferHandleForwardProgress(&bench->mSendBuffer, aInSendBuffer);
+    tcpFill(bench);
+}
+
+static void tcpHandleReceiveAvailable(otTcpEndpoint *aEndpoint,
+                                      size_t         aBytesAvailable,
+                                      bool           aEndOfStream,
+                                      size_t         aBytesRemaining)
+{
+    tcpBench             *bench  = (tcpBench *)otTcpEndpointGetContext(aEndpoint);
+    const otLinkedBuffer *data   = NULL;
+    size_t                length = 0;
+
+    OT_UNUSED_VARIABLE(aBytesAvailable);
+    OT_UNUSED_VARIABLE(aEndOfStream);
+    OT_UNUSED_VARIABLE(aBytesRemaining);
+
+    otEXPECT(otTcpReceiveByReference(aEndpoint, &data) == OT_ERROR_NONE);
+
+    for (; data != NULL; data = data->mNext)
+    {
+        length += data->mLength;
+    }
+
+    otEXPECT(length > 0 && otTcpCommitReceive(aEndpoint, length, 0) == OT_ERROR_NONE);
+
+    bench->mReceived += length;
+
+    if (bench->mReceived >= bench->mTotal)
+    {
+        bench->mDoneTime = otSimGetNow();
+    }
+
+exit:
+    return;
+}
+
+static void tcpHandleDisconnected(otTcpEndpoint *aEndpoint, otTcpDisconnectedReason aReason)
+{
+    tcpBench *bench = (tcpBench *)otTcpEndpointGetContext(aEndpoint);
+
+    OT_UNUSED_VARIABLE(aReason);
+
+    bench->mDisconnected = true;
+}
+
+static otTcpIncomingConnectionAction tcpHandleAcceptReady(otTcpListener    *aListener,
+                                                          const otSockAddr *aPeer,
+                                                          otTcpEndpoint   **aAcceptInto)
+{
+    tcpBench *bench = (tcpBench *)otTcpListenerGetContext(aListener);
+
+    OT_UNUSED_VARIABLE(aPeer);
+
+    *aAcceptInto = &bench->mServer;
+
+    return OT_TCP_INCOMING_CONNECTION_ACTION_ACCEPT;
+}
+
+static void tcpHandleAcceptDone(otTcpListener *aListener, otTcpEndpoint *aEndpoint, const otSockAddr *aPeer)
+{
+    OT_UNUSED_VARIABLE(aListener);
+    OT_UNUSED_VARIABLE(aEndpoint);
+    OT_UNUSED_VARIABLE(aPeer);
+}
+
+static bool tcpIsDone(void *aContext)
+{
+    tcpBench *bench = (tcpBench *)aContext;
+
+    return bench->mReceived >= bench->mTotal || bench->mDisconnected;
+}
+
+static void runTcp(uint16_t aHops, size_t aTotal)
+{
+    static tcpBench             bench;
+    benchResult                 result;
+    otInstance                 *client;
+    otInstance                 *server;
+    otTcpEndpointInitializeArgs endpointArgs;
+    otTcpListenerInitializeArgs listenerArgs;
+    otSockAddr                  sockName;
+    uint64_t                    startTime;
+    uint64_t                    wallTime;
+
+    buildLine(aHops + 1);
+    client = sNodes[0];
+    server = sNodes[aHops];
+
+    memset(&bench, 0, sizeof(bench));
+    bench.mTotal = aTotal;
+    resultInit(&result, "tcp", aHops + 1, (uint32_t)aTotal, 1);
+
+    memset(&endpointArgs, 0, sizeof(endpointArgs));
+    endpointArgs.mContext                  = &bench;
+    endpointArgs.mEstablishedCallback      = tcpHandleEstablished;
+    endpointArgs.mForwardProgressCallback  = tcpHandleForwardProgress;
+    endpointArgs.mReceiveAvailableCallback = tcpHandleReceiveAvailable;
+    endpointArgs.mDisconnectedCallback     = tcpHandleDisconnected;
+    endpointArgs.mReceiveBuffer            = bench.mClientReceiveStorage;
+    endpointArgs.mReceiveBufferSize        = sizeof(bench.mClientReceiveStorage);
+    BENCH_CHECK(otTcpEndpointInitialize(client, &bench.mClient, &endpointArgs));
+
+    // The server only receives.
+    endpointArgs.mEstablishedCallback     = NULL;
+    endpointArgs.mForwardProgressCallback = NULL;
+    endpointArgs.mReceiveBuffer           = bench.mServerReceiveStorage;
+    BENCH_CHECK(otTcpEndpointInitialize(server, &bench.mServer, &endpointArgs));
+    otTcpCircularSendBufferInitialize(&bench.mSendBuffer, bench.mSendStorage, sizeof(bench.mSendStorage));
+
+    memset(&listenerArgs, 0, sizeof(listenerArgs));
+    listenerArgs.mContext             = &bench;
+    listenerArgs.mAcceptReadyCallback = tcpHandleAcceptReady;
+    listenerArgs.mAcceptDoneCallback  = tcpHandleAcceptDone;
+    BENCH_CHECK(otTcpListenerInitialize(server, &bench.mListener, &listenerArgs));
+
+    memset(&sockName, 0, sizeof(sockName));
+    sockName.mPort = BENCH_TCP_PORT;
+    BENCH_CHECK(otTcpListen(&bench.mListener, &sockName));
+
+    warmUp(client, server);
+
+    sockName.mAddress = *otThreadGetMeshLocalEid(server);
+    startTime         = otSimGetNow();
+    wallTime          = getWallTime();
+    BENCH_CHECK(otTcpConnect(&bench.mClient, &sockName, OT_TCP_CONNECT_NO_FAST_OPEN));
+
+    if (!otSimRunUntil(tcpIsDone, &bench, BENCH_RUN_TIMEOUT) || bench.mReceived < bench.mTotal)
+    {
+        result.mLost = 1;
+    }
+    else
+    {
+        // The connection setup time, the only latency of a single transfer.
+        resultAddLatency(&result, bench.mEstablishedTime - startTime);
+    }
+
+    result.mWallTime = getWallTime() - wallTime;
+    result.mSimTime  = ((result.mLost == 0) ? bench.mDoneTime : otSimGetNow()) - startTime;
+    result.mBytes    = bench.mReceived;
+    resultPrint(&result);
+
+    otTcpCircularSendBufferForceDiscardAll(&bench.mSendBuffer);
+    (void)otTcpEndpointDeinitialize(&bench.mClient);
+    (void)otTcpEndpointDeinitialize(&bench.mServer);
+    (void)otTcpListenerDeinitialize(&bench.mListener);
+    (void)otTcpCircularSendBufferDeinitialize(&bench.mSendBuffer);
+    otSimDeinit();
+}
+
+static bool attachIsDone(void *aContext)
+{
+    attachBench *bench = (attachBench *)aContext;
+
+    for (uint16_t i = 1; i < sNumNodes; i++)
+    {
+        if (bench->mAttachTime[i] == 0 && otThreadGetDeviceRole(sNodes[i]) >= OT_DEVICE_ROLE_CHILD)
+        {
+            bench->mAttachTime[i] = otSimGetNow();
+            bench->mNumAttached++;
+        }
+    }
+
+    return bench->mNumAttached == sNumNodes - 1;
+}
+
+static void runAttach(uint16_t aNumNodes)
+{
+    attachBench  bench;
+    benchResult  result;
+    benchMemory *memory = &sMemory[sNumMemory++];
+    otBufferInfo bufferInfo;
+    uint64_t     startTime;
+    uint64_t     wallTime;
+    long         rss;
+
+    memset(&bench, 0, sizeof(bench));
+    resultInit(&result, "attach", aNumNodes, 0, aNumNodes - 1);
+
+    startNetwork(BENCH_GRID_RANGE);
+
+    // Measured once the leader runs, so that the memory used once by the process is not counted for the nodes.
+    rss = getRss();
+
+    // The other nodes all start together, and attach to the leader and to each other.
+    for (uint16_t i = 1; i < aNumNodes; i++)
+    {
+        addNode((i % BENCH_GRID_WIDTH) * BENCH_GRID_SPACING, (i / BENCH_GRID_WIDTH) * BENCH_GRID_SPACING);
+    }
+
+    for (uint16_t i = 1; i < aNumNodes; i++)
+    {
+        startNode(sNodes[i]);
+    }
+
+    startTime = otSimGetNow();
+    wallTime  = getWallTime();
+
+    (void)otSimRunUntil(attachIsDone, &bench, BENCH_ATTACH_TIMEOUT);
+
+    result.mWallTime = getWallTime() - wallTime;
+    result.mLost     = aNumNodes - 1 - bench.mNumAttached;
+
+    for (uint16_t i = 1; i < aNumNodes; i++)
+    {
+        if (bench.mAttachTime[i] != 0)
+        {
+            resultAddLatency(&result, bench.mAttachTime[i] - startTime);
+        }
+    }
+
+    result.mSimTime = (result.mLost == 0) ? result.mLatencyMax : otSimGetNow() - startTime;
+    resultPrint(&result);
+
+    memset(memory, 0, sizeof(*memory));
+    memory->mNodes      = aNumNodes;
+    memory->mNodeSize   = otSimGetNodeSize();
+    memory->mRssPerNode = (getRss() - rss) / (aNumNodes - 1);
+    (void)otInstanceInit(NULL, &memory->mInstanceSize);
+
+    for (uint16_t i = 0; i < aNumNodes; i++)
+    {
+        otMessageGetBufferInfo(sNodes[i], &bufferInfo);
+        memory->mTotalBuffers = bufferInfo.mTotalBuffers;
+
+        if (bufferInfo.mMaxUsedBuffers > memory->mMaxUsedBuffers)
+        {
+            memory->mMaxUsedBuffers = bufferInfo.mMaxUsedBuffers;
+        }
+    }
+
+    otSimDeinit();
+}
+
+static bool isSelected(const char *aFilter, const char *aTest)
+{
+    return aFilter == NULL || strncmp(aTest, aFilter, strlen(aFilter)) == 0;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *filter = (argc > 1) ? argv[1] : NULL;
+
+    // Every node gets its own mapping, which is unmapped when the node is deleted, so that the resident memory
+    // measured around a test only counts the nodes of the test.
+    mallopt(M_MMAP_THRESHOLD, 64 * 1024);
+
+    for (size_t i = 0; i < sizeof(sPayload); i++)
+    {
+        sPayload[i] = (uint8_t)i;
+    }
+
+    printf("test,nodes,size,count,lost,sim_ms,sim_kbps,avg_ms,min_ms,max_ms,wall_ns_per_op\n");
+
+    if (isSelected(filter, "udp_w1"))
+    {
+        runUdp("udp_w1", 1, 64, 1, 200);
+        runUdp("udp_w1", 1, 512, 1, 200);
+        runUdp("udp_w1", 1, 1024, 1, 200);
+        runUdp("udp_w1", 3, 64, 1, 200);
+        runUdp("udp_w1", 3, 1024, 1, 200);
+    }
+
+    if (isSelected(filter, "udp_w8"))
+    {
+        runUdp("udp_w8", 1, 64, 8, 200);
+        runUdp("udp_w8", 1, 1024, 8, 200);
+        runUdp("udp_w8", 3, 1024, 8, 200);
+    }
+
+    if (isSelected(filter, "coap"))
+    {
+        runCoap(1, 64, 200);
+        runCoap(1, 512, 200);
+        runCoap(3, 64, 200);
+    }
+
+    if (isSelected(filter, "tcp"))
+    {
+        runTcp(1, 64 * 1024);
+        runTcp(3, 64 * 1024);
+    }
+
+    if (isSelected(filter, "attach"))
+    {
+        runAttach(8);
+        runAttach(32);
+    }
+
+    if (sNumMemory > 0)
+    {
+        printf("\nmemory,nodes,instance_bytes,node_bytes,rss_bytes_per_node,buffers_total,buffers_max_used\n");
+
+        for (uint16_t i = 0; i < sNumMemory; i++)
+        {
+            printf("memory,%u,%lu,%lu,%ld,%u,%u\n", sMemory[i].mNodes, (unsigned long)sMemory[i].mInstanceSize,
+                   (unsigned long)sMemory[i].mNodeSize, sMemory[i].mRssPerNode, sMemory[i].mTotalBuffers,
+                   sMemory[i].mMaxUsedBuffers);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,70 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file implements the millisecond alarm of the simulation platform on the simulated time.
+ *
+ */
+
+#include "platform-simulation.h"
+
+#include <openthread/platform/alarm-milli.h>
+
+#define US_PER_MS 1000
+
+uint64_t platformAlarmGetNextEventTime(const simNode *aNode)
+{
+    return aNode->mAlarmArmed ? aNode->mAlarmFireTime : UINT64_MAX;
+}
+
+void platformAlarmProcess(simNode *aNode)
+{
+    if (aNode->mAlarmArmed && aNode->mAlarmFireTime <= gSimNow)
+    {
+        aNode->mAlarmArmed = false;
+        otPlatAlarmMilliFired(simNodeGetInstance(aNode));
+    }
+}
+
+void otPlatAlarmMilliStartAt(otInstance *aInstance, uint32_t aT0, uint32_t aDt)
+{
+    simNode *node = simNodeFromInstance(aInstance);
+    uint64_t now  = gSimNow / US_PER_MS;
+
+    // The 32-bit time of the core wraps, the distance to the fire time does not.
+    int32_t delay = (int32_t)(aT0 + aDt - (uint32_t)now);
+
+    node->mAlarmArmed    = true;
+    node->mAlarmFireTime = (delay > 0) ? (now + (uint64_t)delay) * US_PER_MS : gSimNow;
+}
+
+void otPlatAlarmMilliStop(otInstance *aInstance) { simNodeFromInstance(aInstance)->mAlarmArmed = false; }
+
+uint32_t otPlatAlarmMilliGetNow(void) { return (uint32_t)(gSimNow / US_PER_MS); }
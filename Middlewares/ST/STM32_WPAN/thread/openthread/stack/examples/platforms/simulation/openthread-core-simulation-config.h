@@ -0,0 +1,149 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the platform-specific configuration for the simulation platform.
+ *
+ */
+
+#ifndef OPENTHREAD_CORE_SIMULATION_CONFIG_H_
+#define OPENTHREAD_CORE_SIMULATION_CONFIG_H_
+
+/**
+ * @def OPENTHREAD_CONFIG_PLATFORM_INFO
+ *
+ * The platform-specific string to insert into the OpenThread version string.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_PLATFORM_INFO
+#define OPENTHREAD_CONFIG_PLATFORM_INFO "SIMULATION"
+#endif
+
+/**
+ * @def PACKAGE_NAME
+ *
+ * The package name inserted into the OpenThread version string. The STM32WB project configurations define it too.
+ *
+ */
+#ifndef PACKAGE_NAME
+#define PACKAGE_NAME "OT"
+#endif
+
+/**
+ * @def PACKAGE_VERSION
+ *
+ * The package version inserted into the OpenThread version string.
+ *
+ */
+#ifndef PACKAGE_VERSION
+#define PACKAGE_VERSION "simulation"
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MULTIPLE_INSTANCE_ENABLE
+ *
+ * The simulation runs every node as a separate OpenThread instance in the same process.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MULTIPLE_INSTANCE_ENABLE
+#define OPENTHREAD_CONFIG_MULTIPLE_INSTANCE_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE
+ *
+ * The simulated radio does CSMA-CA and ACK timeouts itself, so the core only needs the millisecond alarm.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE
+#define OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_LOG_OUTPUT
+ *
+ * Logs go to `otPlatLog()` of the simulation platform, which prints them on stderr.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_LOG_OUTPUT
+#define OPENTHREAD_CONFIG_LOG_OUTPUT OPENTHREAD_CONFIG_LOG_OUTPUT_PLATFORM_DEFINED
+#endif
+
+/**
+ * @def OPENTHREAD_SIMULATION_MAX_NODES
+ *
+ * The maximum number of nodes in the simulation.
+ *
+ */
+#ifndef OPENTHREAD_SIMULATION_MAX_NODES
+#define OPENTHREAD_SIMULATION_MAX_NODES 256
+#endif
+
+/**
+ * @def OPENTHREAD_SIMULATION_SETTINGS_SIZE
+ *
+ * The size in bytes of the settings storage of each node.
+ *
+ */
+#ifndef OPENTHREAD_SIMULATION_SETTINGS_SIZE
+#define OPENTHREAD_SIMULATION_SETTINGS_SIZE 1024
+#endif
+
+/**
+ * @def OPENTHREAD_SIMULATION_SRC_MATCH_SIZE
+ *
+ * The number of short and of extended addresses in the source match table of each node.
+ *
+ */
+#ifndef OPENTHREAD_SIMULATION_SRC_MATCH_SIZE
+#define OPENTHREAD_SIMULATION_SRC_MATCH_SIZE OPENTHREAD_CONFIG_MLE_MAX_CHILDREN
+#endif
+
+/**
+ * @def OPENTHREAD_SIMULATION_RADIO_RSSI
+ *
+ * The RSSI in dBm of every frame received over the virtual 802.15.4 medium.
+ *
+ */
+#ifndef OPENTHREAD_SIMULATION_RADIO_RSSI
+#define OPENTHREAD_SIMULATION_RADIO_RSSI -50
+#endif
+
+/**
+ * @def OPENTHREAD_SIMULATION_DEFAULT_RADIO_RANGE
+ *
+ * The default radio range, in the unit of the node positions. Nodes hear each other when they are at most this far
+ * apart.
+ *
+ */
+#ifndef OPENTHREAD_SIMULATION_DEFAULT_RADIO_RANGE
+#define OPENTHREAD_SIMULATION_DEFAULT_RADIO_RANGE 100
+#endif
+
+#endif // OPENTHREAD_CORE_SIMULATION_CONFIG_H_
@@ -0,0 +1,280 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the declarations shared by the modules of the simulation platform.
+ *
+ */
+
+#ifndef PLATFORM_SIMULATION_H_
+#define PLATFORM_SIMULATION_H_
+
+#include <openthread-core-config.h>
+#include <openthread/config.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <openthread/instance.h>
+#include <openthread/platform/radio.h>
+
+#include "simulation.h"
+
+/**
+ * The transmit phases of a simulated radio.
+ *
+ */
+typedef enum
+{
+    SIM_TX_IDLE,       ///< No transmission.
+    SIM_TX_BACKOFF,    ///< Waiting for the end of a CSMA-CA backoff period and CCA.
+    SIM_TX_TURNAROUND, ///< Switching from receive to transmit.
+    SIM_TX_ON_AIR,     ///< The frame is on the air.
+    SIM_TX_DONE,       ///< Waiting for the ACK, or its timeout, to report the transmission done.
+} simTxPhase;
+
+/**
+ * Represents the state of a simulated radio.
+ *
+ */
+typedef struct simRadio
+{
+    otRadioState   mState;
+    uint8_t        mChannel;
+    bool           mPromiscuous;
+    otPanId        mPanId;
+    otShortAddress mShortAddress;
+    otExtAddress   mExtAddress; // In over-the-air (reversed) byte order, as in frames.
+
+    bool           mSrcMatchEnabled;
+    uint8_t        mSrcMatchShortCount;
+    uint8_t        mSrcMatchExtCount;
+    otShortAddress mSrcMatchShort[OPENTHREAD_SIMULATION_SRC_MATCH_SIZE];
+    otExtAddress   mSrcMatchExt[OPENTHREAD_SIMULATION_SRC_MATCH_SIZE];
+
+    otRadioFrame mTxFrame;
+    otRadioFrame mRxFrame;
+    otRadioFrame mAckFrame;
+    uint8_t      mTxPsdu[OT_RADIO_FRAME_MAX_SIZE];
+    uint8_t      mRxPsdu[OT_RADIO_FRAME_MAX_SIZE];
+    uint8_t      mAckPsdu[OT_RADIO_FRAME_MAX_SIZE];
+
+    simTxPhase mTxPhase;
+    uint64_t   mTxEventTime;  // Time of the end of the current phase.
+    uint64_t   mTxStartTime;  // Time the frame went on the air.
+    uint8_t    mCsmaBackoffs; // Number of CSMA-CA backoffs done.
+    uint8_t    mBackoffExponent;
+    otError    mTxError; // Result reported at the end of the `SIM_TX_DONE` phase.
+    bool       mTxAcked; // Whether `mAckFrame` holds the ACK reported at the end of `SIM_TX_DONE`.
+
+    uint64_t mEnergyEndTime;  // Time the last frame heard by this radio ends.
+    uint64_t mCorruptEndTime; // Frames on the air at this radio before this time collided.
+} simRadio;
+
+/**
+ * Represents a simulated node.
+ *
+ */
+typedef struct simNode
+{
+    uint16_t        mId;
+    int32_t         mX;
+    int32_t         mY;
+    struct simNode *mNextPending; // Next node in the list of nodes with pending tasklets.
+    bool            mTaskletsPending;
+    bool            mResetPending;
+
+    bool     mAlarmArmed;
+    uint64_t mAlarmFireTime;
+
+    simRadio mRadio;
+
+    uint16_t mSettingsLength;
+    uint8_t  mSettings[OPENTHREAD_SIMULATION_SETTINGS_SIZE];
+
+    uint64_t mInstance[]; // Storage of the OpenThread instance of the node, MUST be the last member.
+} simNode;
+
+/**
+ * The simulated time in microseconds.
+ *
+ */
+extern uint64_t gSimNow;
+
+/**
+ * The counters of the virtual 802.15.4 medium.
+ *
+ */
+extern otSimRadioStats gSimRadioStats;
+
+/**
+ * Gets the node which owns an OpenThread instance.
+ *
+ * @param[in]  aInstance  The OpenThread instance.
+ *
+ * @returns The node.
+ *
+ */
+static inline simNode *simNodeFromInstance(otInstance *aInstance)
+{
+    return (simNode *)((uint8_t *)aInstance - offsetof(simNode, mInstance));
+}
+
+/**
+ * Gets the OpenThread instance of a node.
+ *
+ * @param[in]  aNode  The node.
+ *
+ * @returns The OpenThread instance.
+ *
+ */
+static inline otInstance *simNodeGetInstance(simNode *aNode) { return (otInstance *)aNode->mInstance; }
+
+/**
+ * Gets the first node.
+ *
+ * Together with `simNodeGetNext()`, iterates over the nodes in the order of their IDs.
+ *
+ * @returns The first node, or NULL if there is none.
+ *
+ */
+simNode *simNodeGetFirst(void);
+
+/**
+ * Gets the node following a given one.
+ *
+ * @param[in]  aNode  The node.
+ *
+ * @returns The next node, or NULL if @p aNode is the last one.
+ *
+ */
+simNode *simNodeGetNext(const simNode *aNode);
+
+/**
+ * Indicates whether two nodes hear each other.
+ *
+ * @param[in]  aNode   A node.
+ * @param[in]  aOther  Another node.
+ *
+ * @retval TRUE   The nodes are in radio range.
+ * @retval FALSE  The nodes are out of radio range.
+ *
+ */
+bool simNodesInRange(const simNode *aNode, const simNode *aOther);
+
+/**
+ * Finalizes and destroys the OpenThread instance of a node, as a single instance build does.
+ *
+ * With multiple instances, `otInstanceFinalize()` leaves the destruction to the owner of the instance buffer. The
+ * destruction releases what the instance holds outside of it, e.g. the random number generators shared by all the
+ * instances, so that they are seeded again when the next instance is initialized.
+ *
+ * @param[in]  aInstance  The OpenThread instance.
+ *
+ */
+void platformInstanceFinalize(otInstance *aInstance);
+
+/**
+ * Initializes the random number generator of the simulation.
+ *
+ * @param[in]  aSeed  The seed.
+ *
+ */
+void platformRandomInit(uint32_t aSeed);
+
+/**
+ * Gets a random number from the random number generator of the simulation.
+ *
+ * @returns A random number.
+ *
+ */
+uint32_t platformRandomGet(void);
+
+/**
+ * Gets the time of the next alarm event of a node.
+ *
+ * @param[in]  aNode  The node.
+ *
+ * @returns The time of the next alarm event, or UINT64_MAX if there is none.
+ *
+ */
+uint64_t platformAlarmGetNextEventTime(const simNode *aNode);
+
+/**
+ * Processes the alarm event of a node, if it is due.
+ *
+ * @param[in]  aNode  The node.
+ *
+ */
+void platformAlarmProcess(simNode *aNode);
+
+/**
+ * Initializes the radio of a node.
+ *
+ * @param[in]  aNode  The node.
+ *
+ */
+void platformRadioInit(simNode *aNode);
+
+/**
+ * Gets the time of the next radio event of a node.
+ *
+ * @param[in]  aNode  The node.
+ *
+ * @returns The time of the next radio event, or UINT64_MAX if there is none.
+ *
+ */
+uint64_t platformRadioGetNextEventTime(const simNode *aNode);
+
+/**
+ * Processes the radio event of a node, if it is due.
+ *
+ * @param[in]  aNode  The node.
+ *
+ */
+void platformRadioProcess(simNode *aNode);
+
+/**
+ * Initializes the settings of a node as empty.
+ *
+ * @param[in]  aNode  The node.
+ *
+ */
+void platformSettingsInit(simNode *aNode);
+
+/**
+ * Processes the UART: reports the end of the pending send and reads the available input.
+ *
+ * @param[in]  aTimeout  The maximum time to wait for input, in microseconds.
+ *
+ */
+void platformUartProcess(uint64_t aTimeout);
+
+#endif // PLATFORM_SIMULATION_H_
@@ -0,0 +1,617 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file implements the radio of the simulation platform over a virtual IEEE 802.15.4 medium.
+ *
+ * A frame is heard by the nodes in radio range tuned to its channel, during its air time at 250 kbit/s. A node
+ * receives the frame if it listens until the end of it and no other frame overlapped it at this node. The radio does
+ * the address filtering, the ACKs (with the frame pending bit from the source match table), the CSMA-CA and the ACK
+ * timeout. The core does the retransmissions and the security.
+ *
+ */
+
+#include "platform-simulation.h"
+
+#include <string.h>
+
+#include <openthread/platform/radio.h>
+
+#include "utils/code_utils.h"
+#include "utils/mac_frame.h"
+
+enum
+{
+    SIM_BYTE_TIME_US       = 32,  // At 250 kbit/s.
+    SIM_SHR_PHR_SIZE       = 6,   // Preamble, SFD and PHY header.
+    SIM_TURNAROUND_TIME_US = 192, // aTurnaroundTime, 12 symbols.
+    SIM_UNIT_BACKOFF_US    = 320, // aUnitBackoffPeriod, 20 symbols.
+    SIM_CCA_TIME_US        = 128, // 8 symbols.
+    SIM_ACK_WAIT_US        = 864, // macAckWaitDuration, 54 symbols.
+    SIM_MIN_BE             = 3,
+    SIM_MAX_BE             = 5,
+    SIM_NOISE_FLOOR        = -100,
+    SIM_LQI                = 255,
+};
+
+static uint64_t getAirTime(const otRadioFrame *aFrame)
+{
+    return (uint64_t)(SIM_SHR_PHR_SIZE + aFrame->mLength) * SIM_BYTE_TIME_US;
+}
+
+static bool isListening(const simRadio *aRadio)
+{
+    // Like most radios, it also receives during the CSMA-CA backoff periods.
+    return aRadio->mState == OT_RADIO_STATE_RECEIVE ||
+           (aRadio->mState == OT_RADIO_STATE_TRANSMIT && aRadio->mTxPhase == SIM_TX_BACKOFF);
+}
+
+static void addEnergy(simRadio *aRadio, uint64_t aStartTime, uint64_t aEndTime)
+{
+    if (aRadio->mEnergyEndTime > aStartTime)
+    {
+        // Overlapping frames collide: none of the frames on the air until the last one ends can be received.
+        uint64_t endTime = (aRadio->mEnergyEndTime > aEndTime) ? aRadio->mEnergyEndTime : aEndTime;
+
+        if (endTime > aRadio->mCorruptEndTime)
+        {
+            aRadio->mCorruptEndTime = endTime;
+        }
+    }
+
+    if (aEndTime > aRadio->mEnergyEndTime)
+    {
+        aRadio->mEnergyEndTime = aEndTime;
+    }
+}
+
+static bool findSrcMatchShort(const simRadio *aRadio, otShortAddress aShortAddress)
+{
+    bool found = false;
+
+    for (uint8_t i = 0; i < aRadio->mSrcMatchShortCount && !found; i++)
+    {
+        found = (aRadio->mSrcMatchShort[i] == aShortAddress);
+    }
+
+    return found;
+}
+
+static bool findSrcMatchExt(const simRadio *aRadio, const otExtAddress *aExtAddress)
+{
+    bool found = false;
+
+    for (uint8_t i = 0; i < aRadio->mSrcMatchExtCount && !found; i++)
+    {
+        found = (memcmp(&aRadio->mSrcMatchExt[i], aExtAddress, sizeof(otExtAddress)) == 0);
+    }
+
+    return found;
+}
+
+static void reverseExtAddress(otExtAddress *aOutput, const otExtAddress *aInput)
+{
+    for (uint8_t i = 0; i < sizeof(otExtAddress); i++)
+    {
+        aOutput->m8[i] = aInput->m8[sizeof(otExtAddress) - 1 - i];
+    }
+}
+
+static bool hasFramePending(const simRadio *aRadio, const otRadioFrame *aFrame)
+{
+    bool         pending = false;
+    otMacAddress srcAddress;
+
+    // The frame pending bit is only meaningful in the ACK of a data request, or in an Enh-ACK.
+    otEXPECT(otMacFrameIsVersion2015(aFrame) || otMacFrameIsDataRequest(aFrame));
+
+    pending = !aRadio->mSrcMatchEnabled;
+    otEXPECT(!pending);
+
+    otEXPECT(otMacFrameGetSrcAddr(aFrame, &srcAddress) == OT_ERROR_NONE);
+
+    if (srcAddress.mType == OT_MAC_ADDRESS_TYPE_SHORT)
+    {
+        pending = findSrcMatchShort(aRadio, srcAddress.mAddress.mShortAddress);
+    }
+    else if (srcAddress.mType == OT_MAC_ADDRESS_TYPE_EXTENDED)
+    {
+        pending = findSrcMatchExt(aRadio, &srcAddress.mAddress.mExtAddress);
+    }
+
+exit:
+    return pending;
+}
+
+static void generateAck(const simRadio *aReceiver, otRadioFrame *aFrame, otRadioFrame *aAckFrame)
+{
+    bool framePending = hasFramePending(aReceiver, aFrame);
+
+#if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
+    if (otMacFrameIsVersion2015(aFrame))
+    {
+        if (otMacFrameGenerateEnhAck(aFrame, framePending, NULL, 0, aAckFrame) != OT_ERROR_NONE)
+        {
+            otMacFrameGenerateImmAck(aFrame, framePending, aAckFrame);
+        }
+    }
+    else
+#endif
+    {
+        otMacFrameGenerateImmAck(aFrame, framePending, aAckFrame);
+    }
+
+    aFrame->mInfo.mRxInfo.mAckedWithFramePending = framePending;
+}
+
+static void startBackoff(simNode *aNode)
+{
+    simRadio *radio   = &aNode->mRadio;
+    uint32_t  periods = platformRandomGet() % (1U << radio->mBackoffExponent);
+
+    radio->mTxPhase     = SIM_TX_BACKOFF;
+    radio->mTxEventTime = gSimNow + (uint64_t)periods * SIM_UNIT_BACKOFF_US + SIM_CCA_TIME_US;
+}
+
+static void startOnAir(simNode *aNode)
+{
+    simRadio *radio   = &aNode->mRadio;
+    uint64_t  airTime = getAirTime(&radio->mTxFrame);
+
+    radio->mTxPhase     = SIM_TX_ON_AIR;
+    radio->mTxStartTime = gSimNow;
+    radio->mTxEventTime = gSimNow + airTime;
+
+    gSimRadioStats.mTxFrames++;
+    gSimRadioStats.mAirTime += airTime;
+
+    for (simNode *node = simNodeGetFirst(); node != NULL; node = simNodeGetNext(node))
+    {
+        if (node == aNode)
+        {
+            // Half-duplex: nothing is received while transmitting.
+            addEnergy(radio, gSimNow, radio->mTxEventTime);
+
+            if (radio->mCorruptEndTime < radio->mTxEventTime)
+            {
+                radio->mCorruptEndTime = radio->mTxEventTime;
+            }
+        }
+        else if (node->mRadio.mChannel == radio->mTxFrame.mChannel && simNodesInRange(aNode, node))
+        {
+            addEnergy(&node->mRadio, gSimNow, radio->mTxEventTime);
+        }
+    }
+
+    otPlatRadioTxStarted(simNodeGetInstance(aNode), &radio->mTxFrame);
+}
+
+static void endOnAir(simNode *aNode)
+{
+    simRadio     *radio        = &aNode->mRadio;
+    otRadioFrame *frame        = &radio->mTxFrame;
+    bool          ackRequested = otMacFrameIsAckRequested(frame);
+
+    radio->mTxAcked = false;
+
+    for (simNode *node = simNodeGetFirst(); node != NULL; node = simNodeGetNext(node))
+    {
+        simRadio     *receiver = &node->mRadio;
+        otRadioFrame *rxFrame;
+        bool          addressMatch;
+
+        if (node == aNode || receiver->mChannel != frame->mChannel || !isListening(receiver) ||
+            !simNodesInRange(aNode, node))
+        {
+            continue;
+        }
+
+        if (receiver->mCorruptEndTime > radio->mTxStartTime)
+        {
+            gSimRadioStats.mCollisions++;
+            continue;
+        }
+
+        addressMatch = otMacFrameDoesAddrMatch(frame, receiver->mPanId, receiver->mShortAddress,
+                                               &receiver->mExtAddress);
+
+        if (!addressMatch && !receiver->mPromiscuous)
+        {
+            continue;
+        }
+
+        rxFrame = &receiver->mRxFrame;
+
+        memcpy(rxFrame->mPsdu, frame->mPsdu, frame->mLength);
+        rxFrame->mLength                              = frame->mLength;
+        rxFrame->mChannel                             = frame->mChannel;
+        rxFrame->mInfo.mRxInfo.mTimestamp             = radio->mTxStartTime + SIM_SHR_PHR_SIZE * SIM_BYTE_TIME_US;
+        rxFrame->mInfo.mRxInfo.mRssi                  = OPENTHREAD_SIMULATION_RADIO_RSSI;
+        rxFrame->mInfo.mRxInfo.mLqi                   = SIM_LQI;
+        rxFrame->mInfo.mRxInfo.mAckedWithFramePending = false;
+        rxFrame->mInfo.mRxInfo.mAckedWithSecEnhAck    = false;
+
+        if (ackRequested && addressMatch && !radio->mTxAcked)
+        {
+            generateAck(receiver, rxFrame, &radio->mAckFrame);
+            radio->mTxAcked = true;
+        }
+
+        gSimRadioStats.mRxFrames++;
+        otPlatRadioReceiveDone(simNodeGetInstance(node), rxFrame, OT_ERROR_NONE);
+    }
+
+    radio->mTxPhase = SIM_TX_DONE;
+    radio->mTxError = OT_ERROR_NONE;
+
+    if (!ackRequested)
+    {
+        radio->mTxEventTime = gSimNow;
+    }
+    else if (radio->mTxAcked)
+    {
+        radio->mTxEventTime = gSimNow + SIM_TURNAROUND_TIME_US + getAirTime(&radio->mAckFrame);
+        gSimRadioStats.mAcks++;
+    }
+    else
+    {
+        radio->mTxEventTime = gSimNow + SIM_ACK_WAIT_US;
+        radio->mTxError     = OT_ERROR_NO_ACK;
+        gSimRadioStats.mNoAcks++;
+    }
+}
+
+static void finishTransmit(simNode *aNode, otError aError)
+{
+    simRadio     *radio    = &aNode->mRadio;
+    otRadioFrame *ackFrame = NULL;
+
+    radio->mTxPhase = SIM_TX_IDLE;
+    radio->mState   = OT_RADIO_STATE_RECEIVE;
+
+    if (aError == OT_ERROR_NONE && radio->mTxAcked)
+    {
+        ackFrame                           = &radio->mAckFrame;
+        ackFrame->mChannel                 = radio->mTxFrame.mChannel;
+        ackFrame->mInfo.mRxInfo.mTimestamp = gSimNow;
+        ackFrame->mInfo.mRxInfo.mRssi      = OPENTHREAD_SIMULATION_RADIO_RSSI;
+        ackFrame->mInfo.mRxInfo.mLqi       = SIM_LQI;
+    }
+
+    otPlatRadioTxDone(simNodeGetInstance(aNode), &radio->mTxFrame, ackFrame, aError);
+}
+
+void platformRadioInit(simNode *aNode)
+{
+    simRadio *radio = &aNode->mRadio;
+
+    memset(radio, 0, sizeof(*radio));
+
+    radio->mState          = OT_RADIO_STATE_DISABLED;
+    radio->mChannel        = OT_RADIO_2P4GHZ_OQPSK_CHANNEL_MIN;
+    radio->mPanId          = 0xffff;
+    radio->mShortAddress   = 0xfffe;
+    radio->mTxFrame.mPsdu  = radio->mTxPsdu;
+    radio->mRxFrame.mPsdu  = radio->mRxPsdu;
+    radio->mAckFrame.mPsdu = radio->mAckPsdu;
+}
+
+uint64_t platformRadioGetNextEventTime(const simNode *aNode)
+{
+    return (aNode->mRadio.mTxPhase != SIM_TX_IDLE) ? aNode->mRadio.mTxEventTime : UINT64_MAX;
+}
+
+void platformRadioProcess(simNode *aNode)
+{
+    simRadio *radio = &aNode->mRadio;
+
+    otEXPECT(radio->mTxPhase != SIM_TX_IDLE && radio->mTxEventTime <= gSimNow);
+
+    switch (radio->mTxPhase)
+    {
+    case SIM_TX_BACKOFF:
+        if (radio->mEnergyEndTime <= gSimNow)
+        {
+            radio->mTxPhase     = SIM_TX_TURNAROUND;
+            radio->mTxEventTime = gSimNow + SIM_TURNAROUND_TIME_US;
+        }
+        else if (radio->mCsmaBackoffs++ < radio->mTxFrame.mInfo.mTxInfo.mMaxCsmaBackoffs)
+        {
+            if (radio->mBackoffExponent < SIM_MAX_BE)
+            {
+                radio->mBackoffExponent++;
+            }
+
+            startBackoff(aNode);
+        }
+        else
+        {
+            gSimRadioStats.mCcaFailures++;
+            finishTransmit(aNode, OT_ERROR_CHANNEL_ACCESS_FAILURE);
+        }
+        break;
+
+    case SIM_TX_TURNAROUND:
+        startOnAir(aNode);
+        break;
+
+    case SIM_TX_ON_AIR:
+        endOnAir(aNode);
+        break;
+
+    case SIM_TX_DONE:
+        finishTransmit(aNode, radio->mTxError);
+        break;
+
+    case SIM_TX_IDLE:
+        break;
+    }
+
+exit:
+    return;
+}
+
+otRadioCaps otPlatRadioGetCaps(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return OT_RADIO_CAPS_ACK_TIMEOUT | OT_RADIO_CAPS_CSMA_BACKOFF;
+}
+
+int8_t otPlatRadioGetReceiveSensitivity(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return SIM_NOISE_FLOOR;
+}
+
+void otPlatRadioGetIeeeEui64(otInstance *aInstance, uint8_t *aIeeeEui64)
+{
+    uint16_t id = simNodeFromInstance(aInstance)->mId;
+
+    aIeeeEui64[0] = 0x18;
+    aIeeeEui64[1] = 0xb4;
+    aIeeeEui64[2] = 0x30;
+    aIeeeEui64[3] = 0x00;
+    aIeeeEui64[4] = 0x00;
+    aIeeeEui64[5] = 0x00;
+    aIeeeEui64[6] = (uint8_t)(id >> 8);
+    aIeeeEui64[7] = (uint8_t)id;
+}
+
+void otPlatRadioSetPanId(otInstance *aInstance, otPanId aPanId)
+{
+    simNodeFromInstance(aInstance)->mRadio.mPanId = aPanId;
+}
+
+void otPlatRadioSetExtendedAddress(otInstance *aInstance, const otExtAddress *aExtAddress)
+{
+    reverseExtAddress(&simNodeFromInstance(aInstance)->mRadio.mExtAddress, aExtAddress);
+}
+
+void otPlatRadioSetShortAddress(otInstance *aInstance, otShortAddress aShortAddress)
+{
+    simNodeFromInstance(aInstance)->mRadio.mShortAddress = aShortAddress;
+}
+
+bool otPlatRadioGetPromiscuous(otInstance *aInstance) { return simNodeFromInstance(aInstance)->mRadio.mPromiscuous; }
+
+void otPlatRadioSetPromiscuous(otInstance *aInstance, bool aEnable)
+{
+    simNodeFromInstance(aInstance)->mRadio.mPromiscuous = aEnable;
+}
+
+otRadioState otPlatRadioGetState(otInstance *aInstance) { return simNodeFromInstance(aInstance)->mRadio.mState; }
+
+bool otPlatRadioIsEnabled(otInstance *aInstance)
+{
+    return simNodeFromInstance(aInstance)->mRadio.mState != OT_RADIO_STATE_DISABLED;
+}
+
+otError otPlatRadioEnable(otInstance *aInstance)
+{
+    simRadio *radio = &simNodeFromInstance(aInstance)->mRadio;
+
+    if (radio->mState == OT_RADIO_STATE_DISABLED)
+    {
+        radio->mState = OT_RADIO_STATE_SLEEP;
+    }
+
+    return OT_ERROR_NONE;
+}
+
+otError otPlatRadioDisable(otInstance *aInstance)
+{
+    simRadio *radio = &simNodeFromInstance(aInstance)->mRadio;
+
+    radio->mState   = OT_RADIO_STATE_DISABLED;
+    radio->mTxPhase = SIM_TX_IDLE;
+
+    return OT_ERROR_NONE;
+}
+
+otError otPlatRadioSleep(otInstance *aInstance)
+{
+    simRadio *radio = &simNodeFromInstance(aInstance)->mRadio;
+    otError   error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION(radio->mState == OT_RADIO_STATE_SLEEP || radio->mState == OT_RADIO_STATE_RECEIVE,
+                    error = OT_ERROR_INVALID_STATE);
+    radio->mState = OT_RADIO_STATE_SLEEP;
+
+exit:
+    return error;
+}
+
+otError otPlatRadioReceive(otInstance *aInstance, uint8_t aChannel)
+{
+    simRadio *radio = &simNodeFromInstance(aInstance)->mRadio;
+    otError   error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION(radio->mState != OT_RADIO_STATE_DISABLED && radio->mTxPhase == SIM_TX_IDLE,
+                    error = OT_ERROR_INVALID_STATE);
+    radio->mState   = OT_RADIO_STATE_RECEIVE;
+    radio->mChannel = aChannel;
+
+exit:
+    return error;
+}
+
+otRadioFrame *otPlatRadioGetTransmitBuffer(otInstance *aInstance)
+{
+    return &simNodeFromInstance(aInstance)->mRadio.mTxFrame;
+}
+
+otError otPlatRadioTransmit(otInstance *aInstance, otRadioFrame *aFrame)
+{
+    simNode  *node  = simNodeFromInstance(aInstance);
+    simRadio *radio = &node->mRadio;
+    otError   error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION(radio->mState == OT_RADIO_STATE_RECEIVE && aFrame == &radio->mTxFrame,
+                    error = OT_ERROR_INVALID_STATE);
+
+    radio->mState           = OT_RADIO_STATE_TRANSMIT;
+    radio->mCsmaBackoffs    = 0;
+    radio->mBackoffExponent = SIM_MIN_BE;
+
+    if (aFrame->mInfo.mTxInfo.mCsmaCaEnabled)
+    {
+        startBackoff(node);
+    }
+    else
+    {
+        radio->mTxPhase     = SIM_TX_TURNAROUND;
+        radio->mTxEventTime = gSimNow + SIM_TURNAROUND_TIME_US;
+    }
+
+exit:
+    return error;
+}
+
+int8_t otPlatRadioGetRssi(otInstance *aInstance)
+{
+    const simRadio *radio = &simNodeFromInstance(aInstance)->mRadio;
+
+    return (radio->mEnergyEndTime > gSimNow) ? OPENTHREAD_SIMULATION_RADIO_RSSI : SIM_NOISE_FLOOR;
+}
+
+otError otPlatRadioEnergyScan(otInstance *aInstance, uint8_t aScanChannel, uint16_t aScanDuration)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aScanChannel);
+    OT_UNUSED_VARIABLE(aScanDuration);
+
+    // Without `OT_RADIO_CAPS_ENERGY_SCAN`, the core samples `otPlatRadioGetRssi()` instead.
+    return OT_ERROR_NOT_IMPLEMENTED;
+}
+
+void otPlatRadioEnableSrcMatch(otInstance *aInstance, bool aEnable)
+{
+    simNodeFromInstance(aInstance)->mRadio.mSrcMatchEnabled = aEnable;
+}
+
+otError otPlatRadioAddSrcMatchShortEntry(otInstance *aInstance, otShortAddress aShortAddress)
+{
+    simRadio *radio = &simNodeFromInstance(aInstance)->mRadio;
+    otError   error = OT_ERROR_NONE;
+
+    otEXPECT(!findSrcMatchShort(radio, aShortAddress));
+    otEXPECT_ACTION(radio->mSrcMatchShortCount < OPENTHREAD_SIMULATION_SRC_MATCH_SIZE, error = OT_ERROR_NO_BUFS);
+    radio->mSrcMatchShort[radio->mSrcMatchShortCount++] = aShortAddress;
+
+exit:
+    return error;
+}
+
+otError otPlatRadioAddSrcMatchExtEntry(otInstance *aInstance, const otExtAddress *aExtAddress)
+{
+    simRadio    *radio = &simNodeFromInstance(aInstance)->mRadio;
+    otExtAddress extAddress;
+    otError      error = OT_ERROR_NONE;
+
+    reverseExtAddress(&extAddress, aExtAddress);
+
+    otEXPECT(!findSrcMatchExt(radio, &extAddress));
+    otEXPECT_ACTION(radio->mSrcMatchExtCount < OPENTHREAD_SIMULATION_SRC_MATCH_SIZE, error = OT_ERROR_NO_BUFS);
+    radio->mSrcMatchExt[radio->mSrcMatchExtCount++] = extAddress;
+
+exit:
+    return error;
+}
+
+otError otPlatRadioClearSrcMatchShortEntry(otInstance *aInstance, otShortAddress aShortAddress)
+{
+    simRadio *radio = &simNodeFromInstance(aInstance)->mRadio;
+    otError   error = OT_ERROR_NO_ADDRESS;
+
+    for (uint8_t i = 0; i < radio->mSrcMatchShortCount; i++)
+    {
+        if (radio->mSrcMatchShort[i] == aShortAddress)
+        {
+            radio->mSrcMatchShort[i] = radio->mSrcMatchShort[--radio->mSrcMatchShortCount];
+            error                    = OT_ERROR_NONE;
+            break;
+        }
+    }
+
+    return error;
+}
+
+otError otPlatRadioClearSrcMatchExtEntry(otInstance *aInstance, const otExtAddress *aExtAddress)
+{
+    simRadio    *radio = &simNodeFromInstance(aInstance)->mRadio;
+    otExtAddress extAddress;
+    otError      error = OT_ERROR_NO_ADDRESS;
+
+    reverseExtAddress(&extAddress, aExtAddress);
+
+    for (uint8_t i = 0; i < radio->mSrcMatchExtCount; i++)
+    {
+        if (memcmp(&radio->mSrcMatchExt[i], &extAddress, sizeof(otExtAddress)) == 0)
+        {
+            radio->mSrcMatchExt[i] = radio->mSrcMatchExt[--radio->mSrcMatchExtCount];
+            error                  = OT_ERROR_NONE;
+            break;
+        }
+    }
+
+    return error;
+}
+
+void otPlatRadioClearSrcMatchShortEntries(otInstance *aInstance)
+{
+    simNodeFromInstance(aInstance)->mRadio.mSrcMatchShortCount = 0;
+}
+
+void otPlatRadioClearSrcMatchExtEntries(otInstance *aInstance)
+{
+    simNodeFromInstance(aInstance)->mRadio.mSrcMatchExtCount = 0;
+}
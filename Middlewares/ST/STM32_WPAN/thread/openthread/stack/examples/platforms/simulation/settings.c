@@ -0,0 +1,186 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the settings of the simulation platform, stored in the RAM of each node.
+ *
+ * The records have the layout of `utils/settings_ram.c`. Unlike there, `otPlatSettingsInit()` keeps the stored
+ * records, so that the settings of a node survive its reset.
+ *
+ */
+
+#include "platform-simulation.h"
+
+#include <assert.h>
+#include <string.h>
+
+#include <openthread/platform/settings.h>
+
+#include "utils/code_utils.h"
+
+OT_TOOL_PACKED_BEGIN
+struct settingsBlock
+{
+    uint16_t key;
+    uint16_t length;
+} OT_TOOL_PACKED_END;
+
+static struct settingsBlock *getBlock(simNode *aNode, uint16_t aOffset)
+{
+    return (struct settingsBlock *)&aNode->mSettings[aOffset];
+}
+
+static uint16_t getBlockLength(const struct settingsBlock *aBlock)
+{
+    return (uint16_t)(sizeof(struct settingsBlock) + aBlock->length);
+}
+
+static void removeBlock(simNode *aNode, uint16_t aOffset)
+{
+    uint16_t blockLength = getBlockLength(getBlock(aNode, aOffset));
+    uint16_t nextOffset  = aOffset + blockLength;
+
+    assert(aNode->mSettingsLength >= nextOffset);
+
+    memmove(&aNode->mSettings[aOffset], &aNode->mSettings[nextOffset], aNode->mSettingsLength - nextOffset);
+    aNode->mSettingsLength -= blockLength;
+}
+
+void platformSettingsInit(simNode *aNode) { aNode->mSettingsLength = 0; }
+
+void otPlatSettingsInit(otInstance *aInstance, const uint16_t *aSensitiveKeys, uint16_t aSensitiveKeysLength)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aSensitiveKeys);
+    OT_UNUSED_VARIABLE(aSensitiveKeysLength);
+}
+
+void otPlatSettingsDeinit(otInstance *aInstance) { OT_UNUSED_VARIABLE(aInstance); }
+
+otError otPlatSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength)
+{
+    simNode *node         = simNodeFromInstance(aInstance);
+    uint16_t offset       = 0;
+    uint16_t valueLength  = 0;
+    int      currentIndex = 0;
+    otError  error        = OT_ERROR_NOT_FOUND;
+
+    while (offset < node->mSettingsLength)
+    {
+        const struct settingsBlock *block = getBlock(node, offset);
+
+        if (block->key == aKey && currentIndex++ == aIndex)
+        {
+            valueLength = block->length;
+
+            if (aValue != NULL && aValueLength != NULL)
+            {
+                memcpy(aValue, &node->mSettings[offset + sizeof(struct settingsBlock)],
+                       (valueLength < *aValueLength) ? valueLength : *aValueLength);
+            }
+
+            error = OT_ERROR_NONE;
+            break;
+        }
+
+        offset += getBlockLength(block);
+    }
+
+    if (aValueLength != NULL)
+    {
+        *aValueLength = valueLength;
+    }
+
+    return error;
+}
+
+otError otPlatSettingsSet(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    simNode *node   = simNodeFromInstance(aInstance);
+    uint16_t offset = 0;
+
+    while (offset < node->mSettingsLength)
+    {
+        if (getBlock(node, offset)->key == aKey)
+        {
+            removeBlock(node, offset);
+        }
+        else
+        {
+            offset += getBlockLength(getBlock(node, offset));
+        }
+    }
+
+    return otPlatSettingsAdd(aInstance, aKey, aValue, aValueLength);
+}
+
+otError otPlatSettingsAdd(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    simNode              *node  = simNodeFromInstance(aInstance);
+    otError               error = OT_ERROR_NONE;
+    struct settingsBlock *block;
+
+    otEXPECT_ACTION(node->mSettingsLength + sizeof(struct settingsBlock) + aValueLength <= sizeof(node->mSettings),
+                    error = OT_ERROR_NO_BUFS);
+
+    block         = getBlock(node, node->mSettingsLength);
+    block->key    = aKey;
+    block->length = aValueLength;
+    memcpy(&node->mSettings[node->mSettingsLength + sizeof(struct settingsBlock)], aValue, aValueLength);
+    node->mSettingsLength += getBlockLength(block);
+
+exit:
+    return error;
+}
+
+otError otPlatSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex)
+{
+    simNode *node         = simNodeFromInstance(aInstance);
+    uint16_t offset       = 0;
+    int      currentIndex = 0;
+    otError  error        = OT_ERROR_NOT_FOUND;
+
+    while (offset < node->mSettingsLength)
+    {
+        const struct settingsBlock *block = getBlock(node, offset);
+
+        if (block->key == aKey && currentIndex++ == aIndex)
+        {
+            removeBlock(node, offset);
+            error = OT_ERROR_NONE;
+            break;
+        }
+
+        offset += getBlockLength(block);
+    }
+
+    return error;
+}
+
+void otPlatSettingsWipe(otInstance *aInstance) { platformSettingsInit(simNodeFromInstance(aInstance)); }
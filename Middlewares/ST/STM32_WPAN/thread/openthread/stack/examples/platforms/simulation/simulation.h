@@ -0,0 +1,205 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file defines the API to drive the simulation platform.
+ *
+ * The simulation runs any number of nodes, each one an OpenThread instance, in one process. The nodes share a virtual
+ * IEEE 802.15.4 medium and a virtual clock. Time only advances when the application runs the simulation, and then
+ * jumps from one event (alarm, frame) to the next, so simulated time is independent of the speed of the host.
+ *
+ */
+
+#ifndef OPENTHREAD_SIMULATION_H_
+#define OPENTHREAD_SIMULATION_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <openthread/instance.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Represents a condition checked by `otSimRunUntil()`.
+ *
+ * @param[in]  aContext  The context given to `otSimRunUntil()`.
+ *
+ * @returns TRUE when the condition is met, FALSE otherwise.
+ *
+ */
+typedef bool (*otSimCondition)(void *aContext);
+
+/**
+ * Represents the counters of the virtual 802.15.4 medium.
+ *
+ */
+typedef struct otSimRadioStats
+{
+    uint32_t mTxFrames;    ///< Number of frames put on the air.
+    uint32_t mRxFrames;    ///< Number of frames delivered to a node.
+    uint32_t mCollisions;  ///< Number of frames lost at a node because of another frame on the air.
+    uint32_t mAcks;        ///< Number of ACKs received by the transmitters.
+    uint32_t mNoAcks;      ///< Number of frames which requested an ACK and got none.
+    uint32_t mCcaFailures; ///< Number of transmissions that failed CSMA-CA.
+    uint64_t mAirTime;     ///< Sum of the air time of all the frames, in microseconds.
+} otSimRadioStats;
+
+/**
+ * Initializes the simulation.
+ *
+ * The simulation starts at time zero without any node. The same seed gives the same sequence of random numbers, and
+ * so the same run.
+ *
+ * @param[in]  aSeed  The seed of the random numbers.
+ *
+ */
+void otSimInit(uint32_t aSeed);
+
+/**
+ * Finalizes the simulation, deleting all its nodes.
+ *
+ */
+void otSimDeinit(void);
+
+/**
+ * Adds a node to the simulation.
+ *
+ * The node is an initialized OpenThread instance, with empty settings. Its extended address and EUI-64 derive from
+ * its node ID. The node is at position (0, 0).
+ *
+ * @returns A pointer to the OpenThread instance of the node, or NULL if no more nodes can be added.
+ *
+ */
+otInstance *otSimNodeNew(void);
+
+/**
+ * Deletes a node from the simulation.
+ *
+ * @param[in]  aInstance  The OpenThread instance of the node.
+ *
+ */
+void otSimNodeDelete(otInstance *aInstance);
+
+/**
+ * Gets the ID of a node.
+ *
+ * Node IDs start at 1, in the order the nodes are added.
+ *
+ * @param[in]  aInstance  The OpenThread instance of the node.
+ *
+ * @returns The ID of the node.
+ *
+ */
+uint16_t otSimNodeGetId(otInstance *aInstance);
+
+/**
+ * Sets the position of a node.
+ *
+ * Two nodes hear each other when their distance is at most the radio range (see `otSimSetRadioRange()`).
+ *
+ * @param[in]  aInstance  The OpenThread instance of the node.
+ * @param[in]  aX         The X coordinate.
+ * @param[in]  aY         The Y coordinate.
+ *
+ */
+void otSimNodeSetPosition(otInstance *aInstance, int32_t aX, int32_t aY);
+
+/**
+ * Gets the number of bytes allocated for each node: the OpenThread instance and the platform state.
+ *
+ * @returns The number of bytes allocated for each node.
+ *
+ */
+size_t otSimGetNodeSize(void);
+
+/**
+ * Sets the radio range of all nodes.
+ *
+ * @param[in]  aRange  The radio range, in the unit of the node positions.
+ *
+ */
+void otSimSetRadioRange(uint32_t aRange);
+
+/**
+ * Gets the counters of the virtual 802.15.4 medium since `otSimInit()` or `otSimResetRadioStats()`.
+ *
+ * @param[out]  aStats  A pointer to where to output the counters.
+ *
+ */
+void otSimGetRadioStats(otSimRadioStats *aStats);
+
+/**
+ * Resets the counters of the virtual 802.15.4 medium.
+ *
+ */
+void otSimResetRadioStats(void);
+
+/**
+ * Gets the simulated time.
+ *
+ * @returns The simulated time since `otSimInit()`, in microseconds.
+ *
+ */
+uint64_t otSimGetNow(void);
+
+/**
+ * Runs the simulation for some time.
+ *
+ * @param[in]  aDuration  The simulated time to run, in microseconds.
+ *
+ */
+void otSimRun(uint64_t aDuration);
+
+/**
+ * Runs the simulation until a condition is met, or for at most some time.
+ *
+ * The condition is checked before running and then after each event, once all the tasklets it posted have run.
+ * The condition may use the OpenThread API of the nodes, for example to keep sending traffic, and the tasklets it
+ * posts run before the simulated time advances.
+ *
+ * @param[in]  aCondition  The condition.
+ * @param[in]  aContext    The context passed to @p aCondition.
+ * @param[in]  aTimeout    The maximum simulated time to run, in microseconds.
+ *
+ * @retval TRUE   The condition was met.
+ * @retval FALSE  The time ran out before the condition was met.
+ *
+ */
+bool otSimRunUntil(otSimCondition aCondition, void *aContext, uint64_t aTimeout);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // OPENTHREAD_SIMULATION_H_
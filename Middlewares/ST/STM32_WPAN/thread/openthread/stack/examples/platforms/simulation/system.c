@@ -0,0 +1,400 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file implements the nodes and the event loop of the simulation platform.
+ *
+ */
+
+#include "platform-simulation.h"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <openthread/tasklet.h>
+#include <openthread/platform/misc.h>
+
+#include "openthread-system.h"
+#include "utils/code_utils.h"
+
+uint64_t        gSimNow;
+otSimRadioStats gSimRadioStats;
+
+static simNode *sNodes[OPENTHREAD_SIMULATION_MAX_NODES];
+static simNode *sPendingHead;
+static simNode *sPendingTail;
+static size_t   sInstanceSize;
+static uint32_t sRadioRange = OPENTHREAD_SIMULATION_DEFAULT_RADIO_RANGE;
+static uint64_t sRealTimeOrigin;
+
+static size_t getInstanceSize(void)
+{
+    if (sInstanceSize == 0)
+    {
+        // Called with a NULL buffer, `otInstanceInit()` only outputs the size of an instance.
+        (void)otInstanceInit(NULL, &sInstanceSize);
+    }
+
+    return sInstanceSize;
+}
+
+static void addPending(simNode *aNode)
+{
+    if (!aNode->mTaskletsPending)
+    {
+        aNode->mTaskletsPending = true;
+        aNode->mNextPending     = NULL;
+
+        if (sPendingTail == NULL)
+        {
+            sPendingHead = aNode;
+        }
+        else
+        {
+            sPendingTail->mNextPending = aNode;
+        }
+
+        sPendingTail = aNode;
+    }
+}
+
+static void removePending(simNode *aNode)
+{
+    simNode *prev = NULL;
+
+    for (simNode *node = sPendingHead; node != NULL; prev = node, node = node->mNextPending)
+    {
+        if (node == aNode)
+        {
+            if (prev == NULL)
+            {
+                sPendingHead = node->mNextPending;
+            }
+            else
+            {
+                prev->mNextPending = node->mNextPending;
+            }
+
+            if (sPendingTail == node)
+            {
+                sPendingTail = prev;
+            }
+
+            break;
+        }
+    }
+
+    aNode->mTaskletsPending = false;
+}
+
+static void initInstance(simNode *aNode)
+{
+    size_t      size     = getInstanceSize();
+    otInstance *instance = otInstanceInit(aNode->mInstance, &size);
+
+    assert(instance == simNodeGetInstance(aNode));
+    (void)instance;
+}
+
+static void resetNode(simNode *aNode)
+{
+    // Like a reboot: the settings are kept, everything else starts over.
+    platformInstanceFinalize(simNodeGetInstance(aNode));
+
+    aNode->mResetPending = false;
+    aNode->mAlarmArmed   = false;
+    platformRadioInit(aNode);
+
+    initInstance(aNode);
+}
+
+static void processTasklets(void)
+{
+    while (sPendingHead != NULL)
+    {
+        simNode *node = sPendingHead;
+
+        sPendingHead = node->mNextPending;
+
+        if (sPendingHead == NULL)
+        {
+            sPendingTail = NULL;
+        }
+
+        node->mTaskletsPending = false;
+        otTaskletsProcess(simNodeGetInstance(node));
+
+        if (node->mResetPending)
+        {
+            resetNode(node);
+        }
+    }
+}
+
+static uint64_t getNextEventTime(void)
+{
+    uint64_t nextTime = UINT64_MAX;
+
+    for (simNode *node = simNodeGetFirst(); node != NULL; node = simNodeGetNext(node))
+    {
+        uint64_t alarmTime = platformAlarmGetNextEventTime(node);
+        uint64_t radioTime = platformRadioGetNextEventTime(node);
+
+        if (alarmTime < nextTime)
+        {
+            nextTime = alarmTime;
+        }
+
+        if (radioTime < nextTime)
+        {
+            nextTime = radioTime;
+        }
+    }
+
+    return nextTime;
+}
+
+static void processEvents(uint64_t aTime)
+{
+    gSimNow = aTime;
+
+    for (simNode *node = simNodeGetFirst(); node != NULL; node = simNodeGetNext(node))
+    {
+        platformRadioProcess(node);
+        platformAlarmProcess(node);
+        processTasklets();
+    }
+}
+
+static uint64_t getRealTime(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)now.tv_sec * 1000000 + (uint64_t)now.tv_nsec / 1000 - sRealTimeOrigin;
+}
+
+simNode *simNodeGetFirst(void)
+{
+    simNode *node = NULL;
+
+    for (uint16_t i = 0; i < OPENTHREAD_SIMULATION_MAX_NODES && node == NULL; i++)
+    {
+        node = sNodes[i];
+    }
+
+    return node;
+}
+
+simNode *simNodeGetNext(const simNode *aNode)
+{
+    simNode *node = NULL;
+
+    // Node IDs are the indexes in `sNodes` plus one.
+    for (uint16_t i = aNode->mId; i < OPENTHREAD_SIMULATION_MAX_NODES && node == NULL; i++)
+    {
+        node = sNodes[i];
+    }
+
+    return node;
+}
+
+bool simNodesInRange(const simNode *aNode, const simNode *aOther)
+{
+    int64_t dx = (int64_t)aNode->mX - aOther->mX;
+    int64_t dy = (int64_t)aNode->mY - aOther->mY;
+
+    return (uint64_t)(dx * dx + dy * dy) <= (uint64_t)sRadioRange * sRadioRange;
+}
+
+void otSimInit(uint32_t aSeed)
+{
+    otSimDeinit();
+
+    gSimNow     = 0;
+    sRadioRange = OPENTHREAD_SIMULATION_DEFAULT_RADIO_RANGE;
+    memset(&gSimRadioStats, 0, sizeof(gSimRadioStats));
+    platformRandomInit(aSeed);
+}
+
+void otSimDeinit(void)
+{
+    for (simNode *node = simNodeGetFirst(); node != NULL; node = simNodeGetFirst())
+    {
+        otSimNodeDelete(simNodeGetInstance(node));
+    }
+}
+
+otInstance *otSimNodeNew(void)
+{
+    otInstance *instance = NULL;
+    simNode    *node;
+    uint16_t    index = 0;
+
+    while (index < OPENTHREAD_SIMULATION_MAX_NODES && sNodes[index] != NULL)
+    {
+        index++;
+    }
+
+    otEXPECT(index < OPENTHREAD_SIMULATION_MAX_NODES);
+
+    node = (simNode *)calloc(1, otSimGetNodeSize());
+    otEXPECT(node != NULL);
+
+    node->mId     = index + 1;
+    sNodes[index] = node;
+    platformRadioInit(node);
+    platformSettingsInit(node);
+
+    initInstance(node);
+    instance = simNodeGetInstance(node);
+
+exit:
+    return instance;
+}
+
+void otSimNodeDelete(otInstance *aInstance)
+{
+    simNode *node = simNodeFromInstance(aInstance);
+
+    platformInstanceFinalize(aInstance);
+    removePending(node);
+
+    sNodes[node->mId - 1] = NULL;
+    free(node);
+}
+
+uint16_t otSimNodeGetId(otInstance *aInstance) { return simNodeFromInstance(aInstance)->mId; }
+
+void otSimNodeSetPosition(otInstance *aInstance, int32_t aX, int32_t aY)
+{
+    simNode *node = simNodeFromInstance(aInstance);
+
+    node->mX = aX;
+    node->mY = aY;
+}
+
+size_t otSimGetNodeSize(void) { return sizeof(simNode) + getInstanceSize(); }
+
+void otSimSetRadioRange(uint32_t aRange) { sRadioRange = aRange; }
+
+void otSimGetRadioStats(otSimRadioStats *aStats) { *aStats = gSimRadioStats; }
+
+void otSimResetRadioStats(void) { memset(&gSimRadioStats, 0, sizeof(gSimRadioStats)); }
+
+uint64_t otSimGetNow(void) { return gSimNow; }
+
+void otSimRun(uint64_t aDuration) { (void)otSimRunUntil(NULL, NULL, aDuration); }
+
+bool otSimRunUntil(otSimCondition aCondition, void *aContext, uint64_t aTimeout)
+{
+    uint64_t endTime = gSimNow + aTimeout;
+    bool     met;
+
+    processTasklets();
+
+    while (!(met = (aCondition != NULL && aCondition(aContext))))
+    {
+        uint64_t nextTime;
+
+        // The condition may have used the OpenThread API, its tasklets run before the time advances.
+        processTasklets();
+
+        nextTime = getNextEventTime();
+
+        if (nextTime > endTime)
+        {
+            gSimNow = endTime;
+            break;
+        }
+
+        processEvents(nextTime);
+    }
+
+    return met;
+}
+
+void otTaskletsSignalPending(otInstance *aInstance) { addPending(simNodeFromInstance(aInstance)); }
+
+void otPlatReset(otInstance *aInstance)
+{
+    simNode *node = simNodeFromInstance(aInstance);
+
+    // The instance cannot be finalized from within its own call stack, `processTasklets()` resets the node.
+    node->mResetPending = true;
+    addPending(node);
+}
+
+otPlatResetReason otPlatGetResetReason(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return OT_PLAT_RESET_REASON_POWER_ON;
+}
+
+void otSysInit(int argc, char *argv[])
+{
+    otSimInit((argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 0);
+
+    sRealTimeOrigin = 0;
+    sRealTimeOrigin = getRealTime();
+}
+
+void otSysDeinit(void) { otSimDeinit(); }
+
+bool otSysPseudoResetWasRequested(void) { return false; }
+
+void otSysProcessDrivers(otInstance *aInstance)
+{
+    uint64_t now      = getRealTime();
+    uint64_t nextTime = getNextEventTime();
+
+    OT_UNUSED_VARIABLE(aInstance);
+
+    // With `otSys*()`, the simulated time follows the real time, so that a node can be used interactively.
+    platformUartProcess((sPendingHead != NULL || nextTime <= now) ? 0 : nextTime - now);
+
+    now = getRealTime();
+
+    while ((nextTime = getNextEventTime()) <= now)
+    {
+        processEvents(nextTime);
+    }
+
+    if (gSimNow < now)
+    {
+        gSimNow = now;
+    }
+
+    processTasklets();
+}
@@ -0,0 +1,155 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file implements the UART of the simulation platform on the standard input and output.
+ *
+ */
+
+#include "platform-simulation.h"
+
+#include <errno.h>
+#include <sys/select.h>
+#include <unistd.h>
+
+#include "utils/code_utils.h"
+#include "utils/uart.h"
+
+#define UART_MAX_WAIT_US 1000000
+
+static bool sUartEnabled;
+static bool sUartInputClosed;
+static bool sUartSendDonePending;
+
+otError otPlatUartEnable(void)
+{
+    sUartEnabled = true;
+
+    return OT_ERROR_NONE;
+}
+
+otError otPlatUartDisable(void)
+{
+    sUartEnabled = false;
+
+    return OT_ERROR_NONE;
+}
+
+otError otPlatUartSend(const uint8_t *aBuf, uint16_t aBufLength)
+{
+    otError error = OT_ERROR_NONE;
+
+    otEXPECT_ACTION(sUartEnabled && !sUartSendDonePending, error = OT_ERROR_BUSY);
+
+    while (aBufLength > 0)
+    {
+        ssize_t written = write(STDOUT_FILENO, aBuf, aBufLength);
+
+        if (written < 0)
+        {
+            otEXPECT_ACTION(errno == EINTR, error = OT_ERROR_FAILED);
+            continue;
+        }
+
+        aBuf += written;
+        aBufLength -= (uint16_t)written;
+    }
+
+    // The data is already written, the send is reported done from `platformUartProcess()`.
+    sUartSendDonePending = true;
+
+exit:
+    return error;
+}
+
+otError otPlatUartFlush(void) { return OT_ERROR_NONE; }
+
+/*
+ * The callbacks are weak so that an application without a UART user, such as a benchmark, still links.
+ */
+
+OT_TOOL_WEAK
+void otPlatUartSendDone(void) {}
+
+OT_TOOL_WEAK
+void otPlatUartReceived(const uint8_t *aBuf, uint16_t aBufLength)
+{
+    OT_UNUSED_VARIABLE(aBuf);
+    OT_UNUSED_VARIABLE(aBufLength);
+}
+
+void platformUartProcess(uint64_t aTimeout)
+{
+    bool           readInput = sUartEnabled && !sUartInputClosed;
+    fd_set         readFds;
+    struct timeval timeout;
+
+    if (sUartSendDonePending)
+    {
+        sUartSendDonePending = false;
+        otPlatUartSendDone();
+        aTimeout = 0;
+    }
+
+    if (aTimeout > UART_MAX_WAIT_US)
+    {
+        aTimeout = UART_MAX_WAIT_US;
+    }
+
+    FD_ZERO(&readFds);
+
+    if (readInput)
+    {
+        FD_SET(STDIN_FILENO, &readFds);
+    }
+
+    timeout.tv_sec  = (time_t)(aTimeout / 1000000);
+    timeout.tv_usec = (suseconds_t)(aTimeout % 1000000);
+
+    otEXPECT(select(readInput ? STDIN_FILENO + 1 : 0, &readFds, NULL, NULL, &timeout) > 0);
+
+    if (FD_ISSET(STDIN_FILENO, &readFds))
+    {
+        uint8_t buf[256];
+        ssize_t count = read(STDIN_FILENO, buf, sizeof(buf));
+
+        if (count > 0)
+        {
+            otPlatUartReceived(buf, (uint16_t)count);
+        }
+        else if (count == 0)
+        {
+            sUartInputClosed = true;
+        }
+    }
+
+exit:
+    return;
+}
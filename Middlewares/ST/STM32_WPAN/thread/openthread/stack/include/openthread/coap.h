@@ -444,6 +444,20 @@ typedef struct otCoapBlockwiseResource
     struct otCoapBlockwiseResource *mNext;    ///< The next CoAP resource in the list
 } otCoapBlockwiseResource;
 
+/**
+ * Represents the counters of the CoAP server response cache.
+ *
+ * The server caches the responses to Confirmable requests, and sends the cached response again when a request is
+ * retransmitted.
+ *
+ */
+typedef struct otCoapResponseCacheCounters
+{
+    uint32_t mLookups;   ///< Number of received requests looked up in the cache.
+    uint32_t mHits;      ///< Number of received requests matching a cached response (retransmitted requests).
+    uint32_t mEvictions; ///< Number of responses removed before the end of their lifetime, to make room for others.
+} otCoapResponseCacheCounters;
+
 /**
  * Represents the CoAP transmission parameters.
  *
@@ -1006,6 +1020,24 @@ otError otCoapStart(otInstance *aInstance, uint16_t aPort);
  */
 otError otCoapStop(otInstance *aInstance);
 
+/**
+ * Gets the counters of the CoAP server response cache.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the counters of the response cache.
+ *
+ */
+const otCoapResponseCacheCounters *otCoapGetResponseCacheCounters(otInstance *aInstance);
+
+/**
+ * Resets the counters of the CoAP server response cache.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otCoapResetResponseCacheCounters(otInstance *aInstance);
+
 /**
  * Adds a resource to the CoAP server.
  *
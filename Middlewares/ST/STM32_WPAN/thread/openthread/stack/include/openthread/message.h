@@ -388,6 +388,26 @@ typedef struct otMessageQueueInfo
     uint32_t mTotalBytes;  ///< Total number of bytes used by all messages in the queue.
 } otMessageQueueInfo;
 
+/**
+ * The number of message priority levels accounted in `otBufferInfo`.
+ *
+ * The levels are the `OT_MESSAGE_PRIORITY_*` values from `otMessagePriority`, followed by the network control
+ * priority level used internally by the OpenThread stack (e.g., for MLE messages).
+ *
+ */
+#define OT_MESSAGE_NUM_PRIORITY_LEVELS 4
+
+/**
+ * Represents the message buffer usage of a message priority level.
+ *
+ */
+typedef struct otMessagePriorityInfo
+{
+    uint16_t mUsedBuffers;    ///< The number of buffers used by messages of the priority level.
+    uint16_t mMaxUsedBuffers; ///< The maximum number of buffers used at the same time by messages of the level.
+    uint32_t mNumDrops;       ///< The number of buffer allocations or transmissions denied to the level.
+} otMessagePriorityInfo;
+
 /**
  * Represents the message buffer information for different queues used by OpenThread stack.
  *
@@ -412,6 +432,15 @@ typedef struct otBufferInfo
     otMessageQueueInfo mCoapQueue;            ///< Info about CoAP/TMF send queue.
     otMessageQueueInfo mCoapSecureQueue;      ///< Info about CoAP secure send queue.
     otMessageQueueInfo mApplicationCoapQueue; ///< Info about application CoAP send queue.
+
+    /**
+     * Buffer usage of each message priority level, indexed by priority level (see `OT_MESSAGE_NUM_PRIORITY_LEVELS`).
+     *
+     * `mMaxUsedBuffers` and `mNumDrops` are counted since OT stack initialization or last call to
+     * `otMessageResetBufferInfo()`.
+     *
+     */
+    otMessagePriorityInfo mPriorityLevels[OT_MESSAGE_NUM_PRIORITY_LEVELS];
 } otBufferInfo;
 
 /**
@@ -487,7 +516,7 @@ void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo);
 /**
  * Reset the Message Buffer information counter tracking the maximum number buffers in use at the same time.
  *
- * This resets `mMaxUsedBuffers` in `otBufferInfo`.
+ * This resets `mMaxUsedBuffers` in `otBufferInfo`, and `mMaxUsedBuffers` and `mNumDrops` of its `mPriorityLevels`.
  *
  * @param[in]   aInstance    A pointer to the OpenThread instance.
  *
@@ -47,6 +47,9 @@ typedef uint64_t time_t;
 #elif defined ( __ARMCC_VERSION ) /* KEIL with ARMCC or Clang */
 typedef unsigned int time_t;
 
+#elif defined ( __linux__ ) /* Host builds (e.g. simulation platform), time_t comes from the C library */
+#include <time.h>
+
 #elif defined ( __GNUC__ ) /* CubeIDE GCC */
 typedef long long int time_t;
 #endif
@@ -94,6 +94,17 @@ typedef enum otCacheEntryState
     OT_CACHE_ENTRY_STATE_RETRY_QUERY = 3, // Entry is in retry wait mode (a prior query did not get a response).
 } otCacheEntryState;
 
+/**
+ * Represents the counters of the EID cache.
+ *
+ */
+typedef struct otCacheCounters
+{
+    uint32_t mHits;      ///< Number of lookups resolved by a cached or snooped entry.
+    uint32_t mMisses;    ///< Number of lookups not resolved by the cache (e.g., address query needed or in progress).
+    uint32_t mEvictions; ///< Number of entries evicted to make room for a new entry.
+} otCacheCounters;
+
 /**
  * Represents an EID cache entry.
  *
@@ -110,6 +121,8 @@ typedef struct otCacheEntryInfo
     otIp6Address      mMeshLocalEid;       ///< Mesh Local EID (applicable if entry in cached state).
     uint16_t          mTimeout;            ///< Timeout in seconds (applicable if in snooped/query/retry-query states).
     uint16_t          mRetryDelay;         ///< Retry delay in seconds (applicable if in query-retry state).
+    uint32_t          mHits;               ///< Number of lookups resolved by the entry.
+    otCacheCounters   mCounters;           ///< Counters of the whole EID cache (same in all entries).
 } otCacheEntryInfo;
 
 /**
@@ -1008,6 +1008,10 @@ exit:
  * coap: 0 0 0
  * coap secure: 0 0 0
  * application coap: 0 0 0
+ * low priority: 0 2 0
+ * normal priority: 0 3 0
+ * high priority: 0 0 0
+ * net priority: 0 2 0
  * Done
  * @endcode
  * @par
@@ -1022,6 +1026,11 @@ exit:
  * *   The first number shows number messages in the queue.
  * *   The second number shows number of buffers used by all messages in the queue.
  * *   The third number shows total number of bytes of all messages in the queue.
+ * @par
+ * Last, the CLI displays info about each message priority level, for example `low priority`:
+ * *   The first number shows number of buffers used by messages of the priority level.
+ * *   The second number shows max number of buffers used at the same time by messages of the priority level.
+ * *   The third number shows number of buffer allocations or transmissions denied to the priority level.
  * @sa otMessageGetBufferInfo
  */
 template <> otError Interpreter::Process<Cmd("bufferinfo")>(Arg aArgs[])
@@ -1043,6 +1052,8 @@ template <> otError Interpreter::Process<Cmd("bufferinfo")>(Arg aArgs[])
         {&otBufferInfo::mApplicationCoapQueue, "application coap"},
     };
 
+    static const char *const kPriorityLevelNames[OT_MESSAGE_NUM_PRIORITY_LEVELS] = {"low", "normal", "high", "net"};
+
     otError error = OT_ERROR_NONE;
 
     if (aArgs[0].IsEmpty())
@@ -1060,6 +1071,14 @@ template <> otError Interpreter::Process<Cmd("bufferinfo")>(Arg aArgs[])
             OutputLine("%s: %u %u %lu", info.mName, (bufferInfo.*info.mQueuePtr).mNumMessages,
                        (bufferInfo.*info.mQueuePtr).mNumBuffers, ToUlong((bufferInfo.*info.mQueuePtr).mTotalBytes));
         }
+
+        for (uint8_t priority = 0; priority < OT_MESSAGE_NUM_PRIORITY_LEVELS; priority++)
+        {
+            const otMessagePriorityInfo &info = bufferInfo.mPriorityLevels[priority];
+
+            OutputLine("%s priority: %u %u %lu", kPriorityLevelNames[priority], info.mUsedBuffers, info.mMaxUsedBuffers,
+                       ToUlong(info.mNumDrops));
+        }
     }
     /**
      * @cli bufferinfo reset
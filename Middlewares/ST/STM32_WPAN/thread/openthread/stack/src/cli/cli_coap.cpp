@@ -141,6 +141,50 @@ void Coap::PrintPayload(otMessage *aMessage)
     OutputNewLine();
 }
 
+/**
+ * @cli coap cachecounters
+ * @code
+ * coap cachecounters
+ * Lookups: 120
+ * Hits: 96
+ * Evictions: 2
+ * Done
+ * @endcode
+ * @code
+ * coap cachecounters reset
+ * Done
+ * @endcode
+ * @cparam coap cachecounters [@ca{reset}]
+ * @par
+ * Gets or resets the counters of the response cache of the CoAP server. A hit is a retransmitted request answered
+ * with its cached response.
+ * @sa otCoapGetResponseCacheCounters
+ * @sa otCoapResetResponseCacheCounters
+ */
+template <> otError Coap::Process<Cmd("cachecounters")>(Arg aArgs[])
+{
+    otError error = OT_ERROR_NONE;
+
+    if (aArgs[0].IsEmpty())
+    {
+        const otCoapResponseCacheCounters *counters = otCoapGetResponseCacheCounters(GetInstancePtr());
+
+        OutputLine("Lookups: %lu", ToUlong(counters->mLookups));
+        OutputLine("Hits: %lu", ToUlong(counters->mHits));
+        OutputLine("Evictions: %lu", ToUlong(counters->mEvictions));
+    }
+    else if ((aArgs[0] == "reset") && aArgs[1].IsEmpty())
+    {
+        otCoapResetResponseCacheCounters(GetInstancePtr());
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_ARGS;
+    }
+
+    return error;
+}
+
 #if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
 /**
  * @cli coap cancel
@@ -788,6 +832,7 @@ otError Coap::Process(Arg aArgs[])
     }
 
     static constexpr Command kCommands[] = {
+        CmdEntry("cachecounters"),
 #if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
         CmdEntry("cancel"),
 #endif
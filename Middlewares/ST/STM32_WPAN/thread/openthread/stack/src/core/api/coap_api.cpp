@@ -259,6 +259,16 @@ otError otCoapStart(otInstance *aInstance, uint16_t aPort)
 
 otError otCoapStop(otInstance *aInstance) { return AsCoreType(aInstance).GetApplicationCoap().Stop(); }
 
+const otCoapResponseCacheCounters *otCoapGetResponseCacheCounters(otInstance *aInstance)
+{
+    return &AsCoreType(aInstance).GetApplicationCoap().GetCachedResponsesCounters();
+}
+
+void otCoapResetResponseCacheCounters(otInstance *aInstance)
+{
+    AsCoreType(aInstance).GetApplicationCoap().ResetCachedResponsesCounters();
+}
+
 #if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
 void otCoapAddBlockWiseResource(otInstance *aInstance, otCoapBlockwiseResource *aResource)
 {
@@ -1473,111 +1473,167 @@ void CoapBase::Metadata::UpdateIn(Message &aMessage) const
 }
 
 ResponsesQueue::ResponsesQueue(Instance &aInstance)
-    : mTimer(aInstance, ResponsesQueue::HandleTimer, this)
+    : mCachedSize(0)
+    , mNextSequence(0)
+    , mTimer(aInstance, ResponsesQueue::HandleTimer, this)
 {
+    ClearAllBytes(mEntries);
+    mCounters.Clear();
 }
 
 Error ResponsesQueue::GetMatchedResponseCopy(const Message          &aRequest,
                                              const Ip6::MessageInfo &aMessageInfo,
                                              Message               **aResponse)
 {
-    Error          error = kErrorNone;
-    const Message *cacheResponse;
+    Error        error = kErrorNone;
+    const Entry *entry;
 
-    cacheResponse = FindMatchedResponse(aRequest, aMessageInfo);
-    VerifyOrExit(cacheResponse != nullptr, error = kErrorNotFound);
+    mCounters.mLookups++;
 
-    *aResponse = cacheResponse->Clone(cacheResponse->GetLength() - sizeof(ResponseMetadata));
+    entry = FindEntry(aRequest.GetMessageId(), aMessageInfo);
+    VerifyOrExit(entry != nullptr, error = kErrorNotFound);
+
+    mCounters.mHits++;
+
+    *aResponse = entry->mResponse->Clone();
     VerifyOrExit(*aResponse != nullptr, error = kErrorNoBufs);
 
 exit:
     return error;
 }
 
-const Message *ResponsesQueue::FindMatchedResponse(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo) const
+uint32_t ResponsesQueue::HashKey(uint16_t aMessageId, const Ip6::MessageInfo &aMessageInfo)
 {
-    const Message *response = nullptr;
+    // The Message ID already tells most requests apart, so only the
+    // last 32 bits of the peer address (the end of its IID) are mixed
+    // with it and the peer port. `Index` scrambles the result.
 
-    for (const Message &message : mQueue)
-    {
-        if (message.GetMessageId() == aRequest.GetMessageId())
-        {
-            ResponseMetadata metadata;
+    return ((static_cast<uint32_t>(aMessageInfo.GetPeerPort()) << 16) | aMessageId) ^
+           aMessageInfo.GetPeerAddr().mFields.m32[3];
+}
 
-            metadata.ReadFrom(message);
+const ResponsesQueue::Entry *ResponsesQueue::FindEntry(uint16_t aMessageId, const Ip6::MessageInfo &aMessageInfo) const
+{
+    const Entry *entry = nullptr;
+    uint16_t     slot  = mIndex.GetHomeSlot(HashKey(aMessageId, aMessageInfo));
+    uint16_t     entryIndex;
 
-            if ((metadata.mMessageInfo.GetPeerPort() == aMessageInfo.GetPeerPort()) &&
-                (metadata.mMessageInfo.GetPeerAddr() == aMessageInfo.GetPeerAddr()))
-            {
-                response = &message;
-                break;
-            }
+    while ((entryIndex = mIndex.GetNext(slot)) != Index::kNotFound)
+    {
+        const Entry &candidate = mEntries[entryIndex];
+
+        if ((candidate.mMessageId == aMessageId) && (candidate.mPeerPort == aMessageInfo.GetPeerPort()) &&
+            (candidate.mPeerAddr == aMessageInfo.GetPeerAddr()))
+        {
+            entry = &candidate;
+            break;
         }
     }
 
-    return response;
+    return entry;
 }
 
 void ResponsesQueue::EnqueueResponse(Message                &aMessage,
                                      const Ip6::MessageInfo &aMessageInfo,
                                      const TxParameters     &aTxParameters)
 {
-    Message         *responseCopy;
-    ResponseMetadata metadata;
+    uint16_t size = static_cast<uint16_t>(aMessage.GetBufferCount() * kBufferSize);
+    Entry   *entry;
+    Message *responseCopy;
 
-    metadata.mDequeueTime = TimerMilli::GetNow() + aTxParameters.CalculateExchangeLifetime();
-    metadata.mMessageInfo = aMessageInfo;
+    VerifyOrExit(FindEntry(aMessage.GetMessageId(), aMessageInfo) == nullptr);
 
-    VerifyOrExit(FindMatchedResponse(aMessage, aMessageInfo) == nullptr);
-
-    UpdateQueue();
+    VerifyOrExit((entry = AllocateEntry(size)) != nullptr);
 
     VerifyOrExit((responseCopy = aMessage.Clone()) != nullptr);
 
-    VerifyOrExit(metadata.AppendTo(*responseCopy) == kErrorNone, responseCopy->Free());
+    entry->mResponse    = responseCopy;
+    entry->mPeerAddr    = aMessageInfo.GetPeerAddr();
+    entry->mPeerPort    = aMessageInfo.GetPeerPort();
+    entry->mMessageId   = aMessage.GetMessageId();
+    entry->mSize        = size;
+    entry->mDequeueTime = TimerMilli::GetNow() + aTxParameters.CalculateExchangeLifetime();
+    entry->mSequence    = mNextSequence++;
 
+    mIndex.Add(GetEntryIndex(*entry), HashKey(entry->mMessageId, aMessageInfo));
+    mCachedSize += size;
     mQueue.Enqueue(*responseCopy);
 
-    mTimer.FireAtIfEarlier(metadata.mDequeueTime);
+    mTimer.FireAtIfEarlier(entry->mDequeueTime);
 
 exit:
     return;
 }
 
-void ResponsesQueue::UpdateQueue(void)
+bool ResponsesQueue::IsDequeuedBefore(const Entry &aEntry, const Entry &aOther)
 {
-    uint16_t  msgCount    = 0;
-    Message  *earliestMsg = nullptr;
-    TimeMilli earliestDequeueTime(0);
+    // The responses cached in the same millisecond, e.g. during a
+    // burst of requests, have the same dequeue time. The oldest of
+    // them is removed first, as in a FIFO.
 
-    // Check the number of messages in the queue and if number is at
-    // `kMaxCachedResponses` remove the one with earliest dequeue
-    // time.
+    return (aEntry.mDequeueTime < aOther.mDequeueTime) ||
+           ((aEntry.mDequeueTime == aOther.mDequeueTime) &&
+            (static_cast<int32_t>(aEntry.mSequence - aOther.mSequence) < 0));
+}
 
-    for (Message &message : mQueue)
-    {
-        ResponseMetadata metadata;
+ResponsesQueue::Entry *ResponsesQueue::AllocateEntry(uint16_t aSize)
+{
+    // Returns an unused entry, after removing the responses with the
+    // earliest dequeue time until the number of cached responses and
+    // their size allow to add a response of `aSize` bytes.
 
-        metadata.ReadFrom(message);
+    Entry *entry = nullptr;
+
+    VerifyOrExit(aSize <= kMaxCachedSize);
 
-        if ((earliestMsg == nullptr) || (metadata.mDequeueTime < earliestDequeueTime))
+    while (true)
+    {
+        Entry *earliest = nullptr;
+
+        for (Entry &candidate : mEntries)
         {
-            earliestMsg         = &message;
-            earliestDequeueTime = metadata.mDequeueTime;
+            if (candidate.mResponse == nullptr)
+            {
+                if (entry == nullptr)
+                {
+                    entry = &candidate;
+                }
+            }
+            else if ((earliest == nullptr) || IsDequeuedBefore(candidate, *earliest))
+            {
+                earliest = &candidate;
+            }
         }
 
-        msgCount++;
-    }
+        VerifyOrExit((entry == nullptr) || (mCachedSize + aSize > kMaxCachedSize));
 
-    if (msgCount >= kMaxCachedResponses)
-    {
-        DequeueResponse(*earliestMsg);
+        entry = nullptr;
+        mCounters.mEvictions++;
+        DequeueResponse(*earliest);
     }
+
+exit:
+    return entry;
 }
 
-void ResponsesQueue::DequeueResponse(Message &aMessage) { mQueue.DequeueAndFree(aMessage); }
+void ResponsesQueue::DequeueResponse(Entry &aEntry)
+{
+    mIndex.Remove(GetEntryIndex(aEntry));
+    mCachedSize -= aEntry.mSize;
+    mQueue.DequeueAndFree(*aEntry.mResponse);
+    aEntry.mResponse = nullptr;
+}
 
-void ResponsesQueue::DequeueAllResponses(void) { mQueue.DequeueAndFreeAll(); }
+void ResponsesQueue::DequeueAllResponses(void)
+{
+    for (Entry &entry : mEntries)
+    {
+        if (entry.mResponse != nullptr)
+        {
+            DequeueResponse(entry);
+        }
+    }
+}
 
 void ResponsesQueue::HandleTimer(Timer &aTimer)
 {
@@ -1588,32 +1644,25 @@ void ResponsesQueue::HandleTimer(void)
 {
     NextFireTime nextDequeueTime;
 
-    for (Message &message : mQueue)
+    for (Entry &entry : mEntries)
     {
-        ResponseMetadata metadata;
-
-        metadata.ReadFrom(message);
+        if (entry.mResponse == nullptr)
+        {
+            continue;
+        }
 
-        if (nextDequeueTime.GetNow() >= metadata.mDequeueTime)
+        if (nextDequeueTime.GetNow() >= entry.mDequeueTime)
         {
-            DequeueResponse(message);
+            DequeueResponse(entry);
             continue;
         }
 
-        nextDequeueTime.UpdateIfEarlier(metadata.mDequeueTime);
+        nextDequeueTime.UpdateIfEarlier(entry.mDequeueTime);
     }
 
     mTimer.FireAt(nextDequeueTime);
 }
 
-void ResponsesQueue::ResponseMetadata::ReadFrom(const Message &aMessage)
-{
-    uint16_t length = aMessage.GetLength();
-
-    OT_ASSERT(length >= sizeof(*this));
-    IgnoreError(aMessage.Read(length - sizeof(*this), *this));
-}
-
 /// Return product of @p aValueA and @p aValueB if no overflow otherwise 0.
 static uint32_t Multiply(uint32_t aValueA, uint32_t aValueB)
 {
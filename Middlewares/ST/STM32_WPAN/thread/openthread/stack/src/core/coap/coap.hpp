@@ -36,7 +36,9 @@
 #include "coap/coap_message.hpp"
 #include "common/as_core_type.hpp"
 #include "common/callback.hpp"
+#include "common/clearable.hpp"
 #include "common/debug.hpp"
+#include "common/hash_index.hpp"
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/message.hpp"
@@ -279,10 +281,21 @@ protected:
 /**
  * Caches CoAP responses to implement message deduplication.
  *
+ * The responses are indexed by their Message ID and peer endpoint. A response is removed at the end of its lifetime,
+ * or earlier when the number of cached responses or the size of their message buffers reaches its limit.
+ *
  */
 class ResponsesQueue
 {
 public:
+    /**
+     * Represents the counters of the response cache.
+     *
+     */
+    struct Counters : public otCoapResponseCacheCounters, public Clearable<Counters>
+    {
+    };
+
     /**
      * Default class constructor.
      *
@@ -334,26 +347,54 @@ public:
      */
     const MessageQueue &GetResponses(void) const { return mQueue; }
 
+    /**
+     * Gets the counters of the response cache.
+     *
+     * @returns A reference to the counters.
+     *
+     */
+    const Counters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * Resets the counters of the response cache.
+     *
+     */
+    void ResetCounters(void) { mCounters.Clear(); }
+
 private:
     static constexpr uint16_t kMaxCachedResponses = OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES;
+    static constexpr uint32_t kMaxCachedSize      = OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES_SIZE;
 
-    struct ResponseMetadata
-    {
-        Error AppendTo(Message &aMessage) const { return aMessage.Append(*this); }
-        void  ReadFrom(const Message &aMessage);
+    typedef HashIndex<kMaxCachedResponses> Index;
 
-        TimeMilli        mDequeueTime;
-        Ip6::MessageInfo mMessageInfo;
+    struct Entry
+    {
+        Message     *mResponse; // `nullptr` if the entry is unused.
+        Ip6::Address mPeerAddr;
+        uint16_t     mPeerPort;
+        uint16_t     mMessageId;
+        uint16_t     mSize;
+        TimeMilli    mDequeueTime;
+        uint32_t     mSequence; // Order of the response in the cache, to evict the oldest of equal dequeue times.
     };
 
-    const Message *FindMatchedResponse(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo) const;
-    void           DequeueResponse(Message &aMessage);
-    void           UpdateQueue(void);
+    static uint32_t HashKey(uint16_t aMessageId, const Ip6::MessageInfo &aMessageInfo);
+    static bool     IsDequeuedBefore(const Entry &aEntry, const Entry &aOther);
+
+    const Entry *FindEntry(uint16_t aMessageId, const Ip6::MessageInfo &aMessageInfo) const;
+    Entry       *AllocateEntry(uint16_t aSize);
+    void         DequeueResponse(Entry &aEntry);
+    uint16_t     GetEntryIndex(const Entry &aEntry) const { return static_cast<uint16_t>(&aEntry - mEntries); }
 
     static void HandleTimer(Timer &aTimer);
     void        HandleTimer(void);
 
     MessageQueue      mQueue;
+    Entry             mEntries[kMaxCachedResponses];
+    Index             mIndex;
+    uint32_t          mCachedSize;
+    uint32_t          mNextSequence;
+    Counters          mCounters;
     TimerMilliContext mTimer;
 };
 
@@ -792,6 +833,20 @@ public:
      */
     const MessageQueue &GetCachedResponses(void) const { return mResponsesQueue.GetResponses(); }
 
+    /**
+     * Returns the counters of the cached response list.
+     *
+     * @returns A reference to the counters of the cached response list.
+     *
+     */
+    const ResponsesQueue::Counters &GetCachedResponsesCounters(void) const { return mResponsesQueue.GetCounters(); }
+
+    /**
+     * Resets the counters of the cached response list.
+     *
+     */
+    void ResetCachedResponsesCounters(void) { mResponsesQueue.ResetCounters(); }
+
 protected:
     /**
      * Defines function pointer to handle a CoAP resource.
@@ -566,20 +566,22 @@ exit:
 
 Error Option::Iterator::ReadOptionValue(uint64_t &aUintValue) const
 {
-    Error   error = kErrorNone;
-    uint8_t buffer[sizeof(uint64_t)];
+    Error error = kErrorNone;
 
     VerifyOrExit(!IsDone(), error = kErrorNotFound);
 
     VerifyOrExit(mOption.mLength <= sizeof(uint64_t), error = kErrorNoBufs);
-    IgnoreError(ReadOptionValue(buffer));
 
     aUintValue = 0;
 
-    for (uint16_t pos = 0; pos < mOption.mLength; pos++)
+    for (Message::ChunkIterator it(GetMessage(), mNextOptionOffset - mOption.mLength, mOption.mLength); !it.IsDone();
+         it.Advance())
     {
-        aUintValue <<= kBitsPerByte;
-        aUintValue |= buffer[pos];
+        for (uint16_t pos = 0; pos < it.GetLength(); pos++)
+        {
+            aUintValue <<= kBitsPerByte;
+            aUintValue |= it.GetBytes()[pos];
+        }
     }
 
 exit:
@@ -0,0 +1,261 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for a generic hash index over an array of entries.
+ */
+
+#ifndef HASH_INDEX_HPP_
+#define HASH_INDEX_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+
+#include "common/clearable.hpp"
+#include "common/code_utils.hpp"
+
+namespace ot {
+
+/**
+ * @addtogroup core-hash-index
+ *
+ * @brief
+ *   This module includes definitions for OpenThread hash index.
+ *
+ * @{
+ *
+ */
+
+/**
+ * Represents a hash index over an array of entries (e.g., a `Pool` or a table).
+ *
+ * The index is an open addressing hash table with linear probing, with twice as many slots as entries so that probe
+ * sequences stay short. It only stores entry indexes: the caller provides the hash of an entry key when adding it, and
+ * compares the key of each candidate entry when looking up a key. An entry is removed in constant time without
+ * knowing its key, so the key of an entry can be changed by removing the entry, then adding it again.
+ *
+ * @tparam kMaxEntries  The number of entries of the indexed array (MUST be smaller than 0x7fff).
+ *
+ */
+template <uint16_t kMaxEntries> class HashIndex
+{
+public:
+    static constexpr uint16_t kNotFound = 0xffff; ///< Entry index indicating no entry.
+
+    /**
+     * Initializes the `HashIndex` as empty.
+     *
+     */
+    HashIndex(void) { Clear(); }
+
+    /**
+     * Removes all entries from the index.
+     *
+     */
+    void Clear(void)
+    {
+        ClearAllBytes(mSlots);
+
+        for (uint16_t &slot : mEntrySlots)
+        {
+            slot = kNotFound;
+        }
+    }
+
+    /**
+     * Indicates whether an entry is in the index.
+     *
+     * @param[in] aEntryIndex  The entry index.
+     *
+     * @retval TRUE   The entry is in the index.
+     * @retval FALSE  The entry is not in the index.
+     *
+     */
+    bool Contains(uint16_t aEntryIndex) const { return mEntrySlots[aEntryIndex] != kNotFound; }
+
+    /**
+     * Adds an entry to the index.
+     *
+     * The entry MUST not already be in the index.
+     *
+     * @param[in] aEntryIndex  The entry index.
+     * @param[in] aKeyHash     The hash of the entry key.
+     *
+     */
+    void Add(uint16_t aEntryIndex, uint32_t aKeyHash)
+    {
+        uint16_t slot = GetHomeSlot(aKeyHash);
+
+        mEntryHomes[aEntryIndex] = slot;
+
+        while (mSlots[slot] != kEmptySlot)
+        {
+            slot = NextSlot(slot);
+        }
+
+        mSlots[slot]             = aEntryIndex + 1;
+        mEntrySlots[aEntryIndex] = slot;
+    }
+
+    /**
+     * Removes an entry from the index.
+     *
+     * Does nothing if the entry is not in the index.
+     *
+     * @param[in] aEntryIndex  The entry index.
+     *
+     */
+    void Remove(uint16_t aEntryIndex)
+    {
+        uint16_t slot = mEntrySlots[aEntryIndex];
+        uint16_t next = slot;
+
+        VerifyOrExit(slot != kNotFound);
+        mEntrySlots[aEntryIndex] = kNotFound;
+
+        // The entries following the removed one are shifted back so that
+        // no empty slot is left between an entry and its home slot.
+
+        while (true)
+        {
+            uint16_t entryIndex;
+
+            mSlots[slot] = kEmptySlot;
+
+            do
+            {
+                next = NextSlot(next);
+                VerifyOrExit(mSlots[next] != kEmptySlot);
+                entryIndex = mSlots[next] - 1;
+            } while (Distance(mEntryHomes[entryIndex], next) < Distance(slot, next));
+
+            mSlots[slot]            = mSlots[next];
+            mEntrySlots[entryIndex] = slot;
+            slot                    = next;
+        }
+
+    exit:
+        return;
+    }
+
+    /**
+     * Gets the slot where the lookup of a key starts.
+     *
+     * The candidate entries for the key are then read with `GetNext()`:
+     *
+     *     for (uint16_t slot = index.GetHomeSlot(hash), entryIndex; (entryIndex = index.GetNext(slot)) != kNotFound;)
+     *
+     * @param[in] aKeyHash  The hash of the key.
+     *
+     * @returns The home slot of @p aKeyHash.
+     *
+     */
+    uint16_t GetHomeSlot(uint32_t aKeyHash) const
+    {
+        // Fibonacci hashing, the product is then scaled to the number of
+        // slots so that its top bits (the best mixed) select the slot.
+
+        uint32_t product = aKeyHash * 2654435769U;
+
+        return static_cast<uint16_t>((static_cast<uint64_t>(product) * kNumSlots) >> 32);
+    }
+
+    /**
+     * Gets the next candidate entry of a lookup and advances the slot.
+     *
+     * The candidates include every entry whose key has the same home slot, along with some entries with other keys.
+     *
+     * @param[in,out] aSlot  The current slot, updated to the next one.
+     *
+     * @returns The index of the candidate entry, or `kNotFound` when there are no more candidates.
+     *
+     */
+    uint16_t GetNext(uint16_t &aSlot) const
+    {
+        uint16_t entryIndex = kNotFound;
+
+        VerifyOrExit(mSlots[aSlot] != kEmptySlot);
+        entryIndex = mSlots[aSlot] - 1;
+        aSlot      = NextSlot(aSlot);
+
+    exit:
+        return entryIndex;
+    }
+
+    /**
+     * Computes a key hash from a byte sequence (e.g., an IPv6 address or an Extended Address).
+     *
+     * @param[in] aBytes   A pointer to the bytes.
+     * @param[in] aLength  The number of bytes.
+     *
+     * @returns The hash of the bytes.
+     *
+     */
+    static uint32_t HashBytes(const void *aBytes, uint16_t aLength)
+    {
+        // FNV-1a
+
+        const uint8_t *bytes = static_cast<const uint8_t *>(aBytes);
+        uint32_t       hash  = 2166136261U;
+
+        for (uint16_t i = 0; i < aLength; i++)
+        {
+            hash = (hash ^ bytes[i]) * 16777619U;
+        }
+
+        return hash;
+    }
+
+private:
+    static_assert(kMaxEntries < 0x7fff, "kMaxEntries is too large");
+
+    static constexpr uint16_t kNumSlots  = 2 * kMaxEntries;
+    static constexpr uint16_t kEmptySlot = 0;
+
+    static uint16_t NextSlot(uint16_t aSlot) { return (aSlot + 1 < kNumSlots) ? aSlot + 1 : 0; }
+
+    static uint16_t Distance(uint16_t aFrom, uint16_t aTo)
+    {
+        return (aTo >= aFrom) ? aTo - aFrom : aTo + kNumSlots - aFrom;
+    }
+
+    uint16_t mSlots[kNumSlots];        // Entry index plus one, or `kEmptySlot`.
+    uint16_t mEntrySlots[kMaxEntries]; // Slot of each entry, or `kNotFound`.
+    uint16_t mEntryHomes[kMaxEntries]; // Home slot of the key of each entry.
+};
+
+/**
+ * @}
+ *
+ */
+
+} // namespace ot
+
+#endif // HASH_INDEX_HPP_
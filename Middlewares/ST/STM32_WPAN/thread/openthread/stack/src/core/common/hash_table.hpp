@@ -0,0 +1,218 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for a generic hash table of chained entries.
+ */
+
+#ifndef HASH_TABLE_HPP_
+#define HASH_TABLE_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+
+#include "common/string.hpp"
+
+namespace ot {
+
+/**
+ * @addtogroup core-hash-table
+ *
+ * @brief
+ *   This module includes definitions for OpenThread hash table.
+ *
+ * @{
+ *
+ */
+
+/**
+ * Represents a hash table of entries which are chained through a pointer member of the entry.
+ *
+ * It is meant for entries which are allocated individually (e.g., from the heap), where a `HashIndex` over an array
+ * cannot be used. The table does not own its entries: the caller provides the hash of an entry key when adding or
+ * removing it, and compares the key of each candidate entry when looking up a key. The candidates of a key are
+ * `GetHead()` and then the entries that follow it with `GetNext()`.
+ *
+ * An entry MUST be in at most one `HashTable` using a given `kNextMember`.
+ *
+ * @tparam Type         The entry type.
+ * @tparam kNextMember  The pointer member of `Type` used to chain the entries.
+ * @tparam kNumBuckets  The number of buckets.
+ *
+ */
+template <typename Type, Type *Type::*kNextMember, uint16_t kNumBuckets> class HashTable
+{
+public:
+    /**
+     * Initializes the `HashTable` as empty.
+     *
+     */
+    HashTable(void) { Clear(); }
+
+    /**
+     * Removes all entries from the table.
+     *
+     */
+    void Clear(void)
+    {
+        for (Type *&head : mBuckets)
+        {
+            head = nullptr;
+        }
+    }
+
+    /**
+     * Adds an entry to the table.
+     *
+     * The entry MUST not already be in the table.
+     *
+     * @param[in] aEntry    The entry to add.
+     * @param[in] aKeyHash  The hash of the entry key.
+     *
+     */
+    void Add(Type &aEntry, uint32_t aKeyHash)
+    {
+        Type *&head = GetBucket(aKeyHash);
+
+        aEntry.*kNextMember = head;
+        head                = &aEntry;
+    }
+
+    /**
+     * Removes an entry from the table.
+     *
+     * Does nothing if the entry is not in the table.
+     *
+     * @param[in] aEntry    The entry to remove.
+     * @param[in] aKeyHash  The hash of the entry key, as given to `Add()`.
+     *
+     */
+    void Remove(Type &aEntry, uint32_t aKeyHash)
+    {
+        for (Type **link = &GetBucket(aKeyHash); *link != nullptr; link = &((*link)->*kNextMember))
+        {
+            if (*link == &aEntry)
+            {
+                *link               = aEntry.*kNextMember;
+                aEntry.*kNextMember = nullptr;
+                break;
+            }
+        }
+    }
+
+    /**
+     * Gets the first candidate entry for a key.
+     *
+     * The candidates include every entry with the same key, along with some entries with other keys.
+     *
+     * @param[in] aKeyHash  The hash of the key.
+     *
+     * @returns A pointer to the first candidate entry, or `nullptr` if there is none.
+     *
+     */
+    Type *GetHead(uint32_t aKeyHash) { return GetBucket(aKeyHash); }
+
+    /**
+     * Gets the first candidate entry for a key.
+     *
+     * @param[in] aKeyHash  The hash of the key.
+     *
+     * @returns A pointer to the first candidate entry, or `nullptr` if there is none.
+     *
+     */
+    const Type *GetHead(uint32_t aKeyHash) const { return mBuckets[aKeyHash % kNumBuckets]; }
+
+    /**
+     * Gets the candidate entry following a given one.
+     *
+     * @param[in] aEntry  A candidate entry.
+     *
+     * @returns A pointer to the next candidate entry, or `nullptr` if there is none.
+     *
+     */
+    static Type *GetNext(const Type &aEntry) { return aEntry.*kNextMember; }
+
+    /**
+     * Computes a key hash from a DNS name, ignoring the case of the characters.
+     *
+     * Names which match with `kStringCaseInsensitiveMatch` have the same hash.
+     *
+     * @param[in] aName  The name.
+     *
+     * @returns The hash of the name.
+     *
+     */
+    static uint32_t HashName(const char *aName) { return Hash(aName, kNullChar); }
+
+    /**
+     * Computes a key hash from the first label of a DNS name, ignoring the case of the characters.
+     *
+     * The hash covers the characters of @p aName up to its first dot '.' character, i.e., it is the `HashName()` of
+     * the first label of the name.
+     *
+     * @param[in] aName  The name.
+     *
+     * @returns The hash of the first label of the name.
+     *
+     */
+    static uint32_t HashFirstLabel(const char *aName) { return Hash(aName, kLabelSeparatorChar); }
+
+private:
+    static_assert(kNumBuckets > 0, "kNumBuckets must be non-zero");
+
+    static constexpr char kLabelSeparatorChar = '.';
+
+    static uint32_t Hash(const char *aName, char aEndChar)
+    {
+        // FNV-1a
+
+        uint32_t hash = 2166136261U;
+
+        for (; (*aName != kNullChar) && (*aName != aEndChar); aName++)
+        {
+            hash = (hash ^ static_cast<uint8_t>(ToLowercase(*aName))) * 16777619U;
+        }
+
+        return hash;
+    }
+
+    Type *&GetBucket(uint32_t aKeyHash) { return mBuckets[aKeyHash % kNumBuckets]; }
+
+    Type *mBuckets[kNumBuckets];
+};
+
+/**
+ * @}
+ *
+ */
+
+} // namespace ot
+
+#endif // HASH_TABLE_HPP_
@@ -58,10 +58,38 @@ RegisterLogModule("Message");
 //---------------------------------------------------------------------------------------------------------------------
 // MessagePool
 
+static_assert(Message::kNumPriorities == OT_MESSAGE_NUM_PRIORITY_LEVELS,
+              "OT_MESSAGE_NUM_PRIORITY_LEVELS does not match Message::kNumPriorities");
+
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_QUOTA_ENABLE
+
+static_assert((OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_BUFFERS_LOW +
+               OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_BUFFERS_NORMAL +
+               OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_BUFFERS_HIGH +
+               OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_BUFFERS_NET) <= kNumBuffers,
+              "The message buffers reserved for the priority levels exceed OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS");
+
+const uint16_t MessagePool::kReservedBuffers[Message::kNumPriorities] = {
+    OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_BUFFERS_LOW,    // kPriorityLow
+    OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_BUFFERS_NORMAL, // kPriorityNormal
+    OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_BUFFERS_HIGH,   // kPriorityHigh
+    OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_BUFFERS_NET,    // kPriorityNet
+};
+
+const uint16_t MessagePool::kMaxBuffers[Message::kNumPriorities] = {
+    OPENTHREAD_CONFIG_MESSAGE_POOL_MAX_BUFFERS_LOW,    // kPriorityLow
+    OPENTHREAD_CONFIG_MESSAGE_POOL_MAX_BUFFERS_NORMAL, // kPriorityNormal
+    OPENTHREAD_CONFIG_MESSAGE_POOL_MAX_BUFFERS_HIGH,   // kPriorityHigh
+    OPENTHREAD_CONFIG_MESSAGE_POOL_MAX_BUFFERS_NET,    // kPriorityNet
+};
+
+#endif
+
 MessagePool::MessagePool(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mNumAllocated(0)
     , mMaxAllocated(0)
+    , mPriorityInfo()
 {
 #if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
     otPlatMessagePoolInit(&GetInstance(), kNumBuffers, sizeof(Buffer));
@@ -70,20 +98,23 @@ MessagePool::MessagePool(Instance &aInstance)
 
 Message *MessagePool::Allocate(Message::Type aType, uint16_t aReserveHeader, const Message::Settings &aSettings)
 {
-    Error    error = kErrorNone;
-    Message *message;
+    Error    error   = kErrorNone;
+    Message *message = nullptr;
 
+    VerifyOrExit(aSettings.GetPriority() < Message::kNumPriorities);
     VerifyOrExit((message = static_cast<Message *>(NewBuffer(aSettings.GetPriority()))) != nullptr);
 
     ClearAllBytes(*message);
-    message->SetMessagePool(this);
     message->SetType(aType);
     message->SetReserved(aReserveHeader);
     message->SetLinkSecurityEnabled(aSettings.IsLinkSecurityEnabled());
     message->SetLoopbackToHostAllowed(OPENTHREAD_CONFIG_IP6_ALLOW_LOOP_BACK_HOST_DATAGRAMS);
     message->SetOrigin(Message::kOriginHostTrusted);
 
+    // The head buffer is already accounted to the message priority,
+    // so the priority is set before the message pool.
     SuccessOrExit(error = message->SetPriority(aSettings.GetPriority()));
+    message->SetMessagePool(this);
     SuccessOrExit(error = message->SetLength(0));
 
 exit:
@@ -107,12 +138,22 @@ void MessagePool::Free(Message *aMessage)
 {
     OT_ASSERT(aMessage->Next() == nullptr && aMessage->Prev() == nullptr);
 
-    FreeBuffers(static_cast<Buffer *>(aMessage));
+    FreeBuffers(static_cast<Buffer *>(aMessage), aMessage->GetPriority());
 }
 
 Buffer *MessagePool::NewBuffer(Message::Priority aPriority)
 {
-    Buffer *buffer = nullptr;
+    Buffer                *buffer       = nullptr;
+    otMessagePriorityInfo &priorityInfo = mPriorityInfo[aPriority];
+
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_QUOTA_ENABLE
+    VerifyOrExit(priorityInfo.mUsedBuffers < kMaxBuffers[aPriority]);
+
+    while (!HasAvailableBuffer(aPriority))
+    {
+        SuccessOrExit(ReclaimBuffers(aPriority));
+    }
+#endif
 
     while ((
 #if OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
@@ -130,18 +171,22 @@ Buffer *MessagePool::NewBuffer(Message::Priority aPriority)
     mNumAllocated++;
     mMaxAllocated = Max(mMaxAllocated, mNumAllocated);
 
+    priorityInfo.mUsedBuffers++;
+    priorityInfo.mMaxUsedBuffers = Max(priorityInfo.mMaxUsedBuffers, priorityInfo.mUsedBuffers);
+
     buffer->SetNextBuffer(nullptr);
 
 exit:
     if (buffer == nullptr)
     {
+        priorityInfo.mNumDrops++;
         LogInfo("No available message buffer");
     }
 
     return buffer;
 }
 
-void MessagePool::FreeBuffers(Buffer *aBuffer)
+void MessagePool::FreeBuffers(Buffer *aBuffer, Message::Priority aPriority)
 {
     while (aBuffer != nullptr)
     {
@@ -154,6 +199,7 @@ void MessagePool::FreeBuffers(Buffer *aBuffer)
         mBufferPool.Free(*aBuffer);
 #endif
         mNumAllocated--;
+        mPriorityInfo[aPriority].mUsedBuffers--;
 
         aBuffer = next;
     }
@@ -161,6 +207,76 @@ void MessagePool::FreeBuffers(Buffer *aBuffer)
 
 Error MessagePool::ReclaimBuffers(Message::Priority aPriority) { return Get<MeshForwarder>().EvictMessage(aPriority); }
 
+void MessagePool::ChangePriority(Message::Priority aOldPriority, Message::Priority aNewPriority, uint16_t aNumBuffers)
+{
+    otMessagePriorityInfo &newInfo = mPriorityInfo[aNewPriority];
+
+    mPriorityInfo[aOldPriority].mUsedBuffers -= aNumBuffers;
+    newInfo.mUsedBuffers += aNumBuffers;
+    newInfo.mMaxUsedBuffers = Max(newInfo.mMaxUsedBuffers, newInfo.mUsedBuffers);
+}
+
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_QUOTA_ENABLE
+
+bool MessagePool::HasAvailableBuffer(Message::Priority aPriority) const
+{
+    // A priority level first uses the buffers reserved for it, then
+    // the buffers that are not reserved for any level.
+
+    bool     available;
+    uint16_t numShared     = kNumBuffers;
+    uint16_t numSharedUsed = 0;
+
+    VerifyOrExit(mPriorityInfo[aPriority].mUsedBuffers >= kReservedBuffers[aPriority], available = true);
+
+    for (uint8_t priority = 0; priority < Message::kNumPriorities; priority++)
+    {
+        numShared -= kReservedBuffers[priority];
+
+        if (mPriorityInfo[priority].mUsedBuffers > kReservedBuffers[priority])
+        {
+            numSharedUsed += mPriorityInfo[priority].mUsedBuffers - kReservedBuffers[priority];
+        }
+    }
+
+    available = (numSharedUsed < numShared);
+
+exit:
+    return available;
+}
+
+#endif // OPENTHREAD_CONFIG_MESSAGE_POOL_QUOTA_ENABLE
+
+Error MessagePool::CheckAdmission(const Message &aMessage)
+{
+    Error error = kErrorNone;
+
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_QUOTA_ENABLE
+    Message::Priority priority = aMessage.GetPriority();
+
+    if (mPriorityInfo[priority].mUsedBuffers > kMaxBuffers[priority])
+    {
+        mPriorityInfo[priority].mNumDrops++;
+        error = kErrorNoBufs;
+    }
+#else
+    OT_UNUSED_VARIABLE(aMessage);
+#endif
+
+    return error;
+}
+
+void MessagePool::ResetMaxUsedBufferCount(void)
+{
+    mMaxAllocated = mNumAllocated;
+
+    for (otMessagePriorityInfo &priorityInfo : mPriorityInfo)
+    {
+        priorityInfo.mMaxUsedBuffers = priorityInfo.mUsedBuffers;
+        priorityInfo.mNumDrops       = 0;
+    }
+}
+
 uint16_t MessagePool::GetFreeBufferCount(void) const
 {
     uint16_t rval;
@@ -251,7 +367,7 @@ Error Message::ResizeMessage(uint16_t aLength)
     curBuffer  = curBuffer->GetNextBuffer();
     lastBuffer->SetNextBuffer(nullptr);
 
-    GetMessagePool()->FreeBuffers(curBuffer);
+    GetMessagePool()->FreeBuffers(curBuffer, GetPriority());
 
 exit:
     return error;
@@ -361,9 +477,14 @@ Error Message::SetPriority(Priority aPriority)
     static_assert(kNumPriorities <= 4, "`Metadata::mPriority` as a 2-bit field cannot fit all `Priority` values");
 
     VerifyOrExit(priority < kNumPriorities, error = kErrorInvalidArgs);
+    VerifyOrExit(GetMetadata().mPriority != priority);
+
+    if (GetMessagePool() != nullptr)
+    {
+        GetMessagePool()->ChangePriority(GetPriority(), aPriority, GetBufferCount());
+    }
 
     VerifyOrExit(IsInAQueue(), GetMetadata().mPriority = priority);
-    VerifyOrExit(GetMetadata().mPriority != priority);
 
     priorityQueue = GetPriorityQueue();
 
@@ -654,6 +775,34 @@ Error Message::Read(uint16_t aOffset, void *aBuf, uint16_t aLength) const
     return (ReadBytes(aOffset, aBuf, aLength) == aLength) ? kErrorNone : kErrorParse;
 }
 
+const void *Message::ReadInPlace(uint16_t aOffset, void *aBuf, uint16_t aLength) const
+{
+    const void *bytes  = nullptr;
+    uint8_t    *bufPtr = reinterpret_cast<uint8_t *>(aBuf);
+    uint16_t    length = aLength;
+    Chunk       chunk;
+
+    GetFirstChunk(aOffset, length, chunk);
+
+    // When the first chunk holds all the bytes, they are read in
+    // place. Otherwise they are copied to `aBuf` as in `ReadBytes()`.
+
+    VerifyOrExit((aLength == 0) || (chunk.GetLength() != aLength), bytes = chunk.GetBytes());
+
+    while (chunk.GetLength() > 0)
+    {
+        chunk.CopyBytesTo(bufPtr);
+        bufPtr += chunk.GetLength();
+        GetNextChunk(length, chunk);
+    }
+
+    VerifyOrExit(bufPtr == reinterpret_cast<uint8_t *>(aBuf) + aLength);
+    bytes = aBuf;
+
+exit:
+    return bytes;
+}
+
 bool Message::CompareBytes(uint16_t aOffset, const void *aBuf, uint16_t aLength, ByteMatcher aMatcher) const
 {
     uint16_t       bytesToCompare = aLength;
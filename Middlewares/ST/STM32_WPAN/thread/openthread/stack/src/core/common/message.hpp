@@ -266,15 +266,14 @@ static_assert(sizeof(Buffer) >= kBufferSize,
  */
 class Message : public otMessage, public Buffer, public GetProvider<Message>
 {
-    friend class Checksum;
-    friend class Crypto::HmacSha256;
-    friend class Crypto::Sha256;
     friend class Crypto::AesCcm;
     friend class MessagePool;
     friend class MessageQueue;
     friend class PriorityQueue;
 
 public:
+    class ChunkIterator; // Defined after `Message`.
+
     /**
      * Represents the message type.
      *
@@ -796,6 +795,48 @@ public:
         return Read(aOffset, &aObject, sizeof(ObjectType));
     }
 
+    /**
+     * Reads bytes from the message in place, without copying them when possible.
+     *
+     * When the @p aLength bytes at @p aOffset are contiguous in one message buffer, a pointer to them in the buffer is
+     * returned. Otherwise the bytes are copied into @p aBuf, and @p aBuf is returned.
+     *
+     * The returned pointer is only valid until the message is modified or freed.
+     *
+     * @param[in]  aOffset  Byte offset within the message to begin reading.
+     * @param[out] aBuf     A pointer to a data buffer the bytes are copied into when they are not contiguous.
+     * @param[in]  aLength  Number of bytes to read.
+     *
+     * @returns A pointer to the @p aLength bytes read, or `nullptr` if there are fewer bytes in the message.
+     *
+     */
+    const void *ReadInPlace(uint16_t aOffset, void *aBuf, uint16_t aLength) const;
+
+    /**
+     * Reads an object from the message in place, without copying it when possible.
+     *
+     * When the object is contiguous in one message buffer, a pointer to it in the buffer is returned. Otherwise it is
+     * copied into @p aObject, and a pointer to @p aObject is returned. The object type must be packed, so that it can
+     * be accessed at any address.
+     *
+     * The returned pointer is only valid until the message is modified or freed.
+     *
+     * @tparam     ObjectType   The object type to read from the message.
+     *
+     * @param[in]  aOffset      Byte offset within the message to begin reading.
+     * @param[out] aObject      A reference to the object the bytes are copied into when they are not contiguous.
+     *
+     * @returns A pointer to the object read, or `nullptr` if there are fewer bytes in the message than the object size.
+     *
+     */
+    template <typename ObjectType> const ObjectType *ReadInPlace(uint16_t aOffset, ObjectType &aObject) const
+    {
+        static_assert(!TypeTraits::IsPointer<ObjectType>::kValue, "ObjectType must not be a pointer");
+        static_assert(alignof(ObjectType) == 1, "ObjectType must be packed to be read in place");
+
+        return static_cast<const ObjectType *>(ReadInPlace(aOffset, &aObject, sizeof(ObjectType)));
+    }
+
     /**
      * Compares the bytes in the message at a given offset with a given byte array.
      *
@@ -1545,6 +1586,77 @@ private:
     Error ResizeMessage(uint16_t aLength);
 };
 
+/**
+ * Iterates over the bytes of a message range, as contiguous chunks in the message buffers.
+ *
+ * Gives read-only access to the message bytes without copying them, e.g., to feed them to a checksum or a hash, or
+ * to parse them in place.
+ *
+ * Usage example:
+ *
+ *     for (Message::ChunkIterator it(aMessage, aOffset, aLength); !it.IsDone(); it.Advance())
+ *     {
+ *         Process(it.GetBytes(), it.GetLength());
+ *     }
+ *
+ */
+class Message::ChunkIterator
+{
+public:
+    /**
+     * Initializes the iterator at the first chunk of a message range.
+     *
+     * The range is truncated at the end of the message.
+     *
+     * @param[in] aMessage  The message.
+     * @param[in] aOffset   The byte offset of the range in @p aMessage.
+     * @param[in] aLength   The number of bytes of the range.
+     *
+     */
+    ChunkIterator(const Message &aMessage, uint16_t aOffset, uint16_t aLength)
+        : mMessage(aMessage)
+        , mLength(aLength)
+    {
+        mMessage.GetFirstChunk(aOffset, mLength, mChunk);
+    }
+
+    /**
+     * Indicates whether the iterator has gone past the last chunk of the range.
+     *
+     * @retval TRUE   There is no more chunk.
+     * @retval FALSE  The iterator is at a chunk.
+     *
+     */
+    bool IsDone(void) const { return (mChunk.GetLength() == 0); }
+
+    /**
+     * Gets a pointer to the bytes of the current chunk.
+     *
+     * @returns A pointer to the bytes of the current chunk.
+     *
+     */
+    const uint8_t *GetBytes(void) const { return mChunk.GetBytes(); }
+
+    /**
+     * Gets the number of bytes of the current chunk.
+     *
+     * @returns The number of bytes of the current chunk, zero when `IsDone()`.
+     *
+     */
+    uint16_t GetLength(void) const { return mChunk.GetLength(); }
+
+    /**
+     * Advances the iterator to the next chunk of the range.
+     *
+     */
+    void Advance(void) { mMessage.GetNextChunk(mLength, mChunk); }
+
+private:
+    const Message &mMessage;
+    uint16_t       mLength;
+    Chunk          mChunk;
+};
+
 /**
  * Implements a message queue.
  *
@@ -1890,23 +2002,58 @@ public:
     uint16_t GetMaxUsedBufferCount(void) const { return mMaxAllocated; }
 
     /**
-     * Resets the tracked maximum number of buffers in use.
+     * Resets the tracked maximum number of buffers in use, and the maximum number of buffers in use and the number of
+     * drops of each message priority level.
      *
      * @sa GetMaxUsedBufferCount
+     * @sa GetPriorityInfo
+     *
+     */
+    void ResetMaxUsedBufferCount(void);
+
+    /**
+     * Returns the buffer usage of a given message priority level.
+     *
+     * @param[in]  aPriority  The message priority level.
+     *
+     * @returns The buffer usage of @p aPriority.
+     *
+     */
+    const otMessagePriorityInfo &GetPriorityInfo(Message::Priority aPriority) const { return mPriorityInfo[aPriority]; }
+
+    /**
+     * Checks whether a message is admitted for transmission.
+     *
+     * The priority of a message may be changed after its buffers are allocated, so the quota of its priority level
+     * is checked again before the message is queued for transmission. A denied message is counted as a drop of its
+     * priority level.
+     *
+     * @param[in]  aMessage  The message to check.
+     *
+     * @retval kErrorNone    The message is admitted.
+     * @retval kErrorNoBufs  The priority level of @p aMessage uses more buffers than its quota.
      *
      */
-    void ResetMaxUsedBufferCount(void) { mMaxAllocated = mNumAllocated; }
+    Error CheckAdmission(const Message &aMessage);
 
 private:
     Buffer *NewBuffer(Message::Priority aPriority);
-    void    FreeBuffers(Buffer *aBuffer);
+    void    FreeBuffers(Buffer *aBuffer, Message::Priority aPriority);
     Error   ReclaimBuffers(Message::Priority aPriority);
+    void    ChangePriority(Message::Priority aOldPriority, Message::Priority aNewPriority, uint16_t aNumBuffers);
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_QUOTA_ENABLE
+    bool HasAvailableBuffer(Message::Priority aPriority) const;
+
+    static const uint16_t kReservedBuffers[Message::kNumPriorities];
+    static const uint16_t kMaxBuffers[Message::kNumPriorities];
+#endif
 
 #if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
     Pool<Buffer, kNumBuffers> mBufferPool;
 #endif
-    uint16_t mNumAllocated;
-    uint16_t mMaxAllocated;
+    uint16_t              mNumAllocated;
+    uint16_t              mMaxAllocated;
+    otMessagePriorityInfo mPriorityInfo[Message::kNumPriorities];
 };
 
 inline Instance &Message::GetInstance(void) const { return GetMessagePool()->GetInstance(); }
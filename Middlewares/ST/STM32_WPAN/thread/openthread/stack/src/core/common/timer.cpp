@@ -34,6 +34,7 @@
 #include "timer.hpp"
 
 #include "common/as_core_type.hpp"
+#include "common/clearable.hpp"
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "common/locator_getters.hpp"
@@ -148,6 +149,405 @@ void TimerMilli::RemoveAll(Instance &aInstance) { aInstance.Get<Scheduler>().Rem
 //---------------------------------------------------------------------------------------------------------------------
 // `Timer::Scheduler`
 
+#if OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+
+void Timer::Scheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
+{
+    Time now(aAlarmApi.AlarmGetNow());
+    bool wasInNextSlot = false;
+
+    if (aTimer.IsRunning())
+    {
+        wasInNextSlot = IsInNextSlot(aTimer);
+        Unlink(aTimer);
+    }
+
+    Advance(now);
+    Place(aTimer);
+
+    // The alarm is re-programmed when the timer fires before it, or
+    // when a restarted timer may be the one it was set for (its
+    // previous fire time is no longer known).
+
+    if (!mAlarmArmed || (GetRemaining(aTimer.mFireTime, now) < GetRemaining(mAlarmTime, now)))
+    {
+        StartAlarm(aTimer.mFireTime, now, aAlarmApi);
+    }
+    else if (wasInNextSlot)
+    {
+        SetAlarm(aAlarmApi);
+    }
+}
+
+void Timer::Scheduler::Remove(Timer &aTimer, const AlarmApi &aAlarmApi)
+{
+    VerifyOrExit(aTimer.IsRunning());
+
+    Unlink(aTimer);
+
+    // The alarm is re-programmed when it was set for the removed
+    // timer, so that it does not fire early, or stopped when no timer
+    // remains. Otherwise it is already set for the next timer.
+
+    if (mAlarmArmed && ((aTimer.mFireTime == mAlarmTime) || IsEmpty()))
+    {
+        SetAlarm(aAlarmApi);
+    }
+
+exit:
+    return;
+}
+
+void Timer::Scheduler::SetAlarm(const AlarmApi &aAlarmApi)
+{
+    Time fireTime;
+
+    if (!GetNextFireTime(fireTime))
+    {
+        aAlarmApi.AlarmStop(&GetInstance());
+        mAlarmArmed = false;
+    }
+    else if (!mAlarmArmed || (fireTime != mAlarmTime))
+    {
+        StartAlarm(fireTime, Time(aAlarmApi.AlarmGetNow()), aAlarmApi);
+    }
+}
+
+void Timer::Scheduler::StartAlarm(Time aFireTime, Time aNow, const AlarmApi &aAlarmApi)
+{
+    aAlarmApi.AlarmStartAt(&GetInstance(), aNow.GetValue(), GetRemaining(aFireTime, aNow));
+    mAlarmTime  = aFireTime;
+    mAlarmArmed = true;
+}
+
+void Timer::Scheduler::ProcessTimers(const AlarmApi &aAlarmApi)
+{
+    Timer *timer;
+
+    mAlarmArmed = false;
+    Advance(Time(aAlarmApi.AlarmGetNow()));
+
+    timer = mSlots[kDueSlot];
+
+    if (timer != nullptr)
+    {
+        Unlink(*timer);
+        SetAlarm(aAlarmApi);
+        timer->Fired();
+        ExitNow();
+    }
+
+    SetAlarm(aAlarmApi);
+
+exit:
+    return;
+}
+
+void Timer::Scheduler::RemoveAll(const AlarmApi &aAlarmApi)
+{
+    for (Timer *&head : mSlots)
+    {
+        while (head != nullptr)
+        {
+            Timer *timer = head;
+
+            head = timer->mNext;
+            timer->SetNext(timer);
+        }
+    }
+
+    ClearAllBytes(mOccupied);
+
+    aAlarmApi.AlarmStop(&GetInstance());
+    mAlarmArmed = false;
+}
+
+bool Timer::Scheduler::IsEmpty(void) const
+{
+    bool isEmpty = (mSlots[kDueSlot] == nullptr);
+
+    for (uint16_t occupied : mOccupied)
+    {
+        isEmpty = isEmpty && (occupied == 0);
+    }
+
+    return isEmpty;
+}
+
+void Timer::Scheduler::Place(Timer &aTimer)
+{
+    uint32_t fireTime = aTimer.mFireTime.GetValue();
+    uint32_t diff     = fireTime ^ mCurrent.GetValue();
+    uint8_t  level    = kNumLevels - 1;
+    uint8_t  index;
+
+    if (aTimer.mFireTime <= mCurrent)
+    {
+        InsertDue(aTimer);
+        ExitNow();
+    }
+
+    while ((diff >> (level * kLevelBits)) == 0)
+    {
+        level--;
+    }
+
+    index = (fireTime >> (level * kLevelBits)) & (kSlotsPerLevel - 1);
+
+    PushToSlot(aTimer, level * kSlotsPerLevel + index);
+    mOccupied[level] |= (1U << index);
+
+exit:
+    return;
+}
+
+void Timer::Scheduler::PushToSlot(Timer &aTimer, uint16_t aSlot)
+{
+    // The slot lists are singly linked forward from the head with
+    // `mNext`, and backward with `mPrev` where the head `mPrev`
+    // points to the tail, so a timer is appended or removed in O(1).
+
+    Timer *&head = mSlots[aSlot];
+
+    aTimer.mNext = nullptr;
+    aTimer.mSlot = aSlot;
+
+    if (head == nullptr)
+    {
+        aTimer.mPrev = &aTimer;
+        head         = &aTimer;
+    }
+    else
+    {
+        aTimer.mPrev       = head->mPrev;
+        head->mPrev->mNext = &aTimer;
+        head->mPrev        = &aTimer;
+    }
+}
+
+void Timer::Scheduler::InsertDue(Timer &aTimer)
+{
+    // The due timers are sorted by fire time, a timer is inserted
+    // after the ones with the same fire time. The list is searched
+    // from the tail since timers are mostly due in the order they
+    // are placed.
+
+    Timer *&head = mSlots[kDueSlot];
+    Timer  *prev = (head != nullptr) ? head->mPrev : nullptr;
+
+    while ((prev != nullptr) && (aTimer.mFireTime < prev->mFireTime))
+    {
+        prev = (prev == head) ? nullptr : prev->mPrev;
+    }
+
+    if (prev == nullptr)
+    {
+        aTimer.mNext = head;
+        aTimer.mSlot = kDueSlot;
+
+        if (head == nullptr)
+        {
+            aTimer.mPrev = &aTimer;
+        }
+        else
+        {
+            aTimer.mPrev = head->mPrev;
+            head->mPrev  = &aTimer;
+        }
+
+        head = &aTimer;
+    }
+    else if (prev->mNext == nullptr)
+    {
+        PushToSlot(aTimer, kDueSlot);
+    }
+    else
+    {
+        aTimer.mNext       = prev->mNext;
+        aTimer.mPrev       = prev;
+        aTimer.mSlot       = kDueSlot;
+        prev->mNext->mPrev = &aTimer;
+        prev->mNext        = &aTimer;
+    }
+}
+
+void Timer::Scheduler::Unlink(Timer &aTimer)
+{
+    uint16_t slot = aTimer.mSlot;
+    Timer  *&head = mSlots[slot];
+
+    if (head == &aTimer)
+    {
+        head = aTimer.mNext;
+
+        if (head != nullptr)
+        {
+            head->mPrev = aTimer.mPrev;
+        }
+    }
+    else
+    {
+        aTimer.mPrev->mNext = aTimer.mNext;
+
+        if (aTimer.mNext != nullptr)
+        {
+            aTimer.mNext->mPrev = aTimer.mPrev;
+        }
+        else
+        {
+            head->mPrev = aTimer.mPrev;
+        }
+    }
+
+    if ((head == nullptr) && (slot != kDueSlot))
+    {
+        mOccupied[slot / kSlotsPerLevel] &= ~(1U << (slot % kSlotsPerLevel));
+    }
+
+    aTimer.SetNext(&aTimer);
+}
+
+bool Timer::Scheduler::FindNextSlot(uint16_t &aSlot) const
+{
+    // Finds the first occupied slot after `mCurrent` at the lowest
+    // level, it holds the next timers to fire. Only the last level
+    // wraps around, at the other levels the occupied slots are all
+    // after the slot of `mCurrent`.
+
+    bool found = false;
+
+    for (uint8_t level = 0; !found && (level < kNumLevels); level++)
+    {
+        uint8_t index = (mCurrent.GetValue() >> (level * kLevelBits)) & (kSlotsPerLevel - 1);
+
+        if (mOccupied[level] == 0)
+        {
+            continue;
+        }
+
+        for (uint8_t i = 1; i < kSlotsPerLevel; i++)
+        {
+            index = (index + 1) & (kSlotsPerLevel - 1);
+
+            if (mOccupied[level] & (1U << index))
+            {
+                aSlot = level * kSlotsPerLevel + index;
+                found = true;
+                break;
+            }
+        }
+    }
+
+    return found;
+}
+
+bool Timer::Scheduler::IsInNextSlot(const Timer &aTimer) const
+{
+    // Indicates whether a running timer is in the due list or in the
+    // slot that holds the next timers to fire.
+
+    bool     rval;
+    uint16_t slot;
+
+    if (mSlots[kDueSlot] != nullptr)
+    {
+        rval = (aTimer.mSlot == kDueSlot);
+    }
+    else
+    {
+        rval = FindNextSlot(slot) && (aTimer.mSlot == slot);
+    }
+
+    return rval;
+}
+
+Time Timer::Scheduler::GetSlotStart(uint16_t aSlot) const
+{
+    uint8_t  level = aSlot / kSlotsPerLevel;
+    uint8_t  shift = level * kLevelBits;
+    uint32_t start = (aSlot % kSlotsPerLevel);
+
+    start <<= shift;
+
+    if (level < kNumLevels - 1)
+    {
+        start |= mCurrent.GetValue() & ~((1UL << (shift + kLevelBits)) - 1);
+    }
+
+    return Time(start);
+}
+
+bool Timer::Scheduler::GetNextFireTime(Time &aFireTime) const
+{
+    bool     found = true;
+    uint16_t slot;
+
+    if (mSlots[kDueSlot] != nullptr)
+    {
+        aFireTime = mSlots[kDueSlot]->mFireTime;
+        ExitNow();
+    }
+
+    VerifyOrExit(FindNextSlot(slot), found = false);
+
+    // The timers of a first level slot all fire at the slot start,
+    // at the upper levels the earliest one is searched.
+
+    aFireTime = GetSlotStart(slot);
+    VerifyOrExit(slot >= kSlotsPerLevel);
+
+    aFireTime = mSlots[slot]->mFireTime;
+
+    for (const Timer *timer = mSlots[slot]->mNext; timer != nullptr; timer = timer->mNext)
+    {
+        if (timer->mFireTime < aFireTime)
+        {
+            aFireTime = timer->mFireTime;
+        }
+    }
+
+exit:
+    return found;
+}
+
+void Timer::Scheduler::Advance(Time aNow)
+{
+    // Moves the wheel time up to `aNow`, going through the occupied
+    // slots on the way. The timers of each slot are placed again from
+    // the slot start, which moves them to a lower level or to the due
+    // list.
+
+    uint16_t slot;
+
+    while (FindNextSlot(slot))
+    {
+        Time   start = GetSlotStart(slot);
+        Timer *timer = mSlots[slot];
+
+        VerifyOrExit((start - mCurrent) <= (aNow - mCurrent));
+
+        mCurrent     = start;
+        mSlots[slot] = nullptr;
+        mOccupied[slot / kSlotsPerLevel] &= ~(1U << (slot % kSlotsPerLevel));
+
+        while (timer != nullptr)
+        {
+            Timer *next = timer->mNext;
+
+            Place(*timer);
+            timer = next;
+        }
+    }
+
+exit:
+    if (IsEmpty() || (mCurrent < aNow))
+    {
+        mCurrent = aNow;
+    }
+}
+
+#else // OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+
 void Timer::Scheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
 {
     Timer *prev = nullptr;
@@ -248,6 +648,8 @@ void Timer::Scheduler::RemoveAll(const AlarmApi &aAlarmApi)
     SetAlarm(aAlarmApi);
 }
 
+#endif // OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+
 extern "C" void otPlatAlarmMilliFired(otInstance *aInstance)
 {
     VerifyOrExit(otInstanceIsInitialized(aInstance));
@@ -36,6 +36,7 @@
 
 #include "openthread-core-config.h"
 
+#include <limits.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -178,10 +179,22 @@ protected:
             uint32_t (*AlarmGetNow)(void);
         };
 
+#if OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
         explicit Scheduler(Instance &aInstance)
             : InstanceLocator(aInstance)
+            , mSlots()
+            , mOccupied()
+            , mCurrent(0)
+            , mAlarmTime(0)
+            , mAlarmArmed(false)
         {
         }
+#else
+        explicit Scheduler(Instance &aInstance)
+            : InstanceLocator(aInstance)
+        {
+        }
+#endif
 
         void Add(Timer &aTimer, const AlarmApi &aAlarmApi);
         void Remove(Timer &aTimer, const AlarmApi &aAlarmApi);
@@ -189,7 +202,44 @@ protected:
         void ProcessTimers(const AlarmApi &aAlarmApi);
         void SetAlarm(const AlarmApi &aAlarmApi);
 
+#if OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+        // The timers are kept in a hierarchical timing wheel of
+        // `kNumLevels` levels of `kSlotsPerLevel` slots. A timer is
+        // placed at the level of the highest bit in which its fire time
+        // differs from the wheel time `mCurrent`, in the slot given by
+        // its fire time bits at that level. When `mCurrent` reaches the
+        // start of a slot, the timers of the slot are moved to a lower
+        // level, or to the due list once their fire time is reached.
+        // The due list is sorted by fire time and is always ahead of
+        // the timers in the wheel.
+
+        static constexpr uint8_t  kLevelBits     = 4;
+        static constexpr uint8_t  kSlotsPerLevel = (1 << kLevelBits);
+        static constexpr uint8_t  kNumLevels     = (sizeof(uint32_t) * CHAR_BIT) / kLevelBits;
+        static constexpr uint16_t kDueSlot       = kNumLevels * kSlotsPerLevel;
+
+        void Place(Timer &aTimer);
+        void PushToSlot(Timer &aTimer, uint16_t aSlot);
+        void InsertDue(Timer &aTimer);
+        void Unlink(Timer &aTimer);
+        void Advance(Time aNow);
+        bool FindNextSlot(uint16_t &aSlot) const;
+        bool IsInNextSlot(const Timer &aTimer) const;
+        Time GetSlotStart(uint16_t aSlot) const;
+        bool GetNextFireTime(Time &aFireTime) const;
+        void StartAlarm(Time aFireTime, Time aNow, const AlarmApi &aAlarmApi);
+        bool IsEmpty(void) const;
+
+        static uint32_t GetRemaining(Time aFireTime, Time aNow) { return (aNow < aFireTime) ? (aFireTime - aNow) : 0; }
+
+        Timer   *mSlots[kDueSlot + 1];
+        uint16_t mOccupied[kNumLevels];
+        Time     mCurrent;
+        Time     mAlarmTime;
+        bool     mAlarmArmed;
+#else
         LinkedList<Timer> mTimerList;
+#endif
     };
 
     Timer(Instance &aInstance, Handler aHandler)
@@ -205,6 +255,10 @@ protected:
     Handler mHandler;
     Time    mFireTime;
     Timer  *mNext;
+#if OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+    Timer   *mPrev; // Tail of the slot list for its head timer.
+    uint16_t mSlot;
+#endif
 };
 
 extern "C" void otPlatAlarmMilliFired(otInstance *aInstance);
@@ -120,25 +120,29 @@ Error Tlv::ParsedInfo::ParseFrom(const Message &aMessage, uint16_t aOffset)
     // from `aMessage`.  Returns `kErrorNone` when successfully parsed,
     // otherwise `kErrorParse`.
 
-    Error       error;
-    Tlv         tlv;
-    ExtendedTlv extTlv;
-    uint16_t    headerSize;
+    Error              error = kErrorParse;
+    Tlv                tlvCopy;
+    ExtendedTlv        extTlvCopy;
+    const Tlv         *tlv;
+    const ExtendedTlv *extTlv;
+    uint16_t           headerSize;
 
-    SuccessOrExit(error = aMessage.Read(aOffset, tlv));
+    tlv = aMessage.ReadInPlace(aOffset, tlvCopy);
+    VerifyOrExit(tlv != nullptr);
 
-    if (!tlv.IsExtended())
+    if (!tlv->IsExtended())
     {
-        mType      = tlv.GetType();
-        mLength    = tlv.GetLength();
+        mType      = tlv->GetType();
+        mLength    = tlv->GetLength();
         headerSize = sizeof(Tlv);
     }
     else
     {
-        SuccessOrExit(error = aMessage.Read(aOffset, extTlv));
+        extTlv = aMessage.ReadInPlace(aOffset, extTlvCopy);
+        VerifyOrExit(extTlv != nullptr);
 
-        mType      = extTlv.GetType();
-        mLength    = extTlv.GetLength();
+        mType      = extTlv->GetType();
+        mLength    = extTlv->GetLength();
         headerSize = sizeof(ExtendedTlv);
     }
 
@@ -147,16 +151,17 @@ Error Tlv::ParsedInfo::ParseFrom(const Message &aMessage, uint16_t aOffset)
     // remaining length as `aMessage.GetLength() - aOffset - headerSize`
     // cannot underflow.
 
-    VerifyOrExit(mLength <= aMessage.GetLength() - aOffset - headerSize, error = kErrorParse);
+    VerifyOrExit(mLength <= aMessage.GetLength() - aOffset - headerSize);
 
     // Now that we know the entire TLV is contained within the
     // `aMessage`, we can safely calculate `mValueOffset` and `mSize`
     // as `uint16_t` and know that there will be no overflow.
 
-    mType        = tlv.GetType();
+    mType        = tlv->GetType();
     mOffset      = aOffset;
     mValueOffset = aOffset + headerSize;
     mSize        = mLength + headerSize;
+    error        = kErrorNone;
 
 exit:
     return error;
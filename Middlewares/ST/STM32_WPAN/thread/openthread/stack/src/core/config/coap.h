@@ -57,6 +57,20 @@
 #define OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES_SIZE
+ *
+ * Maximum size in bytes of the message buffers used by the cached responses for CoAP Confirmable messages.
+ *
+ * When a new response does not fit, the cached responses closest to the end of their lifetime are removed first. A
+ * response larger than this size is not cached.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES_SIZE
+#define OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES_SIZE \
+    (OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES * 2 * OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE)
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_COAP_API_ENABLE
  *
@@ -102,6 +102,20 @@
 #define OPENTHREAD_CONFIG_MULTICAST_DNS_DEFAULT_QUESTION_UNICAST_ALLOWED 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MULTICAST_DNS_NAME_TABLE_SIZE
+ *
+ * Specifies the number of buckets of the hash tables used by mDNS core to look up registered host and service entries
+ * and cache entries (browsers and resolvers) by name.
+ *
+ * Each table takes one pointer per bucket. Lookups stay short as long as the number of entries does not exceed a few
+ * times this value.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MULTICAST_DNS_NAME_TABLE_SIZE
+#define OPENTHREAD_CONFIG_MULTICAST_DNS_NAME_TABLE_SIZE 32
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MULTICAST_DNS_MOCK_PLAT_APIS_ENABLE
  *
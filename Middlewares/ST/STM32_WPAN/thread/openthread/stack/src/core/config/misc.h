@@ -232,6 +232,104 @@
 #define OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE (sizeof(void *) * 32)
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_POOL_QUOTA_ENABLE
+ *
+ * Define to 1 to enforce per-priority reservations and quotas of message buffers.
+ *
+ * The buffers reserved for a priority level can only be used by messages of this level. The other buffers are shared,
+ * and a level cannot use more buffers than its quota. A burst of low priority traffic then cannot take the buffers
+ * needed by MLE and network control messages. A message whose level is over its quota is not admitted for
+ * transmission.
+ *
+ * @note The reservations and quotas are counted out of OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS, also when the message
+ *       buffers are allocated from the heap or by the platform.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_POOL_QUOTA_ENABLE
+#define OPENTHREAD_CONFIG_MESSAGE_POOL_QUOTA_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_BUFFERS_LOW
+ *
+ * The number of message buffers reserved for low priority messages.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_BUFFERS_LOW
+#define OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_BUFFERS_LOW 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_BUFFERS_NORMAL
+ *
+ * The number of message buffers reserved for normal priority messages.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_BUFFERS_NORMAL
+#define OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_BUFFERS_NORMAL 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_BUFFERS_HIGH
+ *
+ * The number of message buffers reserved for high priority messages.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_BUFFERS_HIGH
+#define OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_BUFFERS_HIGH 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_BUFFERS_NET
+ *
+ * The number of message buffers reserved for network control priority messages (e.g., MLE).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_BUFFERS_NET
+#define OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_BUFFERS_NET 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_POOL_MAX_BUFFERS_LOW
+ *
+ * The maximum number of message buffers used by low priority messages.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_POOL_MAX_BUFFERS_LOW
+#define OPENTHREAD_CONFIG_MESSAGE_POOL_MAX_BUFFERS_LOW (OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS / 2)
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_POOL_MAX_BUFFERS_NORMAL
+ *
+ * The maximum number of message buffers used by normal priority messages.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_POOL_MAX_BUFFERS_NORMAL
+#define OPENTHREAD_CONFIG_MESSAGE_POOL_MAX_BUFFERS_NORMAL (OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS * 3 / 4)
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_POOL_MAX_BUFFERS_HIGH
+ *
+ * The maximum number of message buffers used by high priority messages.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_POOL_MAX_BUFFERS_HIGH
+#define OPENTHREAD_CONFIG_MESSAGE_POOL_MAX_BUFFERS_HIGH OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_POOL_MAX_BUFFERS_NET
+ *
+ * The maximum number of message buffers used by network control priority messages.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_POOL_MAX_BUFFERS_NET
+#define OPENTHREAD_CONFIG_MESSAGE_POOL_MAX_BUFFERS_NET OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_DEFAULT_TRANSMIT_POWER
  *
@@ -420,6 +518,84 @@
 #define OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE
+ *
+ * The maximum number of settings records indexed in RAM by the flash storage driver (when
+ * `OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE` is enabled).
+ *
+ * The index holds the key, length and offset of every valid record of the active swap area, so reading a setting
+ * does not go over the record headers in flash. When there are more valid records, the driver falls back to reading
+ * the record headers until the next swap area compaction. Define to 0 to disable the index.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE
+#define OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE 64
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_PLATFORM_FLASH_COMPACT_THRESHOLD
+ *
+ * The percentage of the swap area size taken by deleted or replaced settings records above which the flash storage
+ * driver compacts the swap area on initialization (requires `OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE`).
+ *
+ * Compacting on initialization avoids a swap (which erases a flash area) on a later settings update. Define to 0 to
+ * only compact when the swap area is full.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_PLATFORM_FLASH_COMPACT_THRESHOLD
+#define OPENTHREAD_CONFIG_PLATFORM_FLASH_COMPACT_THRESHOLD 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_ENABLE
+ *
+ * Define to 1 to compile the routes of the Network Data into a route table, used by the route lookups of the
+ * forwarded messages instead of parsing the Network Data TLVs.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_ENABLE
+#define OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_MAX_PREFIXES
+ *
+ * The maximum number of Network Data prefixes with external routes or border routers in the route table.
+ *
+ * When the Network Data contains more prefixes (or more routes than `OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_MAX_ROUTES`),
+ * the route lookups parse the Network Data TLVs until it changes.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_MAX_PREFIXES
+#define OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_MAX_PREFIXES 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_MAX_ROUTES
+ *
+ * The maximum number of external route and default route entries in the route table.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_MAX_ROUTES
+#define OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_MAX_ROUTES 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+ *
+ * Define to 1 to schedule the millisecond and microsecond timers with a hierarchical timing wheel instead of a sorted
+ * list.
+ *
+ * Starting and stopping a timer then takes a constant time instead of a time linear in the number of running timers,
+ * and the platform alarm is only re-programmed when the earliest timer changes. This uses about 540 bytes of RAM per
+ * timer scheduler, and 8 more bytes per timer.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE
+#define OPENTHREAD_CONFIG_TIMER_WHEEL_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_FAILED_CHILD_TRANSMISSIONS
  *
@@ -68,6 +68,20 @@
 #define OPENTHREAD_CONFIG_MLE_MAX_CHILDREN 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+ *
+ * Define as 1 to index the child table by RLOC16 and by extended address.
+ *
+ * The lookups of a child by RLOC16 or extended address then use open addressing hash tables instead of searching the
+ * child table linearly. Each index uses 2 bytes per slot, with twice as many slots as children, and 4 bytes per child.
+ * It is enabled by default when the child table is large.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE (OPENTHREAD_CONFIG_MLE_MAX_CHILDREN >= 32)
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MLE_CHILD_TIMEOUT_DEFAULT
  *
@@ -119,6 +119,20 @@
 #define OPENTHREAD_CONFIG_SRP_SERVER_SERVICE_UPDATE_TIMEOUT ((4 * 250u) + 250u)
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_NAME_TABLE_SIZE
+ *
+ * Specifies the number of buckets of the hash tables used by the SRP server to look up registered hosts by host name,
+ * and registered services by service instance name and by service type.
+ *
+ * Each table takes one pointer per bucket. Lookups stay short as long as the number of registered hosts and services
+ * does not exceed a few times this value.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_NAME_TABLE_SIZE
+#define OPENTHREAD_CONFIG_SRP_SERVER_NAME_TABLE_SIZE 32
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_SRP_SERVER_ADVERTISING_PROXY_ENABLE
  *
@@ -58,14 +58,9 @@ void Sha256::Update(const void *aBuf, uint16_t aBufLength)
 
 void Sha256::Update(const Message &aMessage, uint16_t aOffset, uint16_t aLength)
 {
-    Message::Chunk chunk;
-
-    aMessage.GetFirstChunk(aOffset, aLength, chunk);
-
-    while (chunk.GetLength() > 0)
+    for (Message::ChunkIterator it(aMessage, aOffset, aLength); !it.IsDone(); it.Advance())
     {
-        Update(chunk.GetBytes(), chunk.GetLength());
-        aMessage.GetNextChunk(aLength, chunk);
+        Update(it.GetBytes(), it.GetLength());
     }
 }
 
@@ -474,6 +474,11 @@ void Instance::GetBufferInfo(BufferInfo &aInfo)
     aInfo.mFreeBuffers    = Get<MessagePool>().GetFreeBufferCount();
     aInfo.mMaxUsedBuffers = Get<MessagePool>().GetMaxUsedBufferCount();
 
+    for (uint8_t priority = 0; priority < Message::kNumPriorities; priority++)
+    {
+        aInfo.mPriorityLevels[priority] = Get<MessagePool>().GetPriorityInfo(static_cast<Message::Priority>(priority));
+    }
+
     Get<MeshForwarder>().GetSendQueue().GetInfo(aInfo.m6loSendQueue);
     Get<MeshForwarder>().GetReassemblyQueue().GetInfo(aInfo.m6loReassemblyQueue);
     Get<Ip6::Ip6>().GetSendQueue().GetInfo(aInfo.mIp6Queue);
@@ -46,41 +46,68 @@ namespace ot {
 
 RegisterLogModule("Ip6");
 
-void Checksum::AddUint8(uint8_t aUint8)
+void Checksum::AddUint8(uint8_t aUint8) { AddData(&aUint8, sizeof(aUint8)); }
+
+void Checksum::AddUint16(uint16_t aUint16)
+{
+    uint8_t bytes[sizeof(uint16_t)];
+
+    BigEndian::WriteUint16(aUint16, bytes);
+    AddData(bytes, sizeof(bytes));
+}
+
+void Checksum::AddData(const uint8_t *aBuffer, uint16_t aLength)
 {
-    uint16_t newValue = mValue;
+    // The data is summed 16-bit word at a time in a 32-bit accumulator, the carries are folded back once at the end
+    // (one's complement sum is independent of the order). With at most 0xffff bytes added, the accumulator can not
+    // overflow.
 
-    // BigEndian encoding: Even index is MSB and odd index is LSB.
+    uint32_t sum = 0;
 
-    newValue += mAtOddIndex ? aUint8 : (static_cast<uint16_t>(aUint8) << 8);
+    VerifyOrExit(aLength > 0);
 
-    // Calculate one's complement sum.
+    // BigEndian encoding: Even index is MSB and odd index is LSB. A byte left over by the previous call completes the
+    // word that it started.
 
-    if (newValue < mValue)
+    if (mAtOddIndex)
     {
-        newValue++;
+        sum += *aBuffer++;
+        aLength--;
     }
 
-    mValue      = newValue;
-    mAtOddIndex = !mAtOddIndex;
-}
+    for (; aLength >= 8; aLength -= 8, aBuffer += 8)
+    {
+        sum += BigEndian::ReadUint16(&aBuffer[0]);
+        sum += BigEndian::ReadUint16(&aBuffer[2]);
+        sum += BigEndian::ReadUint16(&aBuffer[4]);
+        sum += BigEndian::ReadUint16(&aBuffer[6]);
+    }
 
-void Checksum::AddUint16(uint16_t aUint16)
-{
-    // BigEndian encoding
-    AddUint8(static_cast<uint8_t>(aUint16 >> 8));
-    AddUint8(static_cast<uint8_t>(aUint16 & 0xff));
-}
+    for (; aLength >= 2; aLength -= 2, aBuffer += 2)
+    {
+        sum += BigEndian::ReadUint16(aBuffer);
+    }
 
-void Checksum::AddData(const uint8_t *aBuffer, uint16_t aLength)
-{
-    for (uint16_t i = 0; i < aLength; i++)
+    mAtOddIndex = (aLength != 0);
+
+    if (mAtOddIndex)
     {
-        AddUint8(aBuffer[i]);
+        sum += static_cast<uint32_t>(*aBuffer) << 8;
     }
+
+    // Calculate one's complement sum.
+
+    sum += mValue;
+    sum = (sum & 0xffff) + (sum >> 16);
+    sum = (sum & 0xffff) + (sum >> 16);
+
+    mValue = static_cast<uint16_t>(sum);
+
+exit:
+    return;
 }
 
-void Checksum::WriteToMessage(uint16_t aOffset, Message &aMessage) const
+uint16_t Checksum::GetFieldValue(void) const
 {
     uint16_t checksum = GetValue();
 
@@ -89,34 +116,41 @@ void Checksum::WriteToMessage(uint16_t aOffset, Message &aMessage) const
         checksum = ~checksum;
     }
 
-    checksum = BigEndian::HostSwap16(checksum);
-
-    aMessage.Write(aOffset, checksum);
+    return checksum;
 }
 
-void Checksum::Calculate(const Ip6::Address &aSource,
-                         const Ip6::Address &aDestination,
-                         uint8_t             aIpProto,
-                         const Message      &aMessage)
+void Checksum::WriteToMessage(uint16_t aOffset, Message &aMessage) const
 {
-    Message::Chunk chunk;
-    uint16_t       length = aMessage.GetLength() - aMessage.GetOffset();
+    aMessage.Write(aOffset, BigEndian::HostSwap16(GetFieldValue()));
+}
 
+void Checksum::AddPseudoHeader(const Ip6::Address &aSource,
+                               const Ip6::Address &aDestination,
+                               uint8_t             aIpProto,
+                               uint16_t            aLength)
+{
     // Pseudo-header for checksum calculation (RFC-2460).
 
     AddData(aSource.GetBytes(), sizeof(Ip6::Address));
     AddData(aDestination.GetBytes(), sizeof(Ip6::Address));
-    AddUint16(length);
+    AddUint16(aLength);
     AddUint16(static_cast<uint16_t>(aIpProto));
+}
 
-    // Add message content (from offset to the end) to checksum.
+void Checksum::Calculate(const Ip6::Address &aSource,
+                         const Ip6::Address &aDestination,
+                         uint8_t             aIpProto,
+                         const Message      &aMessage)
+{
+    uint16_t length = aMessage.GetLength() - aMessage.GetOffset();
+
+    AddPseudoHeader(aSource, aDestination, aIpProto, length);
 
-    aMessage.GetFirstChunk(aMessage.GetOffset(), length, chunk);
+    // Add message content (from offset to the end) to checksum.
 
-    while (chunk.GetLength() > 0)
+    for (Message::ChunkIterator it(aMessage, aMessage.GetOffset(), length); !it.IsDone(); it.Advance())
     {
-        AddData(chunk.GetBytes(), chunk.GetLength());
-        aMessage.GetNextChunk(length, chunk);
+        AddData(it.GetBytes(), it.GetLength());
     }
 }
 
@@ -125,8 +159,7 @@ void Checksum::Calculate(const Ip4::Address &aSource,
                          uint8_t             aIpProto,
                          const Message      &aMessage)
 {
-    Message::Chunk chunk;
-    uint16_t       length = aMessage.GetLength() - aMessage.GetOffset();
+    uint16_t length = aMessage.GetLength() - aMessage.GetOffset();
 
     // Pseudo-header for checksum calculation (RFC-768/792/793).
     // Note: ICMP checksum won't count the pseudo header like TCP and UDP.
@@ -140,12 +173,9 @@ void Checksum::Calculate(const Ip4::Address &aSource,
 
     // Add message content (from offset to the end) to checksum.
 
-    aMessage.GetFirstChunk(aMessage.GetOffset(), length, chunk);
-
-    while (chunk.GetLength() > 0)
+    for (Message::ChunkIterator it(aMessage, aMessage.GetOffset(), length); !it.IsDone(); it.Advance())
     {
-        AddData(chunk.GetBytes(), chunk.GetLength());
-        aMessage.GetNextChunk(length, chunk);
+        AddData(it.GetBytes(), it.GetLength());
     }
 }
 
@@ -235,6 +265,161 @@ exit:
     return;
 }
 
+Error Checksum::ReadTransportChecksum(const Message &aMessage, uint8_t aIpProto, uint16_t &aOffset, uint16_t &aChecksum)
+{
+    // The TCP and UDP protocol numbers are the same for IPv4 and IPv6,
+    // ICMP is only translated from IPv6 and ICMPv6 only from IPv4.
+
+    Error error = kErrorNone;
+
+    switch (aIpProto)
+    {
+    case Ip6::kProtoTcp:
+        aOffset = aMessage.GetOffset() + Ip6::Tcp::Header::kChecksumFieldOffset;
+        break;
+
+    case Ip6::kProtoUdp:
+        aOffset = aMessage.GetOffset() + Ip6::Udp::Header::kChecksumFieldOffset;
+        break;
+
+    case Ip4::kProtoIcmp:
+        aOffset = aMessage.GetOffset() + Ip4::Icmp::Header::kChecksumFieldOffset;
+        break;
+
+    case Ip6::kProtoIcmp6:
+        aOffset = aMessage.GetOffset() + Ip6::Icmp::Header::kChecksumFieldOffset;
+        break;
+
+    default:
+        ExitNow(error = kErrorNotFound);
+    }
+
+    SuccessOrExit(error = aMessage.Read(aOffset, aChecksum));
+    aChecksum = BigEndian::HostSwap16(aChecksum);
+
+    // A zero UDP checksum means no checksum in IPv4, there is nothing to update.
+    VerifyOrExit((aIpProto != Ip6::kProtoUdp) || (aChecksum != 0), error = kErrorNotFound);
+
+exit:
+    return error;
+}
+
+void Checksum::WriteTransportChecksum(Message &aMessage, uint16_t aOffset, uint16_t aChecksum)
+{
+    aMessage.Write(aOffset, BigEndian::HostSwap16(aChecksum));
+}
+
+void Checksum::TranslateMessageChecksum(Message            &aMessage,
+                                        const Ip6::Address &aIp6Source,
+                                        const Ip6::Address &aIp6Destination,
+                                        const Ip4::Address &aIp4Source,
+                                        const Ip4::Address &aIp4Destination,
+                                        uint8_t             aIpProto)
+{
+    uint16_t offset;
+    uint16_t checksum;
+
+    if (ReadTransportChecksum(aMessage, aIpProto, offset, checksum) != kErrorNone)
+    {
+        UpdateMessageChecksum(aMessage, aIp4Source, aIp4Destination, aIpProto);
+        ExitNow();
+    }
+
+    if (aIpProto == Ip4::kProtoIcmp)
+    {
+        // ICMP has no pseudo-header, the ICMPv6 one is removed.
+
+        Checksum pseudoHeader;
+
+        pseudoHeader.AddPseudoHeader(aIp6Source, aIp6Destination, Ip6::kProtoIcmp6,
+                                     aMessage.GetLength() - aMessage.GetOffset());
+        checksum = UpdateChecksum(checksum, pseudoHeader.GetValue(), 0);
+    }
+    else
+    {
+        // The upper-layer length and the protocol are added to both pseudo-headers with the same value (the order of
+        // the 16-bit words does not matter), only the addresses are replaced.
+
+        checksum = UpdateChecksum(checksum, aIp6Source.GetBytes(), sizeof(Ip6::Address), aIp4Source.GetBytes(),
+                                  sizeof(Ip4::Address));
+        checksum = UpdateChecksum(checksum, aIp6Destination.GetBytes(), sizeof(Ip6::Address),
+                                  aIp4Destination.GetBytes(), sizeof(Ip4::Address));
+    }
+
+    WriteTransportChecksum(aMessage, offset, checksum);
+
+exit:
+    return;
+}
+
+void Checksum::TranslateMessageChecksum(Message            &aMessage,
+                                        const Ip4::Address &aIp4Source,
+                                        const Ip4::Address &aIp4Destination,
+                                        const Ip6::Address &aIp6Source,
+                                        const Ip6::Address &aIp6Destination,
+                                        uint8_t             aIpProto)
+{
+    uint16_t offset;
+    uint16_t checksum;
+
+    if (ReadTransportChecksum(aMessage, aIpProto, offset, checksum) != kErrorNone)
+    {
+        UpdateMessageChecksum(aMessage, aIp6Source, aIp6Destination, aIpProto);
+        ExitNow();
+    }
+
+    if (aIpProto == Ip6::kProtoIcmp6)
+    {
+        // ICMP has no pseudo-header, the ICMPv6 one is added.
+
+        Checksum pseudoHeader;
+
+        pseudoHeader.AddPseudoHeader(aIp6Source, aIp6Destination, Ip6::kProtoIcmp6,
+                                     aMessage.GetLength() - aMessage.GetOffset());
+        checksum = UpdateChecksum(checksum, 0, pseudoHeader.GetValue());
+    }
+    else
+    {
+        checksum = UpdateChecksum(checksum, aIp4Source.GetBytes(), sizeof(Ip4::Address), aIp6Source.GetBytes(),
+                                  sizeof(Ip6::Address));
+        checksum = UpdateChecksum(checksum, aIp4Destination.GetBytes(), sizeof(Ip4::Address),
+                                  aIp6Destination.GetBytes(), sizeof(Ip6::Address));
+    }
+
+    WriteTransportChecksum(aMessage, offset, checksum);
+
+exit:
+    return;
+}
+
+uint16_t Checksum::UpdateChecksum(uint16_t       aChecksum,
+                                  const uint8_t *aOldData,
+                                  uint16_t       aOldLength,
+                                  const uint8_t *aNewData,
+                                  uint16_t       aNewLength)
+{
+    Checksum oldData;
+    Checksum newData;
+
+    oldData.AddData(aOldData, aOldLength);
+    newData.AddData(aNewData, aNewLength);
+
+    return UpdateChecksum(aChecksum, oldData.GetValue(), newData.GetValue());
+}
+
+uint16_t Checksum::UpdateChecksum(uint16_t aChecksum, uint16_t aOldValue, uint16_t aNewValue)
+{
+    // HC' = ~(~HC + ~m + m'), RFC 1624 (section 3, eqn. 3).
+
+    Checksum checksum;
+
+    checksum.AddUint16(static_cast<uint16_t>(~aChecksum));
+    checksum.AddUint16(static_cast<uint16_t>(~aOldValue));
+    checksum.AddUint16(aNewValue);
+
+    return checksum.GetFieldValue();
+}
+
 void Checksum::UpdateIp4HeaderChecksum(Ip4::Header &aHeader)
 {
     Checksum checksum;
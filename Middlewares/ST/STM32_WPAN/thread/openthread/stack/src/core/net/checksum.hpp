@@ -109,6 +109,87 @@ public:
      */
     static void UpdateIp4HeaderChecksum(Ip4::Header &aHeader);
 
+    /**
+     * Updates the checksum in a given message translated from IPv6 to IPv4 (if TCP/UDP/ICMP(v4)).
+     *
+     * For TCP and UDP, only the addresses of the pseudo-header differ between the original IPv6 and the translated
+     * IPv4 message, so the checksum is updated incrementally (RFC 1624) without going over the payload. For ICMP, the
+     * ICMPv6 pseudo-header is removed from the checksum the same way.
+     *
+     * @param[in,out] aMessage         The translated message. The `aMessage.GetOffset()` should point to start of the
+     *                                 TCP/UDP/ICMP(v4) header, which still holds the checksum of the IPv6 message
+     *                                 (updated for any header field changed by the translation).
+     * @param[in] aIp6Source           The source address of the original IPv6 message.
+     * @param[in] aIp6Destination      The destination address of the original IPv6 message.
+     * @param[in] aIp4Source           The source address of the translated IPv4 message.
+     * @param[in] aIp4Destination      The destination address of the translated IPv4 message.
+     * @param[in] aIpProto             The Internet Protocol value of the translated IPv4 message.
+     *
+     */
+    static void TranslateMessageChecksum(Message            &aMessage,
+                                         const Ip6::Address &aIp6Source,
+                                         const Ip6::Address &aIp6Destination,
+                                         const Ip4::Address &aIp4Source,
+                                         const Ip4::Address &aIp4Destination,
+                                         uint8_t             aIpProto);
+
+    /**
+     * Updates the checksum in a given message translated from IPv4 to IPv6 (if TCP/UDP/ICMPv6).
+     *
+     * For TCP, UDP and ICMPv6, the checksum is updated incrementally (RFC 1624) from the one of the original IPv4
+     * message, adding the ICMPv6 pseudo-header for ICMPv6. For a UDP datagram without checksum (zero checksum field in
+     * IPv4), the checksum is calculated over the whole message as done by `UpdateMessageChecksum()`.
+     *
+     * @param[in,out] aMessage         The translated message. The `aMessage.GetOffset()` should point to start of the
+     *                                 TCP/UDP/ICMPv6 header, which still holds the checksum of the IPv4 message
+     *                                 (updated for any header field changed by the translation).
+     * @param[in] aIp4Source           The source address of the original IPv4 message.
+     * @param[in] aIp4Destination      The destination address of the original IPv4 message.
+     * @param[in] aIp6Source           The source address of the translated IPv6 message.
+     * @param[in] aIp6Destination      The destination address of the translated IPv6 message.
+     * @param[in] aIpProto             The Internet Protocol value of the translated IPv6 message.
+     *
+     */
+    static void TranslateMessageChecksum(Message            &aMessage,
+                                         const Ip4::Address &aIp4Source,
+                                         const Ip4::Address &aIp4Destination,
+                                         const Ip6::Address &aIp6Source,
+                                         const Ip6::Address &aIp6Destination,
+                                         uint8_t             aIpProto);
+
+    /**
+     * Incrementally updates a checksum field after some of the data it covers is replaced (RFC 1624).
+     *
+     * The old data is removed from the checksum and the new data is added to it, without going over the rest of the
+     * covered data. Both shall start at an even offset in the covered data.
+     *
+     * @param[in] aChecksum    The checksum field value (in host byte order).
+     * @param[in] aOldData     A pointer to the replaced data.
+     * @param[in] aOldLength   The length of @p aOldData in bytes.
+     * @param[in] aNewData     A pointer to the new data.
+     * @param[in] aNewLength   The length of @p aNewData in bytes.
+     *
+     * @returns The updated checksum field value (in host byte order).
+     *
+     */
+    static uint16_t UpdateChecksum(uint16_t       aChecksum,
+                                   const uint8_t *aOldData,
+                                   uint16_t       aOldLength,
+                                   const uint8_t *aNewData,
+                                   uint16_t       aNewLength);
+
+    /**
+     * Incrementally updates a checksum field after a 16-bit word it covers is replaced (RFC 1624).
+     *
+     * @param[in] aChecksum    The checksum field value (in host byte order).
+     * @param[in] aOldValue    The replaced 16-bit word, at an even offset in the covered data (in host byte order).
+     * @param[in] aNewValue    The new 16-bit word (in host byte order).
+     *
+     * @returns The updated checksum field value (in host byte order).
+     *
+     */
+    static uint16_t UpdateChecksum(uint16_t aChecksum, uint16_t aOldValue, uint16_t aNewValue);
+
 private:
     Checksum(void)
         : mValue(0)
@@ -117,10 +198,15 @@ private:
     }
 
     uint16_t GetValue(void) const { return mValue; }
+    uint16_t GetFieldValue(void) const;
     void     AddUint8(uint8_t aUint8);
     void     AddUint16(uint16_t aUint16);
     void     AddData(const uint8_t *aBuffer, uint16_t aLength);
     void     WriteToMessage(uint16_t aOffset, Message &aMessage) const;
+    void     AddPseudoHeader(const Ip6::Address &aSource,
+                             const Ip6::Address &aDestination,
+                             uint8_t             aIpProto,
+                             uint16_t            aLength);
     void     Calculate(const Ip6::Address &aSource,
                        const Ip6::Address &aDestination,
                        uint8_t             aIpProto,
@@ -130,6 +216,12 @@ private:
                        uint8_t             aIpProto,
                        const Message      &aMessage);
 
+    static Error ReadTransportChecksum(const Message &aMessage,
+                                       uint8_t        aIpProto,
+                                       uint16_t      &aOffset,
+                                       uint16_t      &aChecksum);
+    static void  WriteTransportChecksum(Message &aMessage, uint16_t aOffset, uint16_t aChecksum);
+
     static constexpr uint16_t kValidRxChecksum = 0xffff;
 
     uint16_t mValue;
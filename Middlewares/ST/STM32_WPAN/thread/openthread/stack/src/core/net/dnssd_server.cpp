@@ -721,62 +721,69 @@ Error Server::Response::ResolveBySrp(void)
     static const Section kSections[] = {kAnswerSection, kAdditionalDataSection};
 
     Error                       error          = kErrorNotFound;
+    const Srp::Server          &srpServer      = Get<Srp::Server>();
     const Srp::Server::Service *matchedService = nullptr;
-    bool                        found          = false;
+    Name::Buffer                name;
     Section                     srvSection;
     Section                     txtSection;
 
     mSection = kAnswerSection;
 
-    for (const Srp::Server::Host &host : Get<Srp::Server>().GetHosts())
+    switch (mType)
+    {
+    case kAaaaQuery:
     {
-        if (host.IsDeleted())
+        const Srp::Server::Host *host;
+
+        ReadQueryName(name);
+        host = srpServer.FindHost(name);
+
+        if ((host != nullptr) && !host->IsDeleted())
         {
-            continue;
+            error = AppendHostAddresses(*host);
         }
 
-        if (mType == kAaaaQuery)
-        {
-            if (QueryNameMatches(host.GetFullName()))
-            {
-                error = AppendHostAddresses(host);
-                ExitNow();
-            }
+        ExitNow();
+    }
 
-            continue;
-        }
+    case kPtrQuery:
+    {
+        // The candidate services are the ones registered with the
+        // base service name, which is the query name after any
+        // sub-type label.
 
-        // `mType` is PTR or SRV/TXT query
+        using ServiceTypeTable = Srp::Server::ServiceTypeTable;
 
-        for (const Srp::Server::Service &service : host.GetServices())
+        uint16_t offset = mOffsets.mServiceName;
+        uint32_t hash;
+
+        VerifyOrExit(Name::ReadName(*mMessage, offset, name) == kErrorNone);
+        hash = ServiceTypeTable::HashName(name);
+
+        for (const Srp::Server::Service *service = srpServer.mServiceTypeTable.GetHead(hash); service != nullptr;
+             service                             = ServiceTypeTable::GetNext(*service))
         {
-            if (service.IsDeleted())
+            uint32_t ttl;
+
+            if (service->IsDeleted() || service->GetHost().IsDeleted() || !QueryNameMatchesService(*service))
             {
                 continue;
             }
 
-            if (mType == kPtrQuery)
-            {
-                if (QueryNameMatchesService(service))
-                {
-                    uint32_t ttl = TimeMilli::MsecToSec(service.GetExpireTime() - TimerMilli::GetNow());
+            ttl = TimeMilli::MsecToSec(service->GetExpireTime() - TimerMilli::GetNow());
 
-                    SuccessOrExit(error = AppendPtrRecord(service.GetInstanceLabel(), ttl));
-                    matchedService = &service;
-                }
-            }
-            else if (QueryNameMatches(service.GetInstanceName()))
-            {
-                matchedService = &service;
-                found          = true;
-                break;
-            }
+            SuccessOrExit(error = AppendPtrRecord(service->GetInstanceLabel(), ttl));
+            matchedService = service;
         }
 
-        if (found)
-        {
-            break;
-        }
+        break;
+    }
+
+    default:
+        // `mType` is SRV/TXT query
+        ReadQueryName(name);
+        matchedService = srpServer.FindService(name);
+        break;
     }
 
     VerifyOrExit(matchedService != nullptr);
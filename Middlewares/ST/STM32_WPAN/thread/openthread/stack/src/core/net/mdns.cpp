@@ -80,10 +80,12 @@ Core::Core(Instance &aInstance)
     , mEntryTask(aInstance)
     , mTxMessageHistory(aInstance)
     , mConflictCallback(nullptr)
+    , mAddrCachesToCommit(nullptr)
     , mNextQueryTxTime(TimerMilli::GetNow() - 1)
     , mCacheTimer(aInstance)
     , mCacheTask(aInstance)
 {
+    ClearAllBytes(mDueCaches);
 }
 
 Error Core::SetEnabled(bool aEnable, uint32_t aInfraIfIndex)
@@ -107,6 +109,8 @@ Error Core::SetEnabled(bool aEnable, uint32_t aInfraIfIndex)
 
     if (!mIsEnabled)
     {
+        mHostEntryTable.Clear();
+        mServiceEntryTable.Clear();
         mHostEntries.Clear();
         mServiceEntries.Clear();
         mServiceTypes.Clear();
@@ -119,6 +123,9 @@ Error Core::SetEnabled(bool aEnable, uint32_t aInfraIfIndex)
         mTxtCacheList.Clear();
         mIp6AddrCacheList.Clear();
         mIp4AddrCacheList.Clear();
+        mCacheTable.Clear();
+        mCacheFireTimes.Clear();
+        mAddrCachesToCommit = nullptr;
         mCacheTimer.Stop();
     }
 
@@ -135,6 +142,18 @@ void Core::HandleInfraIfStateChanged(void)
 }
 #endif
 
+template <typename EntryType, typename KeyType> EntryType *Core::FindEntry(const KeyType &aKey)
+{
+    EntryType *entry = GetEntryTable<EntryType>().GetHead(HashKey(aKey));
+
+    while ((entry != nullptr) && !entry->Matches(aKey))
+    {
+        entry = NameTable<EntryType>::GetNext(*entry);
+    }
+
+    return entry;
+}
+
 template <typename EntryType, typename ItemInfo>
 Error Core::Register(const ItemInfo &aItemInfo, RequestId aRequestId, RegisterCallback aCallback)
 {
@@ -143,13 +162,16 @@ Error Core::Register(const ItemInfo &aItemInfo, RequestId aRequestId, RegisterCa
 
     VerifyOrExit(mIsEnabled, error = kErrorInvalidState);
 
-    entry = GetEntryList<EntryType>().FindMatching(aItemInfo);
+    entry = FindEntry<EntryType>(aItemInfo);
 
     if (entry == nullptr)
     {
         entry = EntryType::AllocateAndInit(GetInstance(), aItemInfo);
         OT_ASSERT(entry != nullptr);
         GetEntryList<EntryType>().Push(*entry);
+
+        entry->mNameHash = HashKey(aItemInfo);
+        GetEntryTable<EntryType>().Add(*entry, entry->mNameHash);
     }
 
     entry->Register(aItemInfo, Callback(aRequestId, aCallback));
@@ -165,7 +187,7 @@ template <typename EntryType, typename ItemInfo> Error Core::Unregister(const It
 
     VerifyOrExit(mIsEnabled, error = kErrorInvalidState);
 
-    entry = GetEntryList<EntryType>().FindMatching(aItemInfo);
+    entry = FindEntry<EntryType>(aItemInfo);
 
     if (entry != nullptr)
     {
@@ -339,8 +361,21 @@ void Core::HandleEntryTimer(void)
 
 void Core::RemoveEmptyEntries(void)
 {
-    mHostEntries.RemoveAndFreeAllMatching(Entry::kRemoving);
-    mServiceEntries.RemoveAndFreeAllMatching(Entry::kRemoving);
+    OwningList<HostEntry>    removedHosts;
+    OwningList<ServiceEntry> removedServices;
+
+    mHostEntries.RemoveAllMatching(Entry::kRemoving, removedHosts);
+    mServiceEntries.RemoveAllMatching(Entry::kRemoving, removedServices);
+
+    for (HostEntry &entry : removedHosts)
+    {
+        mHostEntryTable.Remove(entry, entry.mNameHash);
+    }
+
+    for (ServiceEntry &entry : removedServices)
+    {
+        mServiceEntryTable.Remove(entry, entry.mNameHash);
+    }
 }
 
 void Core::HandleEntryTask(void)
@@ -391,6 +426,48 @@ bool Core::NameMatch(const Heap::String &aFirst, const Heap::String &aSecond)
     return !aSecond.IsNull() && NameMatch(aFirst, aSecond.AsCString());
 }
 
+uint32_t Core::HashKey(const char *aName)
+{
+    // The key of an entry is the first label of its name. We hash
+    // up to the first dot '.' char, so that a name with multiple
+    // labels (e.g., a host name) and a label which itself contains
+    // dot chars (e.g., a service instance label) both hash the same
+    // as any name which can match them.
+
+    return NameTable<CacheEntry>::HashFirstLabel((aName != nullptr) ? aName : "");
+}
+
+uint32_t Core::HashKey(const Name &aName)
+{
+    uint32_t hash;
+
+    if (aName.IsFromMessage())
+    {
+        Name::LabelBuffer label;
+        uint16_t          offset;
+        const Message    &message = aName.GetAsMessage(offset);
+        uint8_t           length  = sizeof(label);
+
+        if (Name::ReadLabel(message, offset, label, length) != kErrorNone)
+        {
+            label[0] = kNullChar;
+        }
+
+        hash = HashKey(label);
+    }
+    else
+    {
+        hash = HashKey(aName.GetAsCString());
+    }
+
+    return hash;
+}
+
+uint32_t Core::HashKey(const Browser &aBrowser)
+{
+    return HashKey((aBrowser.mSubTypeLabel != nullptr) ? aBrowser.mSubTypeLabel : aBrowser.mServiceType);
+}
+
 void Core::UpdateCacheFlushFlagIn(ResourceRecord &aResourceRecord, Section aSection, bool aIsLegacyUnicast)
 {
     // Do not set the cache-flush flag if the record is
@@ -1352,6 +1429,8 @@ exit:
 
 Core::HostEntry::HostEntry(void)
     : mNext(nullptr)
+    , mNextInTable(nullptr)
+    , mNameHash(0)
     , mNameOffset(kUnspecifiedOffset)
 {
 }
@@ -1726,6 +1805,8 @@ const uint8_t Core::ServiceEntry::kEmptyTxtData[] = {0};
 
 Core::ServiceEntry::ServiceEntry(void)
     : mNext(nullptr)
+    , mNextInTable(nullptr)
+    , mNameHash(0)
     , mPriority(0)
     , mWeight(0)
     , mPort(0)
@@ -2272,7 +2353,7 @@ void Core::ServiceEntry::DiscoverOffsetsAndHost(HostEntry *&aHostEntry)
     // and name compression offsets from the previously appended
     // entries.
 
-    aHostEntry = Get<Core>().mHostEntries.FindMatching(mHostName);
+    aHostEntry = Get<Core>().FindEntry<HostEntry>(mHostName);
 
     if ((aHostEntry != nullptr) && (aHostEntry->GetState() != GetState()))
     {
@@ -3244,25 +3325,11 @@ void Core::TxMessage::Reinit(void)
 
     case kMulticastQuery:
 
-        for (BrowseCache &browseCache : Get<Core>().mBrowseCacheList)
-        {
-            browseCache.ClearCompressOffsets();
-        }
-
-        for (SrvCache &srvCache : Get<Core>().mSrvCacheList)
-        {
-            srvCache.ClearCompressOffsets();
-        }
-
-        for (TxtCache &txtCache : Get<Core>().mTxtCacheList)
-        {
-            txtCache.ClearCompressOffsets();
-        }
-
-        // `Ip6AddrCache` entries do not track any append state or
-        // compress offset since the host name should not be used
-        // in any other query question.
+        // Only the cache entries which are due in the current
+        // `HandleCacheTimer()` append to the query, the compress
+        // offsets of all other entries are already cleared.
 
+        Get<Core>().ClearDueCacheCompressOffsets();
         break;
     case kLegacyUnicastResponse:
         break;
@@ -3540,11 +3607,11 @@ void Core::RxMessage::ProcessQuestion(Question &aQuestion)
 
     // Check if question name matches a `HostEntry` or a `ServiceEntry`
 
-    aQuestion.mEntry = Get<Core>().mHostEntries.FindMatching(name);
+    aQuestion.mEntry = Get<Core>().FindEntry<HostEntry>(name);
 
     if (aQuestion.mEntry == nullptr)
     {
-        aQuestion.mEntry        = Get<Core>().mServiceEntries.FindMatching(name);
+        aQuestion.mEntry        = Get<Core>().FindEntry<ServiceEntry>(name);
         aQuestion.mIsForService = (aQuestion.mEntry != nullptr);
     }
 
@@ -3913,21 +3980,13 @@ void Core::RxMessage::ProcessResponse(void)
     if (!Get<Core>().mIp6AddrCacheList.IsEmpty())
     {
         IterateOnAllRecordsInResponse(&RxMessage::ProcessAaaaRecord);
-
-        for (Ip6AddrCache &addrCache : Get<Core>().mIp6AddrCacheList)
-        {
-            addrCache.CommitNewResponseEntries();
-        }
+        Get<Core>().CommitNewAddrCacheEntries();
     }
 
     if (!Get<Core>().mIp4AddrCacheList.IsEmpty())
     {
         IterateOnAllRecordsInResponse(&RxMessage::ProcessARecord);
-
-        for (Ip4AddrCache &addrCache : Get<Core>().mIp4AddrCacheList)
-        {
-            addrCache.CommitNewResponseEntries();
-        }
+        Get<Core>().CommitNewAddrCacheEntries();
     }
 }
 
@@ -3969,14 +4028,14 @@ void Core::RxMessage::ProcessRecordForConflict(const Name &aName, const Resource
 
     VerifyOrExit(aRecord.GetTtl() > 0);
 
-    hostEntry = Get<Core>().mHostEntries.FindMatching(aName);
+    hostEntry = Get<Core>().FindEntry<HostEntry>(aName);
 
     if (hostEntry != nullptr)
     {
         hostEntry->HandleConflict();
     }
 
-    serviceEntry = Get<Core>().mServiceEntries.FindMatching(aName);
+    serviceEntry = Get<Core>().FindEntry<ServiceEntry>(aName);
 
     if (serviceEntry != nullptr)
     {
@@ -3993,7 +4052,7 @@ void Core::RxMessage::ProcessPtrRecord(const Name &aName, const ResourceRecord &
 
     VerifyOrExit(aRecord.GetType() == ResourceRecord::kTypePtr);
 
-    browseCache = Get<Core>().mBrowseCacheList.FindMatching(aName);
+    browseCache = Get<Core>().FindCache<BrowseCache>(aName);
     VerifyOrExit(browseCache != nullptr);
 
     browseCache->ProcessResponseRecord(*mMessagePtr, aRecordOffset);
@@ -4008,7 +4067,7 @@ void Core::RxMessage::ProcessSrvRecord(const Name &aName, const ResourceRecord &
 
     VerifyOrExit(aRecord.GetType() == ResourceRecord::kTypeSrv);
 
-    srvCache = Get<Core>().mSrvCacheList.FindMatching(aName);
+    srvCache = Get<Core>().FindCache<SrvCache>(aName);
     VerifyOrExit(srvCache != nullptr);
 
     srvCache->ProcessResponseRecord(*mMessagePtr, aRecordOffset);
@@ -4023,7 +4082,7 @@ void Core::RxMessage::ProcessTxtRecord(const Name &aName, const ResourceRecord &
 
     VerifyOrExit(aRecord.GetType() == ResourceRecord::kTypeTxt);
 
-    txtCache = Get<Core>().mTxtCacheList.FindMatching(aName);
+    txtCache = Get<Core>().FindCache<TxtCache>(aName);
     VerifyOrExit(txtCache != nullptr);
 
     txtCache->ProcessResponseRecord(*mMessagePtr, aRecordOffset);
@@ -4038,7 +4097,7 @@ void Core::RxMessage::ProcessAaaaRecord(const Name &aName, const ResourceRecord
 
     VerifyOrExit(aRecord.GetType() == ResourceRecord::kTypeAaaa);
 
-    ip6AddrCache = Get<Core>().mIp6AddrCacheList.FindMatching(aName);
+    ip6AddrCache = Get<Core>().FindCache<Ip6AddrCache>(aName);
     VerifyOrExit(ip6AddrCache != nullptr);
 
     ip6AddrCache->ProcessResponseRecord(*mMessagePtr, aRecordOffset);
@@ -4053,7 +4112,7 @@ void Core::RxMessage::ProcessARecord(const Name &aName, const ResourceRecord &aR
 
     VerifyOrExit(aRecord.GetType() == ResourceRecord::kTypeA);
 
-    ip4AddrCache = Get<Core>().mIp4AddrCacheList.FindMatching(aName);
+    ip4AddrCache = Get<Core>().FindCache<Ip4AddrCache>(aName);
     VerifyOrExit(ip4AddrCache != nullptr);
 
     ip4AddrCache->ProcessResponseRecord(*mMessagePtr, aRecordOffset);
@@ -4270,6 +4329,49 @@ void Core::TxMessageHistory::HandleTimer(void)
     }
 }
 
+template <typename CacheType, typename KeyType> CacheType *Core::FindCache(const KeyType &aKey)
+{
+    CacheEntry *cacheEntry = mCacheTable.GetHead(HashKey(aKey));
+
+    for (; cacheEntry != nullptr; cacheEntry = NameTable<CacheEntry>::GetNext(*cacheEntry))
+    {
+        if ((cacheEntry->mType == CacheType::kType) && static_cast<CacheType *>(cacheEntry)->Matches(aKey))
+        {
+            break;
+        }
+    }
+
+    return static_cast<CacheType *>(cacheEntry);
+}
+
+template <typename CacheType, typename KeyType> CacheType *Core::AddCache(const KeyType &aKey)
+{
+    CacheType *cacheEntry = CacheType::AllocateAndInit(GetInstance(), aKey);
+
+    OT_ASSERT(cacheEntry != nullptr);
+
+    GetCacheList<CacheType>().Push(*cacheEntry);
+
+    cacheEntry->mNameHash = HashKey(aKey);
+    mCacheTable.Add(*cacheEntry, cacheEntry->mNameHash);
+    mCacheFireTimes.Update(*cacheEntry);
+
+    return cacheEntry;
+}
+
+template <typename CacheType> void Core::RemoveExpiredCaches(const ExpireChecker &aExpireChecker)
+{
+    OwningList<CacheType> removedList;
+
+    GetCacheList<CacheType>().RemoveAllMatching(aExpireChecker, removedList);
+
+    for (CacheType &cacheEntry : removedList)
+    {
+        mCacheTable.Remove(cacheEntry, cacheEntry.mNameHash);
+        mCacheFireTimes.Remove(cacheEntry);
+    }
+}
+
 template <typename CacheType, typename BrowserResolverType>
 Error Core::Start(const BrowserResolverType &aBrowserOrResolver)
 {
@@ -4279,14 +4381,11 @@ Error Core::Start(const BrowserResolverType &aBrowserOrResolver)
     VerifyOrExit(mIsEnabled, error = kErrorInvalidState);
     VerifyOrExit(aBrowserOrResolver.mCallback != nullptr, error = kErrorInvalidArgs);
 
-    cacheEntry = GetCacheList<CacheType>().FindMatching(aBrowserOrResolver);
+    cacheEntry = FindCache<CacheType>(aBrowserOrResolver);
 
     if (cacheEntry == nullptr)
     {
-        cacheEntry = CacheType::AllocateAndInit(GetInstance(), aBrowserOrResolver);
-        OT_ASSERT(cacheEntry != nullptr);
-
-        GetCacheList<CacheType>().Push(*cacheEntry);
+        cacheEntry = AddCache<CacheType>(aBrowserOrResolver);
     }
 
     error = cacheEntry->Add(aBrowserOrResolver);
@@ -4304,7 +4403,7 @@ Error Core::Stop(const BrowserResolverType &aBrowserOrResolver)
     VerifyOrExit(mIsEnabled, error = kErrorInvalidState);
     VerifyOrExit(aBrowserOrResolver.mCallback != nullptr, error = kErrorInvalidArgs);
 
-    cacheEntry = GetCacheList<CacheType>().FindMatching(aBrowserOrResolver);
+    cacheEntry = FindCache<CacheType>(aBrowserOrResolver);
     VerifyOrExit(cacheEntry != nullptr);
 
     cacheEntry->Remove(aBrowserOrResolver);
@@ -4349,78 +4448,111 @@ void Core::AddPassiveSrvTxtCache(const char *aServiceInstance, const char *aServ
 {
     ServiceName serviceName(aServiceInstance, aServiceType);
 
-    if (!mSrvCacheList.ContainsMatching(serviceName))
+    if (FindCache<SrvCache>(serviceName) == nullptr)
     {
-        SrvCache *srvCache = SrvCache::AllocateAndInit(GetInstance(), serviceName);
-
-        OT_ASSERT(srvCache != nullptr);
-        mSrvCacheList.Push(*srvCache);
+        IgnoreReturnValue(AddCache<SrvCache>(serviceName));
     }
 
-    if (!mTxtCacheList.ContainsMatching(serviceName))
+    if (FindCache<TxtCache>(serviceName) == nullptr)
     {
-        TxtCache *txtCache = TxtCache::AllocateAndInit(GetInstance(), serviceName);
-
-        OT_ASSERT(txtCache != nullptr);
-        mTxtCacheList.Push(*txtCache);
+        IgnoreReturnValue(AddCache<TxtCache>(serviceName));
     }
 }
 
 void Core::AddPassiveIp6AddrCache(const char *aHostName)
 {
-    if (!mIp6AddrCacheList.ContainsMatching(aHostName))
+    if (FindCache<Ip6AddrCache>(aHostName) == nullptr)
     {
-        Ip6AddrCache *ip6AddrCache = Ip6AddrCache::AllocateAndInit(GetInstance(), aHostName);
-
-        OT_ASSERT(ip6AddrCache != nullptr);
-        mIp6AddrCacheList.Push(*ip6AddrCache);
+        IgnoreReturnValue(AddCache<Ip6AddrCache>(aHostName));
     }
 }
 
-void Core::HandleCacheTimer(void)
+void Core::CommitNewAddrCacheEntries(void)
 {
-    CacheTimerContext context(GetInstance());
-    ExpireChecker     expireChecker(context.GetNow());
+    // Commits the address records of a received response, only
+    // visiting the `AddrCache` entries which got any record.
 
-    // First remove all expired entries.
+    while (mAddrCachesToCommit != nullptr)
+    {
+        AddrCache &addrCache = *mAddrCachesToCommit;
+
+        mAddrCachesToCommit    = addrCache.mNextToCommit;
+        addrCache.mNextToCommit = nullptr;
 
-    mBrowseCacheList.RemoveAndFreeAllMatching(expireChecker);
-    mSrvCacheList.RemoveAndFreeAllMatching(expireChecker);
-    mTxtCacheList.RemoveAndFreeAllMatching(expireChecker);
-    mIp6AddrCacheList.RemoveAndFreeAllMatching(expireChecker);
-    mIp4AddrCacheList.RemoveAndFreeAllMatching(expireChecker);
+        addrCache.CommitNewResponseEntries();
+    }
+}
 
+void Core::HandleCacheTimer(void)
+{
     // Process cache types in a specific order to optimize name
     // compression when constructing query messages.
 
-    for (SrvCache &srvCache : mSrvCacheList)
+    static const CacheEntry::Type kTypeOrder[] = {
+        CacheEntry::kSrvCache,      CacheEntry::kTxtCache,      CacheEntry::kBrowseCache,
+        CacheEntry::kIp6AddrCache, CacheEntry::kIp4AddrCache,
+    };
+
+    CacheTimerContext context(GetInstance());
+    CacheEntry       *cacheEntry;
+    bool              shouldRemove = false;
+
+    // Pop the entries which are due from `mCacheFireTimes` into the
+    // `mDueCaches` list of their type. First remove all the expired
+    // ones.
+
+    while ((cacheEntry = mCacheFireTimes.PopDue(context.GetNow())) != nullptr)
     {
-        srvCache.HandleTimer(context);
+        if (cacheEntry->ShouldDelete(context.GetNow()))
+        {
+            shouldRemove = true;
+            continue;
+        }
+
+        cacheEntry->mNextDue          = mDueCaches[cacheEntry->mType];
+        mDueCaches[cacheEntry->mType] = cacheEntry;
     }
 
-    for (TxtCache &txtCache : mTxtCacheList)
+    if (shouldRemove)
     {
-        txtCache.HandleTimer(context);
+        ExpireChecker expireChecker(context.GetNow());
+
+        RemoveExpiredCaches<BrowseCache>(expireChecker);
+        RemoveExpiredCaches<SrvCache>(expireChecker);
+        RemoveExpiredCaches<TxtCache>(expireChecker);
+        RemoveExpiredCaches<Ip6AddrCache>(expireChecker);
+        RemoveExpiredCaches<Ip4AddrCache>(expireChecker);
     }
 
-    for (BrowseCache &browseCache : mBrowseCacheList)
+    for (CacheEntry::Type type : kTypeOrder)
     {
-        browseCache.HandleTimer(context);
+        for (cacheEntry = mDueCaches[type]; cacheEntry != nullptr; cacheEntry = cacheEntry->mNextDue)
+        {
+            cacheEntry->HandleTimer(context);
+            mCacheFireTimes.Update(*cacheEntry);
+        }
     }
 
-    for (Ip6AddrCache &addrCache : mIp6AddrCacheList)
+    context.GetQueryMessage().Send();
+
+    ClearDueCacheCompressOffsets();
+    ClearAllBytes(mDueCaches);
+
+    if (!mCacheFireTimes.IsEmpty())
     {
-        addrCache.HandleTimer(context);
+        mCacheTimer.FireAtIfEarlier(mCacheFireTimes.GetEarliestFireTime());
     }
+}
 
-    for (Ip4AddrCache &addrCache : mIp4AddrCacheList)
+void Core::ClearDueCacheCompressOffsets(void)
+{
+    for (CacheEntry *cacheEntry : mDueCaches)
     {
-        addrCache.HandleTimer(context);
+        for (; cacheEntry != nullptr; cacheEntry = cacheEntry->mNextDue)
+        {
+            cacheEntry->ClearCompressOffsets();
+        }
     }
-
-    context.GetQueryMessage().Send();
-
-    mCacheTimer.FireAtIfEarlier(context.GetNextFireTime());
 }
 
 void Core::HandleCacheTask(void)
@@ -4527,6 +4659,7 @@ void Core::ResultCallback::Invoke(Instance &aInstance, const AddressResult &aRes
 
 Core::CacheTimerContext::CacheTimerContext(Instance &aInstance)
     : InstanceLocator(aInstance)
+    , mNow(TimerMilli::GetNow())
     , mQueryMessage(aInstance, TxMessage::kMulticastQuery)
 {
 }
@@ -4657,6 +4790,139 @@ TimeMilli Core::CacheRecordInfo::GetQueryTime(uint8_t aAttemptIndex) const
     return mLastRxTime + kTtlFactors[aAttemptIndex] * GetClampedTtl();
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+// Core::CacheFireTimeHeap
+
+void Core::CacheFireTimeHeap::Update(CacheEntry &aCacheEntry)
+{
+    // Adds `aCacheEntry` to the heap, moves it to the position of its
+    // new fire time, or removes it if it has no fire time.
+
+    uint16_t index = aCacheEntry.mHeapIndex;
+
+    if (!aCacheEntry.HasFireTime())
+    {
+        Remove(aCacheEntry);
+        ExitNow();
+    }
+
+    if (index == kNotInHeap)
+    {
+        Node node;
+
+        node.mFireTime   = aCacheEntry.GetFireTime();
+        node.mCacheEntry = &aCacheEntry;
+
+        SuccessOrAssert(mNodes.PushBack(node));
+        index = mNodes.GetLength() - 1;
+        Place(index, node);
+    }
+    else
+    {
+        mNodes[index].mFireTime = aCacheEntry.GetFireTime();
+    }
+
+    SiftUp(index);
+    SiftDown(aCacheEntry.mHeapIndex);
+
+exit:
+    return;
+}
+
+void Core::CacheFireTimeHeap::Remove(CacheEntry &aCacheEntry)
+{
+    if (aCacheEntry.mHeapIndex != kNotInHeap)
+    {
+        RemoveAt(aCacheEntry.mHeapIndex);
+    }
+}
+
+Core::CacheEntry *Core::CacheFireTimeHeap::PopDue(TimeMilli aNow)
+{
+    CacheEntry *cacheEntry = nullptr;
+
+    VerifyOrExit(!IsEmpty());
+    VerifyOrExit(mNodes[0].mFireTime <= aNow);
+
+    cacheEntry = mNodes[0].mCacheEntry;
+    RemoveAt(0);
+
+exit:
+    return cacheEntry;
+}
+
+void Core::CacheFireTimeHeap::Place(uint16_t aIndex, const Node &aNode)
+{
+    mNodes[aIndex]                = aNode;
+    aNode.mCacheEntry->mHeapIndex = aIndex;
+}
+
+void Core::CacheFireTimeHeap::RemoveAt(uint16_t aIndex)
+{
+    uint16_t lastIndex = mNodes.GetLength() - 1;
+
+    mNodes[aIndex].mCacheEntry->mHeapIndex = kNotInHeap;
+
+    if (aIndex != lastIndex)
+    {
+        Place(aIndex, mNodes[lastIndex]);
+    }
+
+    mNodes.PopBack();
+
+    if (aIndex != lastIndex)
+    {
+        SiftDown(aIndex);
+        SiftUp(aIndex);
+    }
+}
+
+void Core::CacheFireTimeHeap::SiftUp(uint16_t aIndex)
+{
+    Node node = mNodes[aIndex];
+
+    while (aIndex > 0)
+    {
+        uint16_t parent = static_cast<uint16_t>((aIndex - 1) / 2);
+
+        if (!(node.mFireTime < mNodes[parent].mFireTime))
+        {
+            break;
+        }
+
+        Place(aIndex, mNodes[parent]);
+        aIndex = parent;
+    }
+
+    Place(aIndex, node);
+}
+
+void Core::CacheFireTimeHeap::SiftDown(uint16_t aIndex)
+{
+    Node     node   = mNodes[aIndex];
+    uint16_t length = mNodes.GetLength();
+
+    while (2 * static_cast<uint32_t>(aIndex) + 1 < length)
+    {
+        uint16_t child = static_cast<uint16_t>(2 * aIndex + 1);
+
+        if ((child + 1 < length) && (mNodes[child + 1].mFireTime < mNodes[child].mFireTime))
+        {
+            child++;
+        }
+
+        if (!(mNodes[child].mFireTime < node.mFireTime))
+        {
+            break;
+        }
+
+        Place(aIndex, mNodes[child]);
+        aIndex = child;
+    }
+
+    Place(aIndex, node);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 // Core::CacheEntry
 
@@ -4664,12 +4930,21 @@ void Core::CacheEntry::Init(Instance &aInstance, Type aType)
 {
     InstanceLocatorInit::Init(aInstance);
 
+    mNextInTable        = nullptr;
+    mNextDue            = nullptr;
+    mNameHash           = 0;
+    mHeapIndex          = CacheFireTimeHeap::kNotInHeap;
     mType               = aType;
     mInitalQueries      = 0;
     mQueryPending       = false;
     mLastQueryTimeValid = false;
     mIsActive           = false;
     mDeleteTime         = TimerMilli::GetNow() + kNonActiveDeleteTimeout;
+
+    // A new entry is passive until a resolver/browser is added, so
+    // it fires at `mDeleteTime` to get deleted.
+
+    SetFireTime(mDeleteTime);
 }
 
 void Core::CacheEntry::SetIsActive(bool aIsActive)
@@ -4833,7 +5108,7 @@ void Core::CacheEntry::ClearEmptyCallbacks(void)
     }
 }
 
-void Core::CacheEntry::HandleTimer(CacheTimerContext &aContext)
+void Core::CacheEntry::ClearCompressOffsets(void)
 {
     switch (mType)
     {
@@ -4853,16 +5128,17 @@ void Core::CacheEntry::HandleTimer(CacheTimerContext &aContext)
         // in any other query question.
         break;
     }
+}
+
+void Core::CacheEntry::HandleTimer(CacheTimerContext &aContext)
+{
+    // Called from `Core::HandleCacheTimer()` for an entry which was
+    // popped from `mCacheFireTimes` as due (and not to be deleted).
 
     VerifyOrExit(HasFireTime());
     VerifyOrExit(GetFireTime() <= aContext.GetNow());
     ClearFireTime();
 
-    if (ShouldDelete(aContext.GetNow()))
-    {
-        ExitNow();
-    }
-
     if (ShouldQuery(aContext.GetNow()))
     {
         mQueryPending = false;
@@ -4889,7 +5165,7 @@ void Core::CacheEntry::HandleTimer(CacheTimerContext &aContext)
     DetermineNextFireTime();
 
 exit:
-    UpdateNextFireTimeOn(aContext.GetNextFireTime());
+    return;
 }
 
 Core::ResultCallback *Core::CacheEntry::FindCallbackMatching(const ResultCallback &aCallback)
@@ -4952,7 +5228,11 @@ void Core::CacheEntry::DetermineNextFireTime(void)
     }
 }
 
-void Core::CacheEntry::ScheduleTimer(void) { ScheduleFireTimeOn(Get<Core>().mCacheTimer); }
+void Core::CacheEntry::ScheduleTimer(void)
+{
+    Get<Core>().mCacheFireTimes.Update(*this);
+    ScheduleFireTimeOn(Get<Core>().mCacheTimer);
+}
 
 void Core::CacheEntry::PrepareQuery(CacheTimerContext &aContext)
 {
@@ -5192,8 +5472,16 @@ void Core::BrowseCache::PreparePtrQuestion(TxMessage &aQuery, TimeMilli aNow)
 
 void Core::BrowseCache::DiscoverCompressOffsets(void)
 {
-    for (const BrowseCache &browseCache : Get<Core>().mBrowseCacheList)
+    // Only the entries which are due in the current round of
+    // `HandleCacheTimer()` have appended names to the query, so
+    // we look for the offsets in the `mDueCaches` lists.
+
+    const CacheEntry *entry;
+
+    for (entry = Get<Core>().mDueCaches[kBrowseCache]; entry != nullptr; entry = entry->GetNextDue())
     {
+        const BrowseCache &browseCache = *static_cast<const BrowseCache *>(entry);
+
         if (&browseCache == this)
         {
             break;
@@ -5209,8 +5497,10 @@ void Core::BrowseCache::DiscoverCompressOffsets(void)
 
     VerifyOrExit(mServiceTypeOffset == kUnspecifiedOffset);
 
-    for (const SrvCache &srvCache : Get<Core>().mSrvCacheList)
+    for (entry = Get<Core>().mDueCaches[kSrvCache]; entry != nullptr; entry = entry->GetNextDue())
     {
+        const SrvCache &srvCache = *static_cast<const SrvCache *>(entry);
+
         if (NameMatch(srvCache.mServiceType, mServiceType))
         {
             UpdateCompressOffset(mServiceTypeOffset, srvCache.mServiceTypeOffset);
@@ -5218,8 +5508,10 @@ void Core::BrowseCache::DiscoverCompressOffsets(void)
         }
     }
 
-    for (const TxtCache &txtCache : Get<Core>().mTxtCacheList)
+    for (entry = Get<Core>().mDueCaches[kTxtCache]; entry != nullptr; entry = entry->GetNextDue())
     {
+        const TxtCache &txtCache = *static_cast<const TxtCache *>(entry);
+
         if (NameMatch(txtCache.mServiceType, mServiceType))
         {
             UpdateCompressOffset(mServiceTypeOffset, txtCache.mServiceTypeOffset);
@@ -5564,8 +5856,10 @@ void Core::SrvCache::PrepareSrvQuestion(TxMessage &aQuery)
 
 void Core::SrvCache::DiscoverCompressOffsets(void)
 {
-    for (const SrvCache &srvCache : Get<Core>().mSrvCacheList)
+    for (const CacheEntry *entry = Get<Core>().mDueCaches[kSrvCache]; entry != nullptr; entry = entry->GetNextDue())
     {
+        const SrvCache &srvCache = *static_cast<const SrvCache *>(entry);
+
         if (&srvCache == this)
         {
             break;
@@ -5734,8 +6028,12 @@ void Core::TxtCache::PrepareTxtQuestion(TxMessage &aQuery)
 
 void Core::TxtCache::DiscoverCompressOffsets(void)
 {
-    for (const SrvCache &srvCache : Get<Core>().mSrvCacheList)
+    const CacheEntry *entry;
+
+    for (entry = Get<Core>().mDueCaches[kSrvCache]; entry != nullptr; entry = entry->GetNextDue())
     {
+        const SrvCache &srvCache = *static_cast<const SrvCache *>(entry);
+
         if (!NameMatch(srvCache.mServiceType, mServiceType))
         {
             continue;
@@ -5751,8 +6049,10 @@ void Core::TxtCache::DiscoverCompressOffsets(void)
         VerifyOrExit(mServiceNameOffset == kUnspecifiedOffset);
     }
 
-    for (const TxtCache &txtCache : Get<Core>().mTxtCacheList)
+    for (entry = Get<Core>().mDueCaches[kTxtCache]; entry != nullptr; entry = entry->GetNextDue())
     {
+        const TxtCache &txtCache = *static_cast<const TxtCache *>(entry);
+
         if (&txtCache == this)
         {
             break;
@@ -5827,8 +6127,9 @@ Error Core::AddrCache::Init(Instance &aInstance, Type aType, const char *aHostNa
 {
     CacheEntry::Init(aInstance, aType);
 
-    mNext        = nullptr;
-    mShouldFlush = false;
+    mNext         = nullptr;
+    mNextToCommit = nullptr;
+    mShouldFlush  = false;
 
     return mName.Set(aHostName);
 }
@@ -6022,6 +6323,15 @@ void Core::AddrCache::AddNewResponseAddress(const Ip6::Address &aAddress, uint32
 
     AddrEntry *entry;
 
+    if (mNewEntries.IsEmpty())
+    {
+        // First address from this response, add the entry to the
+        // list of entries to commit.
+
+        mNextToCommit                   = Get<Core>().mAddrCachesToCommit;
+        Get<Core>().mAddrCachesToCommit = this;
+    }
+
     if (aCacheFlush)
     {
         mShouldFlush = true;
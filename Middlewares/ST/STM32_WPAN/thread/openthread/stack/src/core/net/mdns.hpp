@@ -41,6 +41,7 @@
 #include "common/debug.hpp"
 #include "common/equatable.hpp"
 #include "common/error.hpp"
+#include "common/hash_table.hpp"
 #include "common/heap_allocatable.hpp"
 #include "common/heap_array.hpp"
 #include "common/heap_data.hpp"
@@ -73,6 +74,9 @@ struct otMdnsIterator
 };
 
 namespace ot {
+
+class UnitTester;
+
 namespace Dns {
 namespace Multicast {
 
@@ -91,6 +95,7 @@ class Core : public InstanceLocator, private NonCopyable
                                         otMessage                   *aMessage,
                                         bool                         aIsUnicast,
                                         const otPlatMdnsAddressInfo *aAddress);
+    friend class ot::UnitTester;
 
 public:
     /**
@@ -1052,6 +1057,8 @@ private:
         friend class LinkedListEntry<HostEntry>;
         friend class Entry;
         friend class ServiceEntry;
+        friend class Core;
+        friend class ot::UnitTester;
 
     public:
         HostEntry(void);
@@ -1095,6 +1102,8 @@ private:
         static void AppendEntryName(Entry &aEntry, TxMessage &aTxMessage, Section aSection);
 
         HostEntry   *mNext;
+        HostEntry   *mNextInTable;
+        uint32_t     mNameHash;
         Heap::String mName;
         RecordInfo   mAddrRecord;
         AddressArray mAddresses;
@@ -1108,6 +1117,8 @@ private:
         friend class LinkedListEntry<ServiceEntry>;
         friend class Entry;
         friend class ServiceType;
+        friend class Core;
+        friend class ot::UnitTester;
 
     public:
         ServiceEntry(void);
@@ -1178,6 +1189,8 @@ private:
         static const uint8_t kEmptyTxtData[];
 
         ServiceEntry       *mNext;
+        ServiceEntry       *mNextInTable;
+        uint32_t            mNameHash;
         Heap::String        mServiceInstance;
         Heap::String        mServiceType;
         RecordInfo          mPtrRecord;
@@ -1537,13 +1550,12 @@ private:
     {
     public:
         CacheTimerContext(Instance &aInstance);
-        TimeMilli     GetNow(void) const { return mNextFireTime.GetNow(); }
-        NextFireTime &GetNextFireTime(void) { return mNextFireTime; }
-        TxMessage    &GetQueryMessage(void) { return mQueryMessage; }
+        TimeMilli  GetNow(void) const { return mNow; }
+        TxMessage &GetQueryMessage(void) { return mQueryMessage; }
 
     private:
-        NextFireTime mNextFireTime;
-        TxMessage    mQueryMessage;
+        TimeMilli mNow;
+        TxMessage mQueryMessage;
     };
 
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -1578,6 +1590,45 @@ private:
 
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
+    class CacheFireTimeHeap
+    {
+        // Min-heap of the fire times of all cache entries, so that
+        // `HandleCacheTimer()` only visits the entries which are due.
+        // Each node keeps the fire time of its entry as of the last
+        // `Update()`, and each entry tracks its node index in
+        // `mHeapIndex`.
+
+        friend class ot::UnitTester;
+
+    public:
+        static constexpr uint16_t kNotInHeap = NumericLimits<uint16_t>::kMax;
+
+        void        Update(CacheEntry &aCacheEntry);
+        void        Remove(CacheEntry &aCacheEntry);
+        CacheEntry *PopDue(TimeMilli aNow);
+        bool        IsEmpty(void) const { return (mNodes.GetLength() == 0); }
+        TimeMilli   GetEarliestFireTime(void) const { return mNodes[0].mFireTime; }
+        void        Clear(void) { mNodes.Free(); }
+
+    private:
+        static constexpr uint16_t kCapacityIncrement = 32;
+
+        struct Node
+        {
+            TimeMilli   mFireTime;
+            CacheEntry *mCacheEntry;
+        };
+
+        void Place(uint16_t aIndex, const Node &aNode);
+        void RemoveAt(uint16_t aIndex);
+        void SiftUp(uint16_t aIndex);
+        void SiftDown(uint16_t aIndex);
+
+        Heap::Array<Node, kCapacityIncrement> mNodes;
+    };
+
+    // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
     class CacheEntry : public FireTime, public InstanceLocatorInit, private NonCopyable
     {
         // Base class for cache entries: `BrowseCache`, `mSrvCache`,
@@ -1587,12 +1638,11 @@ private:
         // invokes sub-class method for type-specific behaviors
         // (e.g., query message construction).
 
-    public:
-        void HandleTimer(CacheTimerContext &aContext);
-        void ClearEmptyCallbacks(void);
-        void ScheduleQuery(TimeMilli aQueryTime);
+        friend class Core;
+        friend class CacheFireTimeHeap;
+        friend class ot::UnitTester;
 
-    protected:
+    public:
         enum Type : uint8_t
         {
             kBrowseCache,
@@ -1602,6 +1652,15 @@ private:
             kIp4AddrCache,
         };
 
+        static constexpr uint8_t kNumTypes = kIp4AddrCache + 1;
+
+        void              HandleTimer(CacheTimerContext &aContext);
+        void              ClearEmptyCallbacks(void);
+        void              ScheduleQuery(TimeMilli aQueryTime);
+        void              ClearCompressOffsets(void);
+        const CacheEntry *GetNextDue(void) const { return mNextDue; }
+
+    protected:
         void  Init(Instance &aInstance, Type aType);
         bool  IsActive(void) const { return mIsActive; }
         bool  ShouldDelete(TimeMilli aNow) const;
@@ -1631,6 +1690,10 @@ private:
         template <typename CacheType> CacheType       &As(void) { return *static_cast<CacheType *>(this); }
         template <typename CacheType> const CacheType &As(void) const { return *static_cast<const CacheType *>(this); }
 
+        CacheEntry  *mNextInTable;            // Next entry in `Core::mCacheTable` bucket.
+        CacheEntry  *mNextDue;                // Next entry in `Core::mDueCaches` list of its type.
+        uint32_t     mNameHash;               // Hash of the first label of the entry name.
+        uint16_t     mHeapIndex;              // Index in `Core::mCacheFireTimes` or `kNotInHeap`.
         Type         mType;                   // Cache entry type.
         uint8_t      mInitalQueries;          // Number initial queries sent already.
         bool         mQueryPending : 1;       // Whether a query tx request is pending.
@@ -1651,6 +1714,8 @@ private:
         friend class CacheEntry;
 
     public:
+        static constexpr Type kType = kBrowseCache;
+
         void  ClearCompressOffsets(void);
         bool  Matches(const Name &aFullName) const;
         bool  Matches(const char *aServiceType, const char *aSubTypeLabel) const;
@@ -1755,6 +1820,8 @@ private:
         friend class BrowseCache;
 
     public:
+        static constexpr Type kType = kSrvCache;
+
         bool  Matches(const Name &aFullName) const;
         bool  Matches(const SrvResolver &aResolver) const;
         bool  Matches(const ServiceName &aServiceName) const;
@@ -1793,6 +1860,8 @@ private:
         friend class BrowseCache;
 
     public:
+        static constexpr Type kType = kTxtCache;
+
         bool  Matches(const Name &aFullName) const;
         bool  Matches(const TxtResolver &aResolver) const;
         bool  Matches(const ServiceName &aServiceName) const;
@@ -1826,6 +1895,7 @@ private:
         // shared between the two.
 
         friend class CacheEntry;
+        friend class Core;
 
     public:
         bool  Matches(const Name &aFullName) const;
@@ -1868,6 +1938,7 @@ private:
         void  AddNewResponseAddress(const Ip6::Address &aAddress, uint32_t aTtl, bool aCacheFlush);
 
         AddrCache            *mNext;
+        AddrCache            *mNextToCommit;
         Heap::String          mName;
         OwningList<AddrEntry> mCommittedEntries;
         OwningList<AddrEntry> mNewEntries;
@@ -1883,6 +1954,8 @@ private:
         friend class Heap::Allocatable<Ip6AddrCache>;
 
     public:
+        static constexpr Type kType = kIp6AddrCache;
+
         void ProcessResponseRecord(const Message &aMessage, uint16_t aRecordOffset);
 
     private:
@@ -1900,6 +1973,8 @@ private:
         friend class Heap::Allocatable<Ip4AddrCache>;
 
     public:
+        static constexpr Type kType = kIp4AddrCache;
+
         void ProcessResponseRecord(const Message &aMessage, uint16_t aRecordOffset);
 
     private:
@@ -1966,12 +2041,28 @@ private:
 
     // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
+    // Host and service entries (the ones in `mHostEntries` and
+    // `mServiceEntries`) are in `mHostEntryTable` and
+    // `mServiceEntryTable`, and all cache entries are in
+    // `mCacheTable`. The key of an entry is the first label of its
+    // name, i.e., the host name, the service instance label, or the
+    // sub-type label or service type of a browser.
+
+    static constexpr uint16_t kNameTableSize = OPENTHREAD_CONFIG_MULTICAST_DNS_NAME_TABLE_SIZE;
+
+    template <typename EntryType> using NameTable = HashTable<EntryType, &EntryType::mNextInTable, kNameTableSize>;
+
     template <typename EntryType> OwningList<EntryType> &GetEntryList(void);
+    template <typename EntryType> NameTable<EntryType> &GetEntryTable(void);
+    template <typename EntryType, typename KeyType> EntryType *FindEntry(const KeyType &aKey);
     template <typename EntryType, typename ItemInfo>
     Error Register(const ItemInfo &aItemInfo, RequestId aRequestId, RegisterCallback aCallback);
     template <typename EntryType, typename ItemInfo> Error Unregister(const ItemInfo &aItemInfo);
 
     template <typename CacheType> OwningList<CacheType> &GetCacheList(void);
+    template <typename CacheType, typename KeyType> CacheType *FindCache(const KeyType &aKey);
+    template <typename CacheType, typename KeyType> CacheType *AddCache(const KeyType &aKey);
+    template <typename CacheType> void RemoveExpiredCaches(const ExpireChecker &aExpireChecker);
     template <typename CacheType, typename BrowserResolverType>
     Error Start(const BrowserResolverType &aBrowserOrResolver);
     template <typename CacheType, typename BrowserResolverType>
@@ -1981,6 +2072,7 @@ private:
     void      HandleMessage(Message &aMessage, bool aIsUnicast, const AddressInfo &aSenderAddress);
     void      AddPassiveSrvTxtCache(const char *aServiceInstance, const char *aServiceType);
     void      AddPassiveIp6AddrCache(const char *aHostName);
+    void      CommitNewAddrCacheEntries(void);
     TimeMilli RandomizeFirstProbeTxTime(void);
     TimeMilli RandomizeInitialQueryTxTime(void);
     void      RemoveEmptyEntries(void);
@@ -1988,6 +2080,19 @@ private:
     void      HandleEntryTask(void);
     void      HandleCacheTimer(void);
     void      HandleCacheTask(void);
+    void      ClearDueCacheCompressOffsets(void);
+
+    static uint32_t HashKey(const char *aName);
+    static uint32_t HashKey(const Heap::String &aName) { return HashKey(aName.AsCString()); }
+    static uint32_t HashKey(const Name &aName);
+    static uint32_t HashKey(const Host &aHost) { return HashKey(aHost.mHostName); }
+    static uint32_t HashKey(const Service &aService) { return HashKey(aService.mServiceInstance); }
+    static uint32_t HashKey(const Key &aKey) { return HashKey(aKey.mName); }
+    static uint32_t HashKey(const Browser &aBrowser);
+    static uint32_t HashKey(const SrvResolver &aResolver) { return HashKey(aResolver.mServiceInstance); }
+    static uint32_t HashKey(const TxtResolver &aResolver) { return HashKey(aResolver.mServiceInstance); }
+    static uint32_t HashKey(const AddressResolver &aResolver) { return HashKey(aResolver.mHostName); }
+    static uint32_t HashKey(const ServiceName &aServiceName) { return HashKey(aServiceName.mServiceInstance); }
 
     static bool     IsKeyForService(const Key &aKey) { return aKey.mServiceType != nullptr; }
     static uint32_t DetermineTtl(uint32_t aTtl, uint32_t aDefaultTtl);
@@ -2018,6 +2123,8 @@ private:
     uint32_t                 mInfraIfIndex;
     OwningList<HostEntry>    mHostEntries;
     OwningList<ServiceEntry> mServiceEntries;
+    NameTable<HostEntry>     mHostEntryTable;
+    NameTable<ServiceEntry>  mServiceEntryTable;
     OwningList<ServiceType>  mServiceTypes;
     MultiPacketRxMessages    mMultiPacketRxMessages;
     TimeMilli                mNextProbeTxTime;
@@ -2031,6 +2138,10 @@ private:
     OwningList<TxtCache>     mTxtCacheList;
     OwningList<Ip6AddrCache> mIp6AddrCacheList;
     OwningList<Ip4AddrCache> mIp4AddrCacheList;
+    NameTable<CacheEntry>    mCacheTable;
+    CacheFireTimeHeap        mCacheFireTimes;
+    CacheEntry              *mDueCaches[CacheEntry::kNumTypes];
+    AddrCache               *mAddrCachesToCommit;
     TimeMilli                mNextQueryTxTime;
     CacheTimer               mCacheTimer;
     CacheTask                mCacheTask;
@@ -2045,6 +2156,18 @@ template <> inline OwningList<Core::ServiceEntry> &Core::GetEntryList<Core::Serv
     return mServiceEntries;
 }
 
+// Specializations of `Core::GetEntryTable()` for `HostEntry` and `ServiceEntry`:
+
+template <> inline Core::NameTable<Core::HostEntry> &Core::GetEntryTable<Core::HostEntry>(void)
+{
+    return mHostEntryTable;
+}
+
+template <> inline Core::NameTable<Core::ServiceEntry> &Core::GetEntryTable<Core::ServiceEntry>(void)
+{
+    return mServiceEntryTable;
+}
+
 // Specializations of `Core::GetCacheList()`:
 
 template <> inline OwningList<Core::BrowseCache> &Core::GetCacheList<Core::BrowseCache>(void)
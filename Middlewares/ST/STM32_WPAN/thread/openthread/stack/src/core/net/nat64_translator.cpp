@@ -41,6 +41,7 @@
 #include "common/code_utils.hpp"
 #include "common/locator_getters.hpp"
 #include "common/log.hpp"
+#include "common/num_utils.hpp"
 #include "net/checksum.hpp"
 #include "net/ip4_types.hpp"
 #include "net/ip6.hpp"
@@ -70,13 +71,14 @@ const char *StateToString(State aState)
 Translator::Translator(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mState(State::kStateDisabled)
+    , mExpirySlotIndex(0)
+    , mExpirySlotTime(0)
     , mMappingExpirerTimer(aInstance)
 {
     Random::NonCrypto::Fill(mNextMappingId);
 
     mNat64Prefix.Clear();
     mIp4Cidr.Clear();
-    mMappingExpirerTimer.Start(kAddressMappingIdleTimeoutMsec);
 }
 
 Message *Translator::NewIp4Message(const Message::Settings &aSettings)
@@ -177,8 +179,8 @@ Translator::Result Translator::TranslateFromIp6(Message &aMessage)
     // res here must be kForward based on the switch above.
     // TODO: Implement the logic for replying ICMP messages.
     ip4Header.SetTotalLength(sizeof(Ip4::Header) + aMessage.GetLength() - aMessage.GetOffset());
-    Checksum::UpdateMessageChecksum(aMessage, ip4Header.GetSource(), ip4Header.GetDestination(),
-                                    ip4Header.GetProtocol());
+    Checksum::TranslateMessageChecksum(aMessage, ip6Header.GetSource(), ip6Header.GetDestination(),
+                                       ip4Header.GetSource(), ip4Header.GetDestination(), ip4Header.GetProtocol());
     Checksum::UpdateIp4HeaderChecksum(ip4Header);
     if (aMessage.Prepend(ip4Header) != kErrorNone)
     {
@@ -272,8 +274,8 @@ Translator::Result Translator::TranslateToIp6(Message &aMessage)
     // res here must be kForward based on the switch above.
     // TODO: Implement the logic for replying ICMP datagrams.
     ip6Header.SetPayloadLength(aMessage.GetLength() - aMessage.GetOffset());
-    Checksum::UpdateMessageChecksum(aMessage, ip6Header.GetSource(), ip6Header.GetDestination(),
-                                    ip6Header.GetNextHeader());
+    Checksum::TranslateMessageChecksum(aMessage, ip4Header.GetSource(), ip4Header.GetDestination(),
+                                       ip6Header.GetSource(), ip6Header.GetDestination(), ip6Header.GetNextHeader());
     if (aMessage.Prepend(ip6Header) != kErrorNone)
     {
         // This might happen when the platform failed to reserve enough space before the original IPv4 datagram.
@@ -323,6 +325,10 @@ void Translator::AddressMapping::CopyTo(otNat64AddressMapping &aMapping, TimeMil
 
 void Translator::ReleaseMapping(AddressMapping &aMapping)
 {
+    uint16_t index = mAddressMappingPool.GetIndexOf(aMapping);
+
+    mIp6Index.Remove(index);
+    mIp4Index.Remove(index);
     IgnoreError(mIp4AddressPool.PushBack(aMapping.mIp4));
     mAddressMappingPool.Free(aMapping);
     LogInfo("mapping removed: %s", aMapping.ToString().AsCString());
@@ -341,18 +347,95 @@ uint16_t Translator::ReleaseMappings(LinkedList<AddressMapping> &aMappings)
     return numRemoved;
 }
 
+uint16_t Translator::ReleaseAllMappings(void)
+{
+    uint16_t numRemoved = 0;
+
+    for (LinkedList<AddressMapping> &slot : mExpirySlots)
+    {
+        numRemoved += ReleaseMappings(slot);
+    }
+
+    return numRemoved;
+}
+
 uint16_t Translator::ReleaseExpiredMappings(void)
 {
+    TimeMilli                  now = TimerMilli::GetNow();
     LinkedList<AddressMapping> idleMappings;
 
-    mActiveAddressMappings.RemoveAllMatching(TimerMilli::GetNow(), idleMappings);
+    // The wheel is first advanced over the slots whose time has
+    // passed. Their mappings are either expired, or were touched after
+    // being added and are added again to the slot of their new expiry
+    // time. The mappings of the current slot may also be expired.
+
+    while (now - mExpirySlotTime >= kExpirySlotDurationMsec)
+    {
+        AddressMapping *mapping = mExpirySlots[mExpirySlotIndex].GetHead();
+        AddressMapping *next;
+
+        mExpirySlots[mExpirySlotIndex].Clear();
+        mExpirySlotIndex = static_cast<uint16_t>((mExpirySlotIndex + 1) % kNumExpirySlots);
+        mExpirySlotTime += kExpirySlotDurationMsec;
+
+        for (; mapping != nullptr; mapping = next)
+        {
+            next = mapping->GetNext();
+
+            if (mapping->Matches(now))
+            {
+                idleMappings.Push(*mapping);
+            }
+            else
+            {
+                AddToExpiryWheel(*mapping);
+            }
+        }
+    }
+
+    mExpirySlots[mExpirySlotIndex].RemoveAllMatching(now, idleMappings);
 
     return ReleaseMappings(idleMappings);
 }
 
+void Translator::AddToExpiryWheel(AddressMapping &aMapping)
+{
+    uint32_t numSlotsAhead = 0;
+
+    // A mapping touched after the wheel time went past its slot
+    // (`Touch()` does not move it) is added to the last slot, and is
+    // moved again when the wheel reaches it.
+
+    if (aMapping.mExpiry > mExpirySlotTime)
+    {
+        numSlotsAhead = (aMapping.mExpiry - mExpirySlotTime) / kExpirySlotDurationMsec;
+        numSlotsAhead = Min<uint32_t>(numSlotsAhead, kNumExpirySlots - 1);
+    }
+
+    mExpirySlots[(mExpirySlotIndex + numSlotsAhead) % kNumExpirySlots].Push(aMapping);
+}
+
+bool Translator::HasMappings(void) const
+{
+    bool hasMappings = false;
+
+    for (const LinkedList<AddressMapping> &slot : mExpirySlots)
+    {
+        if (!slot.IsEmpty())
+        {
+            hasMappings = true;
+            break;
+        }
+    }
+
+    return hasMappings;
+}
+
 Translator::AddressMapping *Translator::AllocateMapping(const Ip6::Address &aIp6Addr)
 {
     AddressMapping *mapping = nullptr;
+    TimeMilli       now     = TimerMilli::GetNow();
+    uint16_t        index;
 
     // The address pool will be no larger than the mapping pool, so checking the address pool is enough.
     if (mIp4AddressPool.IsEmpty())
@@ -366,21 +449,53 @@ Translator::AddressMapping *Translator::AllocateMapping(const Ip6::Address &aIp6
     // empty.
     VerifyOrExit(mapping != nullptr);
 
-    mActiveAddressMappings.Push(*mapping);
     mapping->mId  = ++mNextMappingId;
     mapping->mIp6 = aIp6Addr;
     // PopBack must return a valid address since it is not empty.
     mapping->mIp4 = *mIp4AddressPool.PopBack();
-    mapping->Touch(TimerMilli::GetNow());
+    mapping->Touch(now);
+
+    index = mAddressMappingPool.GetIndexOf(*mapping);
+    mIp6Index.Add(index, HashAddress(mapping->mIp6));
+    mIp4Index.Add(index, HashAddress(mapping->mIp4));
+
+    // The timer runs as long as there is any mapping, otherwise the
+    // wheel is empty and it starts over from the current time.
+    if (!mMappingExpirerTimer.IsRunning())
+    {
+        mExpirySlotTime = now;
+        mMappingExpirerTimer.FireAt(now + kExpirySlotDurationMsec);
+    }
+
+    AddToExpiryWheel(*mapping);
     LogInfo("mapping created: %s", mapping->ToString().AsCString());
 
 exit:
     return mapping;
 }
 
+template <typename AddressType>
+Translator::AddressMapping *Translator::FindMapping(const AddressIndex &aIndex, const AddressType &aAddress)
+{
+    AddressMapping *mapping = nullptr;
+    uint16_t        slot    = aIndex.GetHomeSlot(HashAddress(aAddress));
+    uint16_t        index;
+
+    while ((index = aIndex.GetNext(slot)) != AddressIndex::kNotFound)
+    {
+        if (mAddressMappingPool.GetEntryAt(index).Matches(aAddress))
+        {
+            mapping = &mAddressMappingPool.GetEntryAt(index);
+            break;
+        }
+    }
+
+    return mapping;
+}
+
 Translator::AddressMapping *Translator::FindOrAllocateMapping(const Ip6::Address &aIp6Addr)
 {
-    AddressMapping *mapping = mActiveAddressMappings.FindMatching(aIp6Addr);
+    AddressMapping *mapping = FindMapping(mIp6Index, aIp6Addr);
 
     // Exit if we found a valid mapping.
     VerifyOrExit(mapping == nullptr);
@@ -393,7 +508,7 @@ exit:
 
 Translator::AddressMapping *Translator::FindMapping(const Ip4::Address &aIp4Addr)
 {
-    AddressMapping *mapping = mActiveAddressMappings.FindMatching(aIp4Addr);
+    AddressMapping *mapping = FindMapping(mIp4Index, aIp4Addr);
 
     if (mapping != nullptr)
     {
@@ -417,9 +532,13 @@ Error Translator::TranslateIcmp4(Message &aMessage)
     case Ip4::Icmp::Header::Type::kTypeEchoReply:
     {
         // The only difference between ICMPv6 echo and ICMP4 echo is the message type field, so we can reinterpret it as
-        // ICMP6 header and set the message type.
+        // ICMP6 header and set the message type. The checksum is updated for the type here, the caller then adds the
+        // ICMPv6 pseudo-header to it.
         SuccessOrExit(err = aMessage.Read(0, icmp6Header));
         icmp6Header.SetType(Ip6::Icmp::Header::Type::kTypeEchoReply);
+        icmp6Header.SetChecksum(Checksum::UpdateChecksum(icmp6Header.GetChecksum(),
+                                                         Ip4::Icmp::Header::Type::kTypeEchoReply << 8,
+                                                         Ip6::Icmp::Header::Type::kTypeEchoReply << 8));
         aMessage.Write(0, icmp6Header);
         break;
     }
@@ -447,9 +566,13 @@ Error Translator::TranslateIcmp6(Message &aMessage)
     case Ip6::Icmp::Header::Type::kTypeEchoRequest:
     {
         // The only difference between ICMPv6 echo and ICMP4 echo is the message type field, so we can reinterpret it as
-        // ICMP6 header and set the message type.
+        // ICMP6 header and set the message type. The checksum is updated for the type here, the caller then removes
+        // the ICMPv6 pseudo-header from it.
         SuccessOrExit(err = aMessage.Read(0, icmp4Header));
         icmp4Header.SetType(Ip4::Icmp::Header::Type::kTypeEchoRequest);
+        icmp4Header.SetChecksum(Checksum::UpdateChecksum(icmp4Header.GetChecksum(),
+                                                         Ip6::Icmp::Header::Type::kTypeEchoRequest << 8,
+                                                         Ip4::Icmp::Header::Type::kTypeEchoRequest << 8));
         aMessage.Write(0, icmp4Header);
         break;
     }
@@ -493,8 +616,15 @@ Error Translator::SetIp4Cidr(const Ip4::Cidr &aCidr)
     numberOfHosts = OT_MIN(numberOfHosts, kAddressMappingPoolSize);
 
     mAddressMappingPool.FreeAll();
-    mActiveAddressMappings.Clear();
+    mIp6Index.Clear();
+    mIp4Index.Clear();
     mIp4AddressPool.Clear();
+    mMappingExpirerTimer.Stop();
+
+    for (LinkedList<AddressMapping> &slot : mExpirySlots)
+    {
+        slot.Clear();
+    }
 
     for (uint32_t i = 0; i < numberOfHosts; i++)
     {
@@ -543,15 +673,37 @@ exit:
 
 void Translator::HandleMappingExpirerTimer(void)
 {
-    LogInfo("Released %d expired mappings", ReleaseExpiredMappings());
-    mMappingExpirerTimer.Start(kAddressMappingIdleTimeoutMsec);
+    uint16_t numReleased = ReleaseExpiredMappings();
+
+    LogInfo("Released %u expired mappings", numReleased);
+    OT_UNUSED_VARIABLE(numReleased);
+
+    if (HasMappings())
+    {
+        mMappingExpirerTimer.FireAt(mExpirySlotTime + kExpirySlotDurationMsec);
+    }
 }
 
-void Translator::InitAddressMappingIterator(AddressMappingIterator &aIterator)
+Translator::AddressMapping *Translator::FindNextMapping(uint16_t aIndex)
 {
-    aIterator.mPtr = mActiveAddressMappings.GetHead();
+    // The active mappings are the pool entries which are in the indexes.
+
+    AddressMapping *mapping = nullptr;
+
+    for (; aIndex < mAddressMappingPool.GetSize(); aIndex++)
+    {
+        if (mIp6Index.Contains(aIndex))
+        {
+            mapping = &mAddressMappingPool.GetEntryAt(aIndex);
+            break;
+        }
+    }
+
+    return mapping;
 }
 
+void Translator::InitAddressMappingIterator(AddressMappingIterator &aIterator) { aIterator.mPtr = FindNextMapping(0); }
+
 Error Translator::GetNextAddressMapping(AddressMappingIterator &aIterator, otNat64AddressMapping &aMapping)
 {
     Error           err  = kErrorNotFound;
@@ -561,7 +713,7 @@ Error Translator::GetNextAddressMapping(AddressMappingIterator &aIterator, otNat
     VerifyOrExit(item != nullptr);
 
     item->CopyTo(aMapping, now);
-    aIterator.mPtr = item->GetNext();
+    aIterator.mPtr = FindNextMapping(mAddressMappingPool.GetIndexOf(*item) + 1);
     err            = kErrorNone;
 
 exit:
@@ -675,7 +827,8 @@ void Translator::SetEnabled(bool aEnabled)
 
     if (!aEnabled)
     {
-        ReleaseMappings(mActiveAddressMappings);
+        ReleaseAllMappings();
+        mMappingExpirerTimer.Stop();
     }
 
     UpdateState();
@@ -38,6 +38,7 @@
 #include "openthread-core-config.h"
 
 #include "common/array.hpp"
+#include "common/hash_index.hpp"
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/pool.hpp"
@@ -46,6 +47,9 @@
 #include "net/ip6.hpp"
 
 namespace ot {
+
+class UnitTester;
+
 namespace Nat64 {
 
 enum State : uint8_t
@@ -74,6 +78,8 @@ const char *StateToString(State aState);
  */
 class Translator : public InstanceLocator, private NonCopyable
 {
+    friend class ot::UnitTester;
+
 public:
     static constexpr uint32_t kAddressMappingIdleTimeoutMsec =
         OPENTHREAD_CONFIG_NAT64_IDLE_TIMEOUT_SECONDS * Time::kOneSecondInMsec;
@@ -338,11 +344,20 @@ public:
     Error GetIp6Prefix(Ip6::Prefix &aPrefix);
 
 private:
+    // Number of slots of the idle timeout wheel, each slot covering an
+    // equal part of the idle timeout.
+    static constexpr uint16_t kNumExpirySlots         = 16;
+    static constexpr uint32_t kExpirySlotDurationMsec = kAddressMappingIdleTimeoutMsec / kNumExpirySlots;
+
+    static_assert(kExpirySlotDurationMsec > 0, "OPENTHREAD_CONFIG_NAT64_IDLE_TIMEOUT_SECONDS is too small");
+
     class AddressMapping : public LinkedListEntry<AddressMapping>
     {
     public:
         friend class LinkedListEntry<AddressMapping>;
         friend class LinkedList<AddressMapping>;
+        friend class Translator;
+        friend class ot::UnitTester;
 
         typedef String<Ip6::Address::kInfoStringSize + Ip4::Address::kAddressStringSize + 4> InfoString;
 
@@ -369,12 +384,24 @@ private:
     Error TranslateIcmp4(Message &aMessage);
     Error TranslateIcmp6(Message &aMessage);
 
+    typedef HashIndex<kAddressMappingPoolSize> AddressIndex;
+
+    static uint32_t HashAddress(const Ip6::Address &aIp6) { return AddressIndex::HashBytes(&aIp6, sizeof(aIp6)); }
+    static uint32_t HashAddress(const Ip4::Address &aIp4) { return AddressIndex::HashBytes(&aIp4, sizeof(aIp4)); }
+
     uint16_t        ReleaseMappings(LinkedList<AddressMapping> &aMappings);
+    uint16_t        ReleaseAllMappings(void);
     void            ReleaseMapping(AddressMapping &aMapping);
     uint16_t        ReleaseExpiredMappings(void);
+    void            AddToExpiryWheel(AddressMapping &aMapping);
+    bool            HasMappings(void) const;
     AddressMapping *AllocateMapping(const Ip6::Address &aIp6Addr);
     AddressMapping *FindOrAllocateMapping(const Ip6::Address &aIp6Addr);
     AddressMapping *FindMapping(const Ip4::Address &aIp4Addr);
+    AddressMapping *FindNextMapping(uint16_t aIndex);
+
+    template <typename AddressType>
+    AddressMapping *FindMapping(const AddressIndex &aIndex, const AddressType &aAddress);
 
     void HandleMappingExpirerTimer(void);
 
@@ -389,7 +416,16 @@ private:
 
     Array<Ip4::Address, kAddressMappingPoolSize>  mIp4AddressPool;
     Pool<AddressMapping, kAddressMappingPoolSize> mAddressMappingPool;
-    LinkedList<AddressMapping>                    mActiveAddressMappings;
+    AddressIndex                                  mIp6Index;
+    AddressIndex                                  mIp4Index;
+
+    // Idle timeout wheel of the active mappings. A mapping is added to
+    // the slot of its expiry time, and is only moved when the wheel
+    // reaches its slot (touching it only updates its expiry time). A
+    // mapping is thus never in a slot after the one of its expiry time.
+    LinkedList<AddressMapping> mExpirySlots[kNumExpirySlots];
+    uint16_t                   mExpirySlotIndex; // Current slot of the wheel.
+    TimeMilli                  mExpirySlotTime;  // Start time of the current slot.
 
     Ip6::Prefix mNat64Prefix;
     Ip4::Cidr   mIp4Cidr;
@@ -324,6 +324,7 @@ void Server::RemoveHost(Host *aHost, RetainName aRetainName)
     {
         aHost->mKeyLease = 0;
         IgnoreError(mHosts.Remove(*aHost));
+        UnindexHost(*aHost);
         LogInfo("Fully remove host %s", aHost->GetFullName());
     }
 
@@ -358,7 +359,7 @@ exit:
 bool Server::HasNameConflictsWith(Host &aHost) const
 {
     bool        hasConflicts = false;
-    const Host *existingHost = mHosts.FindMatching(aHost.GetFullName());
+    const Host *existingHost = FindHost(aHost.GetFullName());
 
     if ((existingHost != nullptr) && (aHost.mKey != existingHost->mKey))
     {
@@ -372,9 +373,13 @@ bool Server::HasNameConflictsWith(Host &aHost) const
         // instance name and if found, verify that it has the same
         // key.
 
-        for (const Host &host : mHosts)
+        uint32_t hash = ServiceInstanceTable::HashName(service.GetInstanceName());
+
+        for (const Service *existingService = mServiceInstanceTable.GetHead(hash); existingService != nullptr;
+             existingService                = ServiceInstanceTable::GetNext(*existingService))
         {
-            if (host.HasService(service.GetInstanceName()) && (aHost.mKey != host.mKey))
+            if ((existingService->mInstanceNameHash == hash) && existingService->Matches(service.GetInstanceName()) &&
+                (aHost.mKey != existingService->GetHost().mKey))
             {
                 LogWarn("Name conflict: service name %s has already been allocated", service.GetInstanceName());
                 ExitNow(hasConflicts = true);
@@ -474,7 +479,13 @@ void Server::CommitSrpUpdate(Error                    aError,
     grantedKeyLease = useShortLease ? grantedLease : aLeaseConfig.GrantKeyLease(hostKeyLease);
     grantedTtl      = aTtlConfig.GrantTtl(grantedLease, aHost.GetTtl());
 
-    existingHost = mHosts.RemoveMatching(aHost.GetFullName());
+    existingHost = FindHost(aHost.GetFullName());
+
+    if (existingHost != nullptr)
+    {
+        IgnoreError(mHosts.Remove(*existingHost));
+        UnindexHost(*existingHost);
+    }
 
     LogInfo("Committing update for %s host %s", (existingHost != nullptr) ? "existing" : "new", aHost.GetFullName());
     LogInfo("    Granted lease:%lu, key-lease:%lu, ttl:%lu", ToUlong(grantedLease), ToUlong(grantedKeyLease),
@@ -493,6 +504,7 @@ void Server::CommitSrpUpdate(Error                    aError,
     }
 
     mHosts.Push(aHost);
+    IndexHost(aHost);
 
     for (Service &service : aHost.mServices)
     {
@@ -531,6 +543,7 @@ void Server::CommitSrpUpdate(Error                    aError,
             if (!aHost.HasService(existingService->GetInstanceName()))
             {
                 aHost.AddService(*existingService);
+                IndexService(*existingService);
 
                 // If host is deleted we make sure to add any existing
                 // service that is not already included as deleted.
@@ -595,6 +608,79 @@ exit:
     }
 }
 
+void Server::IndexHost(Host &aHost)
+{
+    aHost.mFullNameHash = HostTable::HashName(aHost.GetFullName());
+    mHostTable.Add(aHost, aHost.mFullNameHash);
+
+    for (Service &service : aHost.mServices)
+    {
+        IndexService(service);
+    }
+}
+
+void Server::UnindexHost(Host &aHost)
+{
+    mHostTable.Remove(aHost, aHost.mFullNameHash);
+
+    for (Service &service : aHost.mServices)
+    {
+        UnindexService(service);
+    }
+}
+
+void Server::IndexService(Service &aService)
+{
+    aService.mInstanceNameHash = ServiceInstanceTable::HashName(aService.GetInstanceName());
+    aService.mServiceNameHash  = ServiceTypeTable::HashName(aService.GetServiceName());
+    mServiceInstanceTable.Add(aService, aService.mInstanceNameHash);
+    mServiceTypeTable.Add(aService, aService.mServiceNameHash);
+}
+
+void Server::UnindexService(Service &aService)
+{
+    mServiceInstanceTable.Remove(aService, aService.mInstanceNameHash);
+    mServiceTypeTable.Remove(aService, aService.mServiceNameHash);
+}
+
+Server::Host *Server::FindHost(const char *aFullName) { return AsNonConst(AsConst(this)->FindHost(aFullName)); }
+
+const Server::Host *Server::FindHost(const char *aFullName) const
+{
+    uint32_t    hash = HostTable::HashName(aFullName);
+    const Host *host;
+
+    for (host = mHostTable.GetHead(hash); host != nullptr; host = HostTable::GetNext(*host))
+    {
+        if ((host->mFullNameHash == hash) && host->Matches(aFullName))
+        {
+            break;
+        }
+    }
+
+    return host;
+}
+
+const Server::Service *Server::FindService(const char *aInstanceName) const
+{
+    // Finds an active service (not deleted, on an active host).
+
+    uint32_t       hash = ServiceInstanceTable::HashName(aInstanceName);
+    const Service *service;
+
+    for (service = mServiceInstanceTable.GetHead(hash); service != nullptr;
+         service = ServiceInstanceTable::GetNext(*service))
+    {
+        if ((service->mInstanceNameHash == hash) && !service->IsDeleted() && !service->GetHost().IsDeleted() &&
+            service->Matches(aInstanceName))
+        {
+            break;
+        }
+    }
+
+    return service;
+}
+
 void Server::InitPort(void)
 {
     mPort = kUdpPortMin;
@@ -1357,7 +1443,7 @@ void Server::HandleUpdate(Host &aHost, const MessageMetadata &aMetadata)
 
     aHost.ClearResources();
 
-    existingHost = mHosts.FindMatching(aHost.GetFullName());
+    existingHost = FindHost(aHost.GetFullName());
     VerifyOrExit(existingHost != nullptr);
 
     // The client may not include all services it has registered before
@@ -1807,17 +1893,21 @@ Error Server::Service::Init(const char *aInstanceName, const char *aInstanceLabe
 {
     Error error;
 
-    mNext        = nullptr;
-    mHost        = &aHost;
-    mPriority    = 0;
-    mWeight      = 0;
-    mTtl         = 0;
-    mPort        = 0;
-    mLease       = 0;
-    mKeyLease    = 0;
-    mUpdateTime  = aUpdateTime;
-    mIsDeleted   = false;
-    mIsCommitted = false;
+    mNext                = nullptr;
+    mNextInInstanceTable = nullptr;
+    mNextInTypeTable     = nullptr;
+    mInstanceNameHash    = 0;
+    mServiceNameHash     = 0;
+    mHost                = &aHost;
+    mPriority            = 0;
+    mWeight              = 0;
+    mTtl                 = 0;
+    mPort                = 0;
+    mLease               = 0;
+    mKeyLease            = 0;
+    mUpdateTime          = aUpdateTime;
+    mIsDeleted           = false;
+    mIsCommitted         = false;
 #if OPENTHREAD_CONFIG_SRP_SERVER_ADVERTISING_PROXY_ENABLE
     mIsRegistered      = false;
     mIsKeyRegistered   = false;
@@ -1999,6 +2089,8 @@ exit:
 Server::Host::Host(Instance &aInstance, TimeMilli aUpdateTime)
     : InstanceLocator(aInstance)
     , mNext(nullptr)
+    , mNextInNameTable(nullptr)
+    , mFullNameHash(0)
     , mTtl(0)
     , mLease(0)
     , mKeyLease(0)
@@ -2155,6 +2247,7 @@ void Server::Host::RemoveService(Service *aService, RetainName aRetainName, Noti
 
     if (!aRetainName)
     {
+        server.UnindexService(*aService);
         IgnoreError(mServices.Remove(*aService));
         aService->Free();
     }
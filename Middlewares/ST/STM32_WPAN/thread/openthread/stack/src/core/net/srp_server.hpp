@@ -57,6 +57,7 @@
 #include "common/as_core_type.hpp"
 #include "common/callback.hpp"
 #include "common/clearable.hpp"
+#include "common/hash_table.hpp"
 #include "common/heap.hpp"
 #include "common/heap_allocatable.hpp"
 #include "common/heap_array.hpp"
@@ -88,6 +89,8 @@ struct otSrpServerService
 
 namespace ot {
 
+class UnitTester;
+
 namespace Dns {
 namespace ServiceDiscovery {
 class Server;
@@ -119,6 +122,7 @@ class Server : public InstanceLocator, private NonCopyable
 #if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE
     friend class BorderRouter::RoutingManager;
 #endif
+    friend class ot::UnitTester;
 
     enum RetainName : bool
     {
@@ -194,6 +198,7 @@ public:
         friend class LinkedListEntry<Service>;
         friend class Heap::Allocatable<Service>;
         friend class AdvertisingProxy;
+        friend class ot::UnitTester;
 
     public:
         /**
@@ -423,6 +428,10 @@ public:
         }
 
         Service                  *mNext;
+        Service                  *mNextInInstanceTable;
+        Service                  *mNextInTypeTable;
+        uint32_t                  mInstanceNameHash;
+        uint32_t                  mServiceNameHash;
         Heap::String              mInstanceName;
         Heap::String              mInstanceLabel;
         Heap::String              mServiceName;
@@ -466,6 +475,7 @@ public:
         friend class LinkedListEntry<Host>;
         friend class Heap::Allocatable<Host>;
         friend class AdvertisingProxy;
+        friend class ot::UnitTester;
 
     public:
         typedef Crypto::Ecdsa::P256::PublicKey Key; ///< Host key (public ECDSA P256 key).
@@ -612,6 +622,8 @@ public:
         Error          AddIp6Address(const Ip6::Address &aIp6Address);
 
         Host                     *mNext;
+        Host                     *mNextInNameTable;
+        uint32_t                  mFullNameHash;
         Heap::String              mFullName;
         Heap::Array<Ip6::Address> mAddresses;
         Key                       mKey;
@@ -1047,6 +1059,23 @@ private:
     void UpdateResponseCounters(Dns::Header::Response aResponseCode);
     void UpdateAddrResolverCacheTable(const Ip6::MessageInfo &aMessageInfo, const Host &aHost);
 
+    // Registered hosts (the ones in `mHosts`) are in `mHostTable`,
+    // and all their services are in `mServiceInstanceTable` and in
+    // `mServiceTypeTable` (by base service name).
+
+    void           IndexHost(Host &aHost);
+    void           UnindexHost(Host &aHost);
+    void           IndexService(Service &aService);
+    void           UnindexService(Service &aService);
+    Host          *FindHost(const char *aFullName);
+    const Host    *FindHost(const char *aFullName) const;
+    const Service *FindService(const char *aInstanceName) const;
+
+    static constexpr uint16_t kNameTableSize = OPENTHREAD_CONFIG_SRP_SERVER_NAME_TABLE_SIZE;
+
+    using HostTable            = HashTable<Host, &Host::mNextInNameTable, kNameTableSize>;
+    using ServiceInstanceTable = HashTable<Service, &Service::mNextInInstanceTable, kNameTableSize>;
+    using ServiceTypeTable     = HashTable<Service, &Service::mNextInTypeTable, kNameTableSize>;
     using LeaseTimer           = TimerMilliIn<Server, &Server::HandleLeaseTimer>;
     using UpdateTimer          = TimerMilliIn<Server, &Server::HandleOutstandingUpdatesTimer>;
     using CompletedUpdatesTask = TaskletIn<Server, &Server::ProcessCompletedUpdates>;
@@ -1060,8 +1089,11 @@ private:
     TtlConfig   mTtlConfig;
     LeaseConfig mLeaseConfig;
 
-    LinkedList<Host> mHosts;
-    LeaseTimer       mLeaseTimer;
+    LinkedList<Host>     mHosts;
+    HostTable            mHostTable;
+    ServiceInstanceTable mServiceInstanceTable;
+    ServiceTypeTable     mServiceTypeTable;
+    LeaseTimer           mLeaseTimer;
 
     UpdateTimer                mOutstandingUpdatesTimer;
     LinkedList<UpdateMetadata> mOutstandingUpdates;
@@ -56,10 +56,15 @@ AddressResolver::AddressResolver(Instance &aInstance)
     : InstanceLocator(aInstance)
 #if OPENTHREAD_FTD
     , mCacheEntryPool(aInstance)
+    , mCachedList(kCachedList)
+    , mSnoopedList(kSnoopedList)
+    , mQueryList(kQueryList)
+    , mQueryRetryList(kQueryRetryList)
     , mIcmpHandler(&AddressResolver::HandleIcmpReceive, this)
 #endif
 {
 #if OPENTHREAD_FTD
+    ClearAllBytes(mCounters);
     IgnoreError(Get<Ip6::Icmp>().RegisterHandler(mIcmpHandler));
 #endif
 }
@@ -81,11 +86,33 @@ void AddressResolver::Clear(void)
                 Get<MeshForwarder>().HandleResolved(entry->GetTarget(), kErrorDrop);
             }
 
-            mCacheEntryPool.Free(*entry);
+            FreeCacheEntry(*entry);
         }
     }
 }
 
+AddressResolver::CacheEntryList &AddressResolver::GetCacheEntryList(ListId aListId)
+{
+    CacheEntryList *list = &mCachedList;
+
+    switch (aListId)
+    {
+    case kCachedList:
+        break;
+    case kSnoopedList:
+        list = &mSnoopedList;
+        break;
+    case kQueryList:
+        list = &mQueryList;
+        break;
+    case kQueryRetryList:
+        list = &mQueryRetryList;
+        break;
+    }
+
+    return *list;
+}
+
 Error AddressResolver::GetNextCacheEntry(EntryInfo &aInfo, Iterator &aIterator) const
 {
     Error                 error = kErrorNone;
@@ -124,8 +151,10 @@ Error AddressResolver::GetNextCacheEntry(EntryInfo &aInfo, Iterator &aIterator)
     aIterator.SetList(list);
 
     aInfo.Clear();
-    aInfo.mTarget = entry->GetTarget();
-    aInfo.mRloc16 = entry->GetRloc16();
+    aInfo.mTarget   = entry->GetTarget();
+    aInfo.mRloc16   = entry->GetRloc16();
+    aInfo.mHits     = entry->GetHits();
+    aInfo.mCounters = mCounters;
 
     if (list == &mCachedList)
     {
@@ -171,54 +200,44 @@ void AddressResolver::RemoveEntriesForRouterId(uint8_t aRouterId)
 
 void AddressResolver::RemoveEntriesForRloc16(uint16_t aRloc16) { Remove(aRloc16, /* aMatchRouterId */ false); }
 
-AddressResolver::CacheEntry *AddressResolver::GetEntryAfter(CacheEntry *aPrev, CacheEntryList &aList)
-{
-    return (aPrev == nullptr) ? aList.GetHead() : aPrev->GetNext();
-}
-
 void AddressResolver::Remove(Mac::ShortAddress aRloc16, bool aMatchRouterId)
 {
     CacheEntryList *lists[] = {&mCachedList, &mSnoopedList};
 
     for (CacheEntryList *list : lists)
     {
-        CacheEntry *prev = nullptr;
-        CacheEntry *entry;
+        CacheEntry *next;
 
-        while ((entry = GetEntryAfter(prev, *list)) != nullptr)
+        for (CacheEntry *entry = list->GetHead(); entry != nullptr; entry = next)
         {
+            next = entry->GetNext();
+
             if ((aMatchRouterId && Mle::RouterIdMatch(entry->GetRloc16(), aRloc16)) ||
                 (!aMatchRouterId && (entry->GetRloc16() == aRloc16)))
             {
-                RemoveCacheEntry(*entry, *list, prev, aMatchRouterId ? kReasonRemovingRouterId : kReasonRemovingRloc16);
-                mCacheEntryPool.Free(*entry);
-
-                // If the entry is removed from list, we keep the same
-                // `prev` pointer.
-            }
-            else
-            {
-                prev = entry;
+                RemoveCacheEntry(*entry, *list, aMatchRouterId ? kReasonRemovingRouterId : kReasonRemovingRloc16);
+                FreeCacheEntry(*entry);
             }
         }
     }
 }
 
-AddressResolver::CacheEntry *AddressResolver::FindCacheEntry(const Ip6::Address &aEid,
-                                                             CacheEntryList    *&aList,
-                                                             CacheEntry        *&aPrevEntry)
+AddressResolver::CacheEntry *AddressResolver::FindCacheEntry(const Ip6::Address &aEid, CacheEntryList *&aList)
 {
-    CacheEntry     *entry   = nullptr;
-    CacheEntryList *lists[] = {&mCachedList, &mSnoopedList, &mQueryList, &mQueryRetryList};
+    CacheEntry *entry = nullptr;
+    uint16_t    slot  = mEidIndex.GetHomeSlot(HashEid(aEid));
+    uint16_t    index;
 
-    for (CacheEntryList *list : lists)
+    while ((index = mEidIndex.GetNext(slot)) != EidIndex::kNotFound)
     {
-        aList = list;
-        entry = aList->FindMatching(aEid, aPrevEntry);
-        VerifyOrExit(entry == nullptr);
+        if (mCacheEntryPool.GetEntryAt(index).Matches(aEid))
+        {
+            entry = &mCacheEntryPool.GetEntryAt(index);
+            aList = &GetCacheEntryList(entry->GetListId());
+            break;
+        }
     }
 
-exit:
     return entry;
 }
 
@@ -227,14 +246,13 @@ void AddressResolver::RemoveEntryForAddress(const Ip6::Address &aEid) { Remove(a
 void AddressResolver::Remove(const Ip6::Address &aEid, Reason aReason)
 {
     CacheEntry     *entry;
-    CacheEntry     *prev;
     CacheEntryList *list;
 
-    entry = FindCacheEntry(aEid, list, prev);
+    entry = FindCacheEntry(aEid, list);
     VerifyOrExit(entry != nullptr);
 
-    RemoveCacheEntry(*entry, *list, prev, aReason);
-    mCacheEntryPool.Free(*entry);
+    RemoveCacheEntry(*entry, *list, aReason);
+    FreeCacheEntry(*entry);
 
 exit:
     return;
@@ -256,11 +274,10 @@ void AddressResolver::ReplaceEntriesForRloc16(uint16_t aOldRloc16, uint16_t aNew
     }
 }
 
-AddressResolver::CacheEntry *AddressResolver::NewCacheEntry(bool aSnoopedEntry)
+AddressResolver::CacheEntry *AddressResolver::NewCacheEntry(const Ip6::Address &aEid, bool aSnoopedEntry)
 {
-    CacheEntry     *newEntry  = nullptr;
-    CacheEntry     *prevEntry = nullptr;
-    CacheEntryList *lists[]   = {&mSnoopedList, &mQueryRetryList, &mQueryList, &mCachedList};
+    CacheEntry     *newEntry = nullptr;
+    CacheEntryList *lists[]  = {&mSnoopedList, &mQueryRetryList, &mQueryList, &mCachedList};
 
     // The following order is used when trying to allocate a new cache
     // entry: First the cache pool is checked, followed by the list
@@ -268,21 +285,19 @@ AddressResolver::CacheEntry *AddressResolver::NewCacheEntry(bool aSnoopedEntry)
     // retry timeout wait due to a prior query failing to get a
     // response), then the query list (entries actively querying and
     // waiting for address notification response), and finally the
-    // cached (in-use) list. Within each list the oldest entry is
-    // reclaimed first (the list's tail). We also make sure the entry
-    // can be evicted (e.g., first time query entries can not be
-    // evicted till timeout).
+    // cached (in-use) list. Within each list the least recently used
+    // entry is reclaimed first (the list's tail). We also make sure
+    // the entry can be evicted (e.g., first time query entries can
+    // not be evicted till timeout).
 
     newEntry = mCacheEntryPool.Allocate();
     VerifyOrExit(newEntry == nullptr);
 
     for (CacheEntryList *list : lists)
     {
-        CacheEntry *prev;
-        CacheEntry *entry;
-        uint16_t    numNonEvictable = 0;
+        uint16_t numNonEvictable = 0;
 
-        for (prev = nullptr; (entry = GetEntryAfter(prev, *list)) != nullptr; prev = entry)
+        for (CacheEntry *entry = list->GetTail(); entry != nullptr; entry = entry->GetPrev())
         {
             if ((list != &mCachedList) && !entry->CanEvict())
             {
@@ -290,13 +305,15 @@ AddressResolver::CacheEntry *AddressResolver::NewCacheEntry(bool aSnoopedEntry)
                 continue;
             }
 
-            newEntry  = entry;
-            prevEntry = prev;
+            newEntry = entry;
+            break;
         }
 
         if (newEntry != nullptr)
         {
-            RemoveCacheEntry(*newEntry, *list, prevEntry, kReasonEvictingForNewEntry);
+            RemoveCacheEntry(*newEntry, *list, kReasonEvictingForNewEntry);
+            mEidIndex.Remove(mCacheEntryPool.GetIndexOf(*newEntry));
+            mCounters.mEvictions++;
             ExitNow();
         }
 
@@ -319,15 +336,25 @@ AddressResolver::CacheEntry *AddressResolver::NewCacheEntry(bool aSnoopedEntry)
     }
 
 exit:
+    if (newEntry != nullptr)
+    {
+        newEntry->SetTarget(aEid);
+        newEntry->ResetHits();
+        mEidIndex.Add(mCacheEntryPool.GetIndexOf(*newEntry), HashEid(aEid));
+    }
+
     return newEntry;
 }
 
-void AddressResolver::RemoveCacheEntry(CacheEntry     &aEntry,
-                                       CacheEntryList &aList,
-                                       CacheEntry     *aPrevEntry,
-                                       Reason          aReason)
+void AddressResolver::FreeCacheEntry(CacheEntry &aEntry)
+{
+    mEidIndex.Remove(mCacheEntryPool.GetIndexOf(aEntry));
+    mCacheEntryPool.Free(aEntry);
+}
+
+void AddressResolver::RemoveCacheEntry(CacheEntry &aEntry, CacheEntryList &aList, Reason aReason)
 {
-    aList.PopAfter(aPrevEntry);
+    aList.Remove(aEntry);
 
     if (&aList == &mQueryList)
     {
@@ -346,9 +373,8 @@ Error AddressResolver::UpdateCacheEntry(const Ip6::Address &aEid, Mac::ShortAddr
     Error           error = kErrorNone;
     CacheEntryList *list;
     CacheEntry     *entry;
-    CacheEntry     *prev;
 
-    entry = FindCacheEntry(aEid, list, prev);
+    entry = FindCacheEntry(aEid, list);
     VerifyOrExit(entry != nullptr, error = kErrorNotFound);
 
     if ((list == &mCachedList) || (list == &mSnoopedList))
@@ -362,7 +388,7 @@ Error AddressResolver::UpdateCacheEntry(const Ip6::Address &aEid, Mac::ShortAddr
         // from its current list, update it, and then add it to the
         // `mCachedList`.
 
-        list->PopAfter(prev);
+        list->Remove(*entry);
 
         entry->SetRloc16(aRloc16);
         entry->MarkLastTransactionTimeAsInvalid();
@@ -404,7 +430,7 @@ void AddressResolver::UpdateSnoopedCacheEntry(const Ip6::Address &aEid,
 
     VerifyOrExit((aDest == macAddress) || Get<Mle::MleRouter>().IsMinimalChild(aDest));
 
-    entry = NewCacheEntry(/* aSnoopedEntry */ true);
+    entry = NewCacheEntry(aEid, /* aSnoopedEntry */ true);
     VerifyOrExit(entry != nullptr);
 
     for (CacheEntry &snooped : mSnoopedList)
@@ -415,7 +441,6 @@ void AddressResolver::UpdateSnoopedCacheEntry(const Ip6::Address &aEid,
         }
     }
 
-    entry->SetTarget(aEid);
     entry->SetRloc16(aRloc16);
 
     if (numNonEvictable < kMaxNonEvictableSnoopedEntries)
@@ -441,25 +466,17 @@ exit:
 
 void AddressResolver::RestartAddressQueries(void)
 {
-    CacheEntry *tail;
+    CacheEntry *entry;
 
     // We move all entries from `mQueryRetryList` at the tail of
     // `mQueryList` and then (re)send Address Query for all entries in
     // the updated `mQueryList`.
 
-    tail = mQueryList.GetTail();
-
-    if (tail == nullptr)
-    {
-        mQueryList.SetHead(mQueryRetryList.GetHead());
-    }
-    else
+    while ((entry = mQueryRetryList.Pop()) != nullptr)
     {
-        tail->SetNext(mQueryRetryList.GetHead());
+        mQueryList.PushAfterTail(*entry);
     }
 
-    mQueryRetryList.Clear();
-
     for (CacheEntry &entry : mQueryList)
     {
         IgnoreError(SendAddressQuery(entry.GetTarget()));
@@ -482,18 +499,17 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRlo
 {
     Error           error = kErrorNone;
     CacheEntry     *entry;
-    CacheEntry     *prev = nullptr;
     CacheEntryList *list;
 
 #if OPENTHREAD_CONFIG_TMF_ALLOW_ADDRESS_RESOLUTION_USING_NET_DATA_SERVICES
     VerifyOrExit(ResolveUsingNetDataServices(aEid, aRloc16) != kErrorNone);
 #endif
 
-    entry = FindCacheEntry(aEid, list, prev);
+    entry = FindCacheEntry(aEid, list);
 
     if ((entry != nullptr) && ((list == &mCachedList) || (list == &mSnoopedList)))
     {
-        list->PopAfter(prev);
+        list->Remove(*entry);
 
         if (Get<RouterTable>().GetNextHop(entry->GetRloc16()) == Mle::kInvalidRloc16)
         {
@@ -501,7 +517,7 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRlo
             // next hop towards it), we clear the entry so to start a new
             // address query.
 
-            mCacheEntryPool.Free(*entry);
+            FreeCacheEntry(*entry);
             entry = nullptr;
         }
         else
@@ -515,10 +531,14 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRlo
 
             mCachedList.Push(*entry);
             aRloc16 = entry->GetRloc16();
+            entry->IncrementHits();
+            mCounters.mHits++;
             ExitNow();
         }
     }
 
+    mCounters.mMisses++;
+
     if (entry == nullptr)
     {
         // If the entry is not present in any of the lists, try to
@@ -528,10 +548,9 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRlo
 
         VerifyOrExit(aAllowAddressQuery, error = kErrorNotFound);
 
-        entry = NewCacheEntry(/* aSnoopedEntry */ false);
+        entry = NewCacheEntry(aEid, /* aSnoopedEntry */ false);
         VerifyOrExit(entry != nullptr, error = kErrorNoBufs);
 
-        entry->SetTarget(aEid);
         entry->SetRloc16(Mac::kShortAddrInvalid);
         entry->SetRetryDelay(kAddressQueryInitialRetryDelay);
         entry->SetCanEvict(false);
@@ -558,13 +577,13 @@ Error AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRlo
         // retry delay timeout is expired.
 
         VerifyOrExit(entry->IsInRampDown(), error = kErrorDrop);
-        mQueryRetryList.PopAfter(prev);
+        mQueryRetryList.Remove(*entry);
     }
 
     entry->SetTimeout(kAddressQueryTimeout);
 
     error = SendAddressQuery(aEid);
-    VerifyOrExit(error == kErrorNone, mCacheEntryPool.Free(*entry));
+    VerifyOrExit(error == kErrorNone, FreeCacheEntry(*entry));
 
     if (list == nullptr)
     {
@@ -658,7 +677,6 @@ void AddressResolver::HandleTmf<kUriAddressNotify>(Coap::Message &aMessage, cons
     uint32_t                 lastTransactionTime;
     CacheEntryList          *list;
     CacheEntry              *entry;
-    CacheEntry              *prev;
 
     VerifyOrExit(aMessage.IsConfirmablePostRequest());
 
@@ -680,7 +698,7 @@ void AddressResolver::HandleTmf<kUriAddressNotify>(Coap::Message &aMessage, cons
     LogInfo("Received %s from 0x%04x for %s to 0x%04x", UriToString<kUriAddressNotify>(),
             aMessageInfo.GetPeerAddr().GetIid().GetLocator(), target.ToString().AsCString(), rloc16);
 
-    entry = FindCacheEntry(target, list, prev);
+    entry = FindCacheEntry(target, list);
     VerifyOrExit(entry != nullptr);
 
     if (list == &mCachedList)
@@ -702,7 +720,7 @@ void AddressResolver::HandleTmf<kUriAddressNotify>(Coap::Message &aMessage, cons
     entry->SetMeshLocalIid(meshLocalIid);
     entry->SetLastTransactionTime(lastTransactionTime);
 
-    list->PopAfter(prev);
+    list->Remove(*entry);
     mCachedList.Push(*entry);
 
     LogCacheEntryChange(kEntryUpdated, kReasonReceivedNotification, *entry);
@@ -981,11 +999,12 @@ void AddressResolver::HandleTimeTick(void)
     }
 
     {
-        CacheEntry *prev = nullptr;
-        CacheEntry *entry;
+        CacheEntry *next;
 
-        while ((entry = GetEntryAfter(prev, mQueryList)) != nullptr)
+        for (CacheEntry *entry = mQueryList.GetHead(); entry != nullptr; entry = next)
         {
+            next = entry->GetNext();
+
             OT_ASSERT(!entry->IsTimeoutZero());
 
             continueRxingTicks = true;
@@ -1005,20 +1024,13 @@ void AddressResolver::HandleTimeTick(void)
                 entry->SetRampDown(false);
 
                 // Move the entry from `mQueryList` to `mQueryRetryList`
-                mQueryList.PopAfter(prev);
+                mQueryList.Remove(*entry);
                 mQueryRetryList.Push(*entry);
 
                 LogInfo("Timed out waiting for %s for %s, retry: %d", UriToString<kUriAddressNotify>(),
                         entry->GetTarget().ToString().AsCString(), entry->GetTimeout());
 
                 Get<MeshForwarder>().HandleResolved(entry->GetTarget(), kErrorDrop);
-
-                // When the entry is removed from `mQueryList`
-                // we keep the `prev` pointer same as before.
-            }
-            else
-            {
-                prev = entry;
             }
         }
     }
@@ -1128,28 +1140,123 @@ void AddressResolver::LogCacheEntryChange(EntryChange, Reason, const CacheEntry
 void AddressResolver::CacheEntry::Init(Instance &aInstance)
 {
     InstanceLocatorInit::Init(aInstance);
-    mNextIndex = kNoNextIndex;
+    mNextIndex = kNoIndex;
+    mPrevIndex = kNoIndex;
 }
 
 AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetNext(void)
 {
-    return (mNextIndex == kNoNextIndex) ? nullptr : &Get<AddressResolver>().GetCacheEntryPool().GetEntryAt(mNextIndex);
+    return (mNextIndex == kNoIndex) ? nullptr : &Get<AddressResolver>().GetCacheEntryPool().GetEntryAt(mNextIndex);
 }
 
 const AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetNext(void) const
 {
-    return (mNextIndex == kNoNextIndex) ? nullptr : &Get<AddressResolver>().GetCacheEntryPool().GetEntryAt(mNextIndex);
+    return (mNextIndex == kNoIndex) ? nullptr : &Get<AddressResolver>().GetCacheEntryPool().GetEntryAt(mNextIndex);
 }
 
 void AddressResolver::CacheEntry::SetNext(CacheEntry *aEntry)
 {
-    VerifyOrExit(aEntry != nullptr, mNextIndex = kNoNextIndex);
+    VerifyOrExit(aEntry != nullptr, mNextIndex = kNoIndex);
     mNextIndex = Get<AddressResolver>().GetCacheEntryPool().GetIndexOf(*aEntry);
 
 exit:
     return;
 }
 
+AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetPrev(void)
+{
+    return (mPrevIndex == kNoIndex) ? nullptr : &Get<AddressResolver>().GetCacheEntryPool().GetEntryAt(mPrevIndex);
+}
+
+void AddressResolver::CacheEntry::SetPrev(CacheEntry *aEntry)
+{
+    VerifyOrExit(aEntry != nullptr, mPrevIndex = kNoIndex);
+    mPrevIndex = Get<AddressResolver>().GetCacheEntryPool().GetIndexOf(*aEntry);
+
+exit:
+    return;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// AddressResolver::CacheEntryList
+
+void AddressResolver::CacheEntryList::Push(CacheEntry &aEntry)
+{
+    CacheEntry *head = GetHead();
+
+    aEntry.SetNext(head);
+    aEntry.SetPrev(nullptr);
+    aEntry.SetListId(mListId);
+
+    if (head != nullptr)
+    {
+        head->SetPrev(&aEntry);
+    }
+    else
+    {
+        mTail = &aEntry;
+    }
+
+    SetHead(&aEntry);
+}
+
+void AddressResolver::CacheEntryList::PushAfterTail(CacheEntry &aEntry)
+{
+    aEntry.SetNext(nullptr);
+    aEntry.SetPrev(mTail);
+    aEntry.SetListId(mListId);
+
+    if (mTail != nullptr)
+    {
+        mTail->SetNext(&aEntry);
+    }
+    else
+    {
+        SetHead(&aEntry);
+    }
+
+    mTail = &aEntry;
+}
+
+void AddressResolver::CacheEntryList::Remove(CacheEntry &aEntry)
+{
+    CacheEntry *prev = aEntry.GetPrev();
+    CacheEntry *next = aEntry.GetNext();
+
+    if (prev != nullptr)
+    {
+        prev->SetNext(next);
+    }
+    else
+    {
+        SetHead(next);
+    }
+
+    if (next != nullptr)
+    {
+        next->SetPrev(prev);
+    }
+    else
+    {
+        mTail = prev;
+    }
+
+    aEntry.SetNext(nullptr);
+    aEntry.SetPrev(nullptr);
+}
+
+AddressResolver::CacheEntry *AddressResolver::CacheEntryList::Pop(void)
+{
+    CacheEntry *entry = GetHead();
+
+    if (entry != nullptr)
+    {
+        Remove(*entry);
+    }
+
+    return entry;
+}
+
 #endif // OPENTHREAD_FTD
 
 } // namespace ot
@@ -38,6 +38,7 @@
 
 #include "coap/coap.hpp"
 #include "common/as_core_type.hpp"
+#include "common/hash_index.hpp"
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
@@ -255,6 +256,14 @@ private:
     static constexpr uint16_t kAddressQueryMaxRetryDelay     = OPENTHREAD_CONFIG_TMF_ADDRESS_QUERY_MAX_RETRY_DELAY;
     static constexpr uint16_t kSnoopBlockEvictionTimeout     = OPENTHREAD_CONFIG_TMF_SNOOP_CACHE_ENTRY_TIMEOUT;
 
+    enum ListId : uint8_t
+    {
+        kCachedList,
+        kSnoopedList,
+        kQueryList,
+        kQueryRetryList,
+    };
+
     class CacheEntry : public InstanceLocatorInit
     {
     public:
@@ -263,6 +272,15 @@ private:
         CacheEntry       *GetNext(void);
         const CacheEntry *GetNext(void) const;
         void              SetNext(CacheEntry *aEntry);
+        CacheEntry       *GetPrev(void);
+        void              SetPrev(CacheEntry *aEntry);
+
+        ListId GetListId(void) const { return static_cast<ListId>(mListId); }
+        void   SetListId(ListId aListId) { mListId = aListId; }
+
+        uint32_t GetHits(void) const { return mHits; }
+        void     IncrementHits(void) { mHits++; }
+        void     ResetHits(void) { mHits = 0; }
 
         const Ip6::Address &GetTarget(void) const { return mTarget; }
         void                SetTarget(const Ip6::Address &aTarget) { mTarget = aTarget; }
@@ -295,12 +313,15 @@ private:
         bool Matches(const Ip6::Address &aEid) const { return GetTarget() == aEid; }
 
     private:
-        static constexpr uint16_t kNoNextIndex          = 0xffff;     // `mNextIndex` value when at end of list.
+        static constexpr uint16_t kNoIndex              = 0xffff;     // `mNext/PrevIndex` value at end of list.
         static constexpr uint32_t kInvalidLastTransTime = 0xffffffff; // Value when `mLastTransactionTime` is invalid.
 
         Ip6::Address      mTarget;
         Mac::ShortAddress mRloc16;
         uint16_t          mNextIndex;
+        uint16_t          mPrevIndex;
+        uint8_t           mListId;
+        uint32_t          mHits;
 
         union
         {
@@ -322,9 +343,33 @@ private:
     };
 
     typedef Pool<CacheEntry, kCacheEntries> CacheEntryPool;
+    typedef HashIndex<kCacheEntries>        EidIndex;
 
-    class CacheEntryList : public LinkedList<CacheEntry>
+    // Doubly linked list of cache entries, the most recently used entry
+    // being the head and the least recently used one the tail.
+    class CacheEntryList : private LinkedList<CacheEntry>
     {
+    public:
+        explicit CacheEntryList(ListId aListId)
+            : mTail(nullptr)
+            , mListId(aListId)
+        {
+        }
+
+        using LinkedList<CacheEntry>::GetHead;
+        using LinkedList<CacheEntry>::IsEmpty;
+        using LinkedList<CacheEntry>::begin;
+        using LinkedList<CacheEntry>::end;
+
+        CacheEntry *GetTail(void) { return mTail; }
+        void        Push(CacheEntry &aEntry);
+        void        PushAfterTail(CacheEntry &aEntry);
+        void        Remove(CacheEntry &aEntry);
+        CacheEntry *Pop(void);
+
+    private:
+        CacheEntry *mTail;
+        ListId      mListId;
     };
 
     enum EntryChange : uint8_t
@@ -347,13 +392,17 @@ private:
     };
 
     CacheEntryPool &GetCacheEntryPool(void) { return mCacheEntryPool; }
+    CacheEntryList &GetCacheEntryList(ListId aListId);
+
+    static uint32_t HashEid(const Ip6::Address &aEid) { return EidIndex::HashBytes(&aEid, sizeof(aEid)); }
 
     Error       Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aRloc16, bool aAllowAddressQuery);
     void        Remove(Mac::ShortAddress aRloc16, bool aMatchRouterId);
     void        Remove(const Ip6::Address &aEid, Reason aReason);
-    CacheEntry *FindCacheEntry(const Ip6::Address &aEid, CacheEntryList *&aList, CacheEntry *&aPrevEntry);
-    CacheEntry *NewCacheEntry(bool aSnoopedEntry);
-    void        RemoveCacheEntry(CacheEntry &aEntry, CacheEntryList &aList, CacheEntry *aPrevEntry, Reason aReason);
+    CacheEntry *FindCacheEntry(const Ip6::Address &aEid, CacheEntryList *&aList);
+    CacheEntry *NewCacheEntry(const Ip6::Address &aEid, bool aSnoopedEntry);
+    void        FreeCacheEntry(CacheEntry &aEntry);
+    void        RemoveCacheEntry(CacheEntry &aEntry, CacheEntryList &aList, Reason aReason);
     Error       UpdateCacheEntry(const Ip6::Address &aEid, Mac::ShortAddress aRloc16);
     Error       SendAddressQuery(const Ip6::Address &aEid);
 #if OPENTHREAD_CONFIG_TMF_ALLOW_ADDRESS_RESOLUTION_USING_NET_DATA_SERVICES
@@ -383,13 +432,13 @@ private:
                                     CacheEntryList   *aList = nullptr);
     const char *ListToString(const CacheEntryList *aList) const;
 
-    static AddressResolver::CacheEntry *GetEntryAfter(CacheEntry *aPrev, CacheEntryList &aList);
-
     CacheEntryPool     mCacheEntryPool;
+    EidIndex           mEidIndex;
     CacheEntryList     mCachedList;
     CacheEntryList     mSnoopedList;
     CacheEntryList     mQueryList;
     CacheEntryList     mQueryRetryList;
+    otCacheCounters    mCounters;
     Ip6::Icmp::Handler mIcmpHandler;
 
 #endif // OPENTHREAD_FTD
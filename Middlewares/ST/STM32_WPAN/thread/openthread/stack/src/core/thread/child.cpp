@@ -114,6 +114,7 @@ void Child::Clear(void)
 
     ClearAllBytes(*this);
     Init(instance);
+    UpdateChildTableIndex();
 }
 
 void Child::ClearIp6Addresses(void)
@@ -36,6 +36,7 @@
 #if OPENTHREAD_FTD
 
 #include "common/code_utils.hpp"
+#include "common/encoding.hpp"
 #include "common/locator_getters.hpp"
 #include "instance/instance.hpp"
 
@@ -134,19 +135,112 @@ exit:
 
 Child *ChildTable::FindChild(uint16_t aRloc16, Child::StateFilter aFilter)
 {
-    return FindChild(Child::AddressMatcher(aRloc16, aFilter));
+    Child::AddressMatcher matcher(aRloc16, aFilter);
+
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    // `kShortAddrInvalid` makes the matcher accept any address.
+    if (IsIndexed(aFilter) && (aRloc16 != Mac::kShortAddrInvalid))
+    {
+        return FindIndexedChild(mRloc16Index, HashKey(aRloc16), matcher);
+    }
+#endif
+
+    return FindChild(matcher);
 }
 
 Child *ChildTable::FindChild(const Mac::ExtAddress &aExtAddress, Child::StateFilter aFilter)
 {
-    return FindChild(Child::AddressMatcher(aExtAddress, aFilter));
+    Child::AddressMatcher matcher(aExtAddress, aFilter);
+
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    if (IsIndexed(aFilter))
+    {
+        return FindIndexedChild(mExtAddressIndex, HashKey(aExtAddress), matcher);
+    }
+#endif
+
+    return FindChild(matcher);
 }
 
 Child *ChildTable::FindChild(const Mac::Address &aMacAddress, Child::StateFilter aFilter)
 {
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    if (aMacAddress.IsShort())
+    {
+        return FindChild(aMacAddress.GetShort(), aFilter);
+    }
+
+    if (aMacAddress.IsExtended())
+    {
+        return FindChild(aMacAddress.GetExtended(), aFilter);
+    }
+#endif
+
     return FindChild(Child::AddressMatcher(aMacAddress, aFilter));
 }
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+
+bool ChildTable::IsIndexed(Child::StateFilter aFilter)
+{
+    // The filters accepting a child in `kStateInvalid` cannot
+    // use the indexes.
+
+    return (aFilter != Child::kInStateInvalid) && (aFilter != Child::kInStateAnyExceptValidOrRestoring) &&
+           (aFilter != Child::kInStateAny);
+}
+
+uint32_t ChildTable::HashKey(const Mac::ExtAddress &aExtAddress)
+{
+    return BigEndian::ReadUint32(&aExtAddress.m8[0]) ^ BigEndian::ReadUint32(&aExtAddress.m8[4]);
+}
+
+Child *ChildTable::FindIndexedChild(const Index &aIndex, uint32_t aKeyHash, const Child::AddressMatcher &aMatcher)
+{
+    Child   *child = nullptr;
+    uint16_t slot  = aIndex.GetHomeSlot(aKeyHash);
+    uint16_t childIndex;
+
+    // Several children may match, the one with the lowest index is
+    // returned as a linear search of the table would do.
+
+    while ((childIndex = aIndex.GetNext(slot)) != Index::kNotFound)
+    {
+        if ((childIndex >= mMaxChildrenAllowed) || ((child != nullptr) && (childIndex > GetChildIndex(*child))))
+        {
+            continue;
+        }
+
+        if (mChildren[childIndex].Matches(aMatcher))
+        {
+            child = &mChildren[childIndex];
+        }
+    }
+
+    return child;
+}
+
+void ChildTable::UpdateIndex(const Neighbor &aNeighbor)
+{
+    uint16_t childIndex;
+
+    VerifyOrExit(Contains(aNeighbor));
+    childIndex = GetChildIndex(static_cast<const Child &>(aNeighbor));
+
+    mRloc16Index.Remove(childIndex);
+    mExtAddressIndex.Remove(childIndex);
+
+    VerifyOrExit(!aNeighbor.IsStateInvalid());
+
+    mRloc16Index.Add(childIndex, HashKey(aNeighbor.GetRloc16()));
+    mExtAddressIndex.Add(childIndex, HashKey(aNeighbor.GetExtAddress()));
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+
 bool ChildTable::HasChildren(Child::StateFilter aFilter) const
 {
     return (FindChild(Child::AddressMatcher(aFilter)) != nullptr);
@@ -39,6 +39,7 @@
 #if OPENTHREAD_FTD
 
 #include "common/const_cast.hpp"
+#include "common/hash_index.hpp"
 #include "common/iterator_utils.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
@@ -320,6 +321,19 @@ public:
         return (mChildren <= child) && (child < GetArrayEnd(mChildren));
     }
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    /**
+     * Updates the RLOC16 and Extended Address indexes of the child table for a given `Neighbor`.
+     *
+     * Is called by `Neighbor` whenever its state, RLOC16 or Extended Address changes. Does nothing if @p aNeighbor is
+     * not a `Child` in the child table.
+     *
+     * @param[in]  aNeighbor  A reference to a `Neighbor`.
+     *
+     */
+    void UpdateIndex(const Neighbor &aNeighbor);
+#endif
+
 private:
     static constexpr uint16_t kMaxChildren = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN;
 
@@ -339,13 +353,28 @@ private:
         Child::StateFilter mFilter;
     };
 
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    // Only the children not in `kStateInvalid` are indexed.
+    typedef HashIndex<kMaxChildren> Index;
+
+    static bool     IsIndexed(Child::StateFilter aFilter);
+    static uint32_t HashKey(uint16_t aRloc16) { return aRloc16; }
+    static uint32_t HashKey(const Mac::ExtAddress &aExtAddress);
+
+    Child *FindIndexedChild(const Index &aIndex, uint32_t aKeyHash, const Child::AddressMatcher &aMatcher);
+#endif
+
     Child *FindChild(const Child::AddressMatcher &aMatcher) { return AsNonConst(AsConst(this)->FindChild(aMatcher)); }
 
     const Child *FindChild(const Child::AddressMatcher &aMatcher) const;
     void         RefreshStoredChildren(void);
 
     uint16_t mMaxChildrenAllowed;
-    Child    mChildren[kMaxChildren];
+#if OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    Index mRloc16Index;
+    Index mExtAddressIndex;
+#endif
+    Child mChildren[kMaxChildren];
 };
 
 } // namespace ot
@@ -172,6 +172,8 @@ exit:
 KeyManager::KeyManager(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mKeySequence(0)
+    , mAfterNextKeysValid(false)
+    , mDeriveKeysTask(aInstance)
     , mMleFrameCounter(0)
     , mStoredMacFrameCounter(0)
     , mStoredMleFrameCounter(0)
@@ -332,42 +334,122 @@ void KeyManager::ComputeTrelKey(uint32_t aKeySequence, Mac::Key &aKey) const
 }
 #endif
 
-void KeyManager::UpdateKeyMaterial(void)
+void KeyManager::DeriveKeys(uint32_t aKeySequence, CachedSequence aCachedSequence)
 {
-    HashKeys hashKeys;
-
-    ComputeKeys(mKeySequence, hashKeys);
+    DerivedKeys &keys = mDerivedKeys[aCachedSequence];
+    HashKeys     hashKeys;
 
-    mMleKey.SetFrom(hashKeys.GetMleKey());
-
-#if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
-    {
-        Mac::KeyMaterial curKey;
-        Mac::KeyMaterial prevKey;
-        Mac::KeyMaterial nextKey;
+    ComputeKeys(aKeySequence, hashKeys);
 
-        curKey.SetFrom(hashKeys.GetMacKey(), kExportableMacKeys);
+    keys.mMleKey.SetFrom(hashKeys.GetMleKey());
 
-        ComputeKeys(mKeySequence - 1, hashKeys);
-        prevKey.SetFrom(hashKeys.GetMacKey(), kExportableMacKeys);
+#if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE && !OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
+    keys.mMacKey.SetFrom(hashKeys.GetMacKey(), kExportableMacKeys);
+#endif
 
-        ComputeKeys(mKeySequence + 1, hashKeys);
-        nextKey.SetFrom(hashKeys.GetMacKey(), kExportableMacKeys);
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+    {
+        Mac::Key key;
 
-        Get<Mac::SubMac>().SetMacKey(Mac::Frame::kKeyIdMode1, (mKeySequence & 0x7f) + 1, prevKey, curKey, nextKey);
+        ComputeTrelKey(aKeySequence, key);
+        keys.mTrelKey.SetFrom(key);
     }
 #endif
+}
 
-#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+void KeyManager::UpdateKeyMaterial(void)
+{
+    for (uint8_t index = 0; index < kNumCachedSequences; index++)
     {
-        Mac::Key key;
+        DeriveKeys(mKeySequence - kCurrentSequence + index, static_cast<CachedSequence>(index));
+    }
+
+    mAfterNextKeysValid = true;
 
-        ComputeTrelKey(mKeySequence, key);
-        mTrelKey.SetFrom(key);
+    UpdateMacKeys();
+}
+
+void KeyManager::AdvanceKeyMaterial(void)
+{
+    // Called after `mKeySequence` is incremented by one. The cached
+    // keys are shifted by one entry, the keys of the former previous
+    // key sequence move to the `kAfterNextSequence` entry where they
+    // are replaced from `mDeriveKeysTask`. The entries are moved as
+    // raw bytes since the `KeyMaterial` assignment would destroy the
+    // key references.
+
+    DerivedKeys previousKeys;
+
+    if (!mAfterNextKeysValid)
+    {
+        DeriveKeys(mKeySequence + 1, kAfterNextSequence);
     }
+
+    memcpy(static_cast<void *>(&previousKeys), &mDerivedKeys[kPreviousSequence], sizeof(DerivedKeys));
+    memmove(static_cast<void *>(&mDerivedKeys[kPreviousSequence]), &mDerivedKeys[kCurrentSequence],
+            sizeof(DerivedKeys) * kAfterNextSequence);
+    memcpy(static_cast<void *>(&mDerivedKeys[kAfterNextSequence]), &previousKeys, sizeof(DerivedKeys));
+
+    mAfterNextKeysValid = false;
+    mDeriveKeysTask.Post();
+
+    UpdateMacKeys();
+}
+
+void KeyManager::HandleDeriveKeysTask(void)
+{
+    VerifyOrExit(!mAfterNextKeysValid);
+
+    DeriveKeys(mKeySequence + 2, kAfterNextSequence);
+    mAfterNextKeysValid = true;
+
+exit:
+    return;
+}
+
+void KeyManager::UpdateMacKeys(void)
+{
+#if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
+#if OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
+    // `SubMac` takes over the key references it is given, so new
+    // keys are imported for it rather than sharing the cached ones.
+    HashKeys         hashKeys;
+    Mac::KeyMaterial curKey;
+    Mac::KeyMaterial prevKey;
+    Mac::KeyMaterial nextKey;
+
+    ComputeKeys(mKeySequence, hashKeys);
+    curKey.SetFrom(hashKeys.GetMacKey(), kExportableMacKeys);
+
+    ComputeKeys(mKeySequence - 1, hashKeys);
+    prevKey.SetFrom(hashKeys.GetMacKey(), kExportableMacKeys);
+
+    ComputeKeys(mKeySequence + 1, hashKeys);
+    nextKey.SetFrom(hashKeys.GetMacKey(), kExportableMacKeys);
+
+    Get<Mac::SubMac>().SetMacKey(Mac::Frame::kKeyIdMode1, (mKeySequence & 0x7f) + 1, prevKey, curKey, nextKey);
+#else
+    Get<Mac::SubMac>().SetMacKey(Mac::Frame::kKeyIdMode1, (mKeySequence & 0x7f) + 1,
+                                 mDerivedKeys[kPreviousSequence].mMacKey, mDerivedKeys[kCurrentSequence].mMacKey,
+                                 mDerivedKeys[kNextSequence].mMacKey);
+#endif
 #endif
 }
 
+const KeyManager::DerivedKeys *KeyManager::FindDerivedKeys(uint32_t aKeySequence) const
+{
+    const DerivedKeys *keys  = nullptr;
+    uint32_t           index = aKeySequence - mKeySequence + kCurrentSequence;
+
+    VerifyOrExit(index < kNumCachedSequences);
+    VerifyOrExit((index != kAfterNextSequence) || mAfterNextKeysValid);
+
+    keys = &mDerivedKeys[index];
+
+exit:
+    return keys;
+}
+
 void KeyManager::SetCurrentKeySequence(uint32_t aKeySequence, KeySeqUpdateFlags aFlags)
 {
     VerifyOrExit(aKeySequence != mKeySequence, Get<Notifier>().SignalIfFirst(kEventThreadKeySeqCounterChanged));
@@ -377,8 +459,16 @@ void KeyManager::SetCurrentKeySequence(uint32_t aKeySequence, KeySeqUpdateFlags
         VerifyOrExit(mKeySwitchGuardTimer == 0);
     }
 
-    mKeySequence = aKeySequence;
-    UpdateKeyMaterial();
+    if (aKeySequence == mKeySequence + 1)
+    {
+        mKeySequence = aKeySequence;
+        AdvanceKeyMaterial();
+    }
+    else
+    {
+        mKeySequence = aKeySequence;
+        UpdateKeyMaterial();
+    }
 
     SetAllMacFrameCounters(0, /* aSetIfLarger */ false);
     mMleFrameCounter = 0;
@@ -398,23 +488,31 @@ exit:
 
 const Mle::KeyMaterial &KeyManager::GetTemporaryMleKey(uint32_t aKeySequence)
 {
-    HashKeys hashKeys;
+    const DerivedKeys *keys = FindDerivedKeys(aKeySequence);
+    HashKeys           hashKeys;
+
+    VerifyOrExit(keys == nullptr);
 
     ComputeKeys(aKeySequence, hashKeys);
     mTemporaryMleKey.SetFrom(hashKeys.GetMleKey());
 
-    return mTemporaryMleKey;
+exit:
+    return (keys != nullptr) ? keys->mMleKey : mTemporaryMleKey;
 }
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
 const Mac::KeyMaterial &KeyManager::GetTemporaryTrelMacKey(uint32_t aKeySequence)
 {
-    Mac::Key key;
+    const DerivedKeys *keys = FindDerivedKeys(aKeySequence);
+    Mac::Key           key;
+
+    VerifyOrExit(keys == nullptr);
 
     ComputeTrelKey(aKeySequence, key);
     mTemporaryTrelKey.SetFrom(key);
 
-    return mTemporaryTrelKey;
+exit:
+    return (keys != nullptr) ? keys->mTrelKey : mTemporaryTrelKey;
 }
 #endif
 
@@ -659,7 +757,19 @@ exit:
 
 void KeyManager::DestroyTemporaryKeys(void)
 {
-    mMleKey.Clear();
+    for (DerivedKeys &keys : mDerivedKeys)
+    {
+        keys.mMleKey.Clear();
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+        keys.mTrelKey.Clear();
+#endif
+    }
+
+    mAfterNextKeysValid = false;
+    mTemporaryMleKey.Clear();
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+    mTemporaryTrelKey.Clear();
+#endif
     mKek.Clear();
     Get<Mac::SubMac>().ClearMacKeys();
     Get<Mac::Mac>().ClearMode2Key();
@@ -48,6 +48,7 @@
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
 #include "common/random.hpp"
+#include "common/tasklet.hpp"
 #include "common/timer.hpp"
 #include "crypto/hmac_sha256.hpp"
 #include "mac/mac_types.hpp"
@@ -364,11 +365,13 @@ public:
      * @returns The current TREL MAC key.
      *
      */
-    const Mac::KeyMaterial &GetCurrentTrelMacKey(void) const { return mTrelKey; }
+    const Mac::KeyMaterial &GetCurrentTrelMacKey(void) const { return mDerivedKeys[kCurrentSequence].mTrelKey; }
 
     /**
      * Returns a temporary MAC key for TREL radio link computed from the given key sequence.
      *
+     * The keys of the previous and next key sequences are cached, and are returned without being computed.
+     *
      * @param[in]  aKeySequence  The key sequence value.
      *
      * @returns The temporary TREL MAC key.
@@ -383,11 +386,13 @@ public:
      * @returns The current MLE key.
      *
      */
-    const Mle::KeyMaterial &GetCurrentMleKey(void) const { return mMleKey; }
+    const Mle::KeyMaterial &GetCurrentMleKey(void) const { return mDerivedKeys[kCurrentSequence].mMleKey; }
 
     /**
      * Returns a temporary MLE key Material computed from the given key sequence.
      *
+     * The keys of the previous and next key sequences are cached, and are returned without being computed.
+     *
      * @param[in]  aKeySequence  The key sequence value.
      *
      * @returns The temporary MLE key.
@@ -570,6 +575,9 @@ public:
     /**
      * Updates the MAC keys and MLE key.
      *
+     * Computes the keys of the previous, current and next key sequences, along with the keys of the key sequence that
+     * follows the next one, so that advancing the key sequence by one does not compute any key.
+     *
      */
     void UpdateKeyMaterial(void);
 
@@ -622,12 +630,44 @@ private:
         const Mac::Key &GetMacKey(void) const { return mKeys.mMacKey; }
     };
 
+    // Keys derived from a key sequence. The keys of the key sequences
+    // from `mKeySequence - 1` to `mKeySequence + 2` are cached in
+    // `mDerivedKeys`, so that the keys used by received frames never
+    // need to be computed. When the key sequence advances by one, the
+    // cache is shifted and the keys of the new `mKeySequence + 2` are
+    // computed later from `mDeriveKeysTask`.
+    struct DerivedKeys
+    {
+        Mle::KeyMaterial mMleKey;
+#if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE && !OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE
+        Mac::KeyMaterial mMacKey;
+#endif
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+        Mac::KeyMaterial mTrelKey;
+#endif
+    };
+
+    enum CachedSequence : uint8_t
+    {
+        kPreviousSequence,
+        kCurrentSequence,
+        kNextSequence,
+        kAfterNextSequence,
+        kNumCachedSequences,
+    };
+
     void ComputeKeys(uint32_t aKeySequence, HashKeys &aHashKeys) const;
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
     void ComputeTrelKey(uint32_t aKeySequence, Mac::Key &aKey) const;
 #endif
 
+    void               DeriveKeys(uint32_t aKeySequence, CachedSequence aCachedSequence);
+    void               AdvanceKeyMaterial(void);
+    void               UpdateMacKeys(void);
+    void               HandleDeriveKeysTask(void);
+    const DerivedKeys *FindDerivedKeys(uint32_t aKeySequence) const;
+
     void ResetKeyRotationTimer(void);
     void HandleKeyRotationTimer(void);
     void CheckForKeyRotation(void);
@@ -639,7 +679,8 @@ private:
 
     void ResetFrameCounters(void);
 
-    using RotationTimer = TimerMilliIn<KeyManager, &KeyManager::HandleKeyRotationTimer>;
+    using RotationTimer  = TimerMilliIn<KeyManager, &KeyManager::HandleKeyRotationTimer>;
+    using DeriveKeysTask = TaskletIn<KeyManager, &KeyManager::HandleDeriveKeysTask>;
 
     static const uint8_t kThreadString[];
 
@@ -655,11 +696,12 @@ private:
 #endif
 
     uint32_t         mKeySequence;
-    Mle::KeyMaterial mMleKey;
+    DerivedKeys      mDerivedKeys[kNumCachedSequences];
+    bool             mAfterNextKeysValid;
+    DeriveKeysTask   mDeriveKeysTask;
     Mle::KeyMaterial mTemporaryMleKey;
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
-    Mac::KeyMaterial mTrelKey;
     Mac::KeyMaterial mTemporaryTrelKey;
 #endif
 
@@ -238,23 +238,29 @@ Error Lowpan::Compress(Message              &aMessage,
                        FrameBuilder         &aFrameBuilder,
                        uint8_t              &aHeaderDepth)
 {
-    Error       error       = kErrorNone;
-    uint16_t    startOffset = aMessage.GetOffset();
-    uint16_t    hcCtl       = kHcDispatch;
-    uint16_t    hcCtlOffset = 0;
-    Ip6::Header ip6Header;
-    uint8_t    *ip6HeaderBytes = reinterpret_cast<uint8_t *>(&ip6Header);
-    Context     srcContext, dstContext;
-    uint8_t     nextHeader;
-    uint8_t     ecn;
-    uint8_t     dscp;
-    uint8_t     headerDepth    = 0;
-    uint8_t     headerMaxDepth = aHeaderDepth;
-
-    SuccessOrExit(error = aMessage.Read(aMessage.GetOffset(), ip6Header));
-
-    FindContextToCompressAddress(ip6Header.GetSource(), srcContext);
-    FindContextToCompressAddress(ip6Header.GetDestination(), dstContext);
+    Error              error       = kErrorNone;
+    uint16_t           startOffset = aMessage.GetOffset();
+    uint16_t           hcCtl       = kHcDispatch;
+    uint16_t           hcCtlOffset = 0;
+    Ip6::Header        ip6HeaderCopy;
+    const Ip6::Header *ip6Header;
+    const uint8_t     *ip6HeaderBytes;
+    Context            srcContext, dstContext;
+    uint8_t            nextHeader;
+    uint8_t            ecn;
+    uint8_t            dscp;
+    uint8_t            headerDepth    = 0;
+    uint8_t            headerMaxDepth = aHeaderDepth;
+
+    // The header is parsed in place in the message buffer, it is only
+    // copied when it spans two buffers.
+
+    ip6Header = aMessage.ReadInPlace(aMessage.GetOffset(), ip6HeaderCopy);
+    VerifyOrExit(ip6Header != nullptr, error = kErrorParse);
+    ip6HeaderBytes = reinterpret_cast<const uint8_t *>(ip6Header);
+
+    FindContextToCompressAddress(ip6Header->GetSource(), srcContext);
+    FindContextToCompressAddress(ip6Header->GetDestination(), dstContext);
 
     // Lowpan HC Control Bits
     hcCtlOffset = aFrameBuilder.GetLength();
@@ -303,7 +309,7 @@ Error Lowpan::Compress(Message              &aMessage,
     }
 
     // Next Header
-    switch (ip6Header.GetNextHeader())
+    switch (ip6Header->GetNextHeader())
     {
     case Ip6::kProtoHopOpts:
     case Ip6::kProtoUdp:
@@ -316,12 +322,12 @@ Error Lowpan::Compress(Message              &aMessage,
         OT_FALL_THROUGH;
 
     default:
-        SuccessOrExit(error = aFrameBuilder.AppendUint8(static_cast<uint8_t>(ip6Header.GetNextHeader())));
+        SuccessOrExit(error = aFrameBuilder.AppendUint8(static_cast<uint8_t>(ip6Header->GetNextHeader())));
         break;
     }
 
     // Hop Limit
-    switch (ip6Header.GetHopLimit())
+    switch (ip6Header->GetHopLimit())
     {
     case 1:
         hcCtl |= kHcHopLimit1;
@@ -336,57 +342,57 @@ Error Lowpan::Compress(Message              &aMessage,
         break;
 
     default:
-        SuccessOrExit(error = aFrameBuilder.AppendUint8(ip6Header.GetHopLimit()));
+        SuccessOrExit(error = aFrameBuilder.AppendUint8(ip6Header->GetHopLimit()));
         break;
     }
 
     // Source Address
-    if (ip6Header.GetSource().IsUnspecified())
+    if (ip6Header->GetSource().IsUnspecified())
     {
         hcCtl |= kHcSrcAddrContext;
     }
-    else if (ip6Header.GetSource().IsLinkLocal())
+    else if (ip6Header->GetSource().IsLinkLocal())
     {
         SuccessOrExit(
-            error = CompressSourceIid(aMacAddrs.mSource, ip6Header.GetSource(), srcContext, hcCtl, aFrameBuilder));
+            error = CompressSourceIid(aMacAddrs.mSource, ip6Header->GetSource(), srcContext, hcCtl, aFrameBuilder));
     }
     else if (srcContext.mIsValid)
     {
         hcCtl |= kHcSrcAddrContext;
         SuccessOrExit(
-            error = CompressSourceIid(aMacAddrs.mSource, ip6Header.GetSource(), srcContext, hcCtl, aFrameBuilder));
+            error = CompressSourceIid(aMacAddrs.mSource, ip6Header->GetSource(), srcContext, hcCtl, aFrameBuilder));
     }
     else
     {
-        SuccessOrExit(error = aFrameBuilder.Append(ip6Header.GetSource()));
+        SuccessOrExit(error = aFrameBuilder.Append(ip6Header->GetSource()));
     }
 
     // Destination Address
-    if (ip6Header.GetDestination().IsMulticast())
+    if (ip6Header->GetDestination().IsMulticast())
     {
-        SuccessOrExit(error = CompressMulticast(ip6Header.GetDestination(), hcCtl, aFrameBuilder));
+        SuccessOrExit(error = CompressMulticast(ip6Header->GetDestination(), hcCtl, aFrameBuilder));
     }
-    else if (ip6Header.GetDestination().IsLinkLocal())
+    else if (ip6Header->GetDestination().IsLinkLocal())
     {
-        SuccessOrExit(error = CompressDestinationIid(aMacAddrs.mDestination, ip6Header.GetDestination(), dstContext,
+        SuccessOrExit(error = CompressDestinationIid(aMacAddrs.mDestination, ip6Header->GetDestination(), dstContext,
                                                      hcCtl, aFrameBuilder));
     }
     else if (dstContext.mIsValid)
     {
         hcCtl |= kHcDstAddrContext;
-        SuccessOrExit(error = CompressDestinationIid(aMacAddrs.mDestination, ip6Header.GetDestination(), dstContext,
+        SuccessOrExit(error = CompressDestinationIid(aMacAddrs.mDestination, ip6Header->GetDestination(), dstContext,
                                                      hcCtl, aFrameBuilder));
     }
     else
     {
-        SuccessOrExit(error = aFrameBuilder.Append(ip6Header.GetDestination()));
+        SuccessOrExit(error = aFrameBuilder.Append(ip6Header->GetDestination()));
     }
 
     headerDepth++;
 
-    aMessage.MoveOffset(sizeof(ip6Header));
+    aMessage.MoveOffset(sizeof(Ip6::Header));
 
-    nextHeader = static_cast<uint8_t>(ip6Header.GetNextHeader());
+    nextHeader = static_cast<uint8_t>(ip6Header->GetNextHeader());
 
     while (headerDepth < headerMaxDepth)
     {
@@ -508,16 +514,18 @@ exit:
 
 Error Lowpan::CompressUdp(Message &aMessage, FrameBuilder &aFrameBuilder)
 {
-    Error            error       = kErrorNone;
-    uint16_t         startOffset = aMessage.GetOffset();
-    Ip6::Udp::Header udpHeader;
-    uint16_t         source;
-    uint16_t         destination;
+    Error                   error       = kErrorNone;
+    uint16_t                startOffset = aMessage.GetOffset();
+    Ip6::Udp::Header        udpHeaderCopy;
+    const Ip6::Udp::Header *udpHeader;
+    uint16_t                source;
+    uint16_t                destination;
 
-    SuccessOrExit(error = aMessage.Read(aMessage.GetOffset(), udpHeader));
+    udpHeader = aMessage.ReadInPlace(aMessage.GetOffset(), udpHeaderCopy);
+    VerifyOrExit(udpHeader != nullptr, error = kErrorParse);
 
-    source      = udpHeader.GetSourcePort();
-    destination = udpHeader.GetDestinationPort();
+    source      = udpHeader->GetSourcePort();
+    destination = udpHeader->GetDestinationPort();
 
     if ((source & 0xfff0) == 0xf0b0 && (destination & 0xfff0) == 0xf0b0)
     {
@@ -539,12 +547,12 @@ Error Lowpan::CompressUdp(Message &aMessage, FrameBuilder &aFrameBuilder)
     else
     {
         SuccessOrExit(error = aFrameBuilder.AppendUint8(kUdpDispatch));
-        SuccessOrExit(error = aFrameBuilder.AppendBytes(&udpHeader, Ip6::Udp::Header::kLengthFieldOffset));
+        SuccessOrExit(error = aFrameBuilder.AppendBytes(udpHeader, Ip6::Udp::Header::kLengthFieldOffset));
     }
 
-    SuccessOrExit(error = aFrameBuilder.AppendBigEndianUint16(udpHeader.GetChecksum()));
+    SuccessOrExit(error = aFrameBuilder.AppendBigEndianUint16(udpHeader->GetChecksum()));
 
-    aMessage.MoveOffset(sizeof(udpHeader));
+    aMessage.MoveOffset(sizeof(Ip6::Udp::Header));
 
 exit:
     if (error != kErrorNone)
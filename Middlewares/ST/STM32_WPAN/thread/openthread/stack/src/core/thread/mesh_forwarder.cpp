@@ -656,23 +656,25 @@ exit:
 
 Error MeshForwarder::UpdateIp6Route(Message &aMessage)
 {
-    Mle::MleRouter &mle   = Get<Mle::MleRouter>();
-    Error           error = kErrorNone;
-    Ip6::Header     ip6Header;
+    Mle::MleRouter    &mle   = Get<Mle::MleRouter>();
+    Error              error = kErrorNone;
+    Ip6::Header        ip6HeaderCopy;
+    const Ip6::Header *ip6Header;
 
     mAddMeshHeader = false;
 
-    IgnoreError(aMessage.Read(0, ip6Header));
+    ip6Header = aMessage.ReadInPlace(0, ip6HeaderCopy);
+    VerifyOrExit(ip6Header != nullptr, error = kErrorDrop);
 
-    VerifyOrExit(!ip6Header.GetSource().IsMulticast(), error = kErrorDrop);
+    VerifyOrExit(!ip6Header->GetSource().IsMulticast(), error = kErrorDrop);
 
-    GetMacSourceAddress(ip6Header.GetSource(), mMacAddrs.mSource);
+    GetMacSourceAddress(ip6Header->GetSource(), mMacAddrs.mSource);
 
     if (mle.IsDisabled() || mle.IsDetached())
     {
-        if (ip6Header.GetDestination().IsLinkLocal() || ip6Header.GetDestination().IsLinkLocalMulticast())
+        if (ip6Header->GetDestination().IsLinkLocal() || ip6Header->GetDestination().IsLinkLocalMulticast())
         {
-            GetMacDestinationAddress(ip6Header.GetDestination(), mMacAddrs.mDestination);
+            GetMacDestinationAddress(ip6Header->GetDestination(), mMacAddrs.mDestination);
         }
         else
         {
@@ -682,7 +684,7 @@ Error MeshForwarder::UpdateIp6Route(Message &aMessage)
         ExitNow();
     }
 
-    if (ip6Header.GetDestination().IsMulticast())
+    if (ip6Header->GetDestination().IsMulticast())
     {
         // With the exception of MLE multicasts and any other message
         // with link security disabled, an End Device transmits
@@ -697,9 +699,9 @@ Error MeshForwarder::UpdateIp6Route(Message &aMessage)
             mMacAddrs.mDestination.SetShort(Mac::kShortAddrBroadcast);
         }
     }
-    else if (ip6Header.GetDestination().IsLinkLocal())
+    else if (ip6Header->GetDestination().IsLinkLocal())
     {
-        GetMacDestinationAddress(ip6Header.GetDestination(), mMacAddrs.mDestination);
+        GetMacDestinationAddress(ip6Header->GetDestination(), mMacAddrs.mDestination);
     }
     else if (mle.IsMinimalEndDevice())
     {
@@ -708,7 +710,7 @@ Error MeshForwarder::UpdateIp6Route(Message &aMessage)
     else
     {
 #if OPENTHREAD_FTD
-        error = UpdateIp6RouteFtd(ip6Header, aMessage);
+        error = UpdateIp6RouteFtd(*ip6Header, aMessage);
 #else
         OT_ASSERT(false);
 #endif
@@ -50,6 +50,13 @@ void MeshForwarder::SendMessage(OwnedPtr<Message> aMessagePtr)
 {
     Message &message = *aMessagePtr.Release();
 
+    if (Get<MessagePool>().CheckAdmission(message) != kErrorNone)
+    {
+        LogMessage(kMessageDrop, message, kErrorNoBufs);
+        message.Free();
+        ExitNow();
+    }
+
     message.SetOffset(0);
     message.SetDatagramTag(0);
     message.SetTimestampToNow();
@@ -59,10 +66,18 @@ void MeshForwarder::SendMessage(OwnedPtr<Message> aMessagePtr)
     {
     case Message::kTypeIp6:
     {
-        Ip6::Header         ip6Header;
-        const Ip6::Address &destination = ip6Header.GetDestination();
+        Ip6::Header        ip6HeaderCopy;
+        const Ip6::Header *ip6Header = message.ReadInPlace(0, ip6HeaderCopy);
 
-        IgnoreError(message.Read(0, ip6Header));
+        if (ip6Header == nullptr)
+        {
+            // The message is shorter than an IPv6 header. It is not
+            // marked for any transmission, so it is removed below.
+            LogMessage(kMessageDrop, message, kErrorParse);
+            break;
+        }
+
+        const Ip6::Address &destination = ip6Header->GetDestination();
 
         if (destination.IsMulticast())
         {
@@ -35,12 +35,21 @@
 
 #if OPENTHREAD_MTD
 
+#include "common/locator_getters.hpp"
+
 namespace ot {
 
 void MeshForwarder::SendMessage(OwnedPtr<Message> aMessagePtr)
 {
     Message &message = *aMessagePtr.Release();
 
+    if (Get<MessagePool>().CheckAdmission(message) != kErrorNone)
+    {
+        LogMessage(kMessageDrop, message, kErrorNoBufs);
+        message.Free();
+        ExitNow();
+    }
+
     message.SetDirectTransmission();
     message.SetOffset(0);
     message.SetDatagramTag(0);
@@ -52,6 +61,9 @@ void MeshForwarder::SendMessage(OwnedPtr<Message> aMessagePtr)
 #if (OPENTHREAD_CONFIG_MAX_FRAMES_IN_DIRECT_TX_QUEUE > 0)
     ApplyDirectTxQueueLimit(message);
 #endif
+
+exit:
+    return;
 }
 
 Error MeshForwarder::EvictMessage(Message::Priority aPriority)
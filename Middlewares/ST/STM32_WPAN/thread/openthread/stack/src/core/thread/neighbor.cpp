@@ -46,6 +46,7 @@ void Neighbor::SetState(State aState)
 {
     VerifyOrExit(mState != aState);
     mState = static_cast<uint8_t>(aState);
+    UpdateChildTableIndex();
 
 #if OPENTHREAD_CONFIG_UPTIME_ENABLE
     if (mState == kStateValid)
@@ -58,6 +59,10 @@ exit:
     return;
 }
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+void Neighbor::UpdateChildTableIndex(void) { Get<ChildTable>().UpdateIndex(*this); }
+#endif
+
 #if OPENTHREAD_CONFIG_UPTIME_ENABLE
 uint32_t Neighbor::GetConnectionTime(void) const
 {
@@ -372,21 +372,17 @@ public:
      */
     const Mac::ExtAddress &GetExtAddress(void) const { return mMacAddr; }
 
-    /**
-     * Returns the Extended Address.
-     *
-     * @returns A reference to the Extended Address.
-     *
-     */
-    Mac::ExtAddress &GetExtAddress(void) { return mMacAddr; }
-
     /**
      * Sets the Extended Address.
      *
      * @param[in]  aAddress  The Extended Address value to set.
      *
      */
-    void SetExtAddress(const Mac::ExtAddress &aAddress) { mMacAddr = aAddress; }
+    void SetExtAddress(const Mac::ExtAddress &aAddress)
+    {
+        mMacAddr = aAddress;
+        UpdateChildTableIndex();
+    }
 
     /**
      * Gets the key sequence value.
@@ -499,7 +495,11 @@ public:
      * @param[in]  aRloc16  The RLOC16 value.
      *
      */
-    void SetRloc16(uint16_t aRloc16) { mRloc16 = aRloc16; }
+    void SetRloc16(uint16_t aRloc16)
+    {
+        mRloc16 = aRloc16;
+        UpdateChildTableIndex();
+    }
 
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     /**
@@ -791,6 +791,18 @@ protected:
      */
     void Init(Instance &aInstance);
 
+    /**
+     * Updates the child table index after the state, the RLOC16 or the Extended Address has changed.
+     *
+     * Does nothing if the neighbor is not a child in the child table.
+     *
+     */
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE
+    void UpdateChildTableIndex(void);
+#else
+    void UpdateChildTableIndex(void) {}
+#endif
+
 private:
     enum : uint32_t
     {
@@ -258,9 +258,67 @@ exit:
 
 Error Leader::RouteLookup(const Ip6::Address &aSource, const Ip6::Address &aDestination, uint16_t &aRloc16) const
 {
+    Error error = BorderRouterLookup(aSource, aDestination, aRloc16);
+
+    VerifyOrExit(error != kErrorNone);
+
+#if OPENTHREAD_CONFIG_IP6_SLAAC_ENABLE
+    {
+        // The `Slaac` module keeps track of the associated Domain IDs
+        // for deprecating SLAAC prefixes, even if the related
+        // Prefix TLV has already been removed from the Network
+        // Data.
+
+        uint8_t domainId;
+
+        if (Get<Utils::Slaac>().FindDomainIdFor(aSource, domainId) == kErrorNone)
+        {
+            error = ExternalRouteLookup(domainId, aDestination, aRloc16);
+        }
+    }
+#endif
+
+exit:
+    return error;
+}
+
+Error Leader::BorderRouterLookup(const Ip6::Address &aSource,
+                                 const Ip6::Address &aDestination,
+                                 uint16_t           &aRloc16) const
+{
+    // Looks up a route through the border routers of the Network Data
+    // prefixes matching `aSource`, in the Network Data order.
+
     Error            error     = kErrorNoRoute;
     const PrefixTlv *prefixTlv = nullptr;
 
+#if OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_ENABLE
+    if (mRouteTable.IsValid())
+    {
+        for (uint8_t i = 0; i < mRouteTable.GetNumPrefixes(); i++)
+        {
+            const RouteTable::Prefix &prefix = mRouteTable.GetPrefix(i);
+
+            if (!prefix.HasBorderRouter() || !aSource.MatchesPrefix(prefix.mPrefix))
+            {
+                continue;
+            }
+
+            if (ExternalRouteLookup(prefix.mDomainId, aDestination, aRloc16) == kErrorNone)
+            {
+                ExitNow(error = kErrorNone);
+            }
+
+            if (BestRouteLookup(prefix.mDefaultRoutesStart, prefix.mDefaultRoutesEnd, aRloc16) == kErrorNone)
+            {
+                ExitNow(error = kErrorNone);
+            }
+        }
+
+        ExitNow();
+    }
+#endif
+
     while ((prefixTlv = FindNextMatchingPrefixTlv(aSource, prefixTlv)) != nullptr)
     {
         if (prefixTlv->FindSubTlv<BorderRouterTlv>() == nullptr)
@@ -279,22 +337,6 @@ Error Leader::RouteLookup(const Ip6::Address &aSource, const Ip6::Address &aDest
         }
     }
 
-#if OPENTHREAD_CONFIG_IP6_SLAAC_ENABLE
-    {
-        // The `Slaac` module keeps track of the associated Domain IDs
-        // for deprecating SLAAC prefixes, even if the related
-        // Prefix TLV has already been removed from the Network
-        // Data.
-
-        uint8_t domainId;
-
-        if (Get<Utils::Slaac>().FindDomainIdFor(aSource, domainId) == kErrorNone)
-        {
-            error = ExternalRouteLookup(domainId, aDestination, aRloc16);
-        }
-    }
-#endif
-
 exit:
     return error;
 }
@@ -353,6 +395,26 @@ Error Leader::ExternalRouteLookup(uint8_t aDomainId, const Ip6::Address &aDestin
     const HasRouteEntry *bestRouteEntry  = nullptr;
     uint8_t              bestMatchLength = 0;
 
+#if OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_ENABLE
+    if (mRouteTable.IsValid())
+    {
+        // The first match is the longest one, among prefixes of the
+        // same length the first one in the Network Data.
+
+        for (uint8_t i = 0; i < mRouteTable.GetNumExternalRoutePrefixes(); i++)
+        {
+            const RouteTable::Prefix &prefix = mRouteTable.GetPrefixByLength(i);
+
+            if ((prefix.mDomainId == aDomainId) && aDestination.MatchesPrefix(prefix.mPrefix))
+            {
+                ExitNow(error = BestRouteLookup(prefix.mExternalRoutesStart, prefix.mExternalRoutesEnd, aRloc16));
+            }
+        }
+
+        ExitNow();
+    }
+#endif
+
     while ((prefixTlv = FindNextMatchingPrefixTlv(aDestination, prefixTlv)) != nullptr)
     {
         const HasRouteTlv *hasRoute;
@@ -390,6 +452,9 @@ Error Leader::ExternalRouteLookup(uint8_t aDomainId, const Ip6::Address &aDestin
         error   = kErrorNone;
     }
 
+#if OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_ENABLE
+exit:
+#endif
     return error;
 }
 
@@ -426,6 +491,140 @@ Error Leader::DefaultRouteLookup(const PrefixTlv &aPrefix, uint16_t &aRloc16) co
     return error;
 }
 
+#if OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_ENABLE
+
+Error Leader::BestRouteLookup(uint8_t aStart, uint8_t aEnd, uint16_t &aRloc16) const
+{
+    // The route entries are compared when looking up, as the path
+    // costs to the border routers change with the mesh topology.
+
+    Error                     error = kErrorNoRoute;
+    const RouteTable::Route *best  = nullptr;
+
+    for (uint8_t i = aStart; i < aEnd; i++)
+    {
+        const RouteTable::Route &route = mRouteTable.GetRoute(i);
+
+        if ((best == nullptr) || CompareRouteEntries(route, *best) > 0)
+        {
+            best = &route;
+        }
+    }
+
+    VerifyOrExit(best != nullptr);
+    aRloc16 = best->GetRloc();
+    error   = kErrorNone;
+
+exit:
+    return error;
+}
+
+void Leader::RouteTable::Update(const NetworkDataTlv *aTlvsStart, const NetworkDataTlv *aTlvsEnd)
+{
+    TlvIterator      tlvIterator(aTlvsStart, aTlvsEnd);
+    const PrefixTlv *prefixTlv;
+
+    mValid = false;
+    mPrefixes.Clear();
+    mLongestFirst.Clear();
+    mRoutes.Clear();
+
+    while ((prefixTlv = tlvIterator.Iterate<PrefixTlv>()) != nullptr)
+    {
+        SuccessOrExit(AddPrefix(*prefixTlv));
+    }
+
+    mValid = true;
+
+exit:
+    return;
+}
+
+Error Leader::RouteTable::AddPrefix(const PrefixTlv &aPrefixTlv)
+{
+    Error                  error = kErrorNone;
+    Prefix                 prefix;
+    TlvIterator            hasRouteIterator(aPrefixTlv);
+    TlvIterator            brIterator(aPrefixTlv);
+    const HasRouteTlv     *hasRoute;
+    const BorderRouterTlv *brTlv;
+    uint8_t                index;
+
+    aPrefixTlv.CopyPrefixTo(prefix.mPrefix);
+    prefix.mDomainId        = aPrefixTlv.GetDomainId();
+    prefix.mHasBorderRouter = (aPrefixTlv.FindSubTlv<BorderRouterTlv>() != nullptr);
+
+    prefix.mExternalRoutesStart = mRoutes.GetLength();
+
+    while ((hasRoute = hasRouteIterator.Iterate<HasRouteTlv>()) != nullptr)
+    {
+        for (const HasRouteEntry *entry = hasRoute->GetFirstEntry(); entry <= hasRoute->GetLastEntry();
+             entry                      = entry->GetNext())
+        {
+            Route *route = mRoutes.PushBack();
+
+            VerifyOrExit(route != nullptr, error = kErrorNoBufs);
+            route->mRloc16     = entry->GetRloc();
+            route->mPreference = entry->GetPreference();
+        }
+    }
+
+    prefix.mExternalRoutesEnd  = mRoutes.GetLength();
+    prefix.mDefaultRoutesStart = mRoutes.GetLength();
+
+    while ((brTlv = brIterator.Iterate<BorderRouterTlv>()) != nullptr)
+    {
+        for (const BorderRouterEntry *entry = brTlv->GetFirstEntry(); entry <= brTlv->GetLastEntry();
+             entry                          = entry->GetNext())
+        {
+            Route *route;
+
+            if (!entry->IsDefaultRoute())
+            {
+                continue;
+            }
+
+            route = mRoutes.PushBack();
+            VerifyOrExit(route != nullptr, error = kErrorNoBufs);
+            route->mRloc16     = entry->GetRloc();
+            route->mPreference = entry->GetPreference();
+        }
+    }
+
+    prefix.mDefaultRoutesEnd = mRoutes.GetLength();
+
+    // Prefixes without external routes nor border routers are not used
+    // by the route lookups.
+
+    VerifyOrExit(prefix.HasBorderRouter() || (prefix.mExternalRoutesEnd > prefix.mExternalRoutesStart));
+
+    index = mPrefixes.GetLength();
+    SuccessOrExit(error = mPrefixes.PushBack(prefix));
+
+    VerifyOrExit(prefix.mExternalRoutesEnd > prefix.mExternalRoutesStart);
+
+    // Insert after the prefixes that are longer or of the same length,
+    // which keeps the Network Data order among the same length.
+
+    SuccessOrExit(error = mLongestFirst.PushBack(index));
+
+    for (uint8_t i = mLongestFirst.GetLength() - 1; i > 0; i--)
+    {
+        if (mPrefixes[mLongestFirst[i - 1]].mPrefix.GetLength() >= prefix.mPrefix.GetLength())
+        {
+            break;
+        }
+
+        mLongestFirst[i]     = mLongestFirst[i - 1];
+        mLongestFirst[i - 1] = index;
+    }
+
+exit:
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_ENABLE
+
 Error Leader::SetNetworkData(uint8_t        aVersion,
                              uint8_t        aStableVersion,
                              Type           aType,
@@ -603,6 +802,10 @@ Error Leader::SteeringDataCheckJoiner(const MeshCoP::JoinerDiscerner &aDiscerner
 
 void Leader::SignalNetDataChanged(void)
 {
+#if OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_ENABLE
+    mRouteTable.Update(GetTlvsStart(), GetTlvsEnd());
+#endif
+
     mMaxLength = Max(mMaxLength, GetLength());
     Get<ot::Notifier>().Signal(kEventThreadNetdataChanged);
 }
@@ -39,6 +39,7 @@
 #include <stdint.h>
 
 #include "coap/coap.hpp"
+#include "common/array.hpp"
 #include "common/const_cast.hpp"
 #include "common/non_copyable.hpp"
 #include "common/numeric_limits.hpp"
@@ -444,14 +445,79 @@ private:
 
     const PrefixTlv *FindNextMatchingPrefixTlv(const Ip6::Address &aAddress, const PrefixTlv *aPrevTlv) const;
 
+#if OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_ENABLE
+    class RouteTable
+    {
+        // Routes of the Network Data, compiled on every change.
+        //
+        // The prefixes are kept in the Network Data order, with the range of their entries in the routes array: the
+        // Has Route entries, and the Border Router entries with the default route flag for the prefixes with a Border
+        // Router sub-TLV. The prefixes with external routes are also indexed by decreasing prefix length, so the
+        // first one matching a destination is the longest match.
+
+    public:
+        struct Route
+        {
+            int8_t   GetPreference(void) const { return mPreference; }
+            uint16_t GetRloc(void) const { return mRloc16; }
+
+            uint16_t mRloc16;
+            int8_t   mPreference;
+        };
+
+        struct Prefix
+        {
+            bool HasBorderRouter(void) const { return mHasBorderRouter; }
+
+            Ip6::Prefix mPrefix;
+            uint8_t     mDomainId;
+            uint8_t     mExternalRoutesStart;
+            uint8_t     mExternalRoutesEnd;
+            uint8_t     mDefaultRoutesStart;
+            uint8_t     mDefaultRoutesEnd;
+            bool        mHasBorderRouter;
+        };
+
+        RouteTable(void)
+            : mValid(false)
+        {
+        }
+
+        void Update(const NetworkDataTlv *aTlvsStart, const NetworkDataTlv *aTlvsEnd);
+
+        bool IsValid(void) const { return mValid; }
+
+        uint8_t       GetNumPrefixes(void) const { return mPrefixes.GetLength(); }
+        const Prefix &GetPrefix(uint8_t aIndex) const { return mPrefixes[aIndex]; }
+        const Prefix &GetPrefixByLength(uint8_t aIndex) const { return mPrefixes[mLongestFirst[aIndex]]; }
+        uint8_t       GetNumExternalRoutePrefixes(void) const { return mLongestFirst.GetLength(); }
+        const Route  &GetRoute(uint8_t aIndex) const { return mRoutes[aIndex]; }
+
+    private:
+        static constexpr uint8_t kMaxPrefixes = OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_MAX_PREFIXES;
+        static constexpr uint8_t kMaxRoutes   = OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_MAX_ROUTES;
+
+        Error AddPrefix(const PrefixTlv &aPrefixTlv);
+
+        Array<Prefix, kMaxPrefixes>  mPrefixes;
+        Array<uint8_t, kMaxPrefixes> mLongestFirst;
+        Array<Route, kMaxRoutes>     mRoutes;
+        bool                         mValid;
+    };
+#endif
+
     template <typename EntryType> int CompareRouteEntries(const EntryType &aFirst, const EntryType &aSecond) const;
     int                               CompareRouteEntries(int8_t   aFirstPreference,
                                                           uint16_t aFirstRloc,
                                                           int8_t   aSecondPreference,
                                                           uint16_t aSecondRloc) const;
 
+    Error BorderRouterLookup(const Ip6::Address &aSource, const Ip6::Address &aDestination, uint16_t &aRloc16) const;
     Error ExternalRouteLookup(uint8_t aDomainId, const Ip6::Address &aDestination, uint16_t &aRloc16) const;
     Error DefaultRouteLookup(const PrefixTlv &aPrefix, uint16_t &aRloc16) const;
+#if OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_ENABLE
+    Error BestRouteLookup(uint8_t aStart, uint8_t aEnd, uint16_t &aRloc16) const;
+#endif
     Error SteeringDataCheck(const FilterIndexes &aFilterIndexes) const;
     void  GetContextForMeshLocalPrefix(Lowpan::Context &aContext) const;
     Error ReadCommissioningDataUint16SubTlv(MeshCoP::Tlv::Type aType, uint16_t &aValue) const;
@@ -634,6 +700,10 @@ private:
     uint8_t mTlvBuffer[kMaxSize];
     uint8_t mMaxLength;
 
+#if OPENTHREAD_CONFIG_NETDATA_ROUTE_TABLE_ENABLE
+    RouteTable mRouteTable;
+#endif
+
 #if OPENTHREAD_FTD
 #if OPENTHREAD_CONFIG_BORDER_ROUTER_SIGNAL_NETWORK_DATA_FULL
     bool mIsClone;
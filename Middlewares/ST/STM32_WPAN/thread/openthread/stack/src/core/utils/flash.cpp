@@ -35,6 +35,7 @@
 #include <openthread/platform/flash.h>
 
 #include "common/code_utils.hpp"
+#include "common/num_utils.hpp"
 #include "instance/instance.hpp"
 
 namespace ot {
@@ -50,6 +51,10 @@ void Flash::Init(void)
 
     mSwapSize = otPlatFlashGetSwapSize(&GetInstance());
 
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE
+    ClearIndex();
+#endif
+
     for (mSwapIndex = 0;; mSwapIndex++)
     {
         uint32_t swapMarker;
@@ -80,17 +85,28 @@ void Flash::Init(void)
         {
             break;
         }
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE
+        if (record.IsValid())
+        {
+            AddToIndex(mSwapUsed, record);
+        }
+#endif
     }
 
     SanitizeFreeSpace();
 
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE && OPENTHREAD_CONFIG_PLATFORM_FLASH_COMPACT_THRESHOLD
+    CompactIfNeeded();
+#endif
+
 exit:
     return;
 }
 
 void Flash::SanitizeFreeSpace(void)
 {
-    uint32_t temp;
+    uint32_t temp[kSanitizeReadWords];
     bool     sanitizeNeeded = false;
 
     if (mSwapUsed & 3)
@@ -98,12 +114,20 @@ void Flash::SanitizeFreeSpace(void)
         ExitNow(sanitizeNeeded = true);
     }
 
+    // The free space is read in blocks, it takes most of the swap area once the settings are compacted.
+
     for (uint32_t offset = mSwapUsed; offset < mSwapSize; offset += sizeof(temp))
     {
-        otPlatFlashRead(&GetInstance(), mSwapIndex, offset, &temp, sizeof(temp));
-        if (temp != ~0U)
+        uint32_t length = Min<uint32_t>(sizeof(temp), mSwapSize - offset);
+
+        otPlatFlashRead(&GetInstance(), mSwapIndex, offset, temp, length);
+
+        for (uint32_t i = 0; i < length / sizeof(temp[0]); i++)
         {
-            ExitNow(sanitizeNeeded = true);
+            if (temp[i] != ~0U)
+            {
+                ExitNow(sanitizeNeeded = true);
+            }
         }
     }
 
@@ -122,6 +146,13 @@ Error Flash::Get(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLen
     uint32_t     offset;
     RecordHeader record;
 
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE
+    if (mIndexComplete)
+    {
+        return GetFromIndex(aKey, aIndex, aValue, aValueLength);
+    }
+#endif
+
     for (offset = kSwapMarkerSize; offset < mSwapUsed; offset += record.GetSize())
     {
         otPlatFlashRead(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
@@ -167,7 +198,16 @@ Error Flash::Get(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLen
 
 Error Flash::Set(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
 {
-    return Add(aKey, true, aValue, aValueLength);
+    Error error = Add(aKey, true, aValue, aValueLength);
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE
+    if (error == kErrorNone)
+    {
+        DeleteReplaced(aKey);
+    }
+#endif
+
+    return error;
 }
 
 Error Flash::Add(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
@@ -198,6 +238,10 @@ Error Flash::Add(uint16_t aKey, bool aFirst, const uint8_t *aValue, uint16_t aVa
     record.SetAddCompleteFlag();
     otPlatFlashWrite(&GetInstance(), mSwapIndex, mSwapUsed, &record, sizeof(RecordHeader));
 
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE
+    AddToIndex(mSwapUsed, record);
+#endif
+
     mSwapUsed += record.GetSize();
 
 exit:
@@ -231,6 +275,17 @@ void Flash::Swap(void)
 
     otPlatFlashErase(&GetInstance(), dstIndex);
 
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE
+    if (mIndexComplete)
+    {
+        dstOffset = SwapFromIndex(dstIndex, record);
+        ExitNow();
+    }
+
+    // The index is rebuilt from the copied records, it may fit once the deleted and replaced records are dropped.
+    ClearIndex();
+#endif
+
     for (uint32_t srcOffset = kSwapMarkerSize; srcOffset < mSwapUsed; srcOffset += record.GetSize())
     {
         otPlatFlashRead(&GetInstance(), mSwapIndex, srcOffset, &record, sizeof(RecordHeader));
@@ -244,6 +299,9 @@ void Flash::Swap(void)
 
         otPlatFlashRead(&GetInstance(), mSwapIndex, srcOffset, &record, record.GetSize());
         otPlatFlashWrite(&GetInstance(), dstIndex, dstOffset, &record, record.GetSize());
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE
+        AddToIndex(dstOffset, record);
+#endif
         dstOffset += record.GetSize();
     }
 
@@ -261,6 +319,13 @@ Error Flash::Delete(uint16_t aKey, int aIndex)
     int          index = 0; // This must be initialized to 0. See [Note] below.
     RecordHeader record;
 
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE
+    if (mIndexComplete)
+    {
+        return DeleteFromIndex(aKey, aIndex);
+    }
+#endif
+
     for (uint32_t offset = kSwapMarkerSize; offset < mSwapUsed; offset += record.GetSize())
     {
         otPlatFlashRead(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
@@ -305,8 +370,288 @@ void Flash::Wipe(void)
 
     mSwapIndex = 0;
     mSwapUsed  = sizeof(sSwapActive);
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE
+    ClearIndex();
+#endif
 }
 
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE
+
+void Flash::ClearIndex(void)
+{
+    mIndex.Clear();
+    mIndexComplete = true;
+}
+
+void Flash::AddToIndex(uint32_t aOffset, const RecordHeader &aRecord)
+{
+    IndexEntry *entry;
+
+    VerifyOrExit(mIndexComplete);
+
+    entry = mIndex.PushBack();
+
+    // Once an entry is missing, the record headers are read from flash until the index is rebuilt by `Swap()`.
+    VerifyOrExit(entry != nullptr, mIndexComplete = false);
+
+    entry->mOffset = aOffset;
+    entry->mKey    = aRecord.GetKey();
+    entry->mLength = static_cast<uint8_t>(aRecord.GetLength());
+    entry->mFirst  = aRecord.IsFirst();
+
+exit:
+    return;
+}
+
+bool Flash::IsReplacedInIndex(uint16_t aIndex) const
+{
+    // A record is replaced when a later record is the first one of a new value for its key (see `Set()`).
+
+    bool     rval = false;
+    uint16_t key  = mIndex[aIndex].mKey;
+
+    for (uint16_t i = aIndex + 1; i < mIndex.GetLength(); i++)
+    {
+        if (mIndex[i].mFirst && (mIndex[i].mKey == key))
+        {
+            ExitNow(rval = true);
+        }
+    }
+
+exit:
+    return rval;
+}
+
+void Flash::RemoveFromIndex(uint16_t aIndex)
+{
+    // The entries are kept in the order of the records in flash.
+
+    for (; aIndex + 1 < mIndex.GetLength(); aIndex++)
+    {
+        mIndex[aIndex] = mIndex[aIndex + 1];
+    }
+
+    mIndex.PopBack();
+}
+
+Error Flash::GetFromIndex(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength) const
+{
+    Error             error       = kErrorNotFound;
+    uint16_t          valueLength = 0;
+    int               index       = 0;
+    const IndexEntry *match       = nullptr;
+
+    // Same matching as `Get()` over the record headers.
+
+    for (const IndexEntry &entry : mIndex)
+    {
+        if (entry.mKey != aKey)
+        {
+            continue;
+        }
+
+        if (entry.mFirst)
+        {
+            index = 0;
+        }
+
+        if (index == aIndex)
+        {
+            match = &entry;
+        }
+
+        index++;
+    }
+
+    VerifyOrExit(match != nullptr);
+
+    if (aValue && aValueLength)
+    {
+        uint16_t readLength = *aValueLength;
+
+        if (readLength > match->mLength)
+        {
+            readLength = match->mLength;
+        }
+
+        otPlatFlashRead(&GetInstance(), mSwapIndex, match->mOffset + sizeof(RecordHeader), aValue, readLength);
+    }
+
+    valueLength = match->mLength;
+    error       = kErrorNone;
+
+exit:
+    if (aValueLength)
+    {
+        *aValueLength = valueLength;
+    }
+
+    return error;
+}
+
+Error Flash::DeleteFromIndex(uint16_t aKey, int aIndex)
+{
+    Error        error = kErrorNotFound;
+    int          index = 0;
+    RecordHeader record;
+
+    // Same matching as `Delete()` over the record headers.
+
+    for (uint16_t i = 0; i < mIndex.GetLength();)
+    {
+        IndexEntry &entry   = mIndex[i];
+        bool        deleted = false;
+
+        if (entry.mKey != aKey)
+        {
+            i++;
+            continue;
+        }
+
+        if (entry.mFirst)
+        {
+            index = 0;
+        }
+
+        if ((aIndex == index) || (aIndex == -1))
+        {
+            otPlatFlashRead(&GetInstance(), mSwapIndex, entry.mOffset, &record, sizeof(record));
+            record.SetDeleted();
+            otPlatFlashWrite(&GetInstance(), mSwapIndex, entry.mOffset, &record, sizeof(record));
+            deleted = true;
+            error   = kErrorNone;
+        }
+
+        if ((index == 1) && (aIndex == 0))
+        {
+            otPlatFlashRead(&GetInstance(), mSwapIndex, entry.mOffset, &record, sizeof(record));
+            record.SetFirst();
+            otPlatFlashWrite(&GetInstance(), mSwapIndex, entry.mOffset, &record, sizeof(record));
+            entry.mFirst = true;
+        }
+
+        index++;
+
+        if (deleted)
+        {
+            RemoveFromIndex(i);
+        }
+        else
+        {
+            i++;
+        }
+    }
+
+    return error;
+}
+
+void Flash::DeleteReplaced(uint16_t aKey)
+{
+    // The values replaced by `Set()` are marked deleted once the new value is complete, so they do not take index
+    // entries until the next swap, and so that `Get()` does not find them at a later index when the record headers
+    // are read from flash. If this is interrupted, they are left replaced, as they are without the index.
+
+    RecordHeader record;
+
+    if (!mIndexComplete)
+    {
+        // The new value is the last record.
+
+        for (uint32_t offset = kSwapMarkerSize; offset < mSwapUsed; offset += record.GetSize())
+        {
+            otPlatFlashRead(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
+
+            if ((offset + record.GetSize() == mSwapUsed) || (record.GetKey() != aKey) || !record.IsValid())
+            {
+                continue;
+            }
+
+            record.SetDeleted();
+            otPlatFlashWrite(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
+        }
+
+        ExitNow();
+    }
+
+    // The last entry is the new value.
+
+    for (uint16_t i = 0; i + 1 < mIndex.GetLength();)
+    {
+        if (mIndex[i].mKey != aKey)
+        {
+            i++;
+            continue;
+        }
+
+        otPlatFlashRead(&GetInstance(), mSwapIndex, mIndex[i].mOffset, &record, sizeof(record));
+        record.SetDeleted();
+        otPlatFlashWrite(&GetInstance(), mSwapIndex, mIndex[i].mOffset, &record, sizeof(record));
+
+        RemoveFromIndex(i);
+    }
+
+exit:
+    return;
+}
+
+uint32_t Flash::SwapFromIndex(uint8_t aDstIndex, Record &aRecord)
+{
+    uint32_t dstOffset = kSwapMarkerSize;
+    uint16_t length    = 0;
+
+    // Copies the records that are not replaced, and compacts the index in place with their new offsets. The entries
+    // checked by `IsReplacedInIndex()` come after the current one, so they are not overwritten yet.
+
+    for (uint16_t i = 0; i < mIndex.GetLength(); i++)
+    {
+        IndexEntry entry = mIndex[i];
+
+        if (IsReplacedInIndex(i))
+        {
+            continue;
+        }
+
+        otPlatFlashRead(&GetInstance(), mSwapIndex, entry.mOffset, &aRecord, entry.GetSize());
+        otPlatFlashWrite(&GetInstance(), aDstIndex, dstOffset, &aRecord, entry.GetSize());
+
+        entry.mOffset    = dstOffset;
+        mIndex[length++] = entry;
+        dstOffset += entry.GetSize();
+    }
+
+    mIndex.SetLength(length);
+
+    return dstOffset;
+}
+
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_COMPACT_THRESHOLD
+void Flash::CompactIfNeeded(void)
+{
+    uint32_t liveSize = kSwapMarkerSize;
+
+    VerifyOrExit(mIndexComplete);
+
+    for (uint16_t i = 0; i < mIndex.GetLength(); i++)
+    {
+        if (!IsReplacedInIndex(i))
+        {
+            liveSize += mIndex[i].GetSize();
+        }
+    }
+
+    if ((mSwapUsed - liveSize) * 100 > mSwapSize * OPENTHREAD_CONFIG_PLATFORM_FLASH_COMPACT_THRESHOLD)
+    {
+        Swap();
+    }
+
+exit:
+    return;
+}
+#endif
+
+#endif // OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE
+
 } // namespace ot
 
 #endif // OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
@@ -38,6 +38,7 @@
 
 #include <openthread/platform/toolchain.h>
 
+#include "common/array.hpp"
 #include "common/debug.hpp"
 #include "common/error.hpp"
 #include "common/locator.hpp"
@@ -137,7 +138,8 @@ public:
     void Wipe(void);
 
 private:
-    static constexpr uint32_t kSwapMarkerSize = 4; // in bytes
+    static constexpr uint32_t kSwapMarkerSize    = 4;  // in bytes
+    static constexpr uint32_t kSanitizeReadWords = 16; // Words read at once when checking the free space is erased.
 
     static const uint32_t sSwapActive   = 0xbe5cc5ee;
     static const uint32_t sSwapInactive = 0xbe5cc5ec;
@@ -218,6 +220,36 @@ private:
     void  SanitizeFreeSpace(void);
     void  Swap(void);
 
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE
+    static constexpr uint16_t kIndexSize = OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE;
+
+    // Valid record of the active swap area, in the order of the records in flash.
+    struct IndexEntry
+    {
+        uint16_t GetSize(void) const { return sizeof(RecordHeader) + ((mLength + 3) & 0xfffc); }
+
+        uint32_t mOffset;
+        uint16_t mKey;
+        uint8_t  mLength; // Values are at most `Record::kMaxDataSize` bytes.
+        bool     mFirst;
+    };
+
+    void     ClearIndex(void);
+    void     AddToIndex(uint32_t aOffset, const RecordHeader &aRecord);
+    bool     IsReplacedInIndex(uint16_t aIndex) const;
+    void     RemoveFromIndex(uint16_t aIndex);
+    Error    GetFromIndex(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength) const;
+    Error    DeleteFromIndex(uint16_t aKey, int aIndex);
+    void     DeleteReplaced(uint16_t aKey);
+    uint32_t SwapFromIndex(uint8_t aDstIndex, Record &aRecord);
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_COMPACT_THRESHOLD
+    void CompactIfNeeded(void);
+#endif
+
+    Array<IndexEntry, kIndexSize, uint16_t> mIndex;
+    bool                                    mIndexComplete;
+#endif
+
     uint32_t mSwapSize;
     uint32_t mSwapUsed;
     uint8_t  mSwapIndex;
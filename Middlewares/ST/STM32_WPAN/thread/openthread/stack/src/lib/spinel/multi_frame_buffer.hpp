@@ -86,6 +86,25 @@ public:
                                          : OT_ERROR_NO_BUFS;
     }
 
+    /**
+     * Writes a block of bytes into the buffer and updates the write pointer (if space is available).
+     *
+     * Nothing is written if there is not enough space for the whole block.
+     *
+     * @param[in]  aData    A pointer to the bytes to be written to the buffer.
+     * @param[in]  aLength  The number of bytes in @p aData.
+     *
+     * @retval OT_ERROR_NONE     Successfully wrote the bytes and updated the pointer.
+     * @retval OT_ERROR_NO_BUFS  Insufficient buffer space to write the bytes.
+     *
+     */
+    otError WriteData(const uint8_t *aData, uint16_t aLength)
+    {
+        return CanWrite(aLength) ? (memcpy(mWritePointer, aData, aLength), mWritePointer += aLength,
+                                    mRemainingLength -= aLength, OT_ERROR_NONE)
+                                 : OT_ERROR_NO_BUFS;
+    }
+
     /**
      * Undoes the last @p aUndoLength writes, removing them from frame.
      *
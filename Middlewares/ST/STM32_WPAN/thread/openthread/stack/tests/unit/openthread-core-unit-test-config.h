@@ -0,0 +1,143 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the project-specific configuration of the unit tests.
+ *
+ */
+
+#ifndef OPENTHREAD_CORE_UNIT_TEST_CONFIG_H_
+#define OPENTHREAD_CORE_UNIT_TEST_CONFIG_H_
+
+/**
+ * @def OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS
+ *
+ * The number of message buffers, as in the STM32WB FTD configuration.
+ *
+ */
+#define OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS 128
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_API_ENABLE
+ *
+ * The application CoAP API, as in the STM32WB FTD configuration.
+ *
+ */
+#define OPENTHREAD_CONFIG_COAP_API_ENABLE 1
+
+/**
+ * @def OPENTHREAD_CONFIG_TMF_NETDATA_SERVICE_ENABLE
+ *
+ * The Network Data services, in which the SRP server is published, as in the STM32WB FTD configuration.
+ *
+ */
+#define OPENTHREAD_CONFIG_TMF_NETDATA_SERVICE_ENABLE 1
+
+/**
+ * @def OPENTHREAD_CONFIG_ECDSA_ENABLE
+ *
+ * ECDSA, for the SRP server, as in the STM32WB FTD configuration.
+ *
+ */
+#define OPENTHREAD_CONFIG_ECDSA_ENABLE 1
+
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
+ *
+ * The SRP server, as in the STM32WB FTD configuration.
+ *
+ */
+#define OPENTHREAD_CONFIG_SRP_SERVER_ENABLE 1
+
+/**
+ * @def OPENTHREAD_CONFIG_DNSSD_SERVER_ENABLE
+ *
+ * The DNS-SD server, which answers queries from the hosts and services of the SRP server, as in the STM32WB FTD
+ * configuration.
+ *
+ */
+#define OPENTHREAD_CONFIG_DNSSD_SERVER_ENABLE 1
+
+/**
+ * @def OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
+ *
+ * The heap of the stack is the host heap, so that the benchmarks can register hundreds of SRP hosts.
+ *
+ */
+#define OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE 1
+
+/**
+ * @def OPENTHREAD_CONFIG_MULTICAST_DNS_ENABLE
+ *
+ * The mDNS core, on the infrastructure link of the test platform.
+ *
+ */
+#define OPENTHREAD_CONFIG_MULTICAST_DNS_ENABLE 1
+
+/**
+ * @def OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE
+ *
+ * The NAT64 translator, between the Thread side and an IPv4 network of the test.
+ *
+ */
+#define OPENTHREAD_CONFIG_NAT64_TRANSLATOR_ENABLE 1
+
+/**
+ * @def OPENTHREAD_CONFIG_NAT64_MAX_MAPPINGS
+ *
+ * A mapping pool large enough for the benchmarks of the address indexes (see `Nat64::Translator`).
+ *
+ */
+#define OPENTHREAD_CONFIG_NAT64_MAX_MAPPINGS 1024
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_MAX_CHILDREN
+ *
+ * A child table large enough to be indexed (see `OPENTHREAD_CONFIG_MLE_CHILD_TABLE_INDEX_ENABLE`).
+ *
+ */
+#define OPENTHREAD_CONFIG_MLE_MAX_CHILDREN 256
+
+/**
+ * @def OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
+ *
+ * The settings are stored by the flash storage driver of the core, on the flash of the test platform.
+ *
+ */
+#define OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE 1
+
+/**
+ * @def OPENTHREAD_CONFIG_PLATFORM_FLASH_COMPACT_THRESHOLD
+ *
+ * The swap area is compacted on initialization, so that the tests also go through the compaction.
+ *
+ */
+#define OPENTHREAD_CONFIG_PLATFORM_FLASH_COMPACT_THRESHOLD 50
+
+#endif // OPENTHREAD_CORE_UNIT_TEST_CONFIG_H_
@@ -0,0 +1,477 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include "common/message.hpp"
+#include "instance/instance.hpp"
+#include "net/checksum.hpp"
+#include "net/ip4_types.hpp"
+#include "net/icmp6.hpp"
+#include "net/ip6_address.hpp"
+#include "net/tcp6.hpp"
+#include "net/udp6.hpp"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+/**
+ * The checksum as it was calculated before `Checksum::AddData()` summed words: one byte at a time, with the carry
+ * added back after each byte.
+ *
+ */
+class ReferenceChecksum
+{
+public:
+    ReferenceChecksum(void)
+        : mValue(0)
+        , mAtOddIndex(false)
+    {
+    }
+
+    void AddUint8(uint8_t aUint8)
+    {
+        uint16_t newValue = mValue;
+
+        newValue += mAtOddIndex ? aUint8 : (static_cast<uint16_t>(aUint8) << 8);
+
+        if (newValue < mValue)
+        {
+            newValue++;
+        }
+
+        mValue      = newValue;
+        mAtOddIndex = !mAtOddIndex;
+    }
+
+    void AddData(const uint8_t *aBuffer, uint16_t aLength)
+    {
+        for (uint16_t i = 0; i < aLength; i++)
+        {
+            AddUint8(aBuffer[i]);
+        }
+    }
+
+    uint16_t GetValue(void) const { return mValue; }
+    uint16_t GetFieldValue(void) const { return (mValue == 0xffff) ? mValue : static_cast<uint16_t>(~mValue); }
+
+private:
+    uint16_t mValue;
+    bool     mAtOddIndex;
+};
+
+class ChecksumTester
+{
+public:
+    static constexpr uint16_t kMaxDataLength = 1280;
+
+    static void TestAddData(void)
+    {
+        // Random data is added in random chunks, from one byte to the rest of the data, interleaved with
+        // `AddUint8()` and `AddUint16()` calls, so the chunks start at even and odd indexes.
+
+        static constexpr uint32_t kIterations = 100000;
+
+        uint8_t data[kMaxDataLength];
+
+        for (uint32_t iteration = 0; iteration < kIterations; iteration++)
+        {
+            uint16_t          length = TestRandom() % kMaxDataLength;
+            uint16_t          offset = 0;
+            Checksum          checksum;
+            ReferenceChecksum reference;
+
+            for (uint16_t i = 0; i < length; i++)
+            {
+                data[i] = TestRandomByte();
+            }
+
+            while (offset < length)
+            {
+                uint16_t chunkLength = (TestRandom() % 2 == 0) ? 1 + TestRandom() % 3 : 1 + TestRandom() % length;
+
+                if (chunkLength > length - offset)
+                {
+                    chunkLength = length - offset;
+                }
+
+                checksum.AddData(&data[offset], chunkLength);
+                reference.AddData(&data[offset], chunkLength);
+                offset += chunkLength;
+
+                switch (TestRandom() % 4)
+                {
+                case 0:
+                {
+                    uint8_t byte = TestRandomByte();
+
+                    checksum.AddUint8(byte);
+                    reference.AddUint8(byte);
+                    break;
+                }
+
+                case 1:
+                {
+                    uint16_t word = static_cast<uint16_t>(TestRandom());
+
+                    checksum.AddUint16(word);
+                    reference.AddUint8(static_cast<uint8_t>(word >> 8));
+                    reference.AddUint8(static_cast<uint8_t>(word));
+                    break;
+                }
+
+                default:
+                    break;
+                }
+            }
+
+            VerifyOrQuit(checksum.GetValue() == reference.GetValue(), "AddData() differs from the byte-wise sum");
+            VerifyOrQuit(checksum.GetFieldValue() == reference.GetFieldValue(), "GetFieldValue() differs");
+        }
+
+        printf("TestAddData passed\n");
+    }
+
+    static void TestMessageChecksum(Instance &aInstance)
+    {
+        // The checksums of messages spanning several buffers, with a random offset of the transport header, are
+        // compared with the byte-wise sum of the pseudo-header and of the payload.
+
+        static constexpr uint32_t kIterations = 5000;
+        static const uint8_t      kProtos[]   = {Ip6::kProtoUdp, Ip6::kProtoTcp, Ip6::kProtoIcmp6};
+
+        uint8_t data[kMaxDataLength];
+
+        for (uint32_t iteration = 0; iteration < kIterations; iteration++)
+        {
+            uint8_t           proto       = kProtos[iteration % GetArrayLength(kProtos)];
+            uint16_t          fieldOffset = GetChecksumFieldOffset(proto);
+            uint16_t          offset      = TestRandom() % 100;
+            uint16_t          length      = fieldOffset + sizeof(uint16_t) + TestRandom() % 1000;
+            Ip6::Address      source;
+            Ip6::Address      destination;
+            Ip6::MessageInfo  messageInfo;
+            ReferenceChecksum reference;
+            uint16_t          field;
+            Message          *message = aInstance.Get<MessagePool>().Allocate(Message::kTypeIp6);
+
+            VerifyOrQuit(message != nullptr, "Allocate() failed");
+
+            FillRandom(data, offset + length);
+            FillRandom(source.mFields.m8, sizeof(source));
+            FillRandom(destination.mFields.m8, sizeof(destination));
+            SuccessOrQuit(message->AppendBytes(data, offset + length), "AppendBytes() failed");
+            message->SetOffset(offset);
+
+            Checksum::UpdateMessageChecksum(*message, source, destination, proto);
+
+            data[offset + fieldOffset]     = 0;
+            data[offset + fieldOffset + 1] = 0;
+            reference.AddData(source.GetBytes(), sizeof(source));
+            reference.AddData(destination.GetBytes(), sizeof(destination));
+            reference.AddUint8(static_cast<uint8_t>(length >> 8));
+            reference.AddUint8(static_cast<uint8_t>(length));
+            reference.AddUint8(0);
+            reference.AddUint8(proto);
+            reference.AddData(&data[offset], length);
+
+            SuccessOrQuit(message->Read(offset + fieldOffset, field), "Read() failed");
+            VerifyOrQuit(BigEndian::HostSwap16(field) == reference.GetFieldValue(), "message checksum differs");
+
+            messageInfo.SetPeerAddr(source);
+            messageInfo.SetSockAddr(destination);
+            SuccessOrQuit(Checksum::VerifyMessageChecksum(*message, messageInfo, proto), "checksum does not verify");
+
+            message->Free();
+        }
+
+        printf("TestMessageChecksum passed\n");
+    }
+
+    static void TestUpdateChecksum(void)
+    {
+        // Random even aligned header fields are rewritten, with an old and a new length up to a full IPv6 address,
+        // and the incrementally updated checksum (RFC 1624) is compared with the one of the rewritten data.
+
+        static constexpr uint32_t kIterations = 100000;
+        static constexpr uint16_t kMaxLength  = 64;
+        static constexpr uint16_t kMaxField   = 16;
+
+        uint8_t before[kMaxLength + kMaxField];
+        uint8_t after[kMaxLength + kMaxField];
+        uint8_t oldField[kMaxField];
+        uint8_t newField[kMaxField];
+
+        for (uint32_t iteration = 0; iteration < kIterations; iteration++)
+        {
+            uint16_t          length         = 2 * (TestRandom() % (kMaxLength / 2));
+            uint16_t          fieldOffset    = 2 * (TestRandom() % (length / 2 + 1));
+            uint16_t          oldFieldLength = 2 * (TestRandom() % (kMaxField / 2 + 1));
+            uint16_t          newFieldLength = 2 * (TestRandom() % (kMaxField / 2 + 1));
+            uint16_t          oldWord        = static_cast<uint16_t>(TestRandom());
+            uint16_t          newWord        = static_cast<uint16_t>(TestRandom());
+            ReferenceChecksum oldChecksum;
+            ReferenceChecksum newChecksum;
+            uint16_t          updated;
+
+            FillRandom(before, length);
+            FillRandom(oldField, oldFieldLength);
+            FillRandom(newField, newFieldLength);
+
+            memcpy(after, before, fieldOffset);
+            memcpy(&after[fieldOffset], newField, newFieldLength);
+            memcpy(&after[fieldOffset + newFieldLength], &before[fieldOffset], length - fieldOffset);
+            memmove(&before[fieldOffset + oldFieldLength], &before[fieldOffset], length - fieldOffset);
+            memcpy(&before[fieldOffset], oldField, oldFieldLength);
+
+            oldChecksum.AddData(before, length + oldFieldLength);
+            newChecksum.AddData(after, length + newFieldLength);
+
+            updated = Checksum::UpdateChecksum(oldChecksum.GetFieldValue(), oldField, oldFieldLength, newField,
+                                               newFieldLength);
+            VerifyOrQuit(updated == newChecksum.GetFieldValue(), "UpdateChecksum() of a field differs");
+
+            // A single 16-bit word is rewritten.
+
+            oldChecksum = ReferenceChecksum();
+            newChecksum = ReferenceChecksum();
+            oldChecksum.AddData(before, length);
+            oldChecksum.AddUint8(static_cast<uint8_t>(oldWord >> 8));
+            oldChecksum.AddUint8(static_cast<uint8_t>(oldWord));
+            newChecksum.AddData(before, length);
+            newChecksum.AddUint8(static_cast<uint8_t>(newWord >> 8));
+            newChecksum.AddUint8(static_cast<uint8_t>(newWord));
+
+            updated = Checksum::UpdateChecksum(oldChecksum.GetFieldValue(), oldWord, newWord);
+            VerifyOrQuit(updated == newChecksum.GetFieldValue(), "UpdateChecksum() of a word differs");
+        }
+
+        printf("TestUpdateChecksum passed\n");
+    }
+
+    static void TestTranslateMessageChecksum(Instance &aInstance)
+    {
+        // Messages are translated between IPv6 and IPv4 with random addresses, and the translated checksum is
+        // compared with the one calculated over the whole translated message.
+
+        static constexpr uint32_t kIterations = 5000;
+
+        uint8_t data[kMaxDataLength];
+
+        for (uint32_t iteration = 0; iteration < kIterations; iteration++)
+        {
+            static const uint8_t kProtos[] = {Ip6::kProtoUdp, Ip6::kProtoTcp, Ip6::kProtoIcmp6};
+
+            uint8_t      proto       = kProtos[iteration % GetArrayLength(kProtos)];
+            bool         toIp4       = (iteration / GetArrayLength(kProtos)) % 2 == 0;
+            bool         noChecksum  = (proto == Ip6::kProtoUdp) && !toIp4 && (TestRandom() % 4 == 0);
+            uint8_t      ip4Proto    = (proto == Ip6::kProtoIcmp6) ? static_cast<uint8_t>(Ip4::kProtoIcmp) : proto;
+            uint16_t     fieldOffset = GetChecksumFieldOffset(proto);
+            uint16_t     length      = fieldOffset + sizeof(uint16_t) + TestRandom() % 1000;
+            Ip6::Address ip6Source;
+            Ip6::Address ip6Destination;
+            Ip4::Address ip4Source;
+            Ip4::Address ip4Destination;
+            uint16_t     translated;
+            uint16_t     expected;
+            Message     *message         = aInstance.Get<MessagePool>().Allocate(Message::kTypeIp6);
+            Message     *expectedMessage = aInstance.Get<MessagePool>().Allocate(Message::kTypeIp6);
+
+            VerifyOrQuit(message != nullptr && expectedMessage != nullptr, "Allocate() failed");
+
+            FillRandom(data, length);
+            FillRandom(ip6Source.mFields.m8, sizeof(ip6Source));
+            FillRandom(ip6Destination.mFields.m8, sizeof(ip6Destination));
+            FillRandom(ip4Source.mFields.m8, sizeof(ip4Source));
+            FillRandom(ip4Destination.mFields.m8, sizeof(ip4Destination));
+            SuccessOrQuit(message->AppendBytes(data, length), "AppendBytes() failed");
+            SuccessOrQuit(expectedMessage->AppendBytes(data, length), "AppendBytes() failed");
+
+            if (toIp4)
+            {
+                Checksum::UpdateMessageChecksum(*message, ip6Source, ip6Destination, proto);
+                Checksum::TranslateMessageChecksum(*message, ip6Source, ip6Destination, ip4Source, ip4Destination,
+                                                   ip4Proto);
+                Checksum::UpdateMessageChecksum(*expectedMessage, ip4Source, ip4Destination, ip4Proto);
+            }
+            else
+            {
+                if (noChecksum)
+                {
+                    message->Write<uint16_t>(fieldOffset, 0);
+                }
+                else
+                {
+                    Checksum::UpdateMessageChecksum(*message, ip4Source, ip4Destination, ip4Proto);
+                }
+
+                Checksum::TranslateMessageChecksum(*message, ip4Source, ip4Destination, ip6Source, ip6Destination,
+                                                   proto);
+                Checksum::UpdateMessageChecksum(*expectedMessage, ip6Source, ip6Destination, proto);
+            }
+
+            SuccessOrQuit(message->Read(fieldOffset, translated), "Read() failed");
+            SuccessOrQuit(expectedMessage->Read(fieldOffset, expected), "Read() failed");
+            VerifyOrQuit(translated == expected, "TranslateMessageChecksum() differs from the full checksum");
+
+            message->Free();
+            expectedMessage->Free();
+        }
+
+        printf("TestTranslateMessageChecksum passed\n");
+    }
+
+    static void BenchmarkChecksum(Instance &aInstance)
+    {
+        static constexpr uint32_t kCount = 100000;
+
+        uint8_t      data[kMaxDataLength];
+        uint32_t     sum = 0;
+        double       referenceNs;
+        Ip6::Address ip6Source;
+        Ip6::Address ip6Destination;
+        Ip4::Address ip4Source;
+        Ip4::Address ip4Destination;
+        Message     *message = aInstance.Get<MessagePool>().Allocate(Message::kTypeIp6);
+
+        FillRandom(data, sizeof(data));
+
+        {
+            BenchmarkTimer timer;
+
+            for (uint32_t i = 0; i < kCount; i++)
+            {
+                ReferenceChecksum checksum;
+
+                data[0] = static_cast<uint8_t>(i);
+                checksum.AddData(data, sizeof(data));
+                sum += checksum.GetValue();
+            }
+
+            referenceNs = timer.GetNsPerOp(kCount);
+        }
+
+        {
+            BenchmarkTimer timer;
+
+            for (uint32_t i = 0; i < kCount; i++)
+            {
+                Checksum checksum;
+
+                data[0] = static_cast<uint8_t>(i);
+                checksum.AddData(data, sizeof(data));
+                sum += checksum.GetValue();
+            }
+
+            PrintBenchmark("checksum_add_data_1280", kCount, referenceNs, timer.GetNsPerOp(kCount));
+        }
+
+        // Translation of a 1280-byte UDP datagram to IPv4: the full checksum of the translated message, as done
+        // before, against the incremental update.
+
+        VerifyOrQuit(message != nullptr, "Allocate() failed");
+        SuccessOrQuit(message->AppendBytes(data, sizeof(data)), "AppendBytes() failed");
+        FillRandom(ip6Source.mFields.m8, sizeof(ip6Source));
+        FillRandom(ip6Destination.mFields.m8, sizeof(ip6Destination));
+        FillRandom(ip4Source.mFields.m8, sizeof(ip4Source));
+        FillRandom(ip4Destination.mFields.m8, sizeof(ip4Destination));
+
+        {
+            BenchmarkTimer timer;
+
+            for (uint32_t i = 0; i < kCount; i++)
+            {
+                Checksum::UpdateMessageChecksum(*message, ip4Source, ip4Destination, Ip4::kProtoUdp);
+            }
+
+            referenceNs = timer.GetNsPerOp(kCount);
+        }
+
+        {
+            BenchmarkTimer timer;
+
+            for (uint32_t i = 0; i < kCount; i++)
+            {
+                Checksum::TranslateMessageChecksum(*message, ip6Source, ip6Destination, ip4Source, ip4Destination,
+                                                   Ip4::kProtoUdp);
+            }
+
+            PrintBenchmark("checksum_translate_udp_1280", kCount, referenceNs, timer.GetNsPerOp(kCount));
+        }
+
+        message->Free();
+
+        VerifyOrQuit(sum != 0, "checksums were optimized out");
+    }
+
+private:
+    static uint16_t GetChecksumFieldOffset(uint8_t aIpProto)
+    {
+        uint16_t offset = Ip6::Icmp::Header::kChecksumFieldOffset;
+
+        if (aIpProto == Ip6::kProtoUdp)
+        {
+            offset = Ip6::Udp::Header::kChecksumFieldOffset;
+        }
+        else if (aIpProto == Ip6::kProtoTcp)
+        {
+            offset = Ip6::Tcp::Header::kChecksumFieldOffset;
+        }
+
+        return offset;
+    }
+
+    static void FillRandom(uint8_t *aBuffer, uint16_t aLength)
+    {
+        for (uint16_t i = 0; i < aLength; i++)
+        {
+            aBuffer[i] = TestRandomByte();
+        }
+    }
+};
+
+} // namespace ot
+
+int main(void)
+{
+    ot::Instance *instance = testInitInstance();
+
+    ot::ChecksumTester::TestAddData();
+    ot::ChecksumTester::TestMessageChecksum(*instance);
+    ot::ChecksumTester::TestUpdateChecksum();
+    ot::ChecksumTester::TestTranslateMessageChecksum(*instance);
+    ot::ChecksumTester::BenchmarkChecksum(*instance);
+
+    testFreeInstance(instance);
+
+    printf("All tests passed\n");
+
+    return 0;
+}
@@ -0,0 +1,282 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include "instance/instance.hpp"
+#include "thread/child_table.hpp"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+static const Child::StateFilter kStateFilters[] = {
+    Child::kInStateValid,
+    Child::kInStateValidOrRestoring,
+    Child::kInStateChildIdRequest,
+    Child::kInStateValidOrAttaching,
+    Child::kInStateInvalid,
+    Child::kInStateAnyExceptInvalid,
+    Child::kInStateAnyExceptValidOrRestoring,
+    Child::kInStateAny,
+};
+
+/**
+ * Finds a child as `ChildTable::FindChild()` did before the child table was indexed: by matching each child in turn.
+ *
+ */
+static Child *FindChildLinear(ChildTable &aChildTable, const Child::AddressMatcher &aMatcher)
+{
+    Child *match = nullptr;
+
+    for (uint16_t i = 0; i < aChildTable.GetMaxChildrenAllowed(); i++)
+    {
+        Child *child = aChildTable.GetChildAtIndex(i);
+
+        if (child->Matches(aMatcher))
+        {
+            match = child;
+            break;
+        }
+    }
+
+    return match;
+}
+
+static Mac::ExtAddress GetTestExtAddress(uint16_t aId)
+{
+    Mac::ExtAddress extAddress;
+
+    for (uint8_t i = 0; i < sizeof(extAddress.m8); i++)
+    {
+        extAddress.m8[i] = static_cast<uint8_t>((aId * 0x9e3779b1U) >> ((i % 4) * 8)) ^ i;
+    }
+
+    extAddress.m8[7] = static_cast<uint8_t>(aId);
+
+    return extAddress;
+}
+
+static uint16_t GetTestRloc16(uint16_t aId) { return 0x0400 | aId; }
+
+static void TestChildTableIndex(Instance &aInstance)
+{
+    // Random state, RLOC16 and extended address changes, with more addresses than children so that some are used by
+    // several children, and lookups of each kind compared with the linear search.
+
+    static constexpr uint32_t kIterations = 500000;
+    static constexpr uint16_t kNumIds     = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN + 40;
+
+    ChildTable &childTable = aInstance.Get<ChildTable>();
+    uint32_t    lookups    = 0;
+
+    childTable.Clear();
+
+    for (uint32_t iteration = 0; iteration < kIterations; iteration++)
+    {
+        Child *child = childTable.GetChildAtIndex(TestRandom() % childTable.GetMaxChildrenAllowed());
+
+        switch (TestRandom() % 8)
+        {
+        case 0:
+            child->Clear();
+            break;
+
+        case 1:
+        case 2:
+            child->SetState(static_cast<Neighbor::State>(TestRandom() % (Neighbor::kStateValid + 1)));
+            break;
+
+        case 3:
+            child->SetRloc16((TestRandom() % 4 == 0) ? Mac::kShortAddrInvalid
+                                                     : GetTestRloc16(TestRandom() % kNumIds));
+            break;
+
+        case 4:
+            child->SetExtAddress(GetTestExtAddress(TestRandom() % kNumIds));
+            break;
+
+        case 5:
+            if (TestRandom() % 1000 == 0)
+            {
+                // The number of children allowed can only change while the table is empty.
+
+                childTable.Clear();
+                SuccessOrQuit(childTable.SetMaxChildrenAllowed(1 + TestRandom() % childTable.GetMaxChildren()),
+                              "SetMaxChildrenAllowed() failed");
+            }
+            break;
+
+        default:
+            break;
+        }
+
+        for (uint8_t i = 0; i < 4; i++)
+        {
+            Child::StateFilter filter     = kStateFilters[TestRandom() % GetArrayLength(kStateFilters)];
+            uint16_t           rloc16     = (TestRandom() % 8 == 0) ? static_cast<uint16_t>(Mac::kShortAddrInvalid)
+                                                                    : GetTestRloc16(TestRandom() % kNumIds);
+            Mac::ExtAddress    extAddress = GetTestExtAddress(TestRandom() % kNumIds);
+            Mac::Address       macAddress;
+
+            switch (TestRandom() % 3)
+            {
+            case 0:
+                macAddress.SetShort(rloc16);
+                break;
+            case 1:
+                macAddress.SetExtended(extAddress);
+                break;
+            default:
+                macAddress.SetNone();
+                break;
+            }
+
+            VerifyOrQuit(childTable.FindChild(rloc16, filter) ==
+                             FindChildLinear(childTable, Child::AddressMatcher(rloc16, filter)),
+                         "FindChild() of an RLOC16 differs from the linear search");
+            VerifyOrQuit(childTable.FindChild(extAddress, filter) ==
+                             FindChildLinear(childTable, Child::AddressMatcher(extAddress, filter)),
+                         "FindChild() of an extended address differs from the linear search");
+            VerifyOrQuit(childTable.FindChild(macAddress, filter) ==
+                             FindChildLinear(childTable, Child::AddressMatcher(macAddress, filter)),
+                         "FindChild() of a MAC address differs from the linear search");
+            lookups += 3;
+        }
+    }
+
+    childTable.Clear();
+
+    printf("TestChildTableIndex passed, %lu lookups\n", static_cast<unsigned long>(lookups));
+}
+
+static void BenchmarkChildTable(Instance &aInstance)
+{
+    static constexpr uint32_t kLookups = 200000;
+
+    ChildTable &childTable = aInstance.Get<ChildTable>();
+
+    childTable.Clear();
+    SuccessOrQuit(childTable.SetMaxChildrenAllowed(childTable.GetMaxChildren()), "SetMaxChildrenAllowed() failed");
+
+    for (uint16_t numChildren = 32; numChildren <= childTable.GetMaxChildren(); numChildren *= 2)
+    {
+        volatile uintptr_t sink = 0;
+        double             referenceNs;
+        double             ns;
+        char               name[40];
+
+        childTable.Clear();
+
+        for (uint16_t i = 0; i < numChildren; i++)
+        {
+            Child *child = childTable.GetChildAtIndex(i);
+
+            child->SetRloc16(GetTestRloc16(i + 1));
+            child->SetExtAddress(GetTestExtAddress(1000 + i));
+            child->SetState(Neighbor::kStateValid);
+        }
+
+        {
+            BenchmarkTimer timer;
+
+            for (uint32_t i = 0; i < kLookups; i++)
+            {
+                sink += reinterpret_cast<uintptr_t>(FindChildLinear(
+                    childTable,
+                    Child::AddressMatcher(GetTestRloc16(1 + i % numChildren), Child::kInStateValidOrRestoring)));
+            }
+
+            referenceNs = timer.GetNsPerOp(kLookups);
+        }
+
+        {
+            BenchmarkTimer timer;
+
+            for (uint32_t i = 0; i < kLookups; i++)
+            {
+                sink += reinterpret_cast<uintptr_t>(
+                    childTable.FindChild(GetTestRloc16(1 + i % numChildren), Child::kInStateValidOrRestoring));
+            }
+
+            ns = timer.GetNsPerOp(kLookups);
+        }
+
+        snprintf(name, sizeof(name), "child_table_find_rloc16_%u", numChildren);
+        PrintBenchmark(name, kLookups, referenceNs, ns);
+
+        {
+            BenchmarkTimer timer;
+
+            for (uint32_t i = 0; i < kLookups; i++)
+            {
+                Mac::ExtAddress extAddress = GetTestExtAddress(1000 + i % numChildren);
+
+                sink += reinterpret_cast<uintptr_t>(
+                    FindChildLinear(childTable, Child::AddressMatcher(extAddress, Child::kInStateValid)));
+            }
+
+            referenceNs = timer.GetNsPerOp(kLookups);
+        }
+
+        {
+            BenchmarkTimer timer;
+
+            for (uint32_t i = 0; i < kLookups; i++)
+            {
+                Mac::ExtAddress extAddress = GetTestExtAddress(1000 + i % numChildren);
+
+                sink += reinterpret_cast<uintptr_t>(childTable.FindChild(extAddress, Child::kInStateValid));
+            }
+
+            ns = timer.GetNsPerOp(kLookups);
+        }
+
+        snprintf(name, sizeof(name), "child_table_find_ext_address_%u", numChildren);
+        PrintBenchmark(name, kLookups, referenceNs, ns);
+    }
+
+    childTable.Clear();
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::Instance *instance = testInitInstance();
+
+    ot::TestChildTableIndex(*instance);
+    ot::BenchmarkChildTable(*instance);
+
+    testFreeInstance(instance);
+
+    printf("All tests passed\n");
+
+    return 0;
+}
@@ -0,0 +1,717 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include <openthread/coap.h>
+
+#include "coap/coap.hpp"
+#include "common/message.hpp"
+#include "instance/instance.hpp"
+#include "net/checksum.hpp"
+#include "net/udp6.hpp"
+
+#include "simulation.h"
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+static constexpr uint16_t kMaxCachedResponses = OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES;
+static constexpr uint32_t kMaxCachedSize      = OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES_SIZE;
+static constexpr uint32_t kExchangeLifetime   = 247000; // EXCHANGE_LIFETIME of RFC 7252, with the default parameters.
+static constexpr uint16_t kServerPort         = 5683;
+static constexpr uint16_t kMaxPeers           = 128;
+static constexpr uint64_t kUsPerMs            = 1000;
+
+static void GetPeerMessageInfo(uint16_t aPeer, Ip6::MessageInfo &aMessageInfo)
+{
+    // The peers 4 apart have the same port and the same last 32 bits of address, which the cache hashes, and differ
+    // in the rest of the address.
+
+    aMessageInfo.Clear();
+    aMessageInfo.GetPeerAddr().mFields.m16[0] = BigEndian::HostSwap16(0xfd00);
+    aMessageInfo.GetPeerAddr().mFields.m16[3] = BigEndian::HostSwap16(aPeer / 4);
+    aMessageInfo.GetPeerAddr().mFields.m32[3] = BigEndian::HostSwap32(0x1000 + aPeer % 4);
+    aMessageInfo.SetPeerPort(kServerPort + aPeer % 2);
+}
+
+static Coap::Message *NewCoapMessage(Instance  &aInstance,
+                                     Coap::Type aType,
+                                     Coap::Code aCode,
+                                     uint16_t   aMessageId,
+                                     uint16_t   aPayloadLength,
+                                     uint32_t   aTag)
+{
+    static const uint8_t kPadding[400] = {0};
+
+    Coap::Message *message = aInstance.GetApplicationCoap().NewMessage();
+
+    VerifyOrQuit(message != nullptr, "NewMessage() failed");
+    message->Init(aType, aCode);
+    message->SetMessageId(aMessageId);
+    SuccessOrQuit(message->AppendBytes(kPadding, Min<uint16_t>(aPayloadLength, sizeof(kPadding))),
+                  "AppendBytes() failed");
+    SuccessOrQuit(message->Append(aTag), "Append() failed");
+
+    return message;
+}
+
+static uint32_t ReadTag(const Message &aMessage)
+{
+    uint32_t tag;
+
+    SuccessOrQuit(aMessage.Read(aMessage.GetLength() - sizeof(tag), tag), "Read() failed");
+
+    return tag;
+}
+
+/**
+ * Generates a retransmission storm: the peers send requests with their own Message IDs, the same for all of them,
+ * and each request is retransmitted, interleaved with the requests of the other peers.
+ *
+ */
+class RequestStorm
+{
+public:
+    static constexpr uint8_t kMaxRetransmit = 3;
+
+    RequestStorm(uint16_t aNumPeers, uint16_t aNumOutstanding)
+        : mNumPeers(aNumPeers)
+        , mNumOutstanding(aNumOutstanding)
+    {
+        memset(mOutstanding, 0, sizeof(mOutstanding));
+
+        for (uint16_t &messageId : mNextMessageId)
+        {
+            messageId = 0x100;
+        }
+    }
+
+    void GetNext(uint16_t &aPeer, uint16_t &aMessageId)
+    {
+        Request &request = mOutstanding[TestRandom() % mNumOutstanding];
+
+        if (request.mTransmissionsLeft == 0)
+        {
+            request.mPeer              = TestRandom() % mNumPeers;
+            request.mMessageId         = mNextMessageId[request.mPeer]++;
+            request.mTransmissionsLeft = 1 + kMaxRetransmit;
+        }
+
+        request.mTransmissionsLeft--;
+        aPeer      = request.mPeer;
+        aMessageId = request.mMessageId;
+    }
+
+private:
+    static constexpr uint16_t kMaxOutstanding = 64;
+
+    struct Request
+    {
+        uint16_t mPeer;
+        uint16_t mMessageId;
+        uint8_t  mTransmissionsLeft;
+    };
+
+    uint16_t mNumPeers;
+    uint16_t mNumOutstanding;
+    Request  mOutstanding[kMaxOutstanding];
+    uint16_t mNextMessageId[kMaxPeers];
+};
+
+/**
+ * Models the response cache: the responses, their lifetime, and the removal of the response with the earliest end of
+ * lifetime, the oldest of equal ones, when the number or the size of the cached responses reaches its limit.
+ *
+ */
+class CacheModel
+{
+public:
+    CacheModel(void)
+        : mNumEntries(0)
+        , mCachedSize(0)
+        , mNextSequence(0)
+    {
+        memset(mEntries, 0, sizeof(mEntries));
+        memset(&mCounters, 0, sizeof(mCounters));
+    }
+
+    void Expire(TimeMilli aNow)
+    {
+        for (Entry &entry : mEntries)
+        {
+            if (entry.mUsed && (aNow >= entry.mDequeueTime))
+            {
+                Remove(entry);
+            }
+        }
+    }
+
+    bool Lookup(uint16_t aPeer, uint16_t aMessageId, uint32_t &aTag)
+    {
+        const Entry *entry = Find(aPeer, aMessageId);
+
+        mCounters.mLookups++;
+        VerifyOrExit(entry != nullptr);
+        mCounters.mHits++;
+        aTag = entry->mTag;
+
+    exit:
+        return entry != nullptr;
+    }
+
+    void Enqueue(uint16_t aPeer, uint16_t aMessageId, uint32_t aTag, uint16_t aSize, TimeMilli aDequeueTime)
+    {
+        Entry *entry = nullptr;
+
+        VerifyOrExit(Find(aPeer, aMessageId) == nullptr);
+        VerifyOrExit(aSize <= kMaxCachedSize);
+
+        while ((mNumEntries == kMaxCachedResponses) || (mCachedSize + aSize > kMaxCachedSize))
+        {
+            Entry *earliest = nullptr;
+
+            for (Entry &candidate : mEntries)
+            {
+                if (!candidate.mUsed)
+                {
+                    continue;
+                }
+
+                if ((earliest == nullptr) || (candidate.mDequeueTime < earliest->mDequeueTime) ||
+                    ((candidate.mDequeueTime == earliest->mDequeueTime) && (candidate.mSequence < earliest->mSequence)))
+                {
+                    earliest = &candidate;
+                }
+            }
+
+            mCounters.mEvictions++;
+            Remove(*earliest);
+        }
+
+        for (Entry &candidate : mEntries)
+        {
+            if (!candidate.mUsed)
+            {
+                entry = &candidate;
+                break;
+            }
+        }
+
+        entry->mUsed        = true;
+        entry->mPeer        = aPeer;
+        entry->mMessageId   = aMessageId;
+        entry->mTag         = aTag;
+        entry->mSize        = aSize;
+        entry->mDequeueTime = aDequeueTime;
+        entry->mSequence    = mNextSequence++;
+        mNumEntries++;
+        mCachedSize += aSize;
+
+    exit:
+        return;
+    }
+
+    uint16_t                           GetNumEntries(void) const { return mNumEntries; }
+    const otCoapResponseCacheCounters &GetCounters(void) const { return mCounters; }
+
+private:
+    struct Entry
+    {
+        bool      mUsed;
+        uint16_t  mPeer;
+        uint16_t  mMessageId;
+        uint32_t  mTag;
+        uint16_t  mSize;
+        TimeMilli mDequeueTime;
+        uint32_t  mSequence;
+    };
+
+    const Entry *Find(uint16_t aPeer, uint16_t aMessageId) const
+    {
+        const Entry *match = nullptr;
+
+        for (const Entry &entry : mEntries)
+        {
+            if (entry.mUsed && (entry.mPeer == aPeer) && (entry.mMessageId == aMessageId))
+            {
+                match = &entry;
+                break;
+            }
+        }
+
+        return match;
+    }
+
+    void Remove(Entry &aEntry)
+    {
+        aEntry.mUsed = false;
+        mNumEntries--;
+        mCachedSize -= aEntry.mSize;
+    }
+
+    Entry                       mEntries[kMaxCachedResponses];
+    uint16_t                    mNumEntries;
+    uint32_t                    mCachedSize;
+    uint32_t                    mNextSequence;
+    otCoapResponseCacheCounters mCounters;
+};
+
+/**
+ * Caches the responses as `Coap::ResponsesQueue` did before it was indexed: each response copy carries its peer and
+ * dequeue time at its end, and the lookups read them from every cached response in turn.
+ *
+ */
+class ReferenceResponsesQueue
+{
+public:
+    Error GetMatchedResponseCopy(const Coap::Message    &aRequest,
+                                 const Ip6::MessageInfo &aMessageInfo,
+                                 Coap::Message         **aResponse)
+    {
+        Error          error    = kErrorNone;
+        const Message *response = FindMatchedResponse(aRequest.GetMessageId(), aMessageInfo);
+
+        VerifyOrExit(response != nullptr, error = kErrorNotFound);
+
+        *aResponse = static_cast<Coap::Message *>(response->Clone(response->GetLength() - sizeof(Metadata)));
+        VerifyOrExit(*aResponse != nullptr, error = kErrorNoBufs);
+
+    exit:
+        return error;
+    }
+
+    void EnqueueResponse(Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo, TimeMilli aDequeueTime)
+    {
+        Message *responseCopy;
+        Metadata metadata;
+
+        metadata.mMessageInfo = aMessageInfo;
+        metadata.mDequeueTime = aDequeueTime;
+
+        VerifyOrExit(FindMatchedResponse(aMessage.GetMessageId(), aMessageInfo) == nullptr);
+
+        UpdateQueue();
+
+        VerifyOrExit((responseCopy = aMessage.Clone()) != nullptr);
+        VerifyOrExit(responseCopy->Append(metadata) == kErrorNone, responseCopy->Free());
+
+        mQueue.Enqueue(*responseCopy);
+
+    exit:
+        return;
+    }
+
+    void DequeueAllResponses(void) { mQueue.DequeueAndFreeAll(); }
+
+private:
+    struct Metadata
+    {
+        Ip6::MessageInfo mMessageInfo;
+        TimeMilli        mDequeueTime;
+    };
+
+    static void ReadMetadata(const Message &aMessage, Metadata &aMetadata)
+    {
+        IgnoreError(aMessage.Read(aMessage.GetLength() - sizeof(aMetadata), aMetadata));
+    }
+
+    const Message *FindMatchedResponse(uint16_t aMessageId, const Ip6::MessageInfo &aMessageInfo) const
+    {
+        const Message *response = nullptr;
+
+        for (const Message &message : mQueue)
+        {
+            if (static_cast<const Coap::Message &>(message).GetMessageId() == aMessageId)
+            {
+                Metadata metadata;
+
+                ReadMetadata(message, metadata);
+
+                if ((metadata.mMessageInfo.GetPeerPort() == aMessageInfo.GetPeerPort()) &&
+                    (metadata.mMessageInfo.GetPeerAddr() == aMessageInfo.GetPeerAddr()))
+                {
+                    response = &message;
+                    break;
+                }
+            }
+        }
+
+        return response;
+    }
+
+    void UpdateQueue(void)
+    {
+        uint16_t  count    = 0;
+        Message  *earliest = nullptr;
+        TimeMilli earliestDequeueTime(0);
+
+        for (Message &message : mQueue)
+        {
+            Metadata metadata;
+
+            ReadMetadata(message, metadata);
+
+            if ((earliest == nullptr) || (metadata.mDequeueTime < earliestDequeueTime))
+            {
+                earliest            = &message;
+                earliestDequeueTime = metadata.mDequeueTime;
+            }
+
+            count++;
+        }
+
+        if (count >= kMaxCachedResponses)
+        {
+            mQueue.DequeueAndFree(*earliest);
+        }
+    }
+
+    MessageQueue mQueue;
+};
+
+static uint16_t CountResponses(const Coap::ResponsesQueue &aQueue)
+{
+    uint16_t count = 0;
+
+    for (const Message &message : aQueue.GetResponses())
+    {
+        OT_UNUSED_VARIABLE(message);
+        count++;
+    }
+
+    return count;
+}
+
+static void TestResponseCache(Instance &aInstance, Coap::ResponsesQueue &aQueue)
+{
+    // Retransmission storms of a varying number of peers, with responses of one to three buffers, against the model.
+    // The time advances by 1 ms after half of the requests, so that bursts of responses have the same end of
+    // lifetime, and sometimes by up to 300 s, so that the responses also reach the end of their lifetime.
+
+    static constexpr uint32_t kRequests = 100000;
+
+    const Coap::TxParameters &txParameters = Coap::TxParameters::GetDefault();
+    CacheModel                model;
+    uint32_t                  hits = 0;
+
+    aQueue.DequeueAllResponses();
+    aQueue.ResetCounters();
+
+    for (uint16_t numPeers = 4; numPeers <= 64; numPeers *= 4)
+    {
+        RequestStorm storm(numPeers, numPeers / 2 + 4);
+
+        for (uint32_t i = 0; i < kRequests; i++)
+        {
+            Ip6::MessageInfo messageInfo;
+            Coap::Message   *request;
+            Coap::Message   *copy = nullptr;
+            uint16_t         peer;
+            uint16_t         messageId;
+            uint32_t         tag;
+            Error            error;
+
+            uint32_t step = TestRandom() % 2000;
+
+            if (step == 0)
+            {
+                otSimRun((TestRandom() % 300000) * kUsPerMs);
+            }
+            else if (step < 1000)
+            {
+                otSimRun(kUsPerMs);
+            }
+
+            model.Expire(TimerMilli::GetNow());
+
+            storm.GetNext(peer, messageId);
+            GetPeerMessageInfo(peer, messageInfo);
+
+            request = NewCoapMessage(aInstance, Coap::kTypeConfirmable, Coap::kCodeGet, messageId, 0, 0);
+            error   = aQueue.GetMatchedResponseCopy(*request, messageInfo, &copy);
+            request->Free();
+
+            if (model.Lookup(peer, messageId, tag))
+            {
+                SuccessOrQuit(error, "the cached response of a retransmitted request was not found");
+                VerifyOrQuit(ReadTag(*copy) == tag, "a retransmitted request got the response of another request");
+                copy->Free();
+                hits++;
+            }
+            else
+            {
+                Coap::Message *response;
+
+                VerifyOrQuit(error == kErrorNotFound, "a request got the response of another request");
+
+                response =
+                    NewCoapMessage(aInstance, Coap::kTypeAck, Coap::kCodeContent, messageId, TestRandom() % 400, i);
+                aQueue.EnqueueResponse(*response, messageInfo, txParameters);
+                model.Enqueue(peer, messageId, i, response->GetBufferCount() * kBufferSize,
+                              TimerMilli::GetNow() + kExchangeLifetime);
+                response->Free();
+            }
+
+            VerifyOrQuit(CountResponses(aQueue) == model.GetNumEntries(),
+                         "the number of cached responses differs from the model");
+            VerifyOrQuit(aQueue.GetCounters().mLookups == model.GetCounters().mLookups, "the lookups differ");
+            VerifyOrQuit(aQueue.GetCounters().mHits == model.GetCounters().mHits, "the hits differ");
+            VerifyOrQuit(aQueue.GetCounters().mEvictions == model.GetCounters().mEvictions, "the evictions differ");
+        }
+    }
+
+    aQueue.DequeueAllResponses();
+    aQueue.ResetCounters();
+    VerifyOrQuit(aQueue.GetCounters().mLookups == 0, "ResetCounters() failed");
+
+    VerifyOrQuit(model.GetCounters().mEvictions > 0, "no response was evicted");
+
+    printf("TestResponseCache passed, %lu hits\n", static_cast<unsigned long>(hits));
+}
+
+static uint32_t sHandledRequests;
+
+static void HandleRequest(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    otInstance *instance = static_cast<otInstance *>(aContext);
+    otMessage  *response = otCoapNewMessage(instance, nullptr);
+
+    sHandledRequests++;
+
+    VerifyOrQuit(response != nullptr, "otCoapNewMessage() failed");
+    SuccessOrQuit(otCoapMessageInitResponse(response, aMessage, OT_COAP_TYPE_ACKNOWLEDGMENT, OT_COAP_CODE_CONTENT),
+                  "otCoapMessageInitResponse() failed");
+
+    if (otCoapSendResponse(instance, response, aMessageInfo) != OT_ERROR_NONE)
+    {
+        otMessageFree(response);
+    }
+}
+
+static void ReceiveRequest(Instance &aInstance, uint16_t aPeer, uint16_t aMessageId)
+{
+    // A CoAP Confirmable GET of "test", with a one byte token, in a UDP datagram.
+
+    const uint8_t coapRequest[] = {0x41,
+                                   OT_COAP_CODE_GET,
+                                   static_cast<uint8_t>(aMessageId >> 8),
+                                   static_cast<uint8_t>(aMessageId & 0xff),
+                                   0x5a,
+                                   0xb4,
+                                   't',
+                                   'e',
+                                   's',
+                                   't'};
+
+    Ip6::MessageInfo messageInfo;
+    Ip6::Udp::Header udpHeader;
+    Message         *message = aInstance.Get<MessagePool>().Allocate(Message::kTypeIp6, sizeof(Ip6::Header));
+
+    VerifyOrQuit(message != nullptr, "Allocate() failed");
+
+    GetPeerMessageInfo(aPeer, messageInfo);
+    messageInfo.GetSockAddr().mFields.m16[0] = BigEndian::HostSwap16(0xfd00);
+    messageInfo.GetSockAddr().mFields.m16[7] = BigEndian::HostSwap16(1);
+
+    udpHeader.Clear();
+    udpHeader.SetSourcePort(messageInfo.GetPeerPort());
+    udpHeader.SetDestinationPort(kServerPort);
+    udpHeader.SetLength(sizeof(udpHeader) + sizeof(coapRequest));
+
+    SuccessOrQuit(message->Append(udpHeader), "Append() failed");
+    SuccessOrQuit(message->AppendBytes(coapRequest, sizeof(coapRequest)), "AppendBytes() failed");
+    Checksum::UpdateMessageChecksum(*message, messageInfo.GetPeerAddr(), messageInfo.GetSockAddr(), Ip6::kProtoUdp);
+
+    SuccessOrQuit(aInstance.Get<Ip6::Udp>().HandleMessage(*message, messageInfo), "HandleMessage() failed");
+    message->Free();
+}
+
+static void TestResponseCacheCountersApi(Instance &aInstance)
+{
+    // Requests received by the application CoAP server, each retransmitted once, then more requests than the cache
+    // holds.
+
+    otInstance                        *instance = &aInstance;
+    otCoapResource                     resource = {"test", HandleRequest, instance, nullptr};
+    const otCoapResponseCacheCounters *counters;
+
+    SuccessOrQuit(otCoapStart(instance, kServerPort), "otCoapStart() failed");
+    otCoapAddResource(instance, &resource);
+    otCoapResetResponseCacheCounters(instance);
+    sHandledRequests = 0;
+
+    for (uint16_t messageId = 0; messageId < kMaxCachedResponses; messageId++)
+    {
+        ReceiveRequest(aInstance, 0, messageId);
+        ReceiveRequest(aInstance, 0, messageId);
+    }
+
+    counters = otCoapGetResponseCacheCounters(instance);
+    VerifyOrQuit(sHandledRequests == kMaxCachedResponses, "a retransmitted request was handled again");
+    VerifyOrQuit(counters->mLookups == 2 * kMaxCachedResponses, "otCoapGetResponseCacheCounters() lookups");
+    VerifyOrQuit(counters->mHits == kMaxCachedResponses, "otCoapGetResponseCacheCounters() hits");
+    VerifyOrQuit(counters->mEvictions == 0, "otCoapGetResponseCacheCounters() evictions");
+
+    ReceiveRequest(aInstance, 1, 0);
+    VerifyOrQuit(counters->mEvictions == 1, "a full cache did not evict a response");
+
+    otCoapResetResponseCacheCounters(instance);
+    counters = otCoapGetResponseCacheCounters(instance);
+    VerifyOrQuit((counters->mLookups == 0) && (counters->mHits == 0) && (counters->mEvictions == 0),
+                 "otCoapResetResponseCacheCounters() failed");
+
+    otCoapRemoveResource(instance, &resource);
+    SuccessOrQuit(otCoapStop(instance), "otCoapStop() failed");
+
+    printf("TestResponseCacheCountersApi passed\n");
+}
+
+static void BenchmarkRetransmissionStorm(Instance &aInstance, Coap::ResponsesQueue &aQueue)
+{
+    // The cost of each received request: the cache lookup, then the copy of the cached response or the caching of
+    // the new response. The same storm is run with the reference and the core cache.
+
+    static constexpr uint32_t kRequests = 200000;
+
+    static uint16_t sPeers[kRequests];
+    static uint16_t sMessageIds[kRequests];
+
+    const Coap::TxParameters &txParameters = Coap::TxParameters::GetDefault();
+    Ip6::MessageInfo          messageInfos[kMaxPeers];
+    Coap::Message            *request;
+    Coap::Message            *response;
+    ReferenceResponsesQueue   referenceQueue;
+
+    request  = NewCoapMessage(aInstance, Coap::kTypeConfirmable, Coap::kCodeGet, 0, 0, 0);
+    response = NewCoapMessage(aInstance, Coap::kTypeAck, Coap::kCodeContent, 0, 100, 0);
+
+    for (uint16_t peer = 0; peer < kMaxPeers; peer++)
+    {
+        GetPeerMessageInfo(peer, messageInfos[peer]);
+    }
+
+    for (uint16_t numPeers = 8; numPeers <= kMaxPeers; numPeers *= 4)
+    {
+        RequestStorm storm(numPeers, numPeers / 2 + 4);
+        uint32_t     referenceHits = 0;
+        uint32_t     hits          = 0;
+        double       referenceNs;
+        double       ns;
+        char         name[40];
+
+        for (uint32_t i = 0; i < kRequests; i++)
+        {
+            storm.GetNext(sPeers[i], sMessageIds[i]);
+        }
+
+        {
+            BenchmarkTimer timer;
+
+            for (uint32_t i = 0; i < kRequests; i++)
+            {
+                const Ip6::MessageInfo &messageInfo = messageInfos[sPeers[i]];
+                Coap::Message          *copy;
+
+                request->SetMessageId(sMessageIds[i]);
+
+                if (referenceQueue.GetMatchedResponseCopy(*request, messageInfo, &copy) == kErrorNone)
+                {
+                    copy->Free();
+                    referenceHits++;
+                }
+                else
+                {
+                    response->SetMessageId(sMessageIds[i]);
+                    referenceQueue.EnqueueResponse(*response, messageInfo, TimerMilli::GetNow() + kExchangeLifetime);
+                }
+            }
+
+            referenceNs = timer.GetNsPerOp(kRequests);
+        }
+
+        {
+            BenchmarkTimer timer;
+
+            for (uint32_t i = 0; i < kRequests; i++)
+            {
+                const Ip6::MessageInfo &messageInfo = messageInfos[sPeers[i]];
+                Coap::Message          *copy;
+
+                request->SetMessageId(sMessageIds[i]);
+
+                if (aQueue.GetMatchedResponseCopy(*request, messageInfo, &copy) == kErrorNone)
+                {
+                    copy->Free();
+                    hits++;
+                }
+                else
+                {
+                    response->SetMessageId(sMessageIds[i]);
+                    aQueue.EnqueueResponse(*response, messageInfo, txParameters);
+                }
+            }
+
+            ns = timer.GetNsPerOp(kRequests);
+        }
+
+        referenceQueue.DequeueAllResponses();
+        aQueue.DequeueAllResponses();
+
+        printf("retransmission storm, %u peers: %.1f%% hits, reference %.1f%%\n", numPeers, 100.0 * hits / kRequests,
+               100.0 * referenceHits / kRequests);
+
+        snprintf(name, sizeof(name), "coap_retransmission_storm_%u", numPeers);
+        PrintBenchmark(name, kRequests, referenceNs, ns);
+    }
+
+    request->Free();
+    response->Free();
+    aQueue.ResetCounters();
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::Instance *instance = testInitInstance();
+
+    // The cache outlives the tests, its timer may still be running when they end.
+    static ot::Coap::ResponsesQueue sQueue(*instance);
+
+    ot::TestResponseCache(*instance, sQueue);
+    ot::TestResponseCacheCountersApi(*instance);
+    ot::BenchmarkRetransmissionStorm(*instance, sQueue);
+
+    testFreeInstance(instance);
+
+    printf("All tests passed\n");
+
+    return 0;
+}
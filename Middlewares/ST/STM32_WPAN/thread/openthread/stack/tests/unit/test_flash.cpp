@@ -0,0 +1,534 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include <openthread/platform/flash.h>
+
+#include "instance/instance.hpp"
+#include "utils/flash.hpp"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+/**
+ * Reads the settings as `Flash::Get()` did before the records were indexed in RAM: by going over the record headers
+ * of the active swap area in flash.
+ *
+ */
+class ReferenceFlashReader
+{
+public:
+    explicit ReferenceFlashReader(Instance &aInstance)
+        : mInstance(aInstance)
+        , mSwapIndex(0)
+        , mSwapUsed(0)
+    {
+    }
+
+    void Init(void)
+    {
+        uint32_t     swapMarker;
+        RecordHeader record;
+
+        for (mSwapIndex = 0; mSwapIndex < 2; mSwapIndex++)
+        {
+            otPlatFlashRead(&mInstance, mSwapIndex, 0, &swapMarker, sizeof(swapMarker));
+
+            if (swapMarker == kSwapActive)
+            {
+                break;
+            }
+        }
+
+        VerifyOrQuit(mSwapIndex < 2, "no active swap area");
+
+        for (mSwapUsed = kSwapMarkerSize; mSwapUsed <= TEST_FLASH_SWAP_SIZE - sizeof(record);
+             mSwapUsed += record.GetSize())
+        {
+            otPlatFlashRead(&mInstance, mSwapIndex, mSwapUsed, &record, sizeof(record));
+
+            if (((record.mFlags & kFlagAddBegin) != 0) || ((record.mFlags & kFlagAddComplete) != 0))
+            {
+                break;
+            }
+        }
+    }
+
+    Error Get(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength) const
+    {
+        Error        error       = kErrorNotFound;
+        uint16_t     valueLength = 0;
+        int          index       = 0;
+        RecordHeader record;
+
+        for (uint32_t offset = kSwapMarkerSize; offset < mSwapUsed; offset += record.GetSize())
+        {
+            otPlatFlashRead(&mInstance, mSwapIndex, offset, &record, sizeof(record));
+
+            if ((record.mKey != aKey) || ((record.mFlags & (kFlagAddComplete | kFlagDelete)) != kFlagDelete))
+            {
+                continue;
+            }
+
+            if ((record.mFlags & kFlagFirst) == 0)
+            {
+                index = 0;
+            }
+
+            if (index == aIndex)
+            {
+                uint16_t readLength = (*aValueLength < record.mLength) ? *aValueLength : record.mLength;
+
+                otPlatFlashRead(&mInstance, mSwapIndex, offset + sizeof(record), aValue, readLength);
+                valueLength = record.mLength;
+                error       = kErrorNone;
+            }
+
+            index++;
+        }
+
+        *aValueLength = valueLength;
+
+        return error;
+    }
+
+private:
+    // The record format in flash, see `Flash::RecordHeader`.
+    struct RecordHeader
+    {
+        uint32_t GetSize(void) const { return sizeof(*this) + ((mLength + 3) & 0xfffc); }
+
+        uint16_t mKey;
+        uint16_t mFlags;
+        uint16_t mLength;
+        uint16_t mReserved;
+    };
+
+    static constexpr uint32_t kSwapMarkerSize  = 4;
+    static constexpr uint32_t kSwapActive      = 0xbe5cc5ee;
+    static constexpr uint16_t kFlagAddBegin    = 1 << 0;
+    static constexpr uint16_t kFlagAddComplete = 1 << 1;
+    static constexpr uint16_t kFlagDelete      = 1 << 2;
+    static constexpr uint16_t kFlagFirst       = 1 << 3;
+
+    Instance &mInstance;
+    uint8_t   mSwapIndex;
+    uint32_t  mSwapUsed;
+};
+
+/**
+ * The values of the settings as documented by `Flash`: `Set()` replaces all the values of a key, `Add()` appends a
+ * value and `Delete()` removes one or all of them.
+ *
+ */
+class SettingsModel
+{
+public:
+    static constexpr uint16_t kMaxKey       = 12;
+    static constexpr uint16_t kMaxValues    = 8;
+    static constexpr uint16_t kMaxValueSize = 255;
+
+    SettingsModel(void) { Clear(); }
+
+    void Clear(void) { memset(mCount, 0, sizeof(mCount)); }
+
+    uint16_t GetCount(uint16_t aKey) const { return mCount[aKey]; }
+
+    uint16_t GetTotalCount(void) const
+    {
+        uint16_t count = 0;
+
+        for (uint16_t key = 1; key <= kMaxKey; key++)
+        {
+            count += mCount[key];
+        }
+
+        return count;
+    }
+
+    void Set(uint16_t aKey, const uint8_t *aValue, uint16_t aLength)
+    {
+        mCount[aKey] = 0;
+        Add(aKey, aValue, aLength);
+    }
+
+    void Add(uint16_t aKey, const uint8_t *aValue, uint16_t aLength)
+    {
+        Value &value = mValues[aKey][mCount[aKey]++];
+
+        memcpy(value.mData, aValue, aLength);
+        value.mLength = aLength;
+    }
+
+    void Delete(uint16_t aKey, int aIndex)
+    {
+        if (aIndex < 0)
+        {
+            mCount[aKey] = 0;
+        }
+        else
+        {
+            memmove(&mValues[aKey][aIndex], &mValues[aKey][aIndex + 1],
+                    (mCount[aKey] - aIndex - 1) * sizeof(mValues[aKey][0]));
+            mCount[aKey]--;
+        }
+    }
+
+    bool Matches(uint16_t aKey, int aIndex, Error aError, const uint8_t *aValue, uint16_t aLength) const
+    {
+        bool matches;
+
+        if (aIndex >= mCount[aKey])
+        {
+            matches = (aError == kErrorNotFound) && (aLength == 0);
+        }
+        else
+        {
+            const Value &value = mValues[aKey][aIndex];
+
+            matches = (aError == kErrorNone) && (aLength == value.mLength) && (memcmp(aValue, value.mData, aLength) == 0);
+        }
+
+        return matches;
+    }
+
+private:
+    struct Value
+    {
+        uint8_t  mData[kMaxValueSize];
+        uint16_t mLength;
+    };
+
+    uint16_t mCount[kMaxKey + 1];
+    Value    mValues[kMaxKey + 1][kMaxValues];
+};
+
+static void CheckAllSettings(const Flash &aFlash, ReferenceFlashReader &aReference, const SettingsModel &aModel)
+{
+    aReference.Init();
+
+    for (uint16_t key = 1; key <= SettingsModel::kMaxKey; key++)
+    {
+        for (int index = 0; index <= aModel.GetCount(key); index++)
+        {
+            uint8_t  value[SettingsModel::kMaxValueSize];
+            uint8_t  referenceValue[SettingsModel::kMaxValueSize];
+            uint16_t length          = sizeof(value);
+            uint16_t referenceLength = sizeof(referenceValue);
+            Error    error           = aFlash.Get(key, index, value, &length);
+            Error    referenceError  = aReference.Get(key, index, referenceValue, &referenceLength);
+
+            VerifyOrQuit(aModel.Matches(key, index, error, value, length), "Get() differs from the settings model");
+            VerifyOrQuit(error == referenceError && length == referenceLength &&
+                             memcmp(value, referenceValue, length) == 0,
+                         "Get() differs from reading the records in flash");
+
+            // A presence or length check only.
+
+            length = 0;
+            VerifyOrQuit(aFlash.Get(key, index, nullptr, &length) == error, "Get() of the length differs");
+            VerifyOrQuit(length == referenceLength, "Get() of the length differs");
+            VerifyOrQuit(aFlash.Get(key, index, nullptr, nullptr) == error, "Get() of the presence differs");
+        }
+    }
+}
+
+enum Action : uint8_t
+{
+    kActionSet,
+    kActionAdd,
+    kActionDelete,
+    kActionReboot,
+    kActionWipe,
+};
+
+static Action PickAction(bool aGrowing)
+{
+    // The values are mostly added while growing and deleted while shrinking, so that their number goes from a few
+    // to more than the index holds and back. The weights are per ten thousand.
+
+    uint32_t weight = TestRandom() % 10000;
+    Action   action;
+
+    if (weight < 1)
+    {
+        action = kActionWipe;
+    }
+    else if (weight < 100)
+    {
+        action = kActionReboot;
+    }
+    else if (weight < (aGrowing ? 300 : 1000))
+    {
+        action = kActionSet;
+    }
+    else if (weight < (aGrowing ? 9000 : 4000))
+    {
+        action = kActionAdd;
+    }
+    else
+    {
+        action = kActionDelete;
+    }
+
+    return action;
+}
+
+static void TestFlashIndex(Instance &aInstance)
+{
+    // Random settings operations, with up to 96 values so that the index of 64 records overflows and the driver
+    // falls back to reading the headers in flash, and with reboots that rebuild the index and compact the swap area.
+
+    static constexpr uint32_t kIterations  = 200000;
+    static constexpr uint32_t kPhaseLength = 2000;
+    static constexpr uint32_t kCheckEvery  = 16;
+
+    Flash                flash(aInstance);
+    ReferenceFlashReader reference(aInstance);
+    SettingsModel        model;
+    uint8_t              value[SettingsModel::kMaxValueSize];
+    uint32_t             overflowed = 0;
+
+    flash.Init();
+    flash.Wipe();
+
+    for (uint32_t iteration = 0; iteration < kIterations; iteration++)
+    {
+        uint16_t key    = 1 + TestRandom() % SettingsModel::kMaxKey;
+        uint16_t length = TestRandom() % 40;
+        int      index;
+        bool     found;
+
+        if (TestRandom() % 16 == 0)
+        {
+            length += 150;
+        }
+
+        for (uint16_t i = 0; i < length; i++)
+        {
+            value[i] = TestRandomByte();
+        }
+
+        switch (PickAction((iteration / kPhaseLength) % 2 == 0))
+        {
+        case kActionSet:
+            if (flash.Set(key, value, length) == kErrorNone)
+            {
+                model.Set(key, value, length);
+            }
+            break;
+
+        case kActionAdd:
+            if ((model.GetCount(key) < SettingsModel::kMaxValues) && (flash.Add(key, value, length) == kErrorNone))
+            {
+                model.Add(key, value, length);
+            }
+            break;
+
+        case kActionDelete:
+            index = (TestRandom() % 4 == 0) ? -1 : static_cast<int>(TestRandom() % SettingsModel::kMaxValues);
+            found = (index < 0) ? (model.GetCount(key) > 0) : (index < model.GetCount(key));
+
+            VerifyOrQuit((flash.Delete(key, index) == kErrorNone) == found, "Delete() differs from the model");
+
+            if (found)
+            {
+                model.Delete(key, index);
+            }
+            break;
+
+        case kActionReboot:
+            flash.Init();
+            break;
+
+        case kActionWipe:
+            flash.Wipe();
+            model.Clear();
+            break;
+        }
+
+        if (model.GetTotalCount() > OPENTHREAD_CONFIG_PLATFORM_FLASH_INDEX_SIZE)
+        {
+            overflowed++;
+        }
+
+        if (iteration % kCheckEvery == 0)
+        {
+            CheckAllSettings(flash, reference, model);
+        }
+    }
+
+    CheckAllSettings(flash, reference, model);
+    VerifyOrQuit(overflowed > kIterations / 10, "the index did not overflow");
+
+    printf("TestFlashIndex passed\n");
+}
+
+static void BenchmarkFlash(Instance &aInstance)
+{
+    // The settings read when a router starts: the datasets, network and parent info, the children and the SRP
+    // client state, after a history of child updates.
+
+    enum : uint16_t
+    {
+        kKeyActiveDataset  = 1,
+        kKeyPendingDataset = 2,
+        kKeyNetworkInfo    = 3,
+        kKeyParentInfo     = 4,
+        kKeyChildInfo      = 5,
+        kKeySlaacIidSecret = 6,
+        kKeySrpEcdsaKey    = 8,
+        kKeySrpClientInfo  = 9,
+    };
+
+    static constexpr uint16_t kNumChildren = 32;
+    static constexpr uint32_t kCount       = 1000;
+    static const uint16_t     kKeys[]      = {kKeyActiveDataset, kKeyPendingDataset, kKeyNetworkInfo,
+                                              kKeyParentInfo,    kKeySlaacIidSecret, kKeySrpEcdsaKey,
+                                              kKeySrpClientInfo};
+
+    Flash                flash(aInstance);
+    ReferenceFlashReader reference(aInstance);
+    uint8_t              value[SettingsModel::kMaxValueSize];
+    uint16_t             length;
+    uint32_t             found = 0;
+    uint32_t             referenceReads;
+    double               referenceNs;
+
+    memset(value, 0, sizeof(value));
+
+    flash.Init();
+    flash.Wipe();
+    SuccessOrQuit(flash.Set(kKeyActiveDataset, value, 120), "Set() failed");
+    SuccessOrQuit(flash.Set(kKeyNetworkInfo, value, 38), "Set() failed");
+    SuccessOrQuit(flash.Set(kKeySlaacIidSecret, value, 32), "Set() failed");
+    SuccessOrQuit(flash.Set(kKeySrpEcdsaKey, value, 121), "Set() failed");
+    SuccessOrQuit(flash.Set(kKeySrpClientInfo, value, 18), "Set() failed");
+
+    for (uint16_t i = 0; i < kNumChildren; i++)
+    {
+        SuccessOrQuit(flash.Add(kKeyChildInfo, value, 17), "Add() failed");
+    }
+
+    for (uint16_t i = 0; i < 3 * kNumChildren; i++)
+    {
+        SuccessOrQuit(flash.Delete(kKeyChildInfo, TestRandom() % kNumChildren), "Delete() failed");
+        SuccessOrQuit(flash.Add(kKeyChildInfo, value, 17), "Add() failed");
+
+        if (i % 4 == 0)
+        {
+            SuccessOrQuit(flash.Set(kKeyNetworkInfo, value, 38), "Set() failed");
+        }
+    }
+
+    {
+        BenchmarkTimer timer;
+
+        gTestFlashReadCount = 0;
+
+        for (uint32_t i = 0; i < kCount; i++)
+        {
+            reference.Init();
+
+            for (uint16_t key : kKeys)
+            {
+                length = sizeof(value);
+                found += (reference.Get(key, 0, value, &length) == kErrorNone);
+            }
+
+            for (int index = 0;; index++)
+            {
+                length = sizeof(value);
+
+                if (reference.Get(kKeyChildInfo, index, value, &length) != kErrorNone)
+                {
+                    break;
+                }
+
+                found++;
+            }
+        }
+
+        referenceReads = gTestFlashReadCount / kCount;
+        referenceNs    = timer.GetNsPerOp(kCount);
+    }
+
+    {
+        BenchmarkTimer timer;
+
+        gTestFlashReadCount = 0;
+
+        for (uint32_t i = 0; i < kCount; i++)
+        {
+            flash.Init();
+
+            for (uint16_t key : kKeys)
+            {
+                length = sizeof(value);
+                found += (flash.Get(key, 0, value, &length) == kErrorNone);
+            }
+
+            for (int index = 0;; index++)
+            {
+                length = sizeof(value);
+
+                if (flash.Get(kKeyChildInfo, index, value, &length) != kErrorNone)
+                {
+                    break;
+                }
+
+                found++;
+            }
+        }
+
+        PrintBenchmark("flash_boot_load_32_children", kCount, referenceNs, timer.GetNsPerOp(kCount));
+        printf("flash reads per boot load: %lu before, %lu indexed\n", static_cast<unsigned long>(referenceReads),
+               static_cast<unsigned long>(gTestFlashReadCount / kCount));
+    }
+
+    VerifyOrQuit(found == 2 * kCount * (5 + kNumChildren), "settings were not found");
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::Instance *instance = testInitInstance();
+
+    ot::TestFlashIndex(*instance);
+    ot::BenchmarkFlash(*instance);
+
+    testFreeInstance(instance);
+
+    printf("All tests passed\n");
+
+    return 0;
+}
@@ -0,0 +1,720 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include "common/array.hpp"
+#include "common/code_utils.hpp"
+#include "lib/hdlc/hdlc.hpp"
+#include "lib/spinel/multi_frame_buffer.hpp"
+
+#include "test_util.hpp"
+
+namespace ot {
+
+static constexpr uint8_t kFlagSequence   = 0x7e;
+static constexpr uint8_t kEscapeSequence = 0x7d;
+
+/**
+ * The HDLC-lite encoder and decoder as they were before `Hdlc::Encoder` and `Hdlc::Decoder` processed byte runs as
+ * blocks: one byte at a time, with a byte-wise FCS table. The table is built from the bitwise CRC-16/X.25.
+ *
+ */
+class ReferenceHdlc
+{
+public:
+    static constexpr uint16_t kInitFcs = 0xffff;
+    static constexpr uint16_t kGoodFcs = 0xf0b8;
+
+    static void Init(void)
+    {
+        for (uint16_t i = 0; i < 256; i++)
+        {
+            uint16_t fcs = i;
+
+            for (uint8_t bit = 0; bit < 8; bit++)
+            {
+                fcs = (fcs & 1) ? ((fcs >> 1) ^ 0x8408) : (fcs >> 1);
+            }
+
+            sFcsTable[i] = fcs;
+        }
+    }
+
+    static uint16_t UpdateFcs(uint16_t aFcs, uint8_t aByte) { return (aFcs >> 8) ^ sFcsTable[(aFcs ^ aByte) & 0xff]; }
+
+    static bool NeedsEscape(uint8_t aByte)
+    {
+        return (aByte == 0x11) || (aByte == 0x13) || (aByte == kEscapeSequence) || (aByte == kFlagSequence) ||
+               (aByte == 0xf8);
+    }
+
+private:
+    static uint16_t sFcsTable[256];
+};
+
+uint16_t ReferenceHdlc::sFcsTable[256];
+
+class ReferenceEncoder
+{
+public:
+    ReferenceEncoder(uint8_t *aBuffer, uint16_t aSize)
+        : mBuffer(aBuffer)
+        , mLength(0)
+        , mSize(aSize)
+        , mFcs(0)
+    {
+    }
+
+    otError BeginFrame(void)
+    {
+        mFcs = ReferenceHdlc::kInitFcs;
+
+        return WriteByte(kFlagSequence);
+    }
+
+    otError Encode(uint8_t aByte)
+    {
+        otError error = OT_ERROR_NONE;
+
+        if (ReferenceHdlc::NeedsEscape(aByte))
+        {
+            VerifyOrExit(mLength + 2 <= mSize, error = OT_ERROR_NO_BUFS);
+            IgnoreReturnValue(WriteByte(kEscapeSequence));
+            IgnoreReturnValue(WriteByte(aByte ^ 0x20));
+        }
+        else
+        {
+            SuccessOrExit(error = WriteByte(aByte));
+        }
+
+        mFcs = ReferenceHdlc::UpdateFcs(mFcs, aByte);
+
+    exit:
+        return error;
+    }
+
+    otError Encode(const uint8_t *aData, uint16_t aLength)
+    {
+        otError  error     = OT_ERROR_NONE;
+        uint16_t oldLength = mLength;
+        uint16_t oldFcs    = mFcs;
+
+        while (aLength--)
+        {
+            SuccessOrExit(error = Encode(*aData++));
+        }
+
+    exit:
+        if (error != OT_ERROR_NONE)
+        {
+            mLength = oldLength;
+            mFcs    = oldFcs;
+        }
+
+        return error;
+    }
+
+    otError EndFrame(void)
+    {
+        otError  error     = OT_ERROR_NONE;
+        uint16_t oldLength = mLength;
+        uint16_t oldFcs    = mFcs;
+        uint16_t fcs       = mFcs ^ 0xffff;
+
+        SuccessOrExit(error = Encode(fcs & 0xff));
+        SuccessOrExit(error = Encode(fcs >> 8));
+        SuccessOrExit(error = WriteByte(kFlagSequence));
+
+    exit:
+        if (error != OT_ERROR_NONE)
+        {
+            mLength = oldLength;
+            mFcs    = oldFcs;
+        }
+
+        return error;
+    }
+
+    uint16_t GetLength(void) const { return mLength; }
+
+private:
+    otError WriteByte(uint8_t aByte)
+    {
+        otError error = OT_ERROR_NONE;
+
+        VerifyOrExit(mLength < mSize, error = OT_ERROR_NO_BUFS);
+        mBuffer[mLength++] = aByte;
+
+    exit:
+        return error;
+    }
+
+    uint8_t *mBuffer;
+    uint16_t mLength;
+    uint16_t mSize;
+    uint16_t mFcs;
+};
+
+/**
+ * Records the frames reported by a decoder, with their errors, to compare the decoders.
+ *
+ */
+class FrameLog
+{
+public:
+    FrameLog(void)
+        : mLength(0)
+        , mNumFrames(0)
+    {
+        memset(mNumFramesWithError, 0, sizeof(mNumFramesWithError));
+    }
+
+    void Append(otError aError, const uint8_t *aFrame, uint16_t aLength)
+    {
+        VerifyOrQuit(mLength + 3 + aLength <= sizeof(mLog), "frame log is full");
+
+        mLog[mLength++] = static_cast<uint8_t>(aError);
+        mLog[mLength++] = static_cast<uint8_t>(aLength >> 8);
+        mLog[mLength++] = static_cast<uint8_t>(aLength);
+        memcpy(&mLog[mLength], aFrame, aLength);
+        mLength += aLength;
+        mNumFrames++;
+        mNumFramesWithError[aError]++;
+    }
+
+    bool Matches(const FrameLog &aOther) const
+    {
+        return (mNumFrames == aOther.mNumFrames) && (mLength == aOther.mLength) &&
+               (memcmp(mLog, aOther.mLog, mLength) == 0);
+    }
+
+    uint32_t GetNumFramesWithError(otError aError) const { return mNumFramesWithError[aError]; }
+
+    void Clear(void)
+    {
+        mLength    = 0;
+        mNumFrames = 0;
+    }
+
+private:
+    uint8_t  mLog[32768];
+    uint32_t mLength;
+    uint32_t mNumFrames;
+    uint32_t mNumFramesWithError[OT_NUM_ERRORS]; // Not cleared, for the totals of a test.
+};
+
+class ReferenceDecoder
+{
+public:
+    static constexpr uint16_t kFcsSize = 2;
+
+    ReferenceDecoder(uint16_t aSize, FrameLog &aLog)
+        : mState(kStateNoSync)
+        , mSize(aSize)
+        , mLength(0)
+        , mFcs(0)
+        , mDecodedLength(0)
+        , mLog(aLog)
+    {
+    }
+
+    void Reset(void)
+    {
+        mState         = kStateNoSync;
+        mFcs           = 0;
+        mDecodedLength = 0;
+    }
+
+    void Decode(uint8_t aByte)
+    {
+        switch (mState)
+        {
+        case kStateNoSync:
+            if (aByte == kFlagSequence)
+            {
+                mState         = kStateSync;
+                mDecodedLength = 0;
+                mFcs           = ReferenceHdlc::kInitFcs;
+            }
+
+            break;
+
+        case kStateSync:
+            if (aByte == kEscapeSequence)
+            {
+                mState = kStateEscaped;
+            }
+            else if (aByte == kFlagSequence)
+            {
+                if (mDecodedLength > 0)
+                {
+                    otError error = OT_ERROR_PARSE;
+
+                    if ((mDecodedLength >= kFcsSize) && (mFcs == ReferenceHdlc::kGoodFcs))
+                    {
+                        mLength -= kFcsSize;
+                        error = OT_ERROR_NONE;
+                    }
+
+                    HandleFrame(error);
+                }
+
+                mDecodedLength = 0;
+                mFcs           = ReferenceHdlc::kInitFcs;
+            }
+            else
+            {
+                Write(aByte);
+            }
+
+            break;
+
+        case kStateEscaped:
+            if (Write(aByte ^ 0x20))
+            {
+                mState = kStateSync;
+            }
+
+            break;
+        }
+    }
+
+private:
+    enum State : uint8_t
+    {
+        kStateNoSync,
+        kStateSync,
+        kStateEscaped,
+    };
+
+    bool Write(uint8_t aByte)
+    {
+        bool written = (mLength < mSize);
+
+        if (written)
+        {
+            mFcs             = ReferenceHdlc::UpdateFcs(mFcs, aByte);
+            mFrame[mLength++] = aByte;
+            mDecodedLength++;
+        }
+        else
+        {
+            HandleFrame(OT_ERROR_NO_BUFS);
+            mState = kStateNoSync;
+        }
+
+        return written;
+    }
+
+    void HandleFrame(otError aError)
+    {
+        mLog.Append(aError, mFrame, mLength);
+        mLength = 0;
+    }
+
+    State     mState;
+    uint16_t  mSize;
+    uint16_t  mLength;
+    uint16_t  mFcs;
+    uint16_t  mDecodedLength;
+    uint8_t   mFrame[2048];
+    FrameLog &mLog;
+};
+
+/**
+ * Returns a random payload byte. The escaped bytes, the bytes they are escaped to and the flag are frequent or the
+ * only ones, depending on @p aMode.
+ *
+ */
+static uint8_t GetRandomPayloadByte(uint8_t aMode)
+{
+    static const uint8_t kSpecialBytes[] = {0x11, 0x13, 0x7d, 0x7e, 0xf8, 0x31, 0x33, 0x5d, 0x5e, 0xd8};
+
+    uint8_t byte;
+
+    switch (aMode)
+    {
+    case 0:
+        byte = static_cast<uint8_t>(TestRandom());
+        break;
+    case 1:
+        byte = kSpecialBytes[TestRandom() % GetArrayLength(kSpecialBytes)];
+        break;
+    default:
+        byte = (TestRandom() % 16 == 0) ? kSpecialBytes[TestRandom() % GetArrayLength(kSpecialBytes)]
+                                        : static_cast<uint8_t>(TestRandom());
+        break;
+    }
+
+    return byte;
+}
+
+static uint16_t FillRandomPayload(uint8_t *aPayload, uint16_t aMaxLength)
+{
+    uint8_t  mode   = TestRandom() % 3;
+    uint16_t length = TestRandom() % ((TestRandom() % 4 == 0) ? aMaxLength : 64);
+
+    for (uint16_t i = 0; i < length; i++)
+    {
+        aPayload[i] = GetRandomPayloadByte(mode);
+    }
+
+    return length;
+}
+
+static constexpr uint16_t kDecoderBufferSize = 1300;
+
+static FrameLog                                sFrameLog;
+static Spinel::FrameBuffer<kDecoderBufferSize> sDecoderBuffer;
+
+static void HandleFrame(void *aContext, otError aError)
+{
+    Spinel::FrameBuffer<kDecoderBufferSize> &buffer = *static_cast<Spinel::FrameBuffer<kDecoderBufferSize> *>(aContext);
+
+    sFrameLog.Append(aError, buffer.GetFrame(), buffer.GetLength());
+    buffer.Clear();
+}
+
+static void TestEncoder(void)
+{
+    // Random payloads are encoded in random pieces, through the block and the single byte `Encode()`, into buffers
+    // with from no room to room for the whole frame. The errors, the rollback of a piece which does not fit and the
+    // encoded frames with their FCS are compared with the byte-wise encoder.
+
+    static constexpr uint32_t kIterations = 200000;
+    static constexpr uint16_t kBufferSize = 4096;
+
+    static Spinel::FrameBuffer<kBufferSize> buffer;
+
+    uint8_t  payload[1500];
+    uint8_t  reference[kBufferSize];
+    uint32_t numNoBufs = 0;
+
+    for (uint32_t iteration = 0; iteration < kIterations; iteration++)
+    {
+        uint16_t         size   = (TestRandom() % 3 == 0) ? TestRandom() % 64 + TestRandom() % 2048 : kBufferSize;
+        uint16_t         length = FillRandomPayload(payload, sizeof(payload));
+        uint16_t         offset = 0;
+        Hdlc::Encoder    encoder(buffer);
+        ReferenceEncoder referenceEncoder(reference, size);
+
+        // The buffer space beyond `size` is used by other frames.
+
+        buffer.Clear();
+
+        for (uint16_t i = size; i < kBufferSize; i++)
+        {
+            IgnoreReturnValue(buffer.WriteByte(0));
+        }
+
+        VerifyOrQuit(encoder.BeginFrame() == referenceEncoder.BeginFrame(), "BeginFrame() differs");
+
+        while (offset < length)
+        {
+            uint16_t pieceLength = (TestRandom() % 4 == 0) ? 1 : 1 + TestRandom() % (length - offset);
+            otError  error;
+
+            if ((pieceLength == 1) && (TestRandom() % 2 == 0))
+            {
+                error = encoder.Encode(payload[offset]);
+                VerifyOrQuit(error == referenceEncoder.Encode(payload[offset]), "Encode() of a byte differs");
+            }
+            else
+            {
+                error = encoder.Encode(&payload[offset], pieceLength);
+                VerifyOrQuit(error == referenceEncoder.Encode(&payload[offset], pieceLength), "Encode() differs");
+            }
+
+            numNoBufs += (error == OT_ERROR_NO_BUFS) ? 1 : 0;
+            offset += pieceLength;
+        }
+
+        VerifyOrQuit(encoder.EndFrame() == referenceEncoder.EndFrame(), "EndFrame() differs");
+        VerifyOrQuit(buffer.GetLength() - (kBufferSize - size) == referenceEncoder.GetLength(), "length differs");
+        VerifyOrQuit(memcmp(buffer.GetFrame() + kBufferSize - size, reference, referenceEncoder.GetLength()) == 0,
+                     "encoded frame differs");
+    }
+
+    VerifyOrQuit(numNoBufs > kIterations / 100, "the buffers were too large");
+
+    printf("TestEncoder passed\n");
+}
+
+static void TestDecoder(void)
+{
+    // Streams of valid frames, frames with a flipped bit, truncated frames, frames without their opening flag,
+    // frames larger than the decoder buffer, runs of flags and junk are decoded, fed whole, a byte at a time or in
+    // random blocks. The frames and errors reported are compared with the byte-wise decoder fed a byte at a time.
+
+    static constexpr uint32_t kIterations    = 50000;
+    static constexpr uint16_t kMaxPayload    = kDecoderBufferSize + 100;
+    static constexpr uint16_t kMaxStreamSize = 16384;
+
+    static uint8_t   stream[kMaxStreamSize];
+    static FrameLog  referenceLog;
+    Hdlc::Decoder    decoder;
+    ReferenceDecoder referenceDecoder(kDecoderBufferSize, referenceLog);
+
+    decoder.Init(sDecoderBuffer, HandleFrame, &sDecoderBuffer);
+
+    for (uint32_t iteration = 0; iteration < kIterations; iteration++)
+    {
+        uint16_t streamLength = 0;
+        uint8_t  numPieces    = 1 + TestRandom() % 8;
+        uint8_t  splitMode    = TestRandom() % 4;
+        uint16_t offset       = 0;
+
+        for (uint8_t piece = 0; piece < numPieces; piece++)
+        {
+            uint8_t          payload[kMaxPayload];
+            uint8_t          frame[2 * kMaxPayload + 8];
+            uint16_t         payloadLength = FillRandomPayload(payload, kMaxPayload);
+            ReferenceEncoder encoder(frame, sizeof(frame));
+            uint16_t         start = 0;
+            uint16_t         length;
+
+            IgnoreReturnValue(encoder.BeginFrame());
+            IgnoreReturnValue(encoder.Encode(payload, payloadLength));
+            IgnoreReturnValue(encoder.EndFrame());
+            length = encoder.GetLength();
+
+            switch (TestRandom() % 8)
+            {
+            case 0:
+                frame[1 + TestRandom() % (length - 2)] ^= (1 << (TestRandom() % 8));
+                break;
+
+            case 1:
+                // The frame may end after an escape, which then escapes the flag of the next one.
+                length = 1 + TestRandom() % (length - 1);
+                break;
+
+            case 2:
+                start = 1;
+                break;
+
+            case 3:
+                length = TestRandom() % 64;
+
+                for (uint16_t i = 0; i < length; i++)
+                {
+                    frame[i] = GetRandomPayloadByte(1 + TestRandom() % 2);
+                }
+
+                break;
+
+            case 4:
+                length = 1 + TestRandom() % 3;
+                memset(frame, kFlagSequence, length);
+                break;
+
+            default:
+                break;
+            }
+
+            if (streamLength + length - start > kMaxStreamSize)
+            {
+                break;
+            }
+
+            memcpy(&stream[streamLength], &frame[start], length - start);
+            streamLength += length - start;
+        }
+
+        for (uint16_t i = 0; i < streamLength; i++)
+        {
+            referenceDecoder.Decode(stream[i]);
+        }
+
+        while (offset < streamLength)
+        {
+            uint16_t blockLength;
+
+            switch (splitMode)
+            {
+            case 0:
+                blockLength = 1;
+                break;
+            case 1:
+                blockLength = 1 + TestRandom() % 8;
+                break;
+            case 2:
+                blockLength = 1 + TestRandom() % (streamLength - offset);
+                break;
+            default:
+                blockLength = streamLength - offset;
+                break;
+            }
+
+            if (blockLength > streamLength - offset)
+            {
+                blockLength = streamLength - offset;
+            }
+
+            decoder.Decode(&stream[offset], blockLength);
+            offset += blockLength;
+        }
+
+        VerifyOrQuit(sFrameLog.Matches(referenceLog), "decoded frames differ");
+        sFrameLog.Clear();
+        referenceLog.Clear();
+
+        if (TestRandom() % 32 == 0)
+        {
+            decoder.Reset();
+            referenceDecoder.Reset();
+        }
+    }
+
+    VerifyOrQuit(referenceLog.GetNumFramesWithError(OT_ERROR_NONE) > kIterations, "too few valid frames");
+    VerifyOrQuit(referenceLog.GetNumFramesWithError(OT_ERROR_PARSE) > kIterations / 4, "too few invalid frames");
+    VerifyOrQuit(referenceLog.GetNumFramesWithError(OT_ERROR_NO_BUFS) > kIterations / 100, "too few large frames");
+
+    printf("TestDecoder passed\n");
+}
+
+static void BenchmarkHdlc(void)
+{
+    // Frames of 1280 random bytes, of which 2% need an escape.
+
+    static constexpr uint32_t kCount         = 20000;
+    static constexpr uint16_t kPayloadLength = 1280;
+    static constexpr uint16_t kBufferSize    = 4096;
+
+    static Spinel::FrameBuffer<kBufferSize> buffer;
+    static uint8_t                          encoded[kBufferSize];
+    static FrameLog                         referenceLog;
+
+    uint8_t          payload[kPayloadLength];
+    uint16_t         encodedLength;
+    uint32_t         sum = 0;
+    double           referenceNs;
+    Hdlc::Decoder    decoder;
+    ReferenceDecoder referenceDecoder(kDecoderBufferSize, referenceLog);
+
+    for (uint8_t &byte : payload)
+    {
+        byte = GetRandomPayloadByte(0);
+    }
+
+    {
+        BenchmarkTimer timer;
+
+        for (uint32_t i = 0; i < kCount; i++)
+        {
+            ReferenceEncoder encoder(encoded, sizeof(encoded));
+
+            payload[0] = static_cast<uint8_t>(i);
+            IgnoreReturnValue(encoder.BeginFrame());
+            IgnoreReturnValue(encoder.Encode(payload, kPayloadLength));
+            IgnoreReturnValue(encoder.EndFrame());
+            sum += encoder.GetLength();
+        }
+
+        referenceNs = timer.GetNsPerOp(kCount);
+    }
+
+    {
+        BenchmarkTimer timer;
+
+        for (uint32_t i = 0; i < kCount; i++)
+        {
+            Hdlc::Encoder encoder(buffer);
+
+            buffer.Clear();
+            payload[0] = static_cast<uint8_t>(i);
+            IgnoreReturnValue(encoder.BeginFrame());
+            IgnoreReturnValue(encoder.Encode(payload, kPayloadLength));
+            IgnoreReturnValue(encoder.EndFrame());
+            sum += buffer.GetLength();
+        }
+
+        PrintBenchmark("hdlc_encode_1280", kCount, referenceNs, timer.GetNsPerOp(kCount));
+    }
+
+    encodedLength = buffer.GetLength();
+    memcpy(encoded, buffer.GetFrame(), encodedLength);
+
+    {
+        BenchmarkTimer timer;
+
+        for (uint32_t i = 0; i < kCount; i++)
+        {
+            for (uint16_t j = 0; j < encodedLength; j++)
+            {
+                referenceDecoder.Decode(encoded[j]);
+            }
+
+            referenceLog.Clear();
+        }
+
+        referenceNs = timer.GetNsPerOp(kCount);
+    }
+
+    decoder.Init(sDecoderBuffer, HandleFrame, &sDecoderBuffer);
+    decoder.Decode(encoded, encodedLength);
+
+    for (uint16_t j = 0; j < encodedLength; j++)
+    {
+        referenceDecoder.Decode(encoded[j]);
+    }
+
+    VerifyOrQuit(sFrameLog.Matches(referenceLog), "decoded frames differ");
+    sFrameLog.Clear();
+    referenceLog.Clear();
+
+    {
+        BenchmarkTimer timer;
+
+        for (uint32_t i = 0; i < kCount; i++)
+        {
+            decoder.Decode(encoded, encodedLength);
+            sFrameLog.Clear();
+        }
+
+        PrintBenchmark("hdlc_decode_1280", kCount, referenceNs, timer.GetNsPerOp(kCount));
+    }
+
+    VerifyOrQuit(sum != 0, "nothing was encoded");
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::ReferenceHdlc::Init();
+
+    ot::TestEncoder();
+    ot::TestDecoder();
+    ot::BenchmarkHdlc();
+
+    printf("All tests passed\n");
+
+    return 0;
+}
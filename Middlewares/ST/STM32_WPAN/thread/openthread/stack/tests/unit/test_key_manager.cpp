@@ -0,0 +1,283 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include <openthread/tasklet.h>
+
+#include "crypto/hmac_sha256.hpp"
+#include "instance/instance.hpp"
+#include "mac/sub_mac.hpp"
+#include "thread/key_manager.hpp"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+/**
+ * The keys of a key sequence, computed as `KeyManager` did before it cached them: with HMAC-SHA256 on each call.
+ *
+ */
+struct ReferenceKeys
+{
+    ReferenceKeys(const NetworkKey &aNetworkKey, uint32_t aKeySequence)
+    {
+        static const uint8_t kThreadString[] = {'T', 'h', 'r', 'e', 'a', 'd'};
+
+        Crypto::HmacSha256       hmac;
+        Crypto::HmacSha256::Hash hash;
+        Crypto::Key              cryptoKey;
+        uint8_t                  keySequenceBytes[sizeof(uint32_t)];
+
+        cryptoKey.Set(aNetworkKey.m8, NetworkKey::kSize);
+        BigEndian::WriteUint32(aKeySequence, keySequenceBytes);
+
+        hmac.Start(cryptoKey);
+        hmac.Update(keySequenceBytes);
+        hmac.Update(kThreadString);
+        hmac.Finish(hash);
+
+        memcpy(mMleKey.m8, hash.GetBytes(), Mac::Key::kSize);
+        memcpy(mMacKey.m8, hash.GetBytes() + Mac::Key::kSize, Mac::Key::kSize);
+    }
+
+    Mle::Key mMleKey;
+    Mac::Key mMacKey;
+};
+
+static bool KeyMatches(const Mac::KeyMaterial &aKeyMaterial, const Mac::Key &aKey)
+{
+    Mac::Key key;
+
+    aKeyMaterial.ExtractKey(key);
+
+    return key == aKey;
+}
+
+static void SetRandomNetworkKey(KeyManager &aKeyManager, NetworkKey &aNetworkKey)
+{
+    for (uint8_t &byte : aNetworkKey.m8)
+    {
+        byte = TestRandomByte();
+    }
+
+    aKeyManager.SetNetworkKey(aNetworkKey);
+}
+
+static void TestDerivedKeys(Instance &aInstance)
+{
+    // Random key sequence advances by one, jumps, also across the 32-bit wrap, and network key changes, with the
+    // tasklet deriving the keys of the after-next sequence run or not in between. The keys of the sequences around
+    // the current one are compared with the ones computed from the network key, and so are the MAC keys of `SubMac`.
+
+    static constexpr uint32_t kIterations = 100000;
+    static constexpr int32_t  kMaxOffset  = 3;
+
+    KeyManager &keyManager = aInstance.Get<KeyManager>();
+    NetworkKey  networkKey;
+    uint32_t    keySequence      = 0;
+    uint32_t    temporaryLookups = 0;
+
+    SetRandomNetworkKey(keyManager, networkKey);
+
+    for (uint32_t iteration = 0; iteration < kIterations; iteration++)
+    {
+        switch (TestRandom() % 16)
+        {
+        case 0:
+            SetRandomNetworkKey(keyManager, networkKey);
+            keySequence = 0;
+            break;
+
+        case 1:
+        case 2:
+            keySequence = (TestRandom() % 2 == 0) ? TestRandom() : UINT32_MAX - TestRandom() % 4;
+            keyManager.SetCurrentKeySequence(keySequence, KeyManager::kForceUpdate);
+            break;
+
+        case 3:
+            keySequence += 2 + TestRandom() % 3;
+            keyManager.SetCurrentKeySequence(keySequence, KeyManager::kForceUpdate);
+            break;
+
+        case 4:
+            keySequence -= 1 + TestRandom() % 2;
+            keyManager.SetCurrentKeySequence(keySequence, KeyManager::kForceUpdate);
+            break;
+
+        default:
+            keySequence++;
+            keyManager.SetCurrentKeySequence(keySequence, KeyManager::kForceUpdate);
+            break;
+        }
+
+        if (TestRandom() % 2 == 0)
+        {
+            otTaskletsProcess(&aInstance);
+        }
+
+        VerifyOrQuit(keyManager.GetCurrentKeySequence() == keySequence, "GetCurrentKeySequence() differs");
+
+        {
+            ReferenceKeys current(networkKey, keySequence);
+
+            VerifyOrQuit(KeyMatches(keyManager.GetCurrentMleKey(), current.mMleKey), "GetCurrentMleKey() differs");
+
+#if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
+            VerifyOrQuit(KeyMatches(aInstance.Get<Mac::SubMac>().GetCurrentMacKey(), current.mMacKey),
+                         "current MAC key differs");
+            VerifyOrQuit(KeyMatches(aInstance.Get<Mac::SubMac>().GetPreviousMacKey(),
+                                    ReferenceKeys(networkKey, keySequence - 1).mMacKey),
+                         "previous MAC key differs");
+            VerifyOrQuit(KeyMatches(aInstance.Get<Mac::SubMac>().GetNextMacKey(),
+                                    ReferenceKeys(networkKey, keySequence + 1).mMacKey),
+                         "next MAC key differs");
+#endif
+        }
+
+        // The lookups run in a random order, a key computed in the temporary key must not change the cached ones.
+
+        for (uint8_t i = 0; i < 4; i++)
+        {
+            int32_t  offset   = static_cast<int32_t>(TestRandom() % (2 * kMaxOffset + 1)) - kMaxOffset;
+            uint32_t sequence = keySequence + static_cast<uint32_t>(offset);
+
+            VerifyOrQuit(KeyMatches(keyManager.GetTemporaryMleKey(sequence),
+                                    ReferenceKeys(networkKey, sequence).mMleKey),
+                         "GetTemporaryMleKey() differs");
+            temporaryLookups++;
+        }
+    }
+
+    VerifyOrQuit(temporaryLookups == 4 * kIterations, "lookups were skipped");
+
+    printf("TestDerivedKeys passed\n");
+}
+
+static void BenchmarkReceivePath(Instance &aInstance)
+{
+    // Key rotations with 1000 received frames each, 10% of them from the next key sequence and 10% from the
+    // previous one. The reference computes the keys of the other sequences for each frame, and the ones of the
+    // current, previous and next sequences on each rotation, as `KeyManager` did before the cache.
+
+    static constexpr uint32_t kRotations = 200;
+    static constexpr uint32_t kFrames    = 1000;
+    static constexpr uint32_t kCount     = kRotations * kFrames;
+
+    KeyManager &keyManager = aInstance.Get<KeyManager>();
+    NetworkKey  networkKey;
+    uint32_t    sum = 0;
+    double      referenceNs;
+
+    SetRandomNetworkKey(keyManager, networkKey);
+
+    {
+        BenchmarkTimer timer;
+        uint32_t       keySequence = 0;
+        ReferenceKeys  current(networkKey, keySequence);
+
+        for (uint32_t rotation = 0; rotation < kRotations; rotation++)
+        {
+            for (uint32_t frame = 0; frame < kFrames; frame++)
+            {
+                switch (frame % 10)
+                {
+                case 3:
+                    sum += ReferenceKeys(networkKey, keySequence + 1).mMleKey.m8[0];
+                    break;
+                case 7:
+                    sum += ReferenceKeys(networkKey, keySequence - 1).mMleKey.m8[0];
+                    break;
+                default:
+                    sum += current.mMleKey.m8[0];
+                    break;
+                }
+            }
+
+            keySequence++;
+            current = ReferenceKeys(networkKey, keySequence);
+            sum += ReferenceKeys(networkKey, keySequence - 1).mMacKey.m8[0];
+            sum += ReferenceKeys(networkKey, keySequence + 1).mMacKey.m8[0];
+        }
+
+        referenceNs = timer.GetNsPerOp(kCount);
+    }
+
+    {
+        BenchmarkTimer timer;
+        uint32_t       keySequence = 0;
+
+        for (uint32_t rotation = 0; rotation < kRotations; rotation++)
+        {
+            for (uint32_t frame = 0; frame < kFrames; frame++)
+            {
+                Mac::Key key;
+
+                switch (frame % 10)
+                {
+                case 3:
+                    keyManager.GetTemporaryMleKey(keySequence + 1).ExtractKey(key);
+                    break;
+                case 7:
+                    keyManager.GetTemporaryMleKey(keySequence - 1).ExtractKey(key);
+                    break;
+                default:
+                    keyManager.GetCurrentMleKey().ExtractKey(key);
+                    break;
+                }
+
+                sum += key.m8[0];
+            }
+
+            keySequence++;
+            keyManager.SetCurrentKeySequence(keySequence, KeyManager::kForceUpdate);
+            otTaskletsProcess(&aInstance);
+        }
+
+        PrintBenchmark("key_manager_receive_frames", kCount, referenceNs, timer.GetNsPerOp(kCount));
+    }
+
+    VerifyOrQuit(sum != 0, "no key was read");
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::Instance *instance = testInitInstance();
+
+    ot::TestDerivedKeys(*instance);
+    ot::BenchmarkReceivePath(*instance);
+
+    testFreeInstance(instance);
+
+    printf("All tests passed\n");
+
+    return 0;
+}
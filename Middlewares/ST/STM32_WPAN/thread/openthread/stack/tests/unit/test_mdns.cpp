@@ -0,0 +1,1009 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <openthread/tasklet.h>
+
+#include "instance/instance.hpp"
+#include "net/mdns.hpp"
+
+#include "simulation.h"
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+static constexpr uint32_t kInfraIfIndex     = 1;
+static constexpr uint16_t kNumServiceTypes  = 4;
+static constexpr uint16_t kNumServices      = 48;
+static constexpr uint16_t kNumHosts         = kNumServices / 2;
+static constexpr uint16_t kNumLocalServices = 16;
+
+// The results reported to the browsers and SRV resolvers, by service, and whether each browser or resolver runs.
+
+static bool     sBrowserActive[kNumServiceTypes];
+static bool     sSrvResolverActive[kNumServices];
+static bool     sTxtResolverActive[kNumServices];
+static bool     sAddrResolverActive[kNumHosts];
+static bool     sLocalServiceRegistered[kNumLocalServices];
+static bool     sBrowseReported[kNumServices];
+static bool     sSrvReported[kNumServices];
+static uint32_t sNumResults;
+
+class UnitTester
+{
+public:
+    static void TestCacheIndex(Instance &aInstance);
+    static void BenchmarkCaches(Instance &aInstance);
+
+private:
+    using Core              = Dns::Multicast::Core;
+    using CacheEntry        = Core::CacheEntry;
+    using CacheFireTimeHeap = Core::CacheFireTimeHeap;
+    using BrowseCache       = Core::BrowseCache;
+    using SrvCache          = Core::SrvCache;
+    using TxtCache          = Core::TxtCache;
+    using Ip6AddrCache      = Core::Ip6AddrCache;
+    using Ip4AddrCache      = Core::Ip4AddrCache;
+    using HostEntry         = Core::HostEntry;
+    using ServiceEntry      = Core::ServiceEntry;
+
+    static constexpr uint16_t kNameSize      = 64;
+    static constexpr uint16_t kCacheFlush    = (1U << 15);
+    static constexpr uint32_t kMarginMsec    = 1000;
+    static constexpr uint16_t kNumBuckets    = Core::kNameTableSize;
+    static constexpr uint16_t kServicesPerRx = 4;
+
+    typedef char NameString[kNameSize];
+
+    // A record of a remote service in a cache of the core, as of the last response.
+
+    struct RecordModel
+    {
+        bool IsPresent(TimeMilli aNow) const { return mIsPresent && (aNow < mExpireTime); }
+
+        bool IsNearExpiry(TimeMilli aNow) const
+        {
+            return mIsPresent && (mExpireTime <= aNow + kMarginMsec) && (aNow <= mExpireTime + kMarginMsec);
+        }
+
+        void Update(uint32_t aTtl)
+        {
+            mIsPresent  = (aTtl > 0);
+            mExpireTime = TimerMilli::GetNow() + Time::SecToMsec(aTtl);
+        }
+
+        bool      mIsPresent;
+        TimeMilli mExpireTime;
+    };
+
+    static RecordModel sPtrModels[kNumServices];
+    static RecordModel sSrvModels[kNumServices];
+
+    // Cache and entry statistics gathered while checking the tables.
+
+    struct Stats
+    {
+        uint16_t  mNumCaches;
+        uint16_t  mNumWithFireTime;
+        TimeMilli mEarliestFireTime;
+    };
+
+    static void RandomizeCase(NameString &aName)
+    {
+        for (char &c : aName)
+        {
+            if (TestRandom() % 2 == 0)
+            {
+                c = static_cast<char>(toupper(c));
+            }
+        }
+    }
+
+    static void GetServiceType(NameString &aName, uint16_t aServiceId)
+    {
+        snprintf(aName, sizeof(aName), "_t%u._udp", aServiceId % kNumServiceTypes);
+    }
+
+    static void GetInstanceLabel(NameString &aName, uint16_t aServiceId)
+    {
+        snprintf(aName, sizeof(aName), "svc-%u", aServiceId);
+    }
+
+    static void GetHostName(NameString &aName, uint16_t aServiceId)
+    {
+        snprintf(aName, sizeof(aName), "rh-%u", aServiceId / 2);
+    }
+
+    static uint16_t ParseServiceId(const char *aInstanceLabel)
+    {
+        NameString label;
+        unsigned   serviceId;
+
+        for (uint16_t i = 0; i < kNameSize; i++)
+        {
+            label[i] = static_cast<char>(tolower(aInstanceLabel[i]));
+            VerifyOrExit(label[i] != '\0');
+        }
+
+    exit:
+        VerifyOrQuit(sscanf(label, "svc-%u", &serviceId) == 1, "result of an unknown service");
+
+        return static_cast<uint16_t>(serviceId);
+    }
+
+    static void HandleBrowseResult(otInstance *aInstance, const otMdnsBrowseResult *aResult)
+    {
+        uint16_t serviceId = ParseServiceId(aResult->mServiceInstance);
+
+        OT_UNUSED_VARIABLE(aInstance);
+        VerifyOrQuit(sBrowserActive[serviceId % kNumServiceTypes], "result of a stopped browser");
+        sBrowseReported[serviceId] = (aResult->mTtl > 0);
+        sNumResults++;
+    }
+
+    static void HandleSrvResult(otInstance *aInstance, const otMdnsSrvResult *aResult)
+    {
+        uint16_t serviceId = ParseServiceId(aResult->mServiceInstance);
+
+        OT_UNUSED_VARIABLE(aInstance);
+        VerifyOrQuit(sSrvResolverActive[serviceId], "result of a stopped SRV resolver");
+        sSrvReported[serviceId] = (aResult->mTtl > 0);
+        sNumResults++;
+    }
+
+    static void HandleTxtResult(otInstance *aInstance, const otMdnsTxtResult *aResult)
+    {
+        OT_UNUSED_VARIABLE(aInstance);
+        VerifyOrQuit(sTxtResolverActive[ParseServiceId(aResult->mServiceInstance)], "result of a stopped TXT resolver");
+        sNumResults++;
+    }
+
+    static void HandleAddressResult(otInstance *aInstance, const otMdnsAddressResult *aResult)
+    {
+        OT_UNUSED_VARIABLE(aInstance);
+        OT_UNUSED_VARIABLE(aResult);
+        sNumResults++;
+    }
+
+    static void HandleBenchmarkBrowseResult(otInstance *aInstance, const otMdnsBrowseResult *aResult)
+    {
+        OT_UNUSED_VARIABLE(aInstance);
+        OT_UNUSED_VARIABLE(aResult);
+        sNumResults++;
+    }
+
+    static void HandleRegistered(otInstance *aInstance, otMdnsRequestId aRequestId, otError aError)
+    {
+        OT_UNUSED_VARIABLE(aInstance);
+        OT_UNUSED_VARIABLE(aRequestId);
+        OT_UNUSED_VARIABLE(aError);
+    }
+
+    // The browsers and resolvers of a service, which are also the keys of its caches.
+
+    struct Keys
+    {
+        Keys(uint16_t aServiceId, bool aRandomizeCase)
+        {
+            GetServiceType(mServiceType, aServiceId);
+            GetInstanceLabel(mInstanceLabel, aServiceId);
+            GetHostName(mHostName, aServiceId);
+
+            if (aRandomizeCase)
+            {
+                RandomizeCase(mServiceType);
+                RandomizeCase(mInstanceLabel);
+                RandomizeCase(mHostName);
+            }
+
+            ClearAllBytes(mBrowser);
+            mBrowser.mServiceType  = mServiceType;
+            mBrowser.mInfraIfIndex = kInfraIfIndex;
+            mBrowser.mCallback     = HandleBrowseResult;
+
+            ClearAllBytes(mSrvResolver);
+            mSrvResolver.mServiceInstance = mInstanceLabel;
+            mSrvResolver.mServiceType     = mServiceType;
+            mSrvResolver.mInfraIfIndex    = kInfraIfIndex;
+            mSrvResolver.mCallback        = HandleSrvResult;
+
+            ClearAllBytes(mTxtResolver);
+            mTxtResolver.mServiceInstance = mInstanceLabel;
+            mTxtResolver.mServiceType     = mServiceType;
+            mTxtResolver.mInfraIfIndex    = kInfraIfIndex;
+            mTxtResolver.mCallback        = HandleTxtResult;
+
+            ClearAllBytes(mAddressResolver);
+            mAddressResolver.mHostName     = mHostName;
+            mAddressResolver.mInfraIfIndex = kInfraIfIndex;
+            mAddressResolver.mCallback     = HandleAddressResult;
+        }
+
+        NameString            mServiceType;
+        NameString            mInstanceLabel;
+        NameString            mHostName;
+        Core::Browser         mBrowser;
+        Core::SrvResolver     mSrvResolver;
+        Core::TxtResolver     mTxtResolver;
+        Core::AddressResolver mAddressResolver;
+    };
+
+    struct LocalService
+    {
+        explicit LocalService(uint16_t aLocalId)
+        {
+            snprintf(mInstanceLabel, sizeof(mInstanceLabel), "loc-%u", aLocalId);
+            ClearAllBytes(mService);
+            mService.mHostName        = "lh";
+            mService.mServiceInstance = mInstanceLabel;
+            mService.mServiceType     = "_lt._udp";
+            mService.mPort            = 2000 + aLocalId;
+            mService.mTtl             = 120;
+            mService.mInfraIfIndex    = kInfraIfIndex;
+        }
+
+        NameString    mInstanceLabel;
+        Core::Service mService;
+    };
+
+    // The responses of the remote services on the infrastructure link.
+
+    static Message *NewResponse(Instance &aInstance)
+    {
+        Message    *message = aInstance.Get<MessagePool>().Allocate(Message::kTypeOther);
+        Dns::Header header;
+
+        VerifyOrQuit(message != nullptr, "Allocate() failed");
+        header.Clear();
+        header.SetType(Dns::Header::kTypeResponse);
+        SuccessOrQuit(message->Append(header), "Append() failed");
+
+        return message;
+    }
+
+    static uint16_t AppendRecordHeader(Message    &aMessage,
+                                       const char *aName,
+                                       uint16_t    aType,
+                                       uint16_t    aClass,
+                                       uint32_t    aTtl)
+    {
+        Dns::ResourceRecord record;
+        uint16_t            offset;
+
+        SuccessOrQuit(Dns::Name::AppendName(aName, aMessage), "AppendName() failed");
+        record.Init(aType, aClass);
+        record.SetTtl(aTtl);
+        offset = aMessage.GetLength();
+        SuccessOrQuit(aMessage.Append(record), "Append() failed");
+
+        return offset;
+    }
+
+    static void EndRecord(Message &aMessage, uint16_t aRecordOffset)
+    {
+        Dns::ResourceRecord record;
+
+        SuccessOrQuit(aMessage.Read(aRecordOffset, record), "Read() failed");
+        record.SetLength(aMessage.GetLength() - aRecordOffset - sizeof(record));
+        aMessage.Write(aRecordOffset, record);
+    }
+
+    static void AppendPtr(Message &aMessage, const Keys &aKeys, uint32_t aTtl)
+    {
+        NameString name;
+        uint16_t   offset;
+
+        snprintf(name, sizeof(name), "%s.local.", aKeys.mServiceType);
+        offset = AppendRecordHeader(aMessage, name, Dns::ResourceRecord::kTypePtr, Dns::ResourceRecord::kClassInternet,
+                                    aTtl);
+        snprintf(name, sizeof(name), "%s.%s.local.", aKeys.mInstanceLabel, aKeys.mServiceType);
+        SuccessOrQuit(Dns::Name::AppendName(name, aMessage), "AppendName() failed");
+        EndRecord(aMessage, offset);
+    }
+
+    static void AppendSrvTxt(Message &aMessage, const Keys &aKeys, uint16_t aPort, uint32_t aTtl)
+    {
+        static const uint8_t kTxtData[] = {4, 'i', 'd', '=', '1'};
+
+        NameString name;
+        NameString hostName;
+        uint16_t   offset;
+        uint16_t   srvData[3];
+
+        snprintf(name, sizeof(name), "%s.%s.local.", aKeys.mInstanceLabel, aKeys.mServiceType);
+        snprintf(hostName, sizeof(hostName), "%s.local.", aKeys.mHostName);
+
+        offset = AppendRecordHeader(aMessage, name, Dns::ResourceRecord::kTypeSrv,
+                                    Dns::ResourceRecord::kClassInternet | kCacheFlush, aTtl);
+        srvData[0] = BigEndian::HostSwap16(0);
+        srvData[1] = BigEndian::HostSwap16(0);
+        srvData[2] = BigEndian::HostSwap16(aPort);
+        SuccessOrQuit(aMessage.Append(srvData), "Append() failed");
+        SuccessOrQuit(Dns::Name::AppendName(hostName, aMessage), "AppendName() failed");
+        EndRecord(aMessage, offset);
+
+        offset = AppendRecordHeader(aMessage, name, Dns::ResourceRecord::kTypeTxt,
+                                    Dns::ResourceRecord::kClassInternet | kCacheFlush, aTtl);
+        SuccessOrQuit(aMessage.Append(kTxtData), "Append() failed");
+        EndRecord(aMessage, offset);
+    }
+
+    static void AppendAaaa(Message &aMessage, const Keys &aKeys, uint16_t aHostId, uint32_t aTtl)
+    {
+        NameString   hostName;
+        Ip6::Address address;
+        uint16_t     offset;
+
+        snprintf(hostName, sizeof(hostName), "%s.local.", aKeys.mHostName);
+        address.Clear();
+        address.mFields.m8[0]  = 0xfd;
+        address.mFields.m16[7] = BigEndian::HostSwap16(aHostId);
+
+        offset = AppendRecordHeader(aMessage, hostName, Dns::ResourceRecord::kTypeAaaa,
+                                    Dns::ResourceRecord::kClassInternet | kCacheFlush, aTtl);
+        SuccessOrQuit(aMessage.Append(address), "Append() failed");
+        EndRecord(aMessage, offset);
+    }
+
+    static void Receive(Instance &aInstance, Message &aMessage, uint16_t aNumAnswers)
+    {
+        Dns::Header       header;
+        Core::AddressInfo sender;
+
+        SuccessOrQuit(aMessage.Read(0, header), "Read() failed");
+        header.SetAnswerCount(aNumAnswers);
+        aMessage.Write(0, header);
+
+        ClearAllBytes(sender);
+        sender.mAddress.mFields.m8[0]  = 0xfe;
+        sender.mAddress.mFields.m8[1]  = 0x80;
+        sender.mAddress.mFields.m8[15] = 0x42;
+        sender.mPort                   = 5353;
+        sender.mInfraIfIndex           = kInfraIfIndex;
+
+        otPlatMdnsHandleReceive(&aInstance, &aMessage, /* aIsUnicast */ false, &sender);
+        otTaskletsProcess(&aInstance);
+    }
+
+    // The lookups as they were before the name tables: scans of the cache and entry lists.
+
+    template <typename CacheType, typename KeyType> static CacheType *FindCacheLinear(Core &aCore, const KeyType &aKey)
+    {
+        return aCore.GetCacheList<CacheType>().FindMatching(aKey);
+    }
+
+    template <typename EntryType, typename KeyType> static EntryType *FindEntryLinear(Core &aCore, const KeyType &aKey)
+    {
+        return aCore.GetEntryList<EntryType>().FindMatching(aKey);
+    }
+
+    template <typename CacheType> static void ScanFireTimes(Core &aCore, Stats &aStats)
+    {
+        for (const CacheType &cache : aCore.GetCacheList<CacheType>())
+        {
+            aStats.mNumCaches++;
+
+            if (!cache.HasFireTime())
+            {
+                continue;
+            }
+
+            if ((aStats.mNumWithFireTime++ == 0) || (cache.GetFireTime() < aStats.mEarliestFireTime))
+            {
+                aStats.mEarliestFireTime = cache.GetFireTime();
+            }
+        }
+    }
+
+    template <typename CacheType> static void CheckCaches(Core &aCore, Stats &aStats);
+    template <typename EntryType> static void CheckEntries(Core &aCore);
+
+    static void CheckTables(Core &aCore);
+    static void CheckLookups(Core &aCore);
+    static void CheckResults(Core &aCore);
+    static void ToggleBrowser(Instance &aInstance, Core &aCore);
+    static void ToggleResolver(Instance &aInstance, Core &aCore);
+    static void ToggleLocalService(Core &aCore);
+    static void ReceivePtrs(Instance &aInstance, Core &aCore);
+    static void ReceiveService(Instance &aInstance, Core &aCore);
+};
+
+UnitTester::RecordModel UnitTester::sPtrModels[kNumServices];
+UnitTester::RecordModel UnitTester::sSrvModels[kNumServices];
+
+template <typename CacheType> void UnitTester::CheckCaches(Core &aCore, Stats &aStats)
+{
+    // Each cache is in the bucket of its name hash, and in the fire time heap exactly when it has a fire time.
+
+    const CacheFireTimeHeap &heap = aCore.mCacheFireTimes;
+
+    for (const CacheType &cache : aCore.GetCacheList<CacheType>())
+    {
+        bool found = false;
+
+        for (const CacheEntry *entry = aCore.mCacheTable.GetHead(cache.mNameHash); entry != nullptr;
+             entry                   = Core::NameTable<CacheEntry>::GetNext(*entry))
+        {
+            found |= (entry == &cache);
+        }
+
+        VerifyOrQuit(found, "cache is not in the name table");
+        aStats.mNumCaches++;
+
+        if (cache.HasFireTime())
+        {
+            VerifyOrQuit(cache.mHeapIndex < heap.mNodes.GetLength(), "cache with a fire time is not in the heap");
+            VerifyOrQuit(heap.mNodes[cache.mHeapIndex].mCacheEntry == &cache, "heap index of a cache is wrong");
+
+            if ((aStats.mNumWithFireTime == 0) || (cache.GetFireTime() < aStats.mEarliestFireTime))
+            {
+                aStats.mEarliestFireTime = cache.GetFireTime();
+            }
+
+            aStats.mNumWithFireTime++;
+        }
+        else
+        {
+            VerifyOrQuit(cache.mHeapIndex == CacheFireTimeHeap::kNotInHeap, "cache without a fire time is in the heap");
+        }
+    }
+}
+
+template <typename EntryType> void UnitTester::CheckEntries(Core &aCore)
+{
+    uint16_t numEntries = 0;
+    uint16_t numInTable = 0;
+
+    for (const EntryType &entry : aCore.GetEntryList<EntryType>())
+    {
+        bool found = false;
+
+        for (const EntryType *tableEntry = aCore.GetEntryTable<EntryType>().GetHead(entry.mNameHash);
+             tableEntry != nullptr; tableEntry = Core::NameTable<EntryType>::GetNext(*tableEntry))
+        {
+            found |= (tableEntry == &entry);
+        }
+
+        VerifyOrQuit(found, "entry is not in the name table");
+        numEntries++;
+    }
+
+    for (uint16_t bucket = 0; bucket < kNumBuckets; bucket++)
+    {
+        for (const EntryType *tableEntry = aCore.GetEntryTable<EntryType>().GetHead(bucket); tableEntry != nullptr;
+             tableEntry                  = Core::NameTable<EntryType>::GetNext(*tableEntry))
+        {
+            numInTable++;
+        }
+    }
+
+    VerifyOrQuit(numInTable == numEntries, "entry table has other entries");
+}
+
+void UnitTester::CheckTables(Core &aCore)
+{
+    // The name tables hold exactly the caches and entries of the lists. The heap holds the fire time of each cache
+    // which has one, in heap order, and the cache timer fires no later than the earliest of them.
+
+    const CacheFireTimeHeap &heap       = aCore.mCacheFireTimes;
+    Stats                    stats      = {0, 0, TimerMilli::GetNow()};
+    uint16_t                 numInTable = 0;
+
+    CheckCaches<BrowseCache>(aCore, stats);
+    CheckCaches<SrvCache>(aCore, stats);
+    CheckCaches<TxtCache>(aCore, stats);
+    CheckCaches<Ip6AddrCache>(aCore, stats);
+    CheckCaches<Ip4AddrCache>(aCore, stats);
+
+    for (uint16_t bucket = 0; bucket < kNumBuckets; bucket++)
+    {
+        for (const CacheEntry *entry = aCore.mCacheTable.GetHead(bucket); entry != nullptr;
+             entry                   = Core::NameTable<CacheEntry>::GetNext(*entry))
+        {
+            numInTable++;
+        }
+    }
+
+    VerifyOrQuit(numInTable == stats.mNumCaches, "cache table has other entries");
+    VerifyOrQuit(heap.mNodes.GetLength() == stats.mNumWithFireTime, "heap has other entries");
+
+    for (uint16_t index = 0; index < heap.mNodes.GetLength(); index++)
+    {
+        const CacheEntry &cache = *heap.mNodes[index].mCacheEntry;
+
+        VerifyOrQuit(cache.mHeapIndex == index, "heap index of a cache is wrong");
+        VerifyOrQuit(heap.mNodes[index].mFireTime == cache.GetFireTime(), "heap has a stale fire time");
+        VerifyOrQuit((index == 0) || !(heap.mNodes[index].mFireTime < heap.mNodes[(index - 1) / 2].mFireTime),
+                     "heap order is wrong");
+    }
+
+    if (stats.mNumWithFireTime > 0)
+    {
+        VerifyOrQuit(aCore.mCacheTimer.IsRunning() && (aCore.mCacheTimer.GetFireTime() <= stats.mEarliestFireTime),
+                     "cache timer fires after the earliest cache");
+    }
+
+    CheckEntries<HostEntry>(aCore);
+    CheckEntries<ServiceEntry>(aCore);
+}
+
+void UnitTester::CheckLookups(Core &aCore)
+{
+    // Lookups of random known and unknown names, in random case.
+
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        Keys         keys(TestRandom() % (kNumServices + kNumServiceTypes), /* aRandomizeCase */ true);
+        LocalService localService(TestRandom() % (kNumLocalServices + 2));
+
+        VerifyOrQuit(aCore.FindCache<BrowseCache>(keys.mBrowser) == FindCacheLinear<BrowseCache>(aCore, keys.mBrowser),
+                     "FindCache<BrowseCache>() differs");
+        VerifyOrQuit(aCore.FindCache<SrvCache>(keys.mSrvResolver) ==
+                         FindCacheLinear<SrvCache>(aCore, keys.mSrvResolver),
+                     "FindCache<SrvCache>() differs");
+        VerifyOrQuit(aCore.FindCache<TxtCache>(keys.mTxtResolver) ==
+                         FindCacheLinear<TxtCache>(aCore, keys.mTxtResolver),
+                     "FindCache<TxtCache>() differs");
+        VerifyOrQuit(aCore.FindCache<Ip6AddrCache>(keys.mAddressResolver) ==
+                         FindCacheLinear<Ip6AddrCache>(aCore, keys.mAddressResolver),
+                     "FindCache<Ip6AddrCache>() differs");
+        VerifyOrQuit(aCore.FindCache<Ip4AddrCache>(keys.mAddressResolver) ==
+                         FindCacheLinear<Ip4AddrCache>(aCore, keys.mAddressResolver),
+                     "FindCache<Ip4AddrCache>() differs");
+        VerifyOrQuit(aCore.FindEntry<ServiceEntry>(localService.mService) ==
+                         FindEntryLinear<ServiceEntry>(aCore, localService.mService),
+                     "FindEntry<ServiceEntry>() differs");
+    }
+}
+
+void UnitTester::CheckResults(Core &aCore)
+{
+    // The records of a cache which is removed are removed with it. Then the services reported to each browser and
+    // SRV resolver are the ones whose records are present, except around their expiry time.
+
+    TimeMilli now = TimerMilli::GetNow();
+
+    for (uint16_t serviceId = 0; serviceId < kNumServices; serviceId++)
+    {
+        Keys keys(serviceId, /* aRandomizeCase */ false);
+
+        if (FindCacheLinear<BrowseCache>(aCore, keys.mBrowser) == nullptr)
+        {
+            sPtrModels[serviceId].mIsPresent = false;
+        }
+
+        if (FindCacheLinear<SrvCache>(aCore, keys.mSrvResolver) == nullptr)
+        {
+            sSrvModels[serviceId].mIsPresent = false;
+        }
+
+        if (sBrowserActive[serviceId % kNumServiceTypes] && !sPtrModels[serviceId].IsNearExpiry(now))
+        {
+            VerifyOrQuit(sBrowseReported[serviceId] == sPtrModels[serviceId].IsPresent(now), "browse result differs");
+        }
+
+        if (sSrvResolverActive[serviceId] && !sSrvModels[serviceId].IsNearExpiry(now))
+        {
+            VerifyOrQuit(sSrvReported[serviceId] == sSrvModels[serviceId].IsPresent(now), "SRV result differs");
+        }
+    }
+}
+
+void UnitTester::ToggleBrowser(Instance &aInstance, Core &aCore)
+{
+    uint16_t serviceType = TestRandom() % kNumServiceTypes;
+    Keys     keys(serviceType, /* aRandomizeCase */ true);
+
+    if (sBrowserActive[serviceType])
+    {
+        SuccessOrQuit(aCore.StopBrowser(keys.mBrowser), "StopBrowser() failed");
+        sBrowserActive[serviceType] = false;
+
+        for (uint16_t serviceId = serviceType; serviceId < kNumServices; serviceId += kNumServiceTypes)
+        {
+            sBrowseReported[serviceId] = false;
+        }
+    }
+    else
+    {
+        sBrowserActive[serviceType] = true;
+        SuccessOrQuit(aCore.StartBrowser(keys.mBrowser), "StartBrowser() failed");
+    }
+
+    otTaskletsProcess(&aInstance);
+}
+
+void UnitTester::ToggleResolver(Instance &aInstance, Core &aCore)
+{
+    uint16_t serviceId = TestRandom() % kNumServices;
+    Keys     keys(serviceId, /* aRandomizeCase */ true);
+
+    switch (TestRandom() % 3)
+    {
+    case 0:
+        if (sSrvResolverActive[serviceId])
+        {
+            SuccessOrQuit(aCore.StopSrvResolver(keys.mSrvResolver), "StopSrvResolver() failed");
+            sSrvResolverActive[serviceId] = false;
+            sSrvReported[serviceId]       = false;
+        }
+        else
+        {
+            sSrvResolverActive[serviceId] = true;
+            SuccessOrQuit(aCore.StartSrvResolver(keys.mSrvResolver), "StartSrvResolver() failed");
+        }
+
+        break;
+
+    case 1:
+        if (sTxtResolverActive[serviceId])
+        {
+            SuccessOrQuit(aCore.StopTxtResolver(keys.mTxtResolver), "StopTxtResolver() failed");
+            sTxtResolverActive[serviceId] = false;
+        }
+        else
+        {
+            sTxtResolverActive[serviceId] = true;
+            SuccessOrQuit(aCore.StartTxtResolver(keys.mTxtResolver), "StartTxtResolver() failed");
+        }
+
+        break;
+
+    default:
+        if (sAddrResolverActive[serviceId / 2])
+        {
+            SuccessOrQuit(aCore.StopIp6AddressResolver(keys.mAddressResolver), "StopIp6AddressResolver() failed");
+            sAddrResolverActive[serviceId / 2] = false;
+        }
+        else
+        {
+            sAddrResolverActive[serviceId / 2] = true;
+            SuccessOrQuit(aCore.StartIp6AddressResolver(keys.mAddressResolver), "StartIp6AddressResolver() failed");
+        }
+
+        break;
+    }
+
+    otTaskletsProcess(&aInstance);
+}
+
+void UnitTester::ToggleLocalService(Core &aCore)
+{
+    uint16_t     localId = TestRandom() % kNumLocalServices;
+    LocalService localService(localId);
+
+    if (sLocalServiceRegistered[localId])
+    {
+        SuccessOrQuit(aCore.UnregisterService(localService.mService), "UnregisterService() failed");
+    }
+    else
+    {
+        SuccessOrQuit(aCore.RegisterService(localService.mService, localId, HandleRegistered),
+                      "RegisterService() failed");
+    }
+
+    sLocalServiceRegistered[localId] = !sLocalServiceRegistered[localId];
+}
+
+void UnitTester::ReceivePtrs(Instance &aInstance, Core &aCore)
+{
+    // A response with PTR records of random services of a type, some of them goodbyes (zero TTL). A cache only
+    // holds the records it receives.
+
+    uint16_t serviceType = TestRandom() % kNumServiceTypes;
+    uint16_t numAnswers  = 1 + TestRandom() % 4;
+    bool     hasCache    = (FindCacheLinear<BrowseCache>(aCore, Keys(serviceType, false).mBrowser) != nullptr);
+    Message *message     = NewResponse(aInstance);
+
+    for (uint16_t i = 0; i < numAnswers; i++)
+    {
+        uint16_t serviceId = serviceType + kNumServiceTypes * (TestRandom() % (kNumServices / kNumServiceTypes));
+        uint32_t ttl       = (TestRandom() % 5 == 0) ? 0 : 5 + TestRandom() % 120;
+
+        AppendPtr(*message, Keys(serviceId, /* aRandomizeCase */ true), ttl);
+
+        if (hasCache)
+        {
+            sPtrModels[serviceId].Update(ttl);
+        }
+    }
+
+    Receive(aInstance, *message, numAnswers);
+}
+
+void UnitTester::ReceiveService(Instance &aInstance, Core &aCore)
+{
+    // A response with the SRV and TXT records of a random service and the AAAA record of its host.
+
+    uint16_t serviceId = TestRandom() % kNumServices;
+    uint32_t ttl       = (TestRandom() % 6 == 0) ? 0 : 5 + TestRandom() % 120;
+    Keys     keys(serviceId, /* aRandomizeCase */ true);
+    Message *message = NewResponse(aInstance);
+
+    if (FindCacheLinear<SrvCache>(aCore, keys.mSrvResolver) != nullptr)
+    {
+        sSrvModels[serviceId].Update(ttl);
+    }
+
+    AppendSrvTxt(*message, keys, 1000 + TestRandom() % 2, ttl);
+    AppendAaaa(*message, keys, serviceId / 2, ttl);
+    Receive(aInstance, *message, 3);
+}
+
+void UnitTester::TestCacheIndex(Instance &aInstance)
+{
+    // Random browsers, resolvers and local services are started and stopped while remote services announce, refresh
+    // and withdraw their records, and time runs through record expirations and the removal of unused caches. After
+    // each step the name tables and the fire time heap are checked against the lists, the lookups against the scans
+    // of the lists, and the results reported against the records received.
+
+    static constexpr uint32_t kIterations = 30000;
+
+    Core        &core = aInstance.Get<Core>();
+    Core::Host   host;
+    Ip6::Address hostAddress;
+    uint16_t     maxCaches = 0;
+
+    SuccessOrQuit(core.SetEnabled(true, kInfraIfIndex), "SetEnabled() failed");
+
+    hostAddress.Clear();
+    hostAddress.mFields.m8[0]  = 0xfd;
+    hostAddress.mFields.m8[15] = 1;
+    ClearAllBytes(host);
+    host.mHostName        = "lh";
+    host.mAddresses       = &hostAddress;
+    host.mAddressesLength = 1;
+    host.mTtl             = 120;
+    host.mInfraIfIndex    = kInfraIfIndex;
+    SuccessOrQuit(core.RegisterHost(host, kNumLocalServices, HandleRegistered), "RegisterHost() failed");
+
+    for (uint32_t iteration = 0; iteration < kIterations; iteration++)
+    {
+        uint16_t numCaches = 0;
+
+        switch (TestRandom() % 20)
+        {
+        case 0:
+        case 1:
+            ToggleBrowser(aInstance, core);
+            break;
+
+        case 2:
+        case 3:
+        case 4:
+            ToggleResolver(aInstance, core);
+            break;
+
+        case 5:
+            ToggleLocalService(core);
+            break;
+
+        case 6:
+        case 7:
+        case 8:
+        case 9:
+            ReceivePtrs(aInstance, core);
+            break;
+
+        case 10:
+        case 11:
+        case 12:
+        case 13:
+            ReceiveService(aInstance, core);
+            break;
+
+        case 14:
+            otSimRun((TestRandom() % 600) * 1000ULL * 1000);
+            break;
+
+        default:
+            otSimRun((TestRandom() % 20000) * 1000ULL);
+            break;
+        }
+
+        otTaskletsProcess(&aInstance);
+        CheckResults(core);
+        CheckTables(core);
+        CheckLookups(core);
+
+        for (uint16_t bucket = 0; bucket < kNumBuckets; bucket++)
+        {
+            for (const CacheEntry *entry = core.mCacheTable.GetHead(bucket); entry != nullptr;
+                 entry                   = Core::NameTable<CacheEntry>::GetNext(*entry))
+            {
+                numCaches++;
+            }
+        }
+
+        maxCaches = Max(maxCaches, numCaches);
+    }
+
+    VerifyOrQuit(maxCaches > kNumServices, "too few caches");
+    VerifyOrQuit(gTestMdnsTxCount > 0, "no message was sent");
+
+    SuccessOrQuit(core.SetEnabled(false, kInfraIfIndex), "SetEnabled() failed");
+    ClearAllBytes(sBrowserActive);
+    ClearAllBytes(sSrvResolverActive);
+    ClearAllBytes(sTxtResolverActive);
+    ClearAllBytes(sAddrResolverActive);
+
+    printf("TestCacheIndex passed, %lu results, up to %u caches, %lu messages sent\n",
+           static_cast<unsigned long>(sNumResults), maxCaches, static_cast<unsigned long>(gTestMdnsTxCount));
+}
+
+void UnitTester::BenchmarkCaches(Instance &aInstance)
+{
+    // Remote services announce themselves, in responses of four services, to a browser of their type. The browser
+    // adds passive SRV and TXT caches for each service and an address cache for each host. Then the caches of
+    // random services are looked up, and the earliest cache is taken from the heap, as on each cache timer fire,
+    // against the scans of the lists.
+
+    static const uint16_t kNumServicesList[] = {125, 250, 500, 1000};
+
+    static constexpr uint32_t kCount = 20000;
+
+    Core &core = aInstance.Get<Core>();
+
+    for (uint16_t numServices : kNumServicesList)
+    {
+        Keys        browserKeys(0, /* aRandomizeCase */ false);
+        char        benchmarkName[64];
+        uint32_t    found        = 0;
+        uint32_t    numResponses = 0;
+        double      referenceNs;
+        double      responseNs;
+        CacheEntry *cacheEntry;
+
+        SuccessOrQuit(core.SetEnabled(true, kInfraIfIndex), "SetEnabled() failed");
+        browserKeys.mBrowser.mCallback = HandleBenchmarkBrowseResult;
+        SuccessOrQuit(core.StartBrowser(browserKeys.mBrowser), "StartBrowser() failed");
+
+        {
+            BenchmarkTimer timer;
+
+            for (uint16_t serviceId = 0; serviceId < numServices; numResponses++)
+            {
+                Message *message    = NewResponse(aInstance);
+                uint16_t numAnswers = 0;
+
+                for (uint16_t i = 0; (i < kServicesPerRx) && (serviceId < numServices); i++)
+                {
+                    Keys keys(serviceId * kNumServiceTypes, /* aRandomizeCase */ false);
+
+                    AppendPtr(*message, keys, 4500);
+                    AppendSrvTxt(*message, keys, 1000, 120);
+                    AppendAaaa(*message, keys, serviceId, 120);
+                    numAnswers += 4;
+                    serviceId++;
+                }
+
+                Receive(aInstance, *message, numAnswers);
+                otSimRun(1000 * 1000ULL * 10 / numServices);
+            }
+
+            responseNs = timer.GetNsPerOp(numResponses);
+        }
+
+        for (const SrvCache &srvCache : core.mSrvCacheList)
+        {
+            OT_UNUSED_VARIABLE(srvCache);
+            found++;
+        }
+
+        VerifyOrQuit(found == numServices, "SRV caches are missing");
+        found = 0;
+
+        {
+            BenchmarkTimer timer;
+
+            for (uint32_t i = 0; i < kCount; i++)
+            {
+                Keys keys(((7 * i) % numServices) * kNumServiceTypes, /* aRandomizeCase */ false);
+
+                found += (FindCacheLinear<SrvCache>(core, keys.mSrvResolver) != nullptr);
+            }
+
+            referenceNs = timer.GetNsPerOp(kCount);
+        }
+
+        {
+            BenchmarkTimer timer;
+
+            for (uint32_t i = 0; i < kCount; i++)
+            {
+                Keys keys(((7 * i) % numServices) * kNumServiceTypes, /* aRandomizeCase */ false);
+
+                found -= (core.FindCache<SrvCache>(keys.mSrvResolver) != nullptr);
+            }
+
+            snprintf(benchmarkName, sizeof(benchmarkName), "mdns_find_srv_cache_%u", numServices);
+            PrintBenchmark(benchmarkName, kCount, referenceNs, timer.GetNsPerOp(kCount));
+        }
+
+        VerifyOrQuit(found == 0, "lookups differ");
+
+        {
+            BenchmarkTimer timer;
+
+            for (uint32_t i = 0; i < kCount; i++)
+            {
+                Stats stats = {0, 0, TimerMilli::GetNow()};
+
+                ScanFireTimes<BrowseCache>(core, stats);
+                ScanFireTimes<SrvCache>(core, stats);
+                ScanFireTimes<TxtCache>(core, stats);
+                ScanFireTimes<Ip6AddrCache>(core, stats);
+                ScanFireTimes<Ip4AddrCache>(core, stats);
+                found += (stats.mEarliestFireTime == core.mCacheFireTimes.GetEarliestFireTime());
+            }
+
+            referenceNs = timer.GetNsPerOp(kCount);
+        }
+
+        {
+            BenchmarkTimer timer;
+
+            for (uint32_t i = 0; i < kCount; i++)
+            {
+                cacheEntry = core.mCacheFireTimes.PopDue(core.mCacheFireTimes.GetEarliestFireTime());
+                found -= (cacheEntry != nullptr);
+                core.mCacheFireTimes.Update(*cacheEntry);
+            }
+
+            snprintf(benchmarkName, sizeof(benchmarkName), "mdns_cache_timer_earliest_%u", numServices);
+            PrintBenchmark(benchmarkName, kCount, referenceNs, timer.GetNsPerOp(kCount));
+        }
+
+        VerifyOrQuit(found == 0, "earliest caches differ");
+
+        printf("announcements of %u services: %.1f us per response, %u caches\n", numServices, responseNs / 1000,
+               static_cast<unsigned>(core.mCacheFireTimes.mNodes.GetLength()));
+
+        SuccessOrQuit(core.SetEnabled(false, kInfraIfIndex), "SetEnabled() failed");
+    }
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::Instance *instance = testInitInstance();
+
+    ot::UnitTester::TestCacheIndex(*instance);
+    ot::UnitTester::BenchmarkCaches(*instance);
+
+    testFreeInstance(instance);
+
+    printf("All tests passed\n");
+
+    return 0;
+}
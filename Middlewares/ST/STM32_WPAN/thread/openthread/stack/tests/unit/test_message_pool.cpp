@@ -0,0 +1,407 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include "common/message.hpp"
+#include "common/num_utils.hpp"
+#include "instance/instance.hpp"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_QUOTA_ENABLE
+static const uint16_t kReservedBuffers[Message::kNumPriorities] = {
+    OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_BUFFERS_LOW,
+    OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_BUFFERS_NORMAL,
+    OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_BUFFERS_HIGH,
+    OPENTHREAD_CONFIG_MESSAGE_POOL_RESERVED_BUFFERS_NET,
+};
+
+static const uint16_t kMaxBuffers[Message::kNumPriorities] = {
+    OPENTHREAD_CONFIG_MESSAGE_POOL_MAX_BUFFERS_LOW,
+    OPENTHREAD_CONFIG_MESSAGE_POOL_MAX_BUFFERS_NORMAL,
+    OPENTHREAD_CONFIG_MESSAGE_POOL_MAX_BUFFERS_HIGH,
+    OPENTHREAD_CONFIG_MESSAGE_POOL_MAX_BUFFERS_NET,
+};
+#endif
+
+/**
+ * The buffer usage of each priority level, counted from the messages of the test, and the admission policy of the
+ * message pool as documented by `OPENTHREAD_CONFIG_MESSAGE_POOL_QUOTA_ENABLE`.
+ *
+ */
+class PoolModel
+{
+public:
+    static constexpr uint16_t kMaxMessages = 64;
+
+    explicit PoolModel(MessagePool &aPool)
+        : mPool(aPool)
+    {
+        memset(mMessages, 0, sizeof(mMessages));
+        mPool.ResetMaxUsedBufferCount();
+
+        // The buffers used by the instance before the test.
+
+        for (uint8_t priority = 0; priority < Message::kNumPriorities; priority++)
+        {
+            mBaseUsed[priority] = GetInfo(priority).mUsedBuffers;
+            mMaxUsed[priority]  = mBaseUsed[priority];
+            mNumDrops[priority] = 0;
+        }
+    }
+
+    Message *&GetMessage(uint16_t aIndex) { return mMessages[aIndex]; }
+
+    uint16_t GetUsed(uint8_t aPriority) const
+    {
+        uint16_t used = mBaseUsed[aPriority];
+
+        for (const Message *message : mMessages)
+        {
+            if ((message != nullptr) && (message->GetPriority() == aPriority))
+            {
+                used += message->GetBufferCount();
+            }
+        }
+
+        return used;
+    }
+
+    // Indicates whether the pool may give one more buffer to a priority level, in the state before the last
+    // `aNumAllocated` buffers of this level were allocated.
+    bool CanAllocate(uint8_t aPriority, uint16_t aNumAllocated) const
+    {
+        bool canAllocate = (mPool.GetFreeBufferCount() + aNumAllocated > 0);
+
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_QUOTA_ENABLE
+        uint16_t numShared     = kNumBuffers;
+        uint16_t numSharedUsed = 0;
+        uint16_t levelUsed     = GetUsed(aPriority) - aNumAllocated;
+
+        for (uint8_t priority = 0; priority < Message::kNumPriorities; priority++)
+        {
+            uint16_t used = (priority == aPriority) ? levelUsed : GetUsed(priority);
+
+            numShared -= kReservedBuffers[priority];
+            numSharedUsed += (used > kReservedBuffers[priority]) ? (used - kReservedBuffers[priority]) : 0;
+        }
+
+        canAllocate = canAllocate && (levelUsed < kMaxBuffers[aPriority]) &&
+                      ((levelUsed < kReservedBuffers[aPriority]) || (numSharedUsed < numShared));
+#endif
+
+        return canAllocate;
+    }
+
+    // Checks the result of an operation that allocated `aNumAllocated` buffers for a priority level.
+    void CheckAllocation(uint8_t aPriority, uint16_t aNumAllocated, bool aSucceeded)
+    {
+        for (uint16_t numAllocated = aNumAllocated; numAllocated > 0; numAllocated--)
+        {
+            VerifyOrQuit(CanAllocate(aPriority, numAllocated), "a level was given a buffer it could not use");
+        }
+
+        if (!aSucceeded)
+        {
+            // A denied allocation is counted as a drop, the buffers allocated before it are kept.
+            VerifyOrQuit(!CanAllocate(aPriority, 0), "an allocation was denied while the level could use a buffer");
+            mNumDrops[aPriority]++;
+        }
+
+        Check();
+    }
+
+    void CountAdmissionDrop(uint8_t aPriority) { mNumDrops[aPriority]++; }
+
+    void Reset(void)
+    {
+        mPool.ResetMaxUsedBufferCount();
+
+        for (uint8_t priority = 0; priority < Message::kNumPriorities; priority++)
+        {
+            mMaxUsed[priority]  = GetUsed(priority);
+            mNumDrops[priority] = 0;
+        }
+    }
+
+    void Check(void)
+    {
+        uint16_t totalUsed = 0;
+
+        for (uint8_t priority = 0; priority < Message::kNumPriorities; priority++)
+        {
+            const otMessagePriorityInfo &info = GetInfo(priority);
+            uint16_t                     used = GetUsed(priority);
+
+            mMaxUsed[priority] = Max(mMaxUsed[priority], used);
+            totalUsed += used;
+
+            VerifyOrQuit(info.mUsedBuffers == used, "the used buffers of a level differ from its messages");
+            VerifyOrQuit(info.mMaxUsedBuffers == mMaxUsed[priority], "the max used buffers of a level differ");
+            VerifyOrQuit(info.mNumDrops == mNumDrops[priority], "the drops of a level differ");
+        }
+
+        VerifyOrQuit(totalUsed == mPool.GetTotalBufferCount() - mPool.GetFreeBufferCount(),
+                     "the used buffers of the levels differ from the pool");
+    }
+
+    void FreeAll(void)
+    {
+        for (Message *&message : mMessages)
+        {
+            if (message != nullptr)
+            {
+                message->Free();
+                message = nullptr;
+            }
+        }
+    }
+
+private:
+    const otMessagePriorityInfo &GetInfo(uint8_t aPriority) const
+    {
+        return mPool.GetPriorityInfo(static_cast<Message::Priority>(aPriority));
+    }
+
+    MessagePool &mPool;
+    Message     *mMessages[kMaxMessages];
+    uint16_t     mBaseUsed[Message::kNumPriorities];
+    uint16_t     mMaxUsed[Message::kNumPriorities];
+    uint32_t     mNumDrops[Message::kNumPriorities];
+};
+
+static Message::Priority GetRandomPriority(void)
+{
+    return static_cast<Message::Priority>(TestRandom() % Message::kNumPriorities);
+}
+
+static void TestPriorityAccounting(Instance &aInstance)
+{
+    // Random allocations, resizes, priority changes and frees of messages of all the levels, enough to exhaust the
+    // pool, with the accounting and the denied allocations checked against the model after each operation.
+
+    static constexpr uint32_t kIterations = 200000;
+
+    MessagePool &pool = aInstance.Get<MessagePool>();
+    PoolModel    model(pool);
+    uint32_t     denied = 0;
+
+    for (uint32_t iteration = 0; iteration < kIterations; iteration++)
+    {
+        Message         *&message = model.GetMessage(TestRandom() % PoolModel::kMaxMessages);
+        Message::Priority priority;
+
+        switch (TestRandom() % 8)
+        {
+        case 0:
+        case 1:
+            if (message == nullptr)
+            {
+                priority = GetRandomPriority();
+                message  = pool.Allocate(Message::kTypeIp6, 0, Message::Settings(priority));
+                model.CheckAllocation(priority, (message != nullptr) ? message->GetBufferCount() : 0,
+                                      message != nullptr);
+                denied += (message == nullptr);
+            }
+            break;
+
+        case 2:
+        case 3:
+        case 4:
+            if (message != nullptr)
+            {
+                uint16_t numBuffers = message->GetBufferCount();
+                Error    error      = message->SetLength(TestRandom() % 1500);
+
+                // A shorter length frees the buffers past it.
+                numBuffers = (message->GetBufferCount() > numBuffers) ? message->GetBufferCount() - numBuffers : 0;
+                model.CheckAllocation(message->GetPriority(), numBuffers, error == kErrorNone);
+                denied += (error != kErrorNone);
+            }
+            break;
+
+        case 5:
+            if (message != nullptr)
+            {
+                SuccessOrQuit(message->SetPriority(GetRandomPriority()), "SetPriority() failed");
+                model.Check();
+
+                // A message moved to a level over its quota is not admitted for transmission.
+
+                if (pool.CheckAdmission(*message) != kErrorNone)
+                {
+                    model.CountAdmissionDrop(message->GetPriority());
+                }
+
+                model.Check();
+            }
+            break;
+
+        case 6:
+            if (message != nullptr)
+            {
+                message->Free();
+                message = nullptr;
+                model.Check();
+            }
+            break;
+
+        default:
+            if (TestRandom() % 256 == 0)
+            {
+                model.Reset();
+                model.Check();
+            }
+            break;
+        }
+    }
+
+    model.FreeAll();
+    model.Check();
+
+    VerifyOrQuit(denied > kIterations / 100, "the pool was not exhausted");
+
+    printf("TestPriorityAccounting passed, %lu allocations denied\n", static_cast<unsigned long>(denied));
+}
+
+static void TestFloodKeepAlive(Instance &aInstance)
+{
+    // A child keeps its parent link with an MLE keep-alive each second while a flood of low priority fragmented
+    // datagrams, with lost fragments, holds reassembly buffers until they time out. Each keep-alive needs a network
+    // control request and response. With the quotas, the flood is capped and no keep-alive fails.
+
+    static constexpr uint32_t kDurationMs        = 600000;
+    static constexpr uint32_t kReassemblyTimeout = 2000;
+    static constexpr uint32_t kKeepAlivePeriod   = 1000;
+    static constexpr uint16_t kNumReassemblies   = 64;
+    static constexpr uint16_t kDatagramSize      = 1280;
+    static constexpr uint16_t kFragsPerDatagram  = 14;
+
+    struct Reassembly
+    {
+        Message *mMessage;
+        uint32_t mStart;
+        uint16_t mFragsLeft;
+    };
+
+    MessagePool &pool = aInstance.Get<MessagePool>();
+    Reassembly   reassemblies[kNumReassemblies];
+    uint32_t     keepAlives = 0;
+    uint32_t     failed     = 0;
+    uint32_t     delivered  = 0;
+
+    memset(reassemblies, 0, sizeof(reassemblies));
+
+    for (uint32_t now = 0; now < kDurationMs; now++)
+    {
+        Reassembly &reassembly = reassemblies[TestRandom() % kNumReassemblies];
+
+        if (reassembly.mMessage == nullptr)
+        {
+            reassembly.mMessage = pool.Allocate(Message::kTypeIp6, 0, Message::Settings(Message::kPriorityLow));
+
+            if ((reassembly.mMessage != nullptr) && (reassembly.mMessage->SetLength(kDatagramSize) != kErrorNone))
+            {
+                reassembly.mMessage->Free();
+                reassembly.mMessage = nullptr;
+            }
+
+            reassembly.mStart     = now;
+            reassembly.mFragsLeft = kFragsPerDatagram - 1;
+        }
+        else if ((TestRandom() % 10 != 0) && (--reassembly.mFragsLeft == 0))
+        {
+            reassembly.mMessage->Free();
+            reassembly.mMessage = nullptr;
+            delivered++;
+        }
+
+        for (Reassembly &entry : reassemblies)
+        {
+            if ((entry.mMessage != nullptr) && (now - entry.mStart >= kReassemblyTimeout))
+            {
+                entry.mMessage->Free();
+                entry.mMessage = nullptr;
+            }
+        }
+
+        if (now % kKeepAlivePeriod == 0)
+        {
+            Message::Settings settings(Message::kNoLinkSecurity, Message::kPriorityNet);
+            Message          *request  = pool.Allocate(Message::kTypeIp6, 0, settings);
+            Message          *response = pool.Allocate(Message::kTypeIp6, 0, settings);
+
+            keepAlives++;
+
+            if ((request == nullptr) || (request->SetLength(200) != kErrorNone) || (response == nullptr) ||
+                (response->SetLength(120) != kErrorNone))
+            {
+                failed++;
+            }
+
+            FreeMessage(request);
+            FreeMessage(response);
+        }
+    }
+
+    for (Reassembly &entry : reassemblies)
+    {
+        FreeMessage(entry.mMessage);
+    }
+
+    printf("flood keep-alives: %lu of %lu failed, %lu datagrams delivered, low priority max used %u buffers\n",
+           static_cast<unsigned long>(failed), static_cast<unsigned long>(keepAlives),
+           static_cast<unsigned long>(delivered), pool.GetPriorityInfo(Message::kPriorityLow).mMaxUsedBuffers);
+
+#if OPENTHREAD_CONFIG_MESSAGE_POOL_QUOTA_ENABLE
+    VerifyOrQuit(failed == 0, "a keep-alive failed with the quotas");
+#endif
+    VerifyOrQuit(pool.GetPriorityInfo(Message::kPriorityLow).mUsedBuffers == 0, "the flood buffers are not freed");
+
+    printf("TestFloodKeepAlive passed\n");
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::Instance *instance = testInitInstance();
+
+    ot::TestPriorityAccounting(*instance);
+    ot::TestFloodKeepAlive(*instance);
+
+    testFreeInstance(instance);
+
+    printf("All tests passed\n");
+
+    return 0;
+}
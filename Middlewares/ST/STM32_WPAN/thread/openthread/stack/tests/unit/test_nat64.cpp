@@ -0,0 +1,953 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "instance/instance.hpp"
+#include "net/nat64_translator.hpp"
+
+#include "simulation.h"
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+/**
+ * The checksum of a packet, summed one byte at a time.
+ *
+ */
+class ReferenceChecksum
+{
+public:
+    ReferenceChecksum(void)
+        : mValue(0)
+        , mAtOddIndex(false)
+    {
+    }
+
+    void AddUint8(uint8_t aUint8)
+    {
+        uint16_t newValue = mValue;
+
+        newValue += mAtOddIndex ? aUint8 : (static_cast<uint16_t>(aUint8) << 8);
+
+        if (newValue < mValue)
+        {
+            newValue++;
+        }
+
+        mValue      = newValue;
+        mAtOddIndex = !mAtOddIndex;
+    }
+
+    void AddData(const uint8_t *aBuffer, uint16_t aLength)
+    {
+        for (uint16_t i = 0; i < aLength; i++)
+        {
+            AddUint8(aBuffer[i]);
+        }
+    }
+
+    void AddPseudoHeader(const uint8_t *aSource, const uint8_t *aDestination, uint8_t aAddressSize, uint8_t aProto,
+                         uint16_t aLength)
+    {
+        AddData(aSource, aAddressSize);
+        AddData(aDestination, aAddressSize);
+        AddUint8(0);
+        AddUint8(aProto);
+        AddUint8(aLength >> 8);
+        AddUint8(aLength & 0xff);
+    }
+
+    uint16_t GetValue(void) const { return mValue; }
+    uint16_t GetFieldValue(void) const { return (mValue == 0xffff) ? mValue : static_cast<uint16_t>(~mValue); }
+
+private:
+    uint16_t mValue;
+    bool     mAtOddIndex;
+};
+
+class UnitTester
+{
+public:
+    static void TestMappings(Instance &aInstance);
+    static void BenchmarkTranslation(Instance &aInstance);
+
+private:
+    using Translator     = Nat64::Translator;
+    using AddressMapping = Translator::AddressMapping;
+
+    static constexpr uint16_t kNumClients       = 400;
+    static constexpr uint16_t kNumServers       = 1000;
+    static constexpr uint16_t kNumIp4Addresses  = 254; // Of the IPv4 CIDR of the test, a /24.
+    static constexpr uint16_t kIp6HeaderSize    = 40;
+    static constexpr uint16_t kIp4HeaderSize    = 20;
+    static constexpr uint16_t kMaxPayloadLength = 1200;
+    static constexpr uint16_t kMaxPacketLength  = kIp6HeaderSize + 20 + kMaxPayloadLength;
+    static constexpr uint8_t  kIp6HopLimit      = 64;
+    static constexpr uint8_t  kIp4Ttl           = 50;
+    static constexpr uint32_t kIdleTimeoutMsec  = Translator::kAddressMappingIdleTimeoutMsec;
+    static constexpr uint32_t kSlotDurationMsec = Translator::kExpirySlotDurationMsec;
+    static constexpr uint8_t  kIcmp6EchoRequest = 128;
+    static constexpr uint8_t  kIcmp6EchoReply   = 129;
+    static constexpr uint8_t  kIcmp4EchoRequest = 8;
+    static constexpr uint8_t  kIcmp4EchoReply   = 0;
+    static constexpr uint16_t kNoClient         = 0xffff;
+
+    struct Packet
+    {
+        uint8_t *GetTransport(void) { return &mBytes[mTransportOffset]; }
+
+        uint8_t  mBytes[kMaxPacketLength];
+        uint16_t mLength;
+        uint16_t mTransportOffset;
+    };
+
+    // The mapping of a client, as the translator should hold it.
+
+    struct MappingModel
+    {
+        bool IsExpired(TimeMilli aNow) const { return mExpiry < aNow; }
+
+        bool         mIsPresent;
+        Ip4::Address mIp4;
+        TimeMilli    mExpiry;
+    };
+
+    static MappingModel sModels[kNumClients];
+    static uint32_t     sNumDrops;
+    static uint32_t     sNumReleasedOnAllocation;
+
+    static uint16_t GetTransportHeaderSize(uint8_t aProto) { return (aProto == Ip6::kProtoTcp) ? 20 : 8; }
+
+    static uint16_t GetChecksumOffset(uint8_t aProto)
+    {
+        return (aProto == Ip6::kProtoTcp) ? 16 : (aProto == Ip6::kProtoUdp) ? 6 : 2;
+    }
+
+    static uint8_t GetIp4Proto(uint8_t aIp6Proto)
+    {
+        return (aIp6Proto == Ip6::kProtoIcmp6) ? Ip4::kProtoIcmp : aIp6Proto;
+    }
+
+    static uint8_t GetRandomProto(void)
+    {
+        static const uint8_t kProtos[] = {Ip6::kProtoUdp, Ip6::kProtoUdp, Ip6::kProtoTcp, Ip6::kProtoIcmp6};
+
+        return kProtos[TestRandom() % GetArrayLength(kProtos)];
+    }
+
+    static void GetClientAddress(uint16_t aClient, Ip6::Address &aAddress)
+    {
+        aAddress.Clear();
+        aAddress.mFields.m8[0]  = 0xfd;
+        aAddress.mFields.m8[7]  = 0x01;
+        aAddress.mFields.m16[7] = BigEndian::HostSwap16(aClient + 1);
+    }
+
+    static uint16_t GetClient(const Ip6::Address &aAddress)
+    {
+        Ip6::Address address;
+        uint16_t     client = BigEndian::HostSwap16(aAddress.mFields.m16[7]) - 1;
+
+        GetClientAddress(client, address);
+
+        return (address == aAddress) ? client : kNoClient;
+    }
+
+    static void GetServerAddress(uint16_t aServer, Ip4::Address &aAddress)
+    {
+        aAddress.mFields.m8[0] = 198;
+        aAddress.mFields.m8[1] = 51;
+        aAddress.mFields.m8[2] = static_cast<uint8_t>(aServer >> 8);
+        aAddress.mFields.m8[3] = static_cast<uint8_t>(aServer);
+    }
+
+    static void GetSynthesizedAddress(const Ip4::Address &aIp4Address, Ip6::Address &aAddress)
+    {
+        aAddress.Clear();
+        aAddress.mFields.m8[1]  = 0x64;
+        aAddress.mFields.m8[2]  = 0xff;
+        aAddress.mFields.m8[3]  = 0x9b;
+        aAddress.mFields.m32[3] = aIp4Address.mFields.m32;
+    }
+
+    // The packets of the clients and servers, with random transport headers and payloads.
+
+    static void InitTransport(Packet &aPacket, uint8_t aProto, uint8_t aIcmpType, uint16_t aPayloadLength)
+    {
+        uint8_t *transport = aPacket.GetTransport();
+        uint16_t length    = GetTransportHeaderSize(aProto) + aPayloadLength;
+
+        for (uint16_t i = 0; i < length; i++)
+        {
+            transport[i] = TestRandomByte();
+        }
+
+        if (aProto == Ip6::kProtoUdp)
+        {
+            transport[4] = static_cast<uint8_t>(length >> 8);
+            transport[5] = static_cast<uint8_t>(length);
+        }
+        else if ((aProto == Ip6::kProtoIcmp6) || (aProto == Ip4::kProtoIcmp))
+        {
+            transport[0] = aIcmpType;
+            transport[1] = 0;
+        }
+
+        transport[GetChecksumOffset(aProto)]     = 0;
+        transport[GetChecksumOffset(aProto) + 1] = 0;
+        aPacket.mLength                          = aPacket.mTransportOffset + length;
+    }
+
+    static void WriteChecksum(uint8_t *aField, const ReferenceChecksum &aChecksum)
+    {
+        aField[0] = static_cast<uint8_t>(aChecksum.GetFieldValue() >> 8);
+        aField[1] = static_cast<uint8_t>(aChecksum.GetFieldValue());
+    }
+
+    static void BuildIp6Packet(Packet  &aPacket,
+                               uint16_t aClient,
+                               uint16_t aServer,
+                               uint8_t  aProto,
+                               uint16_t aPayloadLength)
+    {
+        Ip6::Address      address;
+        Ip4::Address      server;
+        ReferenceChecksum checksum;
+        uint16_t          transportLength;
+
+        memset(aPacket.mBytes, 0, kIp6HeaderSize);
+        aPacket.mTransportOffset = kIp6HeaderSize;
+        InitTransport(aPacket, aProto, kIcmp6EchoRequest, aPayloadLength);
+        transportLength = aPacket.mLength - kIp6HeaderSize;
+
+        aPacket.mBytes[0] = 0x60;
+        aPacket.mBytes[4] = static_cast<uint8_t>(transportLength >> 8);
+        aPacket.mBytes[5] = static_cast<uint8_t>(transportLength);
+        aPacket.mBytes[6] = aProto;
+        aPacket.mBytes[7] = kIp6HopLimit;
+        GetClientAddress(aClient, address);
+        memcpy(&aPacket.mBytes[8], &address, sizeof(address));
+        GetServerAddress(aServer, server);
+        GetSynthesizedAddress(server, address);
+        memcpy(&aPacket.mBytes[24], &address, sizeof(address));
+
+        checksum.AddPseudoHeader(&aPacket.mBytes[8], &aPacket.mBytes[24], sizeof(Ip6::Address), aProto,
+                                 transportLength);
+        checksum.AddData(aPacket.GetTransport(), transportLength);
+        WriteChecksum(aPacket.GetTransport() + GetChecksumOffset(aProto), checksum);
+    }
+
+    static void BuildIp4Packet(Packet             &aPacket,
+                               uint16_t            aServer,
+                               const Ip4::Address &aDestination,
+                               uint8_t             aProto,
+                               uint16_t            aPayloadLength)
+    {
+        Ip4::Address      server;
+        ReferenceChecksum headerChecksum;
+        ReferenceChecksum checksum;
+        uint16_t          transportLength;
+
+        memset(aPacket.mBytes, 0, kIp4HeaderSize);
+        aPacket.mTransportOffset = kIp4HeaderSize;
+        InitTransport(aPacket, aProto, kIcmp4EchoReply, aPayloadLength);
+        transportLength = aPacket.mLength - kIp4HeaderSize;
+
+        aPacket.mBytes[0] = 0x45;
+        aPacket.mBytes[2] = static_cast<uint8_t>(aPacket.mLength >> 8);
+        aPacket.mBytes[3] = static_cast<uint8_t>(aPacket.mLength);
+        aPacket.mBytes[8] = kIp4Ttl;
+        aPacket.mBytes[9] = aProto;
+        GetServerAddress(aServer, server);
+        memcpy(&aPacket.mBytes[12], &server, sizeof(server));
+        memcpy(&aPacket.mBytes[16], &aDestination, sizeof(aDestination));
+        headerChecksum.AddData(aPacket.mBytes, kIp4HeaderSize);
+        WriteChecksum(&aPacket.mBytes[10], headerChecksum);
+
+        if (aProto != Ip4::kProtoIcmp)
+        {
+            checksum.AddPseudoHeader(&aPacket.mBytes[12], &aPacket.mBytes[16], sizeof(Ip4::Address), aProto,
+                                     transportLength);
+        }
+
+        checksum.AddData(aPacket.GetTransport(), transportLength);
+
+        // A UDP datagram over IPv4 may have no checksum, the translator then calculates it.
+
+        if ((aProto != Ip4::kProtoUdp) || (TestRandom() % 8 != 0))
+        {
+            WriteChecksum(aPacket.GetTransport() + GetChecksumOffset(aProto), checksum);
+        }
+    }
+
+    static Message *NewMessage(Instance &aInstance, const Packet &aPacket, bool aIsIp4)
+    {
+        // An IPv4 message reserves the size that the IPv6 header adds, as the platform does.
+
+        Message *message = aIsIp4 ? aInstance.Get<MessagePool>().Allocate(Message::kTypeIp4, kIp4HeaderSize)
+                                  : aInstance.Get<MessagePool>().Allocate(Message::kTypeIp6);
+
+        VerifyOrQuit(message != nullptr, "Allocate() failed");
+        SuccessOrQuit(message->AppendBytes(aPacket.mBytes, aPacket.mLength), "AppendBytes() failed");
+
+        return message;
+    }
+
+    static void ReadAndFree(Message *aMessage, Packet &aPacket, uint16_t aTransportOffset)
+    {
+        aPacket.mLength          = aMessage->GetLength();
+        aPacket.mTransportOffset = aTransportOffset;
+        VerifyOrQuit(aPacket.mLength <= kMaxPacketLength, "translated packet is too long");
+        SuccessOrQuit(aMessage->Read(0, aPacket.mBytes, aPacket.mLength), "Read() failed");
+        aMessage->Free();
+    }
+
+    static void CheckTransport(Packet &aInput, Packet &aOutput, uint8_t aProto, uint8_t aIcmpType)
+    {
+        // The transport header and payload are the same, except the checksum, and the type of an ICMP echo.
+
+        uint16_t length = aInput.mLength - aInput.mTransportOffset;
+
+        VerifyOrQuit(aOutput.mLength - aOutput.mTransportOffset == length, "transport length differs");
+
+        for (uint16_t i = 0; i < length; i++)
+        {
+            if ((i == GetChecksumOffset(aProto)) || (i == GetChecksumOffset(aProto) + 1))
+            {
+                continue;
+            }
+
+            if ((i == 0) && (aProto == Ip6::kProtoIcmp6 || aProto == Ip4::kProtoIcmp))
+            {
+                VerifyOrQuit(aOutput.GetTransport()[0] == aIcmpType, "ICMP type is not translated");
+                continue;
+            }
+
+            VerifyOrQuit(aOutput.GetTransport()[i] == aInput.GetTransport()[i], "transport bytes differ");
+        }
+    }
+
+    static void CheckIp4Packet(Packet &aIp6Packet, Packet &aIp4Packet, uint8_t aProto)
+    {
+        uint8_t           proto4 = GetIp4Proto(aProto);
+        ReferenceChecksum headerChecksum;
+        ReferenceChecksum checksum;
+
+        VerifyOrQuit(aIp4Packet.mLength == aIp6Packet.mLength - (kIp6HeaderSize - kIp4HeaderSize),
+                     "IPv4 packet length is wrong");
+        VerifyOrQuit(aIp4Packet.mBytes[0] == 0x45, "IPv4 version is wrong");
+        VerifyOrQuit(((aIp4Packet.mBytes[2] << 8) | aIp4Packet.mBytes[3]) == aIp4Packet.mLength,
+                     "IPv4 total length is wrong");
+        VerifyOrQuit(aIp4Packet.mBytes[8] == kIp6HopLimit, "IPv4 TTL is wrong");
+        VerifyOrQuit(aIp4Packet.mBytes[9] == proto4, "IPv4 protocol is wrong");
+        VerifyOrQuit(memcmp(&aIp4Packet.mBytes[16], &aIp6Packet.mBytes[36], sizeof(Ip4::Address)) == 0,
+                     "IPv4 destination is wrong");
+
+        headerChecksum.AddData(aIp4Packet.mBytes, kIp4HeaderSize);
+        VerifyOrQuit(headerChecksum.GetValue() == 0xffff, "IPv4 header checksum is wrong");
+
+        if (proto4 != Ip4::kProtoIcmp)
+        {
+            checksum.AddPseudoHeader(&aIp4Packet.mBytes[12], &aIp4Packet.mBytes[16], sizeof(Ip4::Address), proto4,
+                                     aIp4Packet.mLength - kIp4HeaderSize);
+        }
+
+        checksum.AddData(aIp4Packet.GetTransport(), aIp4Packet.mLength - kIp4HeaderSize);
+        VerifyOrQuit(checksum.GetValue() == 0xffff, "IPv4 transport checksum is wrong");
+
+        CheckTransport(aIp6Packet, aIp4Packet, aProto, kIcmp4EchoRequest);
+    }
+
+    static void CheckIp6Packet(Packet &aIp4Packet, Packet &aIp6Packet, uint8_t aProto, uint16_t aClient)
+    {
+        Ip6::Address      address;
+        Ip4::Address      server;
+        ReferenceChecksum checksum;
+        uint16_t          payloadLength = aIp6Packet.mLength - kIp6HeaderSize;
+
+        VerifyOrQuit(aIp6Packet.mLength == aIp4Packet.mLength + (kIp6HeaderSize - kIp4HeaderSize),
+                     "IPv6 packet length is wrong");
+        VerifyOrQuit((aIp6Packet.mBytes[0] >> 4) == 6, "IPv6 version is wrong");
+        VerifyOrQuit(((aIp6Packet.mBytes[4] << 8) | aIp6Packet.mBytes[5]) == payloadLength,
+                     "IPv6 payload length is wrong");
+        VerifyOrQuit(aIp6Packet.mBytes[6] == aProto, "IPv6 next header is wrong");
+        VerifyOrQuit(aIp6Packet.mBytes[7] == kIp4Ttl, "IPv6 hop limit is wrong");
+
+        memcpy(&server, &aIp4Packet.mBytes[12], sizeof(server));
+        GetSynthesizedAddress(server, address);
+        VerifyOrQuit(memcmp(&aIp6Packet.mBytes[8], &address, sizeof(address)) == 0, "IPv6 source is wrong");
+        GetClientAddress(aClient, address);
+        VerifyOrQuit(memcmp(&aIp6Packet.mBytes[24], &address, sizeof(address)) == 0, "IPv6 destination is wrong");
+
+        checksum.AddPseudoHeader(&aIp6Packet.mBytes[8], &aIp6Packet.mBytes[24], sizeof(Ip6::Address), aProto,
+                                 payloadLength);
+        checksum.AddData(aIp6Packet.GetTransport(), payloadLength);
+        VerifyOrQuit(checksum.GetValue() == 0xffff, "IPv6 transport checksum is wrong");
+
+        CheckTransport(aIp4Packet, aIp6Packet, GetIp4Proto(aProto), kIcmp6EchoReply);
+    }
+
+    // The lookup as it was before the address indexes: a walk of the active mappings.
+
+    template <typename AddressType>
+    static AddressMapping *FindMappingLinear(Translator &aTranslator, const AddressType &aAddress)
+    {
+        AddressMapping *mapping = nullptr;
+
+        for (LinkedList<AddressMapping> &slot : aTranslator.mExpirySlots)
+        {
+            mapping = slot.FindMatching(aAddress);
+            VerifyOrExit(mapping == nullptr);
+        }
+
+    exit:
+        return mapping;
+    }
+
+    // The lookup of an address index, the walk of the chain of the home slot of its hash.
+
+    template <typename AddressType>
+    static AddressMapping *FindMappingIndexed(Translator                       &aTranslator,
+                                              const Translator::AddressIndex &aIndex,
+                                              const AddressType              &aAddress)
+    {
+        AddressMapping *mapping = nullptr;
+        uint16_t        slot    = aIndex.GetHomeSlot(Translator::HashAddress(aAddress));
+        uint16_t        index;
+
+        while ((index = aIndex.GetNext(slot)) != Translator::AddressIndex::kNotFound)
+        {
+            if (aTranslator.mAddressMappingPool.GetEntryAt(index).Matches(aAddress))
+            {
+                mapping = &aTranslator.mAddressMappingPool.GetEntryAt(index);
+                break;
+            }
+        }
+
+        return mapping;
+    }
+
+    static uint16_t FindClient(const Ip4::Address &aIp4Address);
+    static void     SendFromClient(Instance &aInstance, uint16_t aClient, bool aWithReply);
+    static void     SendToIp4Address(Instance &aInstance, const Ip4::Address &aIp4Address);
+    static void     CheckMappings(Translator &aTranslator);
+    static void     CheckWheel(Translator &aTranslator);
+};
+
+UnitTester::MappingModel UnitTester::sModels[kNumClients];
+uint32_t                 UnitTester::sNumDrops;
+uint32_t                 UnitTester::sNumReleasedOnAllocation;
+
+uint16_t UnitTester::FindClient(const Ip4::Address &aIp4Address)
+{
+    uint16_t client = kNoClient;
+
+    for (uint16_t i = 0; i < kNumClients; i++)
+    {
+        if (sModels[i].mIsPresent && (sModels[i].mIp4 == aIp4Address))
+        {
+            client = i;
+            break;
+        }
+    }
+
+    return client;
+}
+
+void UnitTester::SendFromClient(Instance &aInstance, uint16_t aClient, bool aWithReply)
+{
+    // A packet of the client to a server, and the reply of the server. The mapping of a client is only refreshed by
+    // the packets to it. When the IPv4 addresses are all mapped, the expired mappings are released to map a new
+    // client, and the packet is dropped if none has expired.
+
+    Translator   &translator = aInstance.Get<Translator>();
+    MappingModel &model      = sModels[aClient];
+    TimeMilli     now        = TimerMilli::GetNow();
+    uint16_t      server     = TestRandom() % kNumServers;
+    uint8_t       proto      = GetRandomProto();
+    bool          shouldDrop = false;
+    Packet        ip6Packet;
+    Packet        ip4Packet;
+    Message      *message;
+    Ip4::Address  ip4Address;
+
+    if (!model.mIsPresent)
+    {
+        uint16_t numPresent = 0;
+
+        for (const MappingModel &other : sModels)
+        {
+            numPresent += other.mIsPresent;
+        }
+
+        if (numPresent == kNumIp4Addresses)
+        {
+            shouldDrop = true;
+
+            for (MappingModel &other : sModels)
+            {
+                if (other.mIsPresent && other.IsExpired(now))
+                {
+                    other.mIsPresent = false;
+                    shouldDrop       = false;
+                    sNumReleasedOnAllocation++;
+                }
+            }
+        }
+    }
+
+    BuildIp6Packet(ip6Packet, aClient, server, proto, TestRandom() % (kMaxPayloadLength + 1));
+    message = NewMessage(aInstance, ip6Packet, /* aIsIp4 */ false);
+
+    if (shouldDrop)
+    {
+        VerifyOrQuit(translator.TranslateFromIp6(*message) == Translator::kDrop, "packet of an unmapped client sent");
+        message->Free();
+        sNumDrops++;
+        ExitNow();
+    }
+
+    VerifyOrQuit(translator.TranslateFromIp6(*message) == Translator::kForward, "TranslateFromIp6() failed");
+    ReadAndFree(message, ip4Packet, kIp4HeaderSize);
+    CheckIp4Packet(ip6Packet, ip4Packet, proto);
+    memcpy(&ip4Address, &ip4Packet.mBytes[12], sizeof(ip4Address));
+
+    if (model.mIsPresent)
+    {
+        VerifyOrQuit(ip4Address == model.mIp4, "IPv4 address of a mapping changed");
+    }
+    else
+    {
+        VerifyOrQuit((ip4Address.mFields.m8[0] == 10) && (ip4Address.mFields.m8[1] == 8) &&
+                         (ip4Address.mFields.m8[2] == 0) && (ip4Address.mFields.m8[3] != 0) &&
+                         (ip4Address.mFields.m8[3] != 255),
+                     "IPv4 address is not a host of the CIDR");
+        VerifyOrQuit(FindClient(ip4Address) == kNoClient, "IPv4 address is mapped twice");
+
+        model.mIsPresent = true;
+        model.mIp4       = ip4Address;
+        model.mExpiry    = now + kIdleTimeoutMsec;
+    }
+
+    VerifyOrExit(aWithReply);
+
+    BuildIp4Packet(ip4Packet, server, ip4Address, GetIp4Proto(proto), TestRandom() % (kMaxPayloadLength + 1));
+    message = NewMessage(aInstance, ip4Packet, /* aIsIp4 */ true);
+    VerifyOrQuit(translator.TranslateToIp6(*message) == Translator::kForward, "TranslateToIp6() failed");
+    ReadAndFree(message, ip6Packet, kIp6HeaderSize);
+    CheckIp6Packet(ip4Packet, ip6Packet, proto, aClient);
+    model.mExpiry = now + kIdleTimeoutMsec;
+
+exit:
+    return;
+}
+
+void UnitTester::SendToIp4Address(Instance &aInstance, const Ip4::Address &aIp4Address)
+{
+    // A packet of a server to an IPv4 address of the CIDR, which may not be mapped.
+
+    Translator &translator = aInstance.Get<Translator>();
+    uint16_t    client     = FindClient(aIp4Address);
+    uint16_t    server     = TestRandom() % kNumServers;
+    uint8_t     proto      = (TestRandom() % 2 == 0) ? Ip4::kProtoUdp : Ip4::kProtoTcp;
+    Packet      ip4Packet;
+    Packet      ip6Packet;
+    Message    *message;
+
+    BuildIp4Packet(ip4Packet, server, aIp4Address, proto, TestRandom() % 200);
+    message = NewMessage(aInstance, ip4Packet, /* aIsIp4 */ true);
+
+    if (client == kNoClient)
+    {
+        VerifyOrQuit(translator.TranslateToIp6(*message) == Translator::kDrop, "packet to an unmapped address sent");
+        message->Free();
+        ExitNow();
+    }
+
+    VerifyOrQuit(translator.TranslateToIp6(*message) == Translator::kForward, "TranslateToIp6() failed");
+    ReadAndFree(message, ip6Packet, kIp6HeaderSize);
+    CheckIp6Packet(ip4Packet, ip6Packet, proto, client);
+    sModels[client].mExpiry = TimerMilli::GetNow() + kIdleTimeoutMsec;
+
+exit:
+    return;
+}
+
+void UnitTester::CheckMappings(Translator &aTranslator)
+{
+    // The mappings are those of the model, with their remaining time. The mappings which are no longer there are
+    // released after their expiry, within one slot of the idle timeout wheel.
+
+    TimeMilli                          now = TimerMilli::GetNow();
+    Translator::AddressMappingIterator iterator;
+    otNat64AddressMapping              mapping;
+    bool                               isListed[kNumClients];
+
+    ClearAllBytes(isListed);
+    aTranslator.InitAddressMappingIterator(iterator);
+
+    while (aTranslator.GetNextAddressMapping(iterator, mapping) == kErrorNone)
+    {
+        uint16_t      client = GetClient(AsCoreType(&mapping.mIp6));
+        MappingModel &model  = sModels[client];
+
+        VerifyOrQuit(client != kNoClient, "mapping of an unknown client");
+        VerifyOrQuit(model.mIsPresent && !isListed[client], "mapping is not in the model");
+        VerifyOrQuit(AsCoreType(&mapping.mIp4) == model.mIp4, "IPv4 address of a mapping differs");
+        VerifyOrQuit(mapping.mRemainingTimeMs == (model.IsExpired(now) ? 0 : model.mExpiry - now),
+                     "remaining time of a mapping differs");
+        isListed[client] = true;
+    }
+
+    for (uint16_t client = 0; client < kNumClients; client++)
+    {
+        MappingModel &model = sModels[client];
+
+        if (model.mIsPresent && !isListed[client])
+        {
+            VerifyOrQuit(model.IsExpired(now), "mapping released before its expiry");
+            model.mIsPresent = false;
+        }
+
+        if (model.mIsPresent)
+        {
+            VerifyOrQuit(!(model.mExpiry + kSlotDurationMsec < now), "expired mapping is not released");
+        }
+    }
+}
+
+void UnitTester::CheckWheel(Translator &aTranslator)
+{
+    // Each mapping of the wheel is in both indexes and in a slot which starts no later than its expiry time, and the
+    // lookups of the indexes find the same mappings as the walk of the wheel. The timer runs while there is a mapping.
+
+    uint16_t numInWheel   = 0;
+    uint16_t numInIndexes = 0;
+
+    for (uint16_t slotIndex = 0; slotIndex < Translator::kNumExpirySlots; slotIndex++)
+    {
+        uint16_t  slotsAhead = (slotIndex + Translator::kNumExpirySlots - aTranslator.mExpirySlotIndex) %
+                              Translator::kNumExpirySlots;
+        TimeMilli slotTime   = aTranslator.mExpirySlotTime + slotsAhead * kSlotDurationMsec;
+
+        for (AddressMapping &mapping : aTranslator.mExpirySlots[slotIndex])
+        {
+            uint16_t index = aTranslator.mAddressMappingPool.GetIndexOf(mapping);
+
+            VerifyOrQuit(aTranslator.mIp6Index.Contains(index) && aTranslator.mIp4Index.Contains(index),
+                         "mapping is not indexed");
+            VerifyOrQuit(FindMappingIndexed(aTranslator, aTranslator.mIp6Index, mapping.mIp6) == &mapping,
+                         "IPv6 index finds another mapping");
+            VerifyOrQuit(FindMappingIndexed(aTranslator, aTranslator.mIp4Index, mapping.mIp4) == &mapping,
+                         "IPv4 index finds another mapping");
+            VerifyOrQuit(!(mapping.mExpiry < slotTime), "mapping is in a slot after its expiry");
+            numInWheel++;
+        }
+    }
+
+    for (uint16_t index = 0; index < aTranslator.mAddressMappingPool.GetSize(); index++)
+    {
+        VerifyOrQuit(aTranslator.mIp6Index.Contains(index) == aTranslator.mIp4Index.Contains(index),
+                     "indexes differ");
+        numInIndexes += aTranslator.mIp6Index.Contains(index);
+    }
+
+    VerifyOrQuit(numInWheel == numInIndexes, "indexes have other mappings");
+    VerifyOrQuit(numInWheel + aTranslator.mIp4AddressPool.GetLength() == kNumIp4Addresses, "IPv4 address is lost");
+    VerifyOrQuit((numInWheel == 0) || aTranslator.mMappingExpirerTimer.IsRunning(), "expirer timer is not running");
+
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        Ip6::Address ip6Address;
+        Ip4::Address ip4Address;
+
+        GetClientAddress(TestRandom() % kNumClients, ip6Address);
+        ip4Address.mFields.m32 = BigEndian::HostSwap32(0x0a080000 + TestRandom() % 256);
+
+        VerifyOrQuit(FindMappingIndexed(aTranslator, aTranslator.mIp6Index, ip6Address) ==
+                         FindMappingLinear(aTranslator, ip6Address),
+                     "IPv6 lookup differs");
+        VerifyOrQuit(FindMappingIndexed(aTranslator, aTranslator.mIp4Index, ip4Address) ==
+                         FindMappingLinear(aTranslator, ip4Address),
+                     "IPv4 lookup differs");
+    }
+}
+
+void UnitTester::TestMappings(Instance &aInstance)
+{
+    // Clients send packets to servers, which mostly reply, and servers send packets to the addresses of the CIDR,
+    // while time runs in short steps and sometimes past the idle timeout. There are more clients than addresses, so
+    // the mappings run out and the expired ones are released to map new clients. After each step the translated
+    // packets, the mappings and the wheel are checked.
+
+    static constexpr uint32_t kIterations = 40000;
+
+    Translator &translator  = aInstance.Get<Translator>();
+    uint16_t    maxMappings = 0;
+    uint32_t    numReleased = 0;
+    Ip4::Cidr   cidr;
+    Ip6::Prefix prefix;
+
+    SuccessOrQuit(cidr.FromString("10.8.0.0/24"), "Cidr::FromString() failed");
+    SuccessOrQuit(prefix.FromString("64:ff9b::/96"), "Prefix::FromString() failed");
+    SuccessOrQuit(translator.SetIp4Cidr(cidr), "SetIp4Cidr() failed");
+    translator.SetNat64Prefix(prefix);
+    translator.SetEnabled(true);
+    VerifyOrQuit(translator.mIp4AddressPool.GetLength() == kNumIp4Addresses, "IPv4 address pool size differs");
+
+    for (uint32_t iteration = 0; iteration < kIterations; iteration++)
+    {
+        uint16_t numTimerReleased = 0;
+
+        switch (TestRandom() % 10)
+        {
+        case 0:
+        case 1:
+        case 2:
+        case 3:
+        case 4:
+            SendFromClient(aInstance, TestRandom() % kNumClients, /* aWithReply */ TestRandom() % 3 != 0);
+            break;
+
+        case 5:
+        {
+            Ip4::Address ip4Address;
+
+            ip4Address.mFields.m32 = BigEndian::HostSwap32(0x0a080000 + TestRandom() % 256);
+            SendToIp4Address(aInstance, ip4Address);
+            break;
+        }
+
+        default:
+            otSimRun((TestRandom() % 300 == 0) ? (TestRandom() % (3 * kIdleTimeoutMsec)) * 1000ULL
+                                               : (TestRandom() % 4000) * 1000ULL);
+            break;
+        }
+
+        for (const MappingModel &model : sModels)
+        {
+            numTimerReleased += model.mIsPresent;
+        }
+
+        CheckMappings(translator);
+        CheckWheel(translator);
+
+        for (const MappingModel &model : sModels)
+        {
+            numTimerReleased -= model.mIsPresent;
+        }
+
+        numReleased += numTimerReleased;
+        maxMappings = Max<uint16_t>(maxMappings, kNumIp4Addresses - translator.mIp4AddressPool.GetLength());
+    }
+
+    VerifyOrQuit(maxMappings == kNumIp4Addresses, "the mappings never ran out");
+    VerifyOrQuit(sNumDrops > 0 && sNumReleasedOnAllocation > 0 && numReleased > 0, "too few releases");
+
+    translator.SetEnabled(false);
+    VerifyOrQuit(translator.mIp4AddressPool.GetLength() == kNumIp4Addresses, "mappings are not released");
+
+    printf("TestMappings passed, %lu dropped, %lu released by the timer, %lu released to map a client\n",
+           static_cast<unsigned long>(sNumDrops), static_cast<unsigned long>(numReleased),
+           static_cast<unsigned long>(sNumReleasedOnAllocation));
+}
+
+void UnitTester::BenchmarkTranslation(Instance &aInstance)
+{
+    // N clients have a mapping. The mappings of random clients are looked up by IPv6 and IPv4 address, against the
+    // walk of the mappings, then UDP packets of random clients and their replies are translated.
+
+    static const uint16_t kNumMappingsList[] = {16, 256, 1024};
+
+    static constexpr uint32_t kCount = 100000;
+    static constexpr uint16_t kNumPackets = 20000;
+    static constexpr uint16_t kBatchSize = 16;
+
+    Translator         &translator = aInstance.Get<Translator>();
+    Ip4::Cidr           cidr;
+    static Ip4::Address sIp4Addresses[Translator::kAddressMappingPoolSize];
+
+    SuccessOrQuit(cidr.FromString("10.9.0.0/20"), "Cidr::FromString() failed");
+    SuccessOrQuit(translator.SetIp4Cidr(cidr), "SetIp4Cidr() failed");
+
+    for (uint16_t numMappings : kNumMappingsList)
+    {
+        char     benchmarkName[64];
+        uint32_t found = 0;
+        double   referenceNs;
+        double   ns6To4 = 0;
+        double   ns4To6 = 0;
+
+        translator.SetEnabled(true);
+
+        for (uint16_t client = 0; client < numMappings; client++)
+        {
+            Packet   packet;
+            Message *message;
+
+            BuildIp6Packet(packet, client, 0, Ip6::kProtoUdp, 20);
+            message = NewMessage(aInstance, packet, /* aIsIp4 */ false);
+            VerifyOrQuit(translator.TranslateFromIp6(*message) == Translator::kForward, "TranslateFromIp6() failed");
+            SuccessOrQuit(message->Read(12, sIp4Addresses[client]), "Read() failed");
+            message->Free();
+        }
+
+        {
+            BenchmarkTimer timer;
+
+            for (uint32_t i = 0; i < kCount; i++)
+            {
+                Ip6::Address ip6Address;
+
+                GetClientAddress((7 * i) % numMappings, ip6Address);
+                found += (FindMappingLinear(translator, ip6Address) != nullptr);
+            }
+
+            referenceNs = timer.GetNsPerOp(kCount);
+        }
+
+        VerifyOrQuit(found == kCount, "mapping is not found");
+
+        {
+            BenchmarkTimer timer;
+
+            for (uint32_t i = 0; i < kCount; i++)
+            {
+                Ip6::Address ip6Address;
+
+                GetClientAddress((7 * i) % numMappings, ip6Address);
+                found -= (FindMappingIndexed(translator, translator.mIp6Index, ip6Address) != nullptr);
+            }
+
+            snprintf(benchmarkName, sizeof(benchmarkName), "nat64_find_mapping_ip6_%u", numMappings);
+            PrintBenchmark(benchmarkName, kCount, referenceNs, timer.GetNsPerOp(kCount));
+        }
+
+        {
+            BenchmarkTimer timer;
+
+            for (uint32_t i = 0; i < kCount; i++)
+            {
+                found += (FindMappingLinear(translator, sIp4Addresses[(7 * i) % numMappings]) != nullptr);
+            }
+
+            referenceNs = timer.GetNsPerOp(kCount);
+        }
+
+        VerifyOrQuit(found == kCount, "mapping is not found");
+
+        {
+            BenchmarkTimer timer;
+
+            for (uint32_t i = 0; i < kCount; i++)
+            {
+                found -= (FindMappingIndexed(translator, translator.mIp4Index, sIp4Addresses[(7 * i) % numMappings]) !=
+                          nullptr);
+            }
+
+            snprintf(benchmarkName, sizeof(benchmarkName), "nat64_find_mapping_ip4_%u", numMappings);
+            PrintBenchmark(benchmarkName, kCount, referenceNs, timer.GetNsPerOp(kCount));
+        }
+
+        VerifyOrQuit(found == 0, "lookups differ");
+
+        for (uint16_t batch = 0; batch < kNumPackets / kBatchSize; batch++)
+        {
+            Message     *messages[kBatchSize];
+            Ip4::Address ip4Addresses[kBatchSize];
+            Packet       packet;
+
+            for (Message *&message : messages)
+            {
+                BuildIp6Packet(packet, TestRandom() % numMappings, TestRandom() % kNumServers, Ip6::kProtoUdp, 100);
+                message = NewMessage(aInstance, packet, /* aIsIp4 */ false);
+            }
+
+            {
+                BenchmarkTimer timer;
+
+                for (Message *message : messages)
+                {
+                    found += (translator.TranslateFromIp6(*message) == Translator::kForward);
+                }
+
+                ns6To4 += timer.GetNsPerOp(kNumPackets);
+            }
+
+            for (uint16_t i = 0; i < kBatchSize; i++)
+            {
+                SuccessOrQuit(messages[i]->Read(12, ip4Addresses[i]), "Read() failed");
+                messages[i]->Free();
+                BuildIp4Packet(packet, TestRandom() % kNumServers, ip4Addresses[i], Ip4::kProtoUdp, 100);
+                messages[i] = NewMessage(aInstance, packet, /* aIsIp4 */ true);
+            }
+
+            {
+                BenchmarkTimer timer;
+
+                for (Message *message : messages)
+                {
+                    found -= (translator.TranslateToIp6(*message) == Translator::kForward);
+                }
+
+                ns4To6 += timer.GetNsPerOp(kNumPackets);
+            }
+
+            for (Message *message : messages)
+            {
+                message->Free();
+            }
+        }
+
+        VerifyOrQuit(found == 0, "packets were dropped");
+
+        printf("translation of UDP packets with %u mappings: %.1f ns per packet to IPv4, %.1f ns per packet to IPv6\n",
+               numMappings, ns6To4, ns4To6);
+
+        translator.SetEnabled(false);
+    }
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::Instance *instance = testInitInstance();
+
+    ot::UnitTester::TestMappings(*instance);
+    ot::UnitTester::BenchmarkTranslation(*instance);
+
+    testFreeInstance(instance);
+
+    printf("All tests passed\n");
+
+    return 0;
+}
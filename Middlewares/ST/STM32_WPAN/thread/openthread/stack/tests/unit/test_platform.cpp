@@ -0,0 +1,139 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the platform of the unit tests, on the simulation platform.
+ *
+ */
+
+#include "test_platform.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <openthread/message.h>
+#include <openthread/platform/flash.h>
+#include <openthread/platform/mdns_socket.h>
+#include <openthread/platform/memory.h>
+
+#include "simulation.h"
+
+static constexpr uint32_t kSimulationSeed = 1;
+
+// The flash is NOR flash: an erase sets all the bits, a write only clears bits.
+static uint8_t sFlash[2][TEST_FLASH_SWAP_SIZE];
+
+uint32_t gTestFlashReadCount;
+uint32_t gTestMdnsTxCount;
+
+ot::Instance *testInitInstance(void)
+{
+    otSimInit(kSimulationSeed);
+
+    return &ot::AsCoreType(otSimNodeNew());
+}
+
+void testFreeInstance(otInstance *aInstance)
+{
+    otSimNodeDelete(aInstance);
+    otSimDeinit();
+}
+
+extern "C" {
+
+void otPlatFlashInit(otInstance *aInstance) { OT_UNUSED_VARIABLE(aInstance); }
+
+uint32_t otPlatFlashGetSwapSize(otInstance *aInstance)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    return TEST_FLASH_SWAP_SIZE;
+}
+
+void otPlatFlashErase(otInstance *aInstance, uint8_t aSwapIndex)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    memset(sFlash[aSwapIndex], 0xff, TEST_FLASH_SWAP_SIZE);
+}
+
+void otPlatFlashRead(otInstance *aInstance, uint8_t aSwapIndex, uint32_t aOffset, void *aData, uint32_t aSize)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_ASSERT(aOffset + aSize <= TEST_FLASH_SWAP_SIZE);
+
+    memcpy(aData, &sFlash[aSwapIndex][aOffset], aSize);
+    gTestFlashReadCount++;
+}
+
+void otPlatFlashWrite(otInstance *aInstance, uint8_t aSwapIndex, uint32_t aOffset, const void *aData, uint32_t aSize)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_ASSERT(aOffset + aSize <= TEST_FLASH_SWAP_SIZE);
+
+    for (uint32_t i = 0; i < aSize; i++)
+    {
+        sFlash[aSwapIndex][aOffset + i] &= static_cast<const uint8_t *>(aData)[i];
+    }
+}
+
+void *otPlatCAlloc(size_t aNum, size_t aSize) { return calloc(aNum, aSize); }
+
+void otPlatFree(void *aPtr) { free(aPtr); }
+
+// The infrastructure link of mDNS has no other node, the messages sent are dropped.
+
+otError otPlatMdnsSetListeningEnabled(otInstance *aInstance, bool aEnable, uint32_t aInfraIfIndex)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aEnable);
+    OT_UNUSED_VARIABLE(aInfraIfIndex);
+
+    return OT_ERROR_NONE;
+}
+
+void otPlatMdnsSendMulticast(otInstance *aInstance, otMessage *aMessage, uint32_t aInfraIfIndex)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aInfraIfIndex);
+
+    otMessageFree(aMessage);
+    gTestMdnsTxCount++;
+}
+
+void otPlatMdnsSendUnicast(otInstance *aInstance, otMessage *aMessage, const otPlatMdnsAddressInfo *aAddress)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aAddress);
+
+    otMessageFree(aMessage);
+    gTestMdnsTxCount++;
+}
+
+} // extern "C"
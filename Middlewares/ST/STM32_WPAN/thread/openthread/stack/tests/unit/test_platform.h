@@ -0,0 +1,76 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the platform of the unit tests, on the simulation platform.
+ *
+ */
+
+#ifndef TEST_PLATFORM_H_
+#define TEST_PLATFORM_H_
+
+#include <openthread/instance.h>
+
+#include "instance/instance.hpp"
+
+/**
+ * Creates an OpenThread instance, as a node of a new simulation.
+ *
+ * @returns The instance.
+ *
+ */
+ot::Instance *testInitInstance(void);
+
+/**
+ * Deletes an instance created by `testInitInstance()` and its simulation.
+ *
+ * @param[in] aInstance  The instance.
+ *
+ */
+void testFreeInstance(otInstance *aInstance);
+
+/**
+ * The size of each swap area of the flash of the test platform, in bytes.
+ *
+ */
+#define TEST_FLASH_SWAP_SIZE 8192
+
+/**
+ * The number of `otPlatFlashRead()` calls since the start of the test.
+ *
+ */
+extern uint32_t gTestFlashReadCount;
+
+/**
+ * The number of mDNS messages sent by the instance since the start of the test.
+ *
+ */
+extern uint32_t gTestMdnsTxCount;
+
+#endif // TEST_PLATFORM_H_
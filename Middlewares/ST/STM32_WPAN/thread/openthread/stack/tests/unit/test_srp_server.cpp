@@ -0,0 +1,580 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "instance/instance.hpp"
+#include "net/srp_server.hpp"
+
+#include "simulation.h"
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+class UnitTester
+{
+public:
+    static void TestNameTables(Instance &aInstance);
+    static void BenchmarkLookups(Instance &aInstance);
+
+private:
+    using Server  = Srp::Server;
+    using Host    = Server::Host;
+    using Service = Server::Service;
+
+    static constexpr uint16_t kNameSize         = 96;
+    static constexpr uint16_t kNumHostNames     = 48;
+    static constexpr uint16_t kNumInstanceNames = 64;
+    static constexpr uint16_t kNumServiceTypes  = 8;
+    static constexpr uint16_t kNumKeys          = 40;
+    static constexpr uint16_t kNumTableBuckets  = Server::kNameTableSize;
+
+    typedef char Name[kNameSize];
+
+    static void RandomizeCase(Name &aName)
+    {
+        for (char &c : aName)
+        {
+            if (TestRandom() % 2 == 0)
+            {
+                c = static_cast<char>(toupper(c));
+            }
+        }
+    }
+
+    static void GetHostName(Name &aName, uint16_t aId)
+    {
+        snprintf(aName, sizeof(aName), "host-%u.default.service.arpa.", aId);
+    }
+
+    static void GetServiceType(Name &aName, uint16_t aType)
+    {
+        snprintf(aName, sizeof(aName), "_t%u._udp.default.service.arpa.", aType);
+    }
+
+    static void GetInstanceLabel(Name &aName, uint16_t aId) { snprintf(aName, sizeof(aName), "inst-%u", aId); }
+
+    static void GetInstanceName(Name &aName, uint16_t aId)
+    {
+        snprintf(aName, sizeof(aName), "inst-%u._t%u._udp.default.service.arpa.", aId, aId % kNumServiceTypes);
+    }
+
+    static void StartServer(Server &aServer) { aServer.mState = Server::kStateRunning; }
+    static void StopServer(Server &aServer) { aServer.mState = Server::kStateStopped; }
+
+    static Host *NewHost(Instance &aInstance, uint16_t aHostId, uint8_t aKeyId)
+    {
+        Host *host = Host::Allocate(aInstance, TimerMilli::GetNow());
+        Name  name;
+
+        VerifyOrQuit(host != nullptr, "Host::Allocate() failed");
+        GetHostName(name, aHostId);
+        RandomizeCase(name);
+        SuccessOrQuit(host->SetFullName(name), "SetFullName() failed");
+        memset(&host->mKey, aKeyId, sizeof(host->mKey));
+
+        return host;
+    }
+
+    static void AddService(Host &aHost, uint16_t aInstanceId, bool aIsDeleted)
+    {
+        Name     instanceName;
+        Name     label;
+        Name     serviceType;
+        Service *service;
+
+        GetInstanceName(instanceName, aInstanceId);
+        RandomizeCase(instanceName);
+        VerifyOrExit(!aHost.HasService(instanceName));
+
+        GetInstanceLabel(label, aInstanceId);
+        GetServiceType(serviceType, aInstanceId % kNumServiceTypes);
+        service = aHost.AddNewService(instanceName, label, TimerMilli::GetNow());
+        VerifyOrQuit(service != nullptr, "AddNewService() failed");
+        SuccessOrQuit(service->mServiceName.Set(serviceType), "Set() failed");
+        service->mPort      = 5683;
+        service->mIsDeleted = aIsDeleted;
+
+    exit:
+        return;
+    }
+
+    static void Commit(Server &aServer, Host &aHost, uint32_t aLease, uint32_t aKeyLease)
+    {
+        Server::TtlConfig   ttlConfig;
+        Server::LeaseConfig leaseConfig;
+        Dns::UpdateHeader   header;
+
+        aServer.GetTtlConfig(ttlConfig);
+        aServer.GetLeaseConfig(leaseConfig);
+        aHost.SetLease(aLease);
+        aHost.SetKeyLease(aKeyLease);
+        aHost.SetTtl(aLease);
+        aServer.CommitSrpUpdate(kErrorNone, aHost, header, nullptr, ttlConfig, leaseConfig);
+    }
+
+    // The lookups as they were before the name tables: scans of every host and of every service.
+
+    static const Host *FindHostLinear(const Server &aServer, const char *aFullName)
+    {
+        const Host *match = nullptr;
+
+        for (const Host &host : aServer.GetHosts())
+        {
+            if (host.Matches(aFullName))
+            {
+                match = &host;
+                break;
+            }
+        }
+
+        return match;
+    }
+
+    static const Service *FindServiceLinear(const Server &aServer, const char *aInstanceName)
+    {
+        for (const Host &host : aServer.GetHosts())
+        {
+            for (const Service &service : host.GetServices())
+            {
+                if (!service.IsDeleted() && !host.IsDeleted() && service.MatchesInstanceName(aInstanceName))
+                {
+                    return &service;
+                }
+            }
+        }
+
+        return nullptr;
+    }
+
+    static bool HasNameConflictsLinear(const Server &aServer, const Host &aHost)
+    {
+        const Host *existingHost = FindHostLinear(aServer, aHost.GetFullName());
+
+        if ((existingHost != nullptr) && (aHost.mKey != existingHost->mKey))
+        {
+            return true;
+        }
+
+        for (const Service &service : aHost.GetServices())
+        {
+            for (const Host &host : aServer.GetHosts())
+            {
+                if (host.HasService(service.GetInstanceName()) && (aHost.mKey != host.mKey))
+                {
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    static uint16_t CountServicesOfTypeLinear(const Server &aServer, const char *aServiceType)
+    {
+        uint16_t count = 0;
+
+        for (const Host &host : aServer.GetHosts())
+        {
+            for (const Service &service : host.GetServices())
+            {
+                count += (!service.IsDeleted() && !host.IsDeleted() && service.MatchesServiceName(aServiceType));
+            }
+        }
+
+        return count;
+    }
+
+    // Walks the services of a type as the DNS-SD server answers a PTR query.
+
+    static uint16_t CountServicesOfType(const Server &aServer, const char *aServiceType)
+    {
+        uint32_t hash  = Server::ServiceTypeTable::HashName(aServiceType);
+        uint16_t count = 0;
+
+        for (const Service *service = aServer.mServiceTypeTable.GetHead(hash); service != nullptr;
+             service                = Server::ServiceTypeTable::GetNext(*service))
+        {
+            count += (!service->IsDeleted() && !service->GetHost().IsDeleted() &&
+                      service->MatchesServiceName(aServiceType));
+        }
+
+        return count;
+    }
+
+    static void CheckTables(const Server &aServer);
+    static void CheckLookups(const Server &aServer);
+    static void RunUpdate(Instance &aInstance, Server &aServer, uint32_t &aNumConflicts);
+};
+
+void UnitTester::CheckTables(const Server &aServer)
+{
+    // Each registered host is in the host table, and each of its services in both service tables, in the bucket of
+    // the hash of its name. The tables hold nothing else.
+
+    uint16_t numHosts    = 0;
+    uint16_t numServices = 0;
+    uint16_t numEntries  = 0;
+
+    for (const Host &host : aServer.GetHosts())
+    {
+        bool found = false;
+
+        for (const Host *entry = aServer.mHostTable.GetHead(Server::HostTable::HashName(host.GetFullName()));
+             entry != nullptr; entry = Server::HostTable::GetNext(*entry))
+        {
+            found |= (entry == &host);
+        }
+
+        VerifyOrQuit(found, "host is not in the host table");
+        numHosts++;
+
+        for (const Service &service : host.GetServices())
+        {
+            bool inInstanceTable = false;
+            bool inTypeTable     = false;
+
+            VerifyOrQuit(&service.GetHost() == &host, "service is not linked to its host");
+
+            for (const Service *entry = aServer.mServiceInstanceTable.GetHead(
+                     Server::ServiceInstanceTable::HashName(service.GetInstanceName()));
+                 entry != nullptr; entry = Server::ServiceInstanceTable::GetNext(*entry))
+            {
+                inInstanceTable |= (entry == &service);
+            }
+
+            for (const Service *entry =
+                     aServer.mServiceTypeTable.GetHead(Server::ServiceTypeTable::HashName(service.GetServiceName()));
+                 entry != nullptr; entry = Server::ServiceTypeTable::GetNext(*entry))
+            {
+                inTypeTable |= (entry == &service);
+            }
+
+            VerifyOrQuit(inInstanceTable, "service is not in the instance table");
+            VerifyOrQuit(inTypeTable, "service is not in the type table");
+            numServices++;
+        }
+    }
+
+    for (uint16_t bucket = 0; bucket < kNumTableBuckets; bucket++)
+    {
+        for (const Host *entry = aServer.mHostTable.GetHead(bucket); entry != nullptr;
+             entry             = Server::HostTable::GetNext(*entry))
+        {
+            numEntries++;
+        }
+    }
+
+    VerifyOrQuit(numEntries == numHosts, "host table has other entries");
+    numEntries = 0;
+
+    for (uint16_t bucket = 0; bucket < kNumTableBuckets; bucket++)
+    {
+        for (const Service *entry = aServer.mServiceInstanceTable.GetHead(bucket); entry != nullptr;
+             entry                = Server::ServiceInstanceTable::GetNext(*entry))
+        {
+            numEntries++;
+        }
+
+        for (const Service *entry = aServer.mServiceTypeTable.GetHead(bucket); entry != nullptr;
+             entry                = Server::ServiceTypeTable::GetNext(*entry))
+        {
+            numEntries++;
+        }
+    }
+
+    VerifyOrQuit(numEntries == 2 * numServices, "service tables have other entries");
+}
+
+void UnitTester::CheckLookups(const Server &aServer)
+{
+    // Lookups of random known and unknown names, in random case, as the DNS-SD server resolves AAAA, SRV and PTR
+    // queries.
+
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        Name           name;
+        const Service *service;
+        const Service *linearService;
+
+        GetHostName(name, TestRandom() % (kNumHostNames + 4));
+        RandomizeCase(name);
+        VerifyOrQuit(aServer.FindHost(name) == FindHostLinear(aServer, name), "FindHost() differs");
+
+        GetInstanceName(name, TestRandom() % (kNumInstanceNames + 4));
+        RandomizeCase(name);
+        service       = aServer.FindService(name);
+        linearService = FindServiceLinear(aServer, name);
+
+        // Hosts sharing a key may register the same instance name, either of their services may be found.
+
+        VerifyOrQuit((service == nullptr) == (linearService == nullptr), "FindService() differs");
+        VerifyOrQuit((service == nullptr) || (service->MatchesInstanceName(name) && !service->IsDeleted() &&
+                                              !service->GetHost().IsDeleted()),
+                     "FindService() found another service");
+
+        GetServiceType(name, TestRandom() % (kNumServiceTypes + 1));
+        RandomizeCase(name);
+        VerifyOrQuit(CountServicesOfType(aServer, name) == CountServicesOfTypeLinear(aServer, name),
+                     "services of a type differ");
+    }
+}
+
+void UnitTester::RunUpdate(Instance &aInstance, Server &aServer, uint32_t &aNumConflicts)
+{
+    // An update of a random host, with the key of the host or another key, registering, refreshing or removing
+    // services whose instance names are shared with other hosts, or removing the host.
+
+    uint16_t hostId   = TestRandom() % kNumHostNames;
+    uint8_t  keyId    = (TestRandom() % 16 == 0) ? TestRandom() % kNumKeys : hostId % kNumKeys;
+    Host    *host     = NewHost(aInstance, hostId, keyId);
+    uint32_t lease    = 30 + TestRandom() % 300;
+    uint32_t keyLease = lease + TestRandom() % 600;
+    bool     isDeleted;
+    bool     hasConflicts;
+
+    switch (TestRandom() % 16)
+    {
+    case 0:
+        lease = 0;
+        break;
+
+    case 1:
+        if (FindHostLinear(aServer, host->GetFullName()) != nullptr)
+        {
+            lease    = 0;
+            keyLease = 0;
+        }
+
+        break;
+
+    default:
+        break;
+    }
+
+    isDeleted = (lease == 0);
+
+    for (uint8_t i = TestRandom() % 4; i > 0; i--)
+    {
+        AddService(*host, TestRandom() % kNumInstanceNames, isDeleted || (TestRandom() % 8 == 0));
+    }
+
+    hasConflicts = aServer.HasNameConflictsWith(*host);
+    VerifyOrQuit(hasConflicts == HasNameConflictsLinear(aServer, *host), "HasNameConflictsWith() differs");
+
+    if (hasConflicts)
+    {
+        aNumConflicts++;
+        host->Free();
+    }
+    else
+    {
+        Commit(aServer, *host, lease, keyLease);
+    }
+}
+
+void UnitTester::TestNameTables(Instance &aInstance)
+{
+    // Random SRP updates and removals of hosts and services, with conflicting names, and lease and key lease
+    // expirations. After each step the tables are checked against the hosts, and the lookups against the scans.
+
+    static constexpr uint32_t kIterations = 50000;
+
+    Server  &server       = aInstance.Get<Server>();
+    uint32_t numConflicts = 0;
+    uint32_t maxHosts     = 0;
+
+    StartServer(server);
+
+    for (uint32_t iteration = 0; iteration < kIterations; iteration++)
+    {
+        uint32_t numHosts = 0;
+
+        if (TestRandom() % 8 == 0)
+        {
+            otSimRun((TestRandom() % 60000) * 1000ULL);
+        }
+        else
+        {
+            RunUpdate(aInstance, server, numConflicts);
+        }
+
+        for (const Host &host : server.GetHosts())
+        {
+            OT_UNUSED_VARIABLE(host);
+            numHosts++;
+        }
+
+        maxHosts = Max(maxHosts, numHosts);
+        CheckTables(server);
+        CheckLookups(server);
+    }
+
+    VerifyOrQuit(numConflicts > kIterations / 100, "too few name conflicts");
+    VerifyOrQuit(maxHosts > kNumHostNames / 2, "too few hosts");
+
+    // The key leases expire: every host and service is removed.
+
+    otSimRun(10000 * 1000 * 1000ULL);
+    VerifyOrQuit(server.GetHosts().IsEmpty(), "hosts remain after the key leases");
+    CheckTables(server);
+    StopServer(server);
+
+    printf("TestNameTables passed, %lu conflicts, up to %lu hosts\n", static_cast<unsigned long>(numConflicts),
+           static_cast<unsigned long>(maxHosts));
+}
+
+void UnitTester::BenchmarkLookups(Instance &aInstance)
+{
+    // The lookups of a DNS-SD query of each kind (AAAA, SRV, PTR) and the conflict check of a lease refresh, with
+    // each host registering two services, against the scans they replaced.
+
+    static const uint16_t kNumHostsList[] = {64, 256, 1024};
+
+    static constexpr uint32_t kCount = 10000;
+
+    Server &server = aInstance.Get<Server>();
+
+    StartServer(server);
+
+    for (uint16_t numHosts : kNumHostsList)
+    {
+        uint32_t found = 0;
+        double   referenceNs;
+        char     benchmarkName[64];
+        Host    *refresh;
+
+        for (uint16_t hostId = 0; hostId < numHosts; hostId++)
+        {
+            Host *host = NewHost(aInstance, hostId, static_cast<uint8_t>(hostId));
+
+            AddService(*host, 2 * hostId, false);
+            AddService(*host, 2 * hostId + 1, false);
+            Commit(server, *host, 7200, 7200);
+        }
+
+        {
+            BenchmarkTimer timer;
+
+            for (uint32_t i = 0; i < kCount; i++)
+            {
+                Name name;
+
+                GetHostName(name, i % numHosts);
+                found += (FindHostLinear(server, name) != nullptr);
+                GetInstanceName(name, (7 * i) % (2 * numHosts));
+                found += (FindServiceLinear(server, name) != nullptr);
+                GetServiceType(name, i % kNumServiceTypes);
+                found += CountServicesOfTypeLinear(server, name);
+            }
+
+            referenceNs = timer.GetNsPerOp(kCount);
+        }
+
+        {
+            BenchmarkTimer timer;
+
+            for (uint32_t i = 0; i < kCount; i++)
+            {
+                Name name;
+
+                GetHostName(name, i % numHosts);
+                found -= (server.FindHost(name) != nullptr);
+                GetInstanceName(name, (7 * i) % (2 * numHosts));
+                found -= (server.FindService(name) != nullptr);
+                GetServiceType(name, i % kNumServiceTypes);
+                found -= CountServicesOfType(server, name);
+            }
+
+            snprintf(benchmarkName, sizeof(benchmarkName), "srp_server_dnssd_lookups_%u", numHosts);
+            PrintBenchmark(benchmarkName, kCount, referenceNs, timer.GetNsPerOp(kCount));
+        }
+
+        VerifyOrQuit(found == 0, "lookups differ");
+
+        refresh = NewHost(aInstance, numHosts / 2, static_cast<uint8_t>(numHosts / 2));
+        AddService(*refresh, numHosts, false);
+        AddService(*refresh, numHosts + 1, false);
+
+        {
+            BenchmarkTimer timer;
+
+            for (uint32_t i = 0; i < kCount; i++)
+            {
+                found += HasNameConflictsLinear(server, *refresh);
+            }
+
+            referenceNs = timer.GetNsPerOp(kCount);
+        }
+
+        {
+            BenchmarkTimer timer;
+
+            for (uint32_t i = 0; i < kCount; i++)
+            {
+                found += server.HasNameConflictsWith(*refresh);
+            }
+
+            snprintf(benchmarkName, sizeof(benchmarkName), "srp_server_conflict_check_%u", numHosts);
+            PrintBenchmark(benchmarkName, kCount, referenceNs, timer.GetNsPerOp(kCount));
+        }
+
+        VerifyOrQuit(found == 0, "a refresh conflicts");
+        refresh->Free();
+
+        for (uint16_t hostId = 0; hostId < numHosts; hostId++)
+        {
+            Host *host = NewHost(aInstance, hostId, static_cast<uint8_t>(hostId));
+
+            Commit(server, *host, 0, 0);
+        }
+
+        VerifyOrQuit(server.GetHosts().IsEmpty(), "hosts remain after their removal");
+    }
+
+    StopServer(server);
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::Instance *instance = testInitInstance();
+
+    ot::UnitTester::TestNameTables(*instance);
+    ot::UnitTester::BenchmarkLookups(*instance);
+
+    testFreeInstance(instance);
+
+    printf("All tests passed\n");
+
+    return 0;
+}
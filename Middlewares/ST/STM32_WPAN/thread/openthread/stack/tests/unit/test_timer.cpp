@@ -0,0 +1,426 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdlib.h>
+
+#include "common/new.hpp"
+#include "common/timer.hpp"
+#include "instance/instance.hpp"
+
+#include "simulation.h"
+#include "test_platform.h"
+#include "test_util.hpp"
+
+extern "C" {
+#include "platform-simulation.h"
+}
+
+namespace ot {
+
+static constexpr uint16_t kNumTimers = 64;
+static constexpr uint64_t kUsPerMs   = 1000;
+
+/**
+ * The expected state of a timer: the timers fire in the order of their fire times, and the ones with the same fire
+ * time in the order they were started.
+ *
+ */
+struct TimerModel
+{
+    bool     mRunning;
+    uint32_t mFireTime;
+    uint32_t mSequence;
+};
+
+/**
+ * Stops all the timers of an instance, which `TimerMilli` only lets the instance do.
+ *
+ */
+class TimerStopper : public TimerMilli
+{
+public:
+    static void StopAll(Instance &aInstance) { RemoveAll(aInstance); }
+};
+
+static TimerMilliContext *sTimers[kNumTimers];
+static TimerModel         sModels[kNumTimers];
+static uint32_t           sSequence;
+static uint32_t           sNumFired;
+static bool               sRestartFromHandler;
+
+static TimerModel *GetEarliestModel(void)
+{
+    TimerModel *earliest = nullptr;
+
+    for (TimerModel &model : sModels)
+    {
+        if (model.mRunning && ((earliest == nullptr) || (model.mFireTime < earliest->mFireTime) ||
+                               ((model.mFireTime == earliest->mFireTime) && (model.mSequence < earliest->mSequence))))
+        {
+            earliest = &model;
+        }
+    }
+
+    return earliest;
+}
+
+static void SetModelFireTime(uint16_t aIndex, uint32_t aFireTime)
+{
+    sModels[aIndex].mRunning  = true;
+    sModels[aIndex].mFireTime = aFireTime;
+    sModels[aIndex].mSequence = ++sSequence;
+}
+
+static void StartTimer(uint16_t aIndex, uint32_t aDelay)
+{
+    sTimers[aIndex]->Start(aDelay);
+    SetModelFireTime(aIndex, TimerMilli::GetNow().GetValue() + aDelay);
+}
+
+static void StopTimer(uint16_t aIndex)
+{
+    sTimers[aIndex]->Stop();
+    sModels[aIndex].mRunning = false;
+}
+
+static void HandleTimer(Timer &aTimer)
+{
+    TimerMilliContext &timer = static_cast<TimerMilliContext &>(aTimer);
+    TimerModel        &model = *static_cast<TimerModel *>(timer.GetContext());
+
+    VerifyOrQuit(&model == GetEarliestModel(), "a timer fired out of order");
+    VerifyOrQuit(model.mFireTime <= TimerMilli::GetNow().GetValue(), "a timer fired early");
+
+    model.mRunning = false;
+    sNumFired++;
+
+    // The handlers also restart and stop timers, as the core does.
+
+    if (sRestartFromHandler)
+    {
+        switch (TestRandom() % 4)
+        {
+        case 0:
+            StartTimer(static_cast<uint16_t>(&model - sModels), TestRandom() % 50);
+            break;
+        case 1:
+            StopTimer(TestRandom() % kNumTimers);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+/**
+ * Verifies that the platform alarm is set for the earliest running timer.
+ *
+ */
+static void CheckAlarm(Instance &aInstance)
+{
+    simNode    *node     = simNodeFromInstance(&aInstance);
+    TimerModel *earliest = GetEarliestModel();
+    uint64_t    fireTime;
+
+    if (earliest == nullptr)
+    {
+        VerifyOrQuit(!node->mAlarmArmed, "the alarm is armed without a running timer");
+        ExitNow();
+    }
+
+    VerifyOrQuit(node->mAlarmArmed, "the alarm is not armed");
+
+    fireTime = earliest->mFireTime * kUsPerMs;
+    VerifyOrQuit(node->mAlarmFireTime == ((fireTime > otSimGetNow()) ? fireTime : otSimGetNow()),
+                 "the alarm is not set for the earliest timer");
+
+exit:
+    return;
+}
+
+static void InitTimers(Instance &aInstance)
+{
+    // The timers of the core modules are stopped, so that the alarm is only set by the timers of the test.
+
+    TimerStopper::StopAll(aInstance);
+
+    for (uint16_t i = 0; i < kNumTimers; i++)
+    {
+        sTimers[i]          = new TimerMilliContext(aInstance, HandleTimer, &sModels[i]);
+        sModels[i].mRunning = false;
+    }
+}
+
+static void FreeTimers(void)
+{
+    for (TimerMilliContext *&timer : sTimers)
+    {
+        timer->Stop();
+        delete timer;
+        timer = nullptr;
+    }
+}
+
+static void TestAlarmOnStop(Instance &aInstance)
+{
+    // Stopping the timer the alarm is set for re-programs the alarm for the next timer, stopping a later timer or a
+    // timer with the same fire time leaves it, and stopping the last timer stops it.
+
+    uint32_t now;
+
+    InitTimers(aInstance);
+    now = TimerMilli::GetNow().GetValue();
+
+    StartTimer(0, 10);
+    StartTimer(1, 10);
+    StartTimer(2, 100);
+    StartTimer(3, 1000);
+    CheckAlarm(aInstance);
+    VerifyOrQuit(simNodeFromInstance(&aInstance)->mAlarmFireTime == (now + 10) * kUsPerMs, "the alarm is not set");
+
+    StopTimer(3);
+    CheckAlarm(aInstance);
+
+    StopTimer(0);
+    CheckAlarm(aInstance);
+
+    StopTimer(1);
+    CheckAlarm(aInstance);
+    VerifyOrQuit(simNodeFromInstance(&aInstance)->mAlarmFireTime == (now + 100) * kUsPerMs,
+                 "the alarm is not re-programmed for the next timer");
+
+    StopTimer(2);
+    CheckAlarm(aInstance);
+
+    FreeTimers();
+
+    printf("TestAlarmOnStop passed\n");
+}
+
+static void TestTimerOrder(Instance &aInstance)
+{
+    // Random timer operations, with fire times in the past, ties, and long delays that go through the upper levels of
+    // the timing wheel, while the simulated time advances.
+
+    static constexpr uint32_t kIterations = 200000;
+
+    // The model compares the fire times without the wrap of the 32-bit time, they stay away from 0.
+    otSimRun(1000 * kUsPerMs);
+
+    InitTimers(aInstance);
+    sRestartFromHandler = true;
+
+    for (uint32_t iteration = 0; iteration < kIterations; iteration++)
+    {
+        uint16_t index = TestRandom() % kNumTimers;
+        uint32_t now   = TimerMilli::GetNow().GetValue();
+        uint32_t delay;
+
+        switch (TestRandom() % 16)
+        {
+        case 0:
+            delay = TestRandom() % (1U << 20);
+            StartTimer(index, delay);
+            break;
+
+        case 1:
+        case 2:
+            // In the past.
+            delay = TestRandom() % 20;
+            sTimers[index]->StartAt(TimeMilli(now - delay), delay / 2);
+            SetModelFireTime(index, now - delay + delay / 2);
+            break;
+
+        case 3:
+        case 4:
+            delay = TestRandom() % 200;
+
+            if (!sModels[index].mRunning || (sModels[index].mFireTime > now + delay))
+            {
+                SetModelFireTime(index, now + delay);
+            }
+
+            sTimers[index]->FireAtIfEarlier(TimeMilli(now + delay));
+            break;
+
+        case 5:
+        case 6:
+        case 7:
+            StopTimer(index);
+            break;
+
+        case 8:
+        case 9:
+            otSimRun((TestRandom() % 300) * kUsPerMs + TestRandom() % kUsPerMs);
+            break;
+
+        default:
+            StartTimer(index, TestRandom() % 200);
+            break;
+        }
+
+        CheckAlarm(aInstance);
+    }
+
+    sRestartFromHandler = false;
+    FreeTimers();
+
+    printf("TestTimerOrder passed, %lu timers fired\n", static_cast<unsigned long>(sNumFired));
+}
+
+/**
+ * The timer list as the scheduler kept it before the timing wheel: sorted by fire time, a restarted timer is removed
+ * then inserted after the timers with the same or an earlier fire time.
+ *
+ */
+class ReferenceTimerList
+{
+public:
+    struct Entry
+    {
+        uint32_t mFireTime;
+        Entry   *mNext;
+    };
+
+    ReferenceTimerList(void)
+        : mHead(nullptr)
+    {
+    }
+
+    void Restart(Entry &aEntry, uint32_t aFireTime)
+    {
+        Entry *prev = nullptr;
+
+        for (Entry **link = &mHead; *link != nullptr; link = &(*link)->mNext)
+        {
+            if (*link == &aEntry)
+            {
+                *link = aEntry.mNext;
+                break;
+            }
+        }
+
+        aEntry.mFireTime = aFireTime;
+
+        for (Entry *cur = mHead; (cur != nullptr) && (cur->mFireTime <= aFireTime); cur = cur->mNext)
+        {
+            prev = cur;
+        }
+
+        if (prev == nullptr)
+        {
+            aEntry.mNext = mHead;
+            mHead        = &aEntry;
+        }
+        else
+        {
+            aEntry.mNext = prev->mNext;
+            prev->mNext  = &aEntry;
+        }
+    }
+
+private:
+    Entry *mHead;
+};
+
+static void BenchmarkTimers(Instance &aInstance)
+{
+    static constexpr uint32_t kRestarts = 100000;
+
+    TimerStopper::StopAll(aInstance);
+
+    for (uint16_t numTimers = 64; numTimers <= 4096; numTimers *= 4)
+    {
+        TimerMilliContext         *timers = static_cast<TimerMilliContext *>(malloc(numTimers * sizeof(*timers)));
+        ReferenceTimerList::Entry *entries =
+            static_cast<ReferenceTimerList::Entry *>(calloc(numTimers, sizeof(*entries)));
+        ReferenceTimerList reference;
+        double             referenceNs;
+        double             ns;
+        char               name[40];
+
+        for (uint16_t i = 0; i < numTimers; i++)
+        {
+            uint32_t delay = 1 + TestRandom() % 100000;
+
+            new (&timers[i]) TimerMilliContext(aInstance, HandleTimer, nullptr);
+            timers[i].Start(delay);
+            reference.Restart(entries[i], delay);
+        }
+
+        {
+            BenchmarkTimer timer;
+
+            for (uint32_t i = 0; i < kRestarts; i++)
+            {
+                reference.Restart(entries[i % numTimers], 1 + (i * 7919) % 100000);
+            }
+
+            referenceNs = timer.GetNsPerOp(kRestarts);
+        }
+
+        {
+            BenchmarkTimer timer;
+
+            for (uint32_t i = 0; i < kRestarts; i++)
+            {
+                timers[i % numTimers].Start(1 + (i * 7919) % 100000);
+            }
+
+            ns = timer.GetNsPerOp(kRestarts);
+        }
+
+        snprintf(name, sizeof(name), "timer_restart_%u", numTimers);
+        PrintBenchmark(name, kRestarts, referenceNs, ns);
+
+        for (uint16_t i = 0; i < numTimers; i++)
+        {
+            timers[i].Stop();
+        }
+
+        free(timers);
+        free(entries);
+    }
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::Instance *instance = testInitInstance();
+
+    ot::TestAlarmOnStop(*instance);
+    ot::TestTimerOrder(*instance);
+    ot::BenchmarkTimers(*instance);
+
+    testFreeInstance(instance);
+
+    printf("All tests passed\n");
+
+    return 0;
+}
@@ -0,0 +1,173 @@
+/*
+ *  Copyright (c) 2024, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the definitions shared by the unit tests of the OpenThread core.
+ *
+ */
+
+#ifndef TEST_UTIL_HPP_
+#define TEST_UTIL_HPP_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "common/error.hpp"
+
+/**
+ * Exits the test with a failure when a condition is false.
+ *
+ * @param[in] aCondition  The condition to verify.
+ * @param[in] aMessage    The message printed on failure.
+ *
+ */
+#define VerifyOrQuit(aCondition, aMessage)                                                            \
+    do                                                                                                \
+    {                                                                                                 \
+        if (!(aCondition))                                                                            \
+        {                                                                                             \
+            fprintf(stderr, "FAILED %s:%d - %s (%s)\n", __FILE__, __LINE__, (aMessage), #aCondition); \
+            exit(EXIT_FAILURE);                                                                       \
+        }                                                                                             \
+    } while (false)
+
+/**
+ * Exits the test with a failure when an error is not `kErrorNone`.
+ *
+ * @param[in] aError    The error to verify.
+ * @param[in] aMessage  The message printed on failure.
+ *
+ */
+#define SuccessOrQuit(aError, aMessage)                                                                             \
+    do                                                                                                              \
+    {                                                                                                               \
+        ot::Error error_ = (aError);                                                                                \
+                                                                                                                    \
+        if (error_ != ot::kErrorNone)                                                                               \
+        {                                                                                                           \
+            fprintf(stderr, "FAILED %s:%d - %s (%s)\n", __FILE__, __LINE__, (aMessage), ot::ErrorToString(error_)); \
+            exit(EXIT_FAILURE);                                                                                     \
+        }                                                                                                           \
+    } while (false)
+
+namespace ot {
+
+/**
+ * Returns the next value of a pseudo-random sequence, so that the random inputs of a test are the same on each run.
+ *
+ * @returns The next 32-bit value.
+ *
+ */
+inline uint32_t TestRandom(void)
+{
+    static uint32_t sState = 0x2545f491;
+
+    sState ^= sState << 13;
+    sState ^= sState >> 17;
+    sState ^= sState << 5;
+
+    return sState;
+}
+
+/**
+ * Returns a pseudo-random byte, 0x00 and 0xff being more frequent to exercise the carries and the escapes.
+ *
+ * @returns The byte.
+ *
+ */
+inline uint8_t TestRandomByte(void)
+{
+    uint32_t value = TestRandom();
+
+    switch (value % 8)
+    {
+    case 0:
+        return 0x00;
+    case 1:
+        return 0xff;
+    default:
+        return static_cast<uint8_t>(value >> 8);
+    }
+}
+
+/**
+ * Measures the host time of a benchmark loop.
+ *
+ */
+class BenchmarkTimer
+{
+public:
+    /**
+     * Initializes the timer and starts it.
+     *
+     */
+    BenchmarkTimer(void) { clock_gettime(CLOCK_MONOTONIC, &mStart); }
+
+    /**
+     * Returns the time since the timer started, divided by a number of operations.
+     *
+     * @param[in] aCount  The number of operations.
+     *
+     * @returns The time per operation in nanoseconds.
+     *
+     */
+    double GetNsPerOp(uint32_t aCount) const
+    {
+        struct timespec now;
+
+        clock_gettime(CLOCK_MONOTONIC, &now);
+
+        return ((now.tv_sec - mStart.tv_sec) * 1e9 + (now.tv_nsec - mStart.tv_nsec)) / aCount;
+    }
+
+private:
+    struct timespec mStart;
+};
+
+/**
+ * Prints the result of a microbenchmark as a CSV line.
+ *
+ * The reference is the implementation the optimized code replaced, as modeled by the test.
+ *
+ * @param[in] aName         The name of the measurement.
+ * @param[in] aCount        The number of operations measured.
+ * @param[in] aReferenceNs  The time per operation of the reference, in nanoseconds.
+ * @param[in] aNs           The time per operation of the core, in nanoseconds.
+ *
+ */
+inline void PrintBenchmark(const char *aName, uint32_t aCount, double aReferenceNs, double aNs)
+{
+    printf("benchmark,%s,%lu,%.1f,%.1f\n", aName, static_cast<unsigned long>(aCount), aReferenceNs, aNs);
+}
+
+} // namespace ot
+
+#endif // TEST_UTIL_HPP_
@@ -623,6 +623,9 @@ typedef struct TX_THREAD_STRUCT
 #if (defined(TX_EXECUTION_PROFILE_ENABLE) && !defined(TX_ENABLE_EXECUTION_CHANGE_NOTIFY))
     EXECUTION_TIME              tx_thread_execution_time_total;
     EXECUTION_TIME_SOURCE_TYPE  tx_thread_execution_time_last_start;
+#ifdef TX_EXECUTION_PROFILE_HISTOGRAM
+    ULONG                       tx_thread_execution_slice_histogram[TX_EXECUTION_HISTOGRAM_BINS];
+#endif
 #endif
 
     /* Define suspension sequence number.  This is used to ensure suspension is still valid when
@@ -199,3 +199,10 @@ tx_trace_object_unregister.c \
 tx_trace_user_event_insert.c \
 
 GENERIC_OBJS = $(GENERIC_SRCS:%.c=.tmp/generic/%.o)
+
+
+EPK_SRCS = \
+tx_execution_profile.c \
+tx_execution_profile_export.c \
+
+EPK_OBJS = $(EPK_SRCS:%.c=.tmp/epk/%.o)
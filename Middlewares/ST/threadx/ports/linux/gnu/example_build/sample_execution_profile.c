@@ -0,0 +1,178 @@
+/* This is a small demo of the execution profile kit on the Linux port.  Three threads with
+   different loads run for a few seconds, then the profile is exported as CSV and as JSON.
+   Build with "make EXECUTION_PROFILE=1 sample_execution_profile".  */
+
+#include   "tx_api.h"
+#include   "tx_execution_profile_export.h"
+#include   <stdio.h>
+#include   <stdlib.h>
+
+#define     DEMO_STACK_SIZE         4096
+#define     DEMO_BYTE_POOL_SIZE     (4 * DEMO_STACK_SIZE + 1024)
+#define     DEMO_PROFILE_TICKS      (5 * TX_TIMER_TICKS_PER_SECOND)
+
+
+/* Define the ThreadX object control blocks...  */
+
+TX_THREAD               report_thread;
+TX_THREAD               busy_thread;
+TX_THREAD               producer_thread;
+TX_THREAD               consumer_thread;
+TX_QUEUE                queue_0;
+TX_BYTE_POOL            byte_pool_0;
+ULONG                   queue_0_storage[16];
+
+
+/* Define the counters used in the demo application...  */
+
+volatile ULONG  busy_thread_counter;
+ULONG           messages_received;
+
+
+/* Define thread prototypes.  */
+
+void    report_thread_entry(ULONG thread_input);
+void    busy_thread_entry(ULONG thread_input);
+void    producer_thread_entry(ULONG thread_input);
+void    consumer_thread_entry(ULONG thread_input);
+
+
+/* Define main entry point.  */
+
+int main()
+{
+
+    /* Enter the ThreadX kernel.  */
+    tx_kernel_enter();
+}
+
+
+/* Define what the initial system looks like.  */
+
+void    tx_application_define(void *first_unused_memory)
+{
+
+CHAR    *pointer = TX_NULL;
+
+    /* Create a byte memory pool from which to allocate the thread stacks.  */
+    tx_byte_pool_create(&byte_pool_0, "byte pool 0", first_unused_memory, DEMO_BYTE_POOL_SIZE);
+
+    /* Create the reporting thread at the highest priority, so it can interrupt the load.  */
+    tx_byte_allocate(&byte_pool_0, (VOID **) &pointer, DEMO_STACK_SIZE, TX_NO_WAIT);
+    tx_thread_create(&report_thread, "report", report_thread_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            1, 1, TX_NO_TIME_SLICE, TX_AUTO_START);
+
+    /* Create a thread that computes in bursts and then sleeps.  */
+    tx_byte_allocate(&byte_pool_0, (VOID **) &pointer, DEMO_STACK_SIZE, TX_NO_WAIT);
+    tx_thread_create(&busy_thread, "busy", busy_thread_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            10, 10, TX_NO_TIME_SLICE, TX_AUTO_START);
+
+    /* Create a producer and a consumer that pass messages through a queue.  */
+    tx_byte_allocate(&byte_pool_0, (VOID **) &pointer, DEMO_STACK_SIZE, TX_NO_WAIT);
+    tx_thread_create(&producer_thread, "producer", producer_thread_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            16, 16, TX_NO_TIME_SLICE, TX_AUTO_START);
+
+    tx_byte_allocate(&byte_pool_0, (VOID **) &pointer, DEMO_STACK_SIZE, TX_NO_WAIT);
+    tx_thread_create(&consumer_thread, "consumer", consumer_thread_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            15, 15, TX_NO_TIME_SLICE, TX_AUTO_START);
+
+    tx_queue_create(&queue_0, "queue 0", TX_1_ULONG, queue_0_storage, sizeof(queue_0_storage));
+}
+
+
+/* Define the test threads.  */
+
+void    report_thread_entry(ULONG thread_input)
+{
+
+FILE    *file;
+
+
+    (VOID)thread_input;
+
+    /* Let the load run.  */
+    tx_thread_sleep(DEMO_PROFILE_TICKS);
+
+    /* Export the profile in both formats.  */
+    file =  fopen("execution_profile.csv", "w");
+    if (file != NULL)
+    {
+        _tx_execution_profile_export(file, TX_EXECUTION_EXPORT_CSV);
+        fclose(file);
+    }
+
+    file =  fopen("execution_profile.json", "w");
+    if (file != NULL)
+    {
+        _tx_execution_profile_export(file, TX_EXECUTION_EXPORT_JSON);
+        fclose(file);
+    }
+
+    /* Also show the CSV on the console.  */
+    _tx_execution_profile_export(stdout, TX_EXECUTION_EXPORT_CSV);
+
+    exit(0);
+}
+
+
+void    busy_thread_entry(ULONG thread_input)
+{
+
+ULONG   i;
+
+
+    (VOID)thread_input;
+
+    while(1)
+    {
+
+        /* Compute for a while, then sleep.  */
+        for (i = 0; i < 200000; i++)
+        {
+            busy_thread_counter++;
+        }
+        tx_thread_sleep(2);
+    }
+}
+
+
+void    producer_thread_entry(ULONG thread_input)
+{
+
+ULONG   message = 0;
+
+
+    (VOID)thread_input;
+
+    while(1)
+    {
+        tx_queue_send(&queue_0, &message, TX_WAIT_FOREVER);
+        message++;
+
+        /* Give up the processor every so often.  */
+        if ((message % 64) == 0)
+        {
+            tx_thread_sleep(1);
+        }
+    }
+}
+
+
+void    consumer_thread_entry(ULONG thread_input)
+{
+
+ULONG   message;
+
+
+    (VOID)thread_input;
+
+    while(1)
+    {
+        tx_queue_receive(&queue_0, &message, TX_WAIT_FOREVER);
+        messages_received++;
+    }
+}
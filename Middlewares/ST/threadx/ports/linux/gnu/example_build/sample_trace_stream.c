@@ -0,0 +1,186 @@
+/* This is a small demo of the trace stream on the Linux port.  A producer and a consumer pass
+   messages through a queue while a busy thread computes in bursts.  The trace buffer is much
+   smaller than the trace, so it wraps many times, and the trace stream writes all events to
+   trace_stream.bin.  Build, run and convert the trace to Chrome/Perfetto JSON with:
+
+     make ARCH64=1 sample_trace_stream tx_trace_convert
+     ./sample_trace_stream
+     ./tx_trace_convert trace_stream.bin trace_stream.json
+
+   Then open trace_stream.json in ui.perfetto.dev or chrome://tracing.  */
+
+#include   "tx_api.h"
+#include   "tx_trace_stream.h"
+#include   <stdio.h>
+#include   <stdlib.h>
+
+#define     DEMO_STACK_SIZE         4096
+#define     DEMO_BYTE_POOL_SIZE     (5 * DEMO_STACK_SIZE + 1024)
+#define     DEMO_TRACE_BUFFER_SIZE  16384
+#define     DEMO_TRACE_REGISTRY     16
+#define     DEMO_TRACE_TICKS        (2 * TX_TIMER_TICKS_PER_SECOND)
+
+
+/* Define the ThreadX object control blocks...  */
+
+TX_THREAD               report_thread;
+TX_THREAD               busy_thread;
+TX_THREAD               producer_thread;
+TX_THREAD               consumer_thread;
+TX_QUEUE                queue_0;
+TX_BYTE_POOL            byte_pool_0;
+ULONG                   queue_0_storage[16];
+UCHAR                   trace_buffer[DEMO_TRACE_BUFFER_SIZE];
+FILE                    *trace_file;
+
+
+/* Define the counters used in the demo application...  */
+
+volatile ULONG  busy_thread_counter;
+ULONG           messages_received;
+
+
+/* Define thread prototypes.  */
+
+void    report_thread_entry(ULONG thread_input);
+void    busy_thread_entry(ULONG thread_input);
+void    producer_thread_entry(ULONG thread_input);
+void    consumer_thread_entry(ULONG thread_input);
+
+
+/* Define main entry point.  */
+
+int main()
+{
+
+    /* Enter the ThreadX kernel.  */
+    tx_kernel_enter();
+}
+
+
+/* Define what the initial system looks like.  */
+
+void    tx_application_define(void *first_unused_memory)
+{
+
+CHAR    *pointer = TX_NULL;
+
+    /* Create a byte memory pool from which to allocate the thread stacks.  */
+    tx_byte_pool_create(&byte_pool_0, "byte pool 0", first_unused_memory, DEMO_BYTE_POOL_SIZE);
+
+    /* Create the reporting thread at the highest priority.  */
+    tx_byte_allocate(&byte_pool_0, (VOID **) &pointer, DEMO_STACK_SIZE, TX_NO_WAIT);
+    tx_thread_create(&report_thread, "report", report_thread_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            1, 1, TX_NO_TIME_SLICE, TX_AUTO_START);
+
+    /* Create a thread that computes in bursts and then sleeps.  */
+    tx_byte_allocate(&byte_pool_0, (VOID **) &pointer, DEMO_STACK_SIZE, TX_NO_WAIT);
+    tx_thread_create(&busy_thread, "busy", busy_thread_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            10, 10, TX_NO_TIME_SLICE, TX_AUTO_START);
+
+    /* Create a producer and a consumer that pass messages through a queue.  */
+    tx_byte_allocate(&byte_pool_0, (VOID **) &pointer, DEMO_STACK_SIZE, TX_NO_WAIT);
+    tx_thread_create(&producer_thread, "producer", producer_thread_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            16, 16, TX_NO_TIME_SLICE, TX_AUTO_START);
+
+    tx_byte_allocate(&byte_pool_0, (VOID **) &pointer, DEMO_STACK_SIZE, TX_NO_WAIT);
+    tx_thread_create(&consumer_thread, "consumer", consumer_thread_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            15, 15, TX_NO_TIME_SLICE, TX_AUTO_START);
+
+    tx_queue_create(&queue_0, "queue 0", TX_1_ULONG, queue_0_storage, sizeof(queue_0_storage));
+
+    /* Start the trace stream, with a drain thread that writes the new events every 10 ticks.  */
+    trace_file =  fopen("trace_stream.bin", "wb");
+    if (trace_file == NULL)
+    {
+        printf("Cannot create trace_stream.bin\n");
+        exit(1);
+    }
+    tx_byte_allocate(&byte_pool_0, (VOID **) &pointer, DEMO_STACK_SIZE, TX_NO_WAIT);
+    _tx_trace_stream_start(trace_file, trace_buffer, sizeof(trace_buffer), DEMO_TRACE_REGISTRY,
+                           pointer, DEMO_STACK_SIZE, 2, 10);
+}
+
+
+/* Define the test threads.  */
+
+void    report_thread_entry(ULONG thread_input)
+{
+
+    (VOID)thread_input;
+
+    /* Let the load run.  */
+    tx_thread_sleep(DEMO_TRACE_TICKS);
+
+    /* Write the remaining events and close the trace.  */
+    _tx_trace_stream_stop();
+    fclose(trace_file);
+
+    printf("%lu events written to trace_stream.bin, %lu messages received\n",
+           (unsigned long) _tx_trace_stream_events_written(), (unsigned long) messages_received);
+
+    exit(0);
+}
+
+
+void    busy_thread_entry(ULONG thread_input)
+{
+
+ULONG   i;
+
+
+    (VOID)thread_input;
+
+    while(1)
+    {
+
+        /* Compute for a while, then sleep.  */
+        for (i = 0; i < 200000; i++)
+        {
+            busy_thread_counter++;
+        }
+        tx_thread_sleep(2);
+    }
+}
+
+
+void    producer_thread_entry(ULONG thread_input)
+{
+
+ULONG   message = 0;
+
+
+    (VOID)thread_input;
+
+    while(1)
+    {
+        tx_queue_send(&queue_0, &message, TX_WAIT_FOREVER);
+        message++;
+
+        /* Give up the processor every so often.  */
+        if ((message % 64) == 0)
+        {
+            tx_thread_sleep(1);
+        }
+    }
+}
+
+
+void    consumer_thread_entry(ULONG thread_input)
+{
+
+ULONG   message;
+
+
+    (VOID)thread_input;
+
+    while(1)
+    {
+        tx_queue_receive(&queue_0, &message, TX_WAIT_FOREVER);
+        messages_received++;
+    }
+}
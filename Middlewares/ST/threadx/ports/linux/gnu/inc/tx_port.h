@@ -332,9 +332,12 @@ void    _tx_linux_debug_entry_insert(char *action, char *file, unsigned long lin
 
 */
 
+/* The Linux time source is the low 32 bits of the nanosecond count, which wraps about every
+   4.3 seconds rather than every second, so the time between events can be reconstructed.  */
+
 #ifndef TX_MISRA_ENABLE
 #ifndef TX_TRACE_TIME_SOURCE
-#define TX_TRACE_TIME_SOURCE                    ((ULONG) (_tx_linux_time_stamp.tv_nsec));
+#define TX_TRACE_TIME_SOURCE                    ((ULONG) ((((ULONG64) _tx_linux_time_stamp.tv_sec) * 1000000000ULL) + ((ULONG64) _tx_linux_time_stamp.tv_nsec)));
 #endif
 #else
 ULONG   _tx_misra_time_stamp_get(VOID);
@@ -351,6 +354,25 @@ ULONG   _tx_misra_time_stamp_get(VOID);
 #define TX_TRACE_PORT_EXTENSION                 clock_gettime(CLOCK_REALTIME, &_tx_linux_time_stamp);
 
 
+/* Define the time source for the execution profile kit. The Linux port uses a 64-bit count of
+   nanoseconds from the monotonic clock, so all thread, ISR and idle times reported by the kit
+   are in nanoseconds.  */
+
+#ifdef TX_EXECUTION_PROFILE_ENABLE
+ULONG64 _tx_linux_execution_time_source_get(VOID);
+
+#define EXECUTION_TIME_SOURCE_TYPE_DEFINED
+typedef ULONG64                                 EXECUTION_TIME_SOURCE_TYPE;
+
+#ifndef TX_EXECUTION_TIME_SOURCE
+#define TX_EXECUTION_TIME_SOURCE                _tx_linux_execution_time_source_get()
+#endif
+#ifndef TX_EXECUTION_MAX_TIME_SOURCE
+#define TX_EXECUTION_MAX_TIME_SOURCE            0xFFFFFFFFFFFFFFFFULL
+#endif
+#endif
+
+
 /* Define the port specific options for the _tx_build_options variable. This variable indicates
    how the ThreadX library was built.  */
 
@@ -153,6 +153,22 @@ pthread_mutex_t        temp_copy;
 #endif
 
 
+#ifdef TX_EXECUTION_PROFILE_ENABLE
+
+/* Define the execution profile time source. The monotonic clock is used so that
+   profiled times are not disturbed by changes to the system time.  */
+
+ULONG64 _tx_linux_execution_time_source_get(VOID)
+{
+struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return(((ULONG64) ts.tv_sec * 1000000000ULL) + (ULONG64) ts.tv_nsec);
+}
+
+#endif
+
+
 /* Define the ThreadX timer interrupt handler.  */
 
 void    _tx_timer_interrupt(void);
@@ -88,6 +88,12 @@ VOID   _tx_thread_context_restore(VOID)
        the core ThreadX data structures.  */
     tx_linux_mutex_lock(_tx_linux_mutex);
 
+#ifdef TX_EXECUTION_PROFILE_ENABLE
+
+    /* Call the ISR exit function to indicate an ISR is complete.  */
+    _tx_execution_isr_exit();
+#endif
+
     /* Decrement the nested interrupt count.  */
     _tx_thread_system_state--;
 
@@ -101,6 +101,12 @@ VOID   _tx_thread_context_save(VOID)
     /* Increment the nested interrupt condition.  */
     _tx_thread_system_state++;
 
+#ifdef TX_EXECUTION_PROFILE_ENABLE
+
+    /* Call the ISR enter function to indicate an ISR is executing.  */
+    _tx_execution_isr_enter();
+#endif
+
     /* Unlock linux mutex. */
     tx_linux_mutex_unlock(_tx_linux_mutex);
 }
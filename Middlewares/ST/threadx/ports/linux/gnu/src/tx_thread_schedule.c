@@ -143,6 +143,12 @@ struct timespec ts;
         /* Increment the run count for this thread.  */
         _tx_thread_current_ptr -> tx_thread_run_count++;
 
+#ifdef TX_EXECUTION_PROFILE_ENABLE
+
+        /* Call the thread entry function to indicate the thread is executing.  */
+        _tx_execution_thread_enter();
+#endif
+
         /* Setup time-slice, if present.  */
         _tx_timer_time_slice =  _tx_thread_current_ptr -> tx_thread_time_slice;
 
@@ -136,6 +136,12 @@ int         exit_code = 0;
     /* Setup the suspension type for this thread.  */
     temp_thread_ptr -> tx_thread_linux_suspension_type  =  0;
 
+#ifdef TX_EXECUTION_PROFILE_ENABLE
+
+    /* Call the thread exit function to indicate the thread is no longer executing.  */
+    _tx_execution_thread_exit();
+#endif
+
     /* Set the current thread pointer to NULL.  */
     _tx_thread_current_ptr =  TX_NULL;
 
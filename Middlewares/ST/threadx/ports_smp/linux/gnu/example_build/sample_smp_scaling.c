@@ -0,0 +1,213 @@
+/* This is a small benchmark of the ThreadX SMP scheduler on the Linux port.  It measures, for the
+   number of simulated cores the library was built with, how much work a set of equal priority
+   threads gets done and how many scheduling operations the SMP scheduler performs per second.
+
+   Two workloads are measured one after the other:
+
+     compute   - one thread per core that computes in fixed size bursts; with one thread per
+                 core the relinquish after each burst finds nothing else to run, but it gives
+                 the simulator a scheduling point for the timer interrupt
+     relinquish - two threads per core that compute a short burst and then call
+                  tx_thread_relinquish, so every burst goes through the SMP scheduler
+
+   Each workload prints one CSV line, so the results of several core counts can be collected
+   into one table.  Build and run with, for example:
+
+     make clean; make ARCH64=1 CORES=2 sample_smp_scaling; ./sample_smp_scaling
+
+   Each simulated core is a Linux pthread, so the results only scale while there are at least as
+   many host CPUs as simulated cores.  */
+
+#include   "tx_api.h"
+#include   <stdio.h>
+#include   <stdlib.h>
+#include   <time.h>
+
+#define     DEMO_STACK_SIZE             4096
+#define     DEMO_MAX_WORKERS            (2 * TX_THREAD_SMP_MAX_CORES)
+#define     DEMO_BYTE_POOL_SIZE         ((DEMO_MAX_WORKERS + 1) * DEMO_STACK_SIZE + 1024)
+#define     DEMO_MEASURE_TICKS          (2 * TX_TIMER_TICKS_PER_SECOND)
+#define     DEMO_COMPUTE_BURST          100000
+#define     DEMO_RELINQUISH_BURST       1000
+
+
+/* Define the ThreadX object control blocks...  */
+
+TX_THREAD               report_thread;
+TX_THREAD               worker_thread[DEMO_MAX_WORKERS];
+TX_BYTE_POOL            byte_pool_0;
+
+
+/* Define the counters used in the benchmark...  */
+
+volatile ULONG          worker_bursts[DEMO_MAX_WORKERS];
+volatile ULONG          worker_scratch[DEMO_MAX_WORKERS];
+
+
+/* Define thread prototypes.  */
+
+void    report_thread_entry(ULONG thread_input);
+void    compute_thread_entry(ULONG thread_input);
+void    relinquish_thread_entry(ULONG thread_input);
+
+
+/* Define main entry point.  */
+
+int main()
+{
+
+    /* Enter the ThreadX kernel.  */
+    tx_kernel_enter();
+}
+
+
+/* Define what the initial system looks like.  */
+
+void    tx_application_define(void *first_unused_memory)
+{
+
+CHAR    *pointer = TX_NULL;
+
+
+    /* Create a byte memory pool from which to allocate the thread stacks.  */
+    tx_byte_pool_create(&byte_pool_0, "byte pool 0", first_unused_memory, DEMO_BYTE_POOL_SIZE);
+
+    /* Create the reporting thread at the highest priority.  It sleeps while the workers run.  */
+    tx_byte_allocate(&byte_pool_0, (VOID **) &pointer, DEMO_STACK_SIZE, TX_NO_WAIT);
+    tx_thread_create(&report_thread, "report", report_thread_entry, 0,
+            pointer, DEMO_STACK_SIZE,
+            1, 1, TX_NO_TIME_SLICE, TX_AUTO_START);
+}
+
+
+/* Return the host monotonic time in seconds.  */
+
+static double  demo_seconds(void)
+{
+
+struct timespec ts;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return((double) ts.tv_sec + ((double) ts.tv_nsec / 1000000000.0));
+}
+
+
+/* Create and start the workers, let them run for the measurement period, then delete them and
+   print one CSV line.  */
+
+static void    demo_measure(const CHAR *workload, VOID (*entry)(ULONG), UINT workers)
+{
+
+UINT            i;
+ULONG           bursts;
+ULONG           run_count;
+double          start;
+double          seconds;
+CHAR            *pointer;
+
+
+    /* Create the workers, all at the same priority and free to run on any core.  */
+    for (i = 0; i < workers; i++)
+    {
+        worker_bursts[i] =  0;
+        tx_byte_allocate(&byte_pool_0, (VOID **) &pointer, DEMO_STACK_SIZE, TX_NO_WAIT);
+        tx_thread_create(&worker_thread[i], "worker", entry, i,
+                pointer, DEMO_STACK_SIZE,
+                10, 10, TX_NO_TIME_SLICE, TX_DONT_START);
+        tx_thread_smp_core_exclude(&worker_thread[i], 0);
+    }
+
+    /* Start the workers and let them run.  */
+    start =  demo_seconds();
+    for (i = 0; i < workers; i++)
+    {
+        tx_thread_resume(&worker_thread[i]);
+    }
+    tx_thread_sleep(DEMO_MEASURE_TICKS);
+
+    /* Stop the workers, then pick up the results.  */
+    for (i = 0; i < workers; i++)
+    {
+        tx_thread_suspend(&worker_thread[i]);
+    }
+    seconds =  demo_seconds() - start;
+
+    bursts =     0;
+    run_count =  0;
+    for (i = 0; i < workers; i++)
+    {
+        bursts =     bursts + worker_bursts[i];
+        run_count =  run_count + worker_thread[i].tx_thread_run_count;
+    }
+
+    printf("%u,%s,%u,%lu,%.3f,%.1f,%lu,%.1f\n", (UINT) TX_THREAD_SMP_MAX_CORES, workload, workers,
+           (unsigned long) bursts, seconds, ((double) bursts) / seconds,
+           (unsigned long) run_count, ((double) run_count) / seconds);
+
+    /* Release the workers.  */
+    for (i = 0; i < workers; i++)
+    {
+        pointer =  (CHAR *) worker_thread[i].tx_thread_stack_start;
+        tx_thread_terminate(&worker_thread[i]);
+        tx_thread_delete(&worker_thread[i]);
+        tx_byte_release(pointer);
+    }
+}
+
+
+/* Define the threads.  */
+
+void    report_thread_entry(ULONG thread_input)
+{
+
+    (VOID)thread_input;
+
+    printf("cores,workload,threads,bursts,seconds,bursts_per_second,schedules,schedules_per_second\n");
+
+    demo_measure("compute", compute_thread_entry, TX_THREAD_SMP_MAX_CORES);
+    demo_measure("relinquish", relinquish_thread_entry, 2 * TX_THREAD_SMP_MAX_CORES);
+
+    exit(0);
+}
+
+
+void    compute_thread_entry(ULONG thread_input)
+{
+
+ULONG   i;
+
+
+    while(1)
+    {
+
+        /* Compute a burst.  There is no other worker for this core, so the relinquish only
+           lets the simulated timer interrupt in.  */
+        for (i = 0; i < DEMO_COMPUTE_BURST; i++)
+        {
+            worker_scratch[thread_input]++;
+        }
+        worker_bursts[thread_input]++;
+        tx_thread_relinquish();
+    }
+}
+
+
+void    relinquish_thread_entry(ULONG thread_input)
+{
+
+ULONG   i;
+
+
+    while(1)
+    {
+
+        /* Compute a short burst, then let the scheduler pick the next thread.  */
+        for (i = 0; i < DEMO_RELINQUISH_BURST; i++)
+        {
+            worker_scratch[thread_input]++;
+        }
+        worker_bursts[thread_input]++;
+        tx_thread_relinquish();
+    }
+}
@@ -75,10 +75,11 @@
 
 
 
-/* Define the ThreadX SMP core mask. */
+/* Define the ThreadX SMP core mask. By default it follows the maximum number of cores, so
+   the number of simulated cores can be changed by defining only TX_THREAD_SMP_MAX_CORES.  */
 
 #ifndef TX_THREAD_SMP_CORE_MASK
-#define TX_THREAD_SMP_CORE_MASK                 0xF            /* Where bit 0 represents Core 0, bit 1 represents Core 1, etc.  */
+#define TX_THREAD_SMP_CORE_MASK                 ((ULONG) ((((ULONG64) 1) << TX_THREAD_SMP_MAX_CORES) - 1))  /* Where bit 0 represents Core 0, bit 1 represents Core 1, etc.  */
 #endif
 
 /* Define dynamic number of cores option.  When commented out, the number of cores is static.  */
@@ -166,13 +167,29 @@ typedef char                                    CHAR;
 typedef unsigned char                           UCHAR;
 typedef int                                     INT;
 typedef unsigned int                            UINT;
+#if defined(__x86_64__) && __x86_64__
+typedef int                                     LONG;
+typedef unsigned int                            ULONG;
+#else /* __x86_64__ */
 typedef long                                    LONG;
 typedef unsigned long                           ULONG;
+#endif /* __x86_64__ */
 typedef short                                   SHORT;
 typedef unsigned short                          USHORT;
 typedef uint64_t                                ULONG64;
 #define ULONG64_DEFINED
 
+/* Override the alignment type to use 64-bit alignment and storage for pointers.  */
+
+#if defined(__x86_64__) && __x86_64__
+#define ALIGN_TYPE_DEFINED
+typedef unsigned long long                      ALIGN_TYPE;
+
+/* Override the free block marker for byte pools to be a 64-bit constant.   */
+
+#define TX_BYTE_BLOCK_FREE                      ((ALIGN_TYPE) 0xFFFFEEEEFFFFEEEE)
+#endif
+
 
 /* Define automated coverage test extensions...  These are required for the 
    ThreadX regression test.  */
@@ -534,6 +551,26 @@ void _tx_thread_delete_port_completion(TX_THREAD *thread_ptr, UINT tx_interrupt_
 void _tx_thread_reset_port_completion(TX_THREAD *thread_ptr, UINT tx_interrupt_save);
 #define TX_THREAD_RESET_PORT_COMPLETION(thread_ptr) _tx_thread_reset_port_completion(thread_ptr, tx_interrupt_save);
 
+#if defined(__x86_64__) && __x86_64__
+
+/* Define the internal timer extension to also hold the thread pointer such that _tx_thread_timeout
+   can figure out what thread timeout to process.  */
+
+#define TX_TIMER_INTERNAL_EXTENSION             VOID    *tx_timer_internal_extension_ptr;
+
+
+/* Define the thread timeout setup logic in _tx_thread_create.  */
+
+#define TX_THREAD_CREATE_TIMEOUT_SETUP(t)    (t) -> tx_thread_timer.tx_timer_internal_timeout_function =    &(_tx_thread_timeout);            \
+                                             (t) -> tx_thread_timer.tx_timer_internal_timeout_param =       0;                                \
+                                             (t) -> tx_thread_timer.tx_timer_internal_extension_ptr =       (VOID *) (t);
+
+
+/* Define the thread timeout pointer setup in _tx_thread_timeout.  */
+
+#define TX_THREAD_TIMEOUT_POINTER_SETUP(t)   (t) =  (TX_THREAD *) _tx_timer_expired_timer_ptr -> tx_timer_internal_extension_ptr;
+#endif /* __x86_64__ */
+
 
 /************* Define ThreadX SMP data types and function prototypes.  *************/
 
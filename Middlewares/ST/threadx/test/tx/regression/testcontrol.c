@@ -229,6 +229,8 @@ void    threadx_timer_multiple_accuracy_application_define(void *);
 void    threadx_timer_information_application_define(void *);
 
 void    threadx_trace_basic_application_define(void *);
+void    threadx_execution_profile_application_define(void *);
+void    threadx_trace_stream_application_define(void *);
 void    test_application_define(void *first_unused_memory);
 
 
@@ -347,6 +349,8 @@ TEST_ENTRY  test_control_tests[] =
     threadx_timer_information_application_define, 
 
     threadx_trace_basic_application_define,
+    threadx_execution_profile_application_define,
+    threadx_trace_stream_application_define,
 #endif
 
     TX_NULL,
@@ -0,0 +1,229 @@
+/* This test is designed to test the execution profile kit and its host export.  */
+
+#include   <stdio.h>
+#include   <string.h>
+#include   "tx_api.h"
+#ifdef TX_EXECUTION_PROFILE_ENABLE
+#include   "tx_execution_profile_export.h"
+
+extern ULONG    _tx_thread_created_count;
+#endif
+
+static unsigned long   thread_0_counter =  0;
+static volatile unsigned long   thread_1_counter =  0;
+static TX_THREAD       thread_0;
+static TX_THREAD       thread_1;
+
+
+/* Define thread prototypes.  */
+
+static void    thread_0_entry(ULONG thread_input);
+static void    thread_1_entry(ULONG thread_input);
+
+
+/* Prototype for test control return.  */
+void  test_control_return(UINT status);
+
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+void test_application_define(void *first_unused_memory)
+#else
+void    threadx_execution_profile_application_define(void *first_unused_memory)
+#endif
+{
+
+UINT    status;
+CHAR    *pointer;
+
+    /* Put first available memory address into a character pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    /* Put system definition stuff in here, e.g. thread creates and other assorted
+       create information.  */
+
+    status =  tx_thread_create(&thread_0, "thread 0", thread_0_entry, 0,
+            pointer, TEST_STACK_SIZE_PRINTF,
+            16, 16, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer = pointer + TEST_STACK_SIZE_PRINTF;
+
+    /* Check for status.  */
+    if (status != TX_SUCCESS)
+    {
+
+        printf("Running Execution Profile Test...................................... ERROR #1\n");
+        test_control_return(1);
+    }
+
+    status =  tx_thread_create(&thread_1, "thread \"1\"", thread_1_entry, 1,
+            pointer, TEST_STACK_SIZE_PRINTF,
+            17, 17, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer = pointer + TEST_STACK_SIZE_PRINTF;
+
+    /* Check for status.  */
+    if (status != TX_SUCCESS)
+    {
+
+        printf("Running Execution Profile Test...................................... ERROR #2\n");
+        test_control_return(1);
+    }
+}
+
+
+
+/* Define the test threads.  */
+
+static void    thread_0_entry(ULONG thread_input)
+{
+
+#ifdef TX_EXECUTION_PROFILE_ENABLE
+EXECUTION_TIME  thread_time;
+EXECUTION_TIME  total_time;
+EXECUTION_TIME  idle_time;
+ULONG           histogram[TX_EXECUTION_HISTOGRAM_BINS];
+ULONG           slices;
+UINT            i;
+UINT            lines;
+int             c;
+FILE            *file;
+#endif
+
+
+    /* Inform user.  */
+    printf("Running Execution Profile Test...................................... ");
+
+    /* Let thread 1 run for a while, with idle time in between.  */
+    while (thread_0_counter < 10)
+    {
+        tx_thread_sleep(2);
+        thread_0_counter++;
+    }
+
+#ifdef TX_EXECUTION_PROFILE_ENABLE
+
+    /* Thread 1 must have accumulated execution time.  */
+    _tx_execution_thread_time_get(&thread_1, &thread_time);
+    _tx_execution_thread_total_time_get(&total_time);
+    _tx_execution_idle_time_get(&idle_time);
+    if ((thread_time == 0) || (total_time < thread_time) || (idle_time == 0))
+    {
+
+        /* Execution profile error.  */
+        printf("ERROR #3\n");
+        test_control_return(1);
+    }
+
+#ifdef TX_EXECUTION_PROFILE_HISTOGRAM
+
+    /* Every completed run slice of thread 1 must be in its histogram.  */
+    _tx_execution_thread_histogram_get(&thread_1, histogram);
+    slices =  0;
+    for (i = 0; i < TX_EXECUTION_HISTOGRAM_BINS; i++)
+    {
+        slices =  slices + histogram[i];
+    }
+    if ((slices == 0) || (slices > thread_1.tx_thread_run_count))
+    {
+
+        /* Execution profile error.  */
+        printf("ERROR #4\n");
+        test_control_return(1);
+    }
+
+    /* Resetting the histograms must clear them.  */
+    _tx_execution_histogram_reset();
+    _tx_execution_isr_histogram_get(histogram);
+    for (i = 0; i < TX_EXECUTION_HISTOGRAM_BINS; i++)
+    {
+        if (histogram[i] != 0)
+        {
+
+            /* Execution profile error.  */
+            printf("ERROR #5\n");
+            test_control_return(1);
+        }
+    }
+#endif
+
+    /* Check the export parameters.  */
+    if ((_tx_execution_profile_export(TX_NULL, TX_EXECUTION_EXPORT_CSV) != TX_PTR_ERROR) ||
+        (_tx_execution_profile_export(stdout, 2) != TX_OPTION_ERROR))
+    {
+
+        /* Execution profile error.  */
+        printf("ERROR #6\n");
+        test_control_return(1);
+    }
+
+    /* The CSV export has a header, one line per thread and one line each for all threads, ISRs and idle.  */
+    file =  tmpfile();
+    if ((file == TX_NULL) || (_tx_execution_profile_export(file, TX_EXECUTION_EXPORT_CSV) != TX_SUCCESS))
+    {
+
+        /* Execution profile error.  */
+        printf("ERROR #7\n");
+        test_control_return(1);
+    }
+    rewind(file);
+    lines =  0;
+    while ((c = fgetc(file)) != EOF)
+    {
+        if (c == '\n')
+        {
+            lines++;
+        }
+    }
+    fclose(file);
+    if (lines != (_tx_thread_created_count + 4))
+    {
+
+        /* Execution profile error.  */
+        printf("ERROR #8\n");
+        test_control_return(1);
+    }
+
+    /* The JSON export is a single object.  */
+    file =  tmpfile();
+    if ((file == TX_NULL) || (_tx_execution_profile_export(file, TX_EXECUTION_EXPORT_JSON) != TX_SUCCESS))
+    {
+
+        /* Execution profile error.  */
+        printf("ERROR #9\n");
+        test_control_return(1);
+    }
+    rewind(file);
+    c =  fgetc(file);
+    fclose(file);
+    if (c != '{')
+    {
+
+        /* Execution profile error.  */
+        printf("ERROR #10\n");
+        test_control_return(1);
+    }
+#endif
+
+    /* Successful execution profile test.  */
+    printf("SUCCESS!\n");
+    test_control_return(0);
+}
+
+
+static void    thread_1_entry(ULONG thread_input)
+{
+
+ULONG   i;
+
+
+    while(1)
+    {
+
+        /* Compute for a while, then give up the processor.  */
+        for (i = 0; i < 10000; i++)
+        {
+            thread_1_counter++;
+        }
+        tx_thread_sleep(1);
+    }
+}
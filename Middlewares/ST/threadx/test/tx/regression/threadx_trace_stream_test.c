@@ -0,0 +1,269 @@
+/* This test is designed to test the trace stream.  */
+
+#include   <stdio.h>
+#include   <string.h>
+#include   "tx_api.h"
+#include   "tx_trace_stream.h"
+#ifdef TX_ENABLE_EVENT_TRACE
+#include   "tx_trace.h"
+#endif
+
+static TX_THREAD       thread_0;
+static UCHAR           drain_stack[TEST_STACK_SIZE_PRINTF];
+
+#ifdef TX_ENABLE_EVENT_TRACE
+
+/* The trace buffer only holds a few events, so it wraps many times during the test.  */
+
+#define TRACE_REGISTRY_ENTRIES  8
+#define TRACE_BUFFER_EVENTS     16
+#define TRACE_USER_EVENTS       1000
+
+static ULONG           trace_buffer[(sizeof(TX_TRACE_HEADER) + (TRACE_REGISTRY_ENTRIES * sizeof(TX_TRACE_OBJECT_ENTRY)) +
+                                     (TRACE_BUFFER_EVENTS * sizeof(TX_TRACE_BUFFER_ENTRY))) / sizeof(ULONG)];
+#endif
+
+
+/* Define thread prototypes.  */
+
+static void    thread_0_entry(ULONG thread_input);
+
+
+/* Prototype for test control return.  */
+void  test_control_return(UINT status);
+
+
+/* Define what the initial system looks like.  */
+
+#ifdef CTEST
+void test_application_define(void *first_unused_memory)
+#else
+void    threadx_trace_stream_application_define(void *first_unused_memory)
+#endif
+{
+
+UINT    status;
+CHAR    *pointer;
+
+    /* Put first available memory address into a character pointer.  */
+    pointer =  (CHAR *) first_unused_memory;
+
+    /* Put system definition stuff in here, e.g. thread creates and other assorted
+       create information.  */
+
+    status =  tx_thread_create(&thread_0, "thread 0", thread_0_entry, 0,
+            pointer, TEST_STACK_SIZE_PRINTF,
+            16, 16, TX_NO_TIME_SLICE, TX_AUTO_START);
+    pointer = pointer + TEST_STACK_SIZE_PRINTF;
+
+    /* Check for status.  */
+    if (status != TX_SUCCESS)
+    {
+
+        printf("Running Trace Stream Test........................................... ERROR #1\n");
+        test_control_return(1);
+    }
+}
+
+
+#ifdef TX_ENABLE_EVENT_TRACE
+
+/* Read the stream back and check that every user event is there, in order, and that thread 0
+   is in the registry. Return the number of user events found, or zero on a format error.  */
+
+static ULONG   stream_check(FILE *file)
+{
+
+TX_TRACE_STREAM_HEADER  header;
+TX_TRACE_STREAM_RECORD  record;
+TX_TRACE_OBJECT_ENTRY   object;
+TX_TRACE_BUFFER_ENTRY   event;
+ULONG                   user_events;
+UINT                    thread_found;
+ULONG                   i;
+
+
+    rewind(file);
+    if ((fread(&header, sizeof(header), 1, file) != 1) ||
+        (header.tx_trace_stream_header_id != TX_TRACE_STREAM_ID) ||
+        (header.tx_trace_stream_header_object_entry_size != sizeof(TX_TRACE_OBJECT_ENTRY)) ||
+        (header.tx_trace_stream_header_event_entry_size != sizeof(TX_TRACE_BUFFER_ENTRY)))
+    {
+        return(0);
+    }
+
+    user_events =   0;
+    thread_found =  TX_FALSE;
+    while (fread(&record, sizeof(record), 1, file) == 1)
+    {
+        for (i = 0; i < record.tx_trace_stream_record_count; i++)
+        {
+            if (record.tx_trace_stream_record_type == TX_TRACE_STREAM_RECORD_OBJECT)
+            {
+                if (fread(&object, sizeof(object), 1, file) != 1)
+                {
+                    return(0);
+                }
+                if ((object.tx_trace_object_entry_thread_pointer == TX_POINTER_TO_ULONG_CONVERT(&thread_0)) &&
+                    (strcmp((char *) object.tx_trace_object_entry_name, "thread 0") == 0))
+                {
+                    thread_found =  TX_TRUE;
+                }
+            }
+            else if (record.tx_trace_stream_record_type == TX_TRACE_STREAM_RECORD_EVENTS)
+            {
+                if (fread(&event, sizeof(event), 1, file) != 1)
+                {
+                    return(0);
+                }
+                if (event.tx_trace_buffer_entry_event_id == TX_TRACE_USER_EVENT_START)
+                {
+
+                    /* User events carry their sequence number, a gap is a dropped event.  */
+#ifdef TX_MISRA_ENABLE
+                    if (event.tx_trace_buffer_entry_info_1 != user_events)
+#else
+                    if (event.tx_trace_buffer_entry_information_field_1 != user_events)
+#endif
+                    {
+                        return(0);
+                    }
+                    user_events++;
+                }
+            }
+            else
+            {
+                return(0);
+            }
+        }
+    }
+
+    if (thread_found == TX_FALSE)
+    {
+        return(0);
+    }
+    return(user_events);
+}
+#endif
+
+
+/* Define the test threads.  */
+
+static void    thread_0_entry(ULONG thread_input)
+{
+
+UINT    status;
+#ifdef TX_ENABLE_EVENT_TRACE
+FILE    *file;
+ULONG   i;
+ULONG   written;
+#endif
+
+
+    /* Inform user.  */
+    printf("Running Trace Stream Test........................................... ");
+
+#ifndef TX_ENABLE_EVENT_TRACE
+
+    /* Without the event trace, the stream is not available.  */
+    status =  _tx_trace_stream_start(stdout, drain_stack, sizeof(drain_stack), 0, TX_NULL, 0, 0, 0);
+    if ((status != TX_FEATURE_NOT_ENABLED) || (_tx_trace_stream_flush() != TX_FEATURE_NOT_ENABLED) ||
+        (_tx_trace_stream_stop() != TX_FEATURE_NOT_ENABLED) || (_tx_trace_stream_events_written() != 0))
+    {
+
+        /* Trace stream error.  */
+        printf("ERROR #2\n");
+        test_control_return(1);
+    }
+#else
+
+    /* Check the parameters.  */
+    if ((_tx_trace_stream_start(TX_NULL, trace_buffer, sizeof(trace_buffer), TRACE_REGISTRY_ENTRIES, TX_NULL, 0, 0, 0) != TX_PTR_ERROR) ||
+        (_tx_trace_stream_start(stdout, trace_buffer, sizeof(trace_buffer), TX_TRACE_STREAM_MAX_REGISTRY_ENTRIES + 1, TX_NULL, 0, 0, 0) != TX_SIZE_ERROR) ||
+        (_tx_trace_stream_start(stdout, trace_buffer, sizeof(trace_buffer), TRACE_REGISTRY_ENTRIES, drain_stack, sizeof(drain_stack), 1, 0) != TX_OPTION_ERROR) ||
+        (_tx_trace_stream_start(stdout, trace_buffer, sizeof(TX_TRACE_HEADER), TRACE_REGISTRY_ENTRIES, TX_NULL, 0, 0, 0) != TX_SIZE_ERROR) ||
+        (_tx_trace_stream_flush() != TX_NOT_DONE) || (_tx_trace_stream_stop() != TX_NOT_DONE))
+    {
+
+        /* Trace stream error.  */
+        printf("ERROR #3\n");
+        test_control_return(1);
+    }
+
+    /* Stream many more events than the buffer holds, without a drain thread. Only the
+       buffer full notification writes them.  */
+    file =  tmpfile();
+    status =  _tx_trace_stream_start(file, trace_buffer, sizeof(trace_buffer), TRACE_REGISTRY_ENTRIES, TX_NULL, 0, 0, 0);
+    if ((file == TX_NULL) || (status != TX_SUCCESS))
+    {
+
+        /* Trace stream error.  */
+        printf("ERROR #4\n");
+        test_control_return(1);
+    }
+
+    /* A second start must fail.  */
+    if (_tx_trace_stream_start(file, trace_buffer, sizeof(trace_buffer), TRACE_REGISTRY_ENTRIES, TX_NULL, 0, 0, 0) != TX_NOT_DONE)
+    {
+
+        /* Trace stream error.  */
+        printf("ERROR #5\n");
+        test_control_return(1);
+    }
+
+    for (i = 0; i < TRACE_USER_EVENTS; i++)
+    {
+        tx_trace_user_event_insert(TX_TRACE_USER_EVENT_START, i, 0, 0, 0);
+
+        /* Flush in between now and then, to mix both ways of writing.  */
+        if ((i % 100) == 50)
+        {
+            _tx_trace_stream_flush();
+        }
+    }
+
+    status =  _tx_trace_stream_stop();
+    written =  _tx_trace_stream_events_written();
+    if ((status != TX_SUCCESS) || (written < TRACE_USER_EVENTS) || (stream_check(file) != TRACE_USER_EVENTS))
+    {
+
+        /* Trace stream error.  */
+        printf("ERROR #6\n");
+        test_control_return(1);
+    }
+    fclose(file);
+
+    /* Now with a drain thread, which must write the events without any flush.  */
+    file =  tmpfile();
+    status =  _tx_trace_stream_start(file, trace_buffer, sizeof(trace_buffer), TRACE_REGISTRY_ENTRIES,
+                                     drain_stack, sizeof(drain_stack), 1, 1);
+    if ((file == TX_NULL) || (status != TX_SUCCESS))
+    {
+
+        /* Trace stream error.  */
+        printf("ERROR #7\n");
+        test_control_return(1);
+    }
+
+    for (i = 0; i < 10; i++)
+    {
+        tx_trace_user_event_insert(TX_TRACE_USER_EVENT_START, i, 0, 0, 0);
+    }
+    tx_thread_sleep(3);
+    written =  _tx_trace_stream_events_written();
+
+    status =  _tx_trace_stream_stop();
+    if ((status != TX_SUCCESS) || (written < 10) || (stream_check(file) != 10))
+    {
+
+        /* Trace stream error.  */
+        printf("ERROR #8\n");
+        test_control_return(1);
+    }
+    fclose(file);
+#endif
+
+    /* Successful trace stream test.  */
+    printf("SUCCESS!\n");
+    test_control_return(0);
+}
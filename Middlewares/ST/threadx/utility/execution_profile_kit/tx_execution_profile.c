@@ -103,6 +103,41 @@ ULONG                                   _tx_execution_isr_nest_counter = 0;
 #endif
 
 
+#ifdef TX_EXECUTION_PROFILE_HISTOGRAM
+
+/* Define the run-slice histograms. Each thread keeps its own histogram in its control block, the
+   histogram below accumulates the slices of all threads. ISR slices are tracked from the first
+   nested interrupt's entry to its exit, consistent with the total ISR time.  */
+
+ULONG                                   _tx_execution_thread_slice_histogram[TX_EXECUTION_HISTOGRAM_BINS];
+ULONG                                   _tx_execution_isr_slice_histogram[TX_EXECUTION_HISTOGRAM_BINS];
+
+
+/* Add one slice of the given length to the histogram.  */
+
+static VOID  _tx_execution_histogram_update(ULONG *histogram, EXECUTION_TIME delta_time)
+{
+
+UINT    bin;
+
+
+    /* Find the most significant bit of the slice length, which is its log2 bin.  */
+    bin =  0;
+    while ((delta_time > ((EXECUTION_TIME) 1)) && (bin < ((UINT) (TX_EXECUTION_HISTOGRAM_BINS - 1))))
+    {
+        delta_time =  delta_time >> 1;
+        bin++;
+    }
+
+    /* Count the slice, saturating rather than wrapping the bin.  */
+    if (histogram[bin] != ((ULONG) 0xFFFFFFFFUL))
+    {
+        histogram[bin]++;
+    }
+}
+#endif
+
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
@@ -370,6 +405,13 @@ EXECUTION_TIME              delta_time;
 
             /* Store back the new total time.  */
             _tx_execution_thread_time_total =  new_total_time;
+
+#ifdef TX_EXECUTION_PROFILE_HISTOGRAM
+
+            /* Record the length of this run slice.  */
+            _tx_execution_histogram_update(thread_ptr -> tx_thread_execution_slice_histogram, delta_time);
+            _tx_execution_histogram_update(_tx_execution_thread_slice_histogram, delta_time);
+#endif
         }
 
         /* Is the system now idle?  */
@@ -510,6 +552,13 @@ EXECUTION_TIME              delta_time;
 
                 /* Store back the new total time.  */
                 _tx_execution_thread_time_total =  new_total_time;
+
+#ifdef TX_EXECUTION_PROFILE_HISTOGRAM
+
+                /* Record the length of the interrupted run slice.  */
+                _tx_execution_histogram_update(thread_ptr -> tx_thread_execution_slice_histogram, delta_time);
+                _tx_execution_histogram_update(_tx_execution_thread_slice_histogram, delta_time);
+#endif
             }
         }
         
@@ -657,6 +706,12 @@ EXECUTION_TIME              delta_time;
     
         /* Store back the new total time.  */
         _tx_execution_isr_time_total =  new_total_time;
+
+#ifdef TX_EXECUTION_PROFILE_HISTOGRAM
+
+        /* Record the length of this ISR slice.  */
+        _tx_execution_histogram_update(_tx_execution_isr_slice_histogram, delta_time);
+#endif
         
         /* Pickup the current thread control block.  */
         thread_ptr =  _tx_thread_current_ptr;
@@ -1097,4 +1152,240 @@ UINT  _tx_execution_idle_time_get(EXECUTION_TIME *total_time)
 }
 
 
+#ifdef TX_EXECUTION_PROFILE_HISTOGRAM
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_thread_histogram_get                  PORTABLE C      */
+/*                                                           6.4.0        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function copies the run-slice histogram of the specified       */
+/*    thread into the supplied array of TX_EXECUTION_HISTOGRAM_BINS       */
+/*    entries.                                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                            Pointer to thread             */
+/*    histogram                             Destination for histogram     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application code                                                    */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_execution_thread_histogram_get(TX_THREAD *thread_ptr, ULONG *histogram)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT            i;
+
+
+    /* Disable interrupts so the histogram is consistent.  */
+    TX_DISABLE
+
+    /* Copy the thread's histogram.  */
+    for (i = 0; i < ((UINT) TX_EXECUTION_HISTOGRAM_BINS); i++)
+    {
+        histogram[i] =  thread_ptr -> tx_thread_execution_slice_histogram[i];
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_thread_total_histogram_get            PORTABLE C      */
+/*                                                           6.4.0        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function copies the run-slice histogram of all threads into    */
+/*    the supplied array of TX_EXECUTION_HISTOGRAM_BINS entries.          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    histogram                             Destination for histogram     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application code                                                    */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_execution_thread_total_histogram_get(ULONG *histogram)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT            i;
+
+
+    /* Disable interrupts so the histogram is consistent.  */
+    TX_DISABLE
+
+    /* Copy the total thread histogram.  */
+    for (i = 0; i < ((UINT) TX_EXECUTION_HISTOGRAM_BINS); i++)
+    {
+        histogram[i] =  _tx_execution_thread_slice_histogram[i];
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_isr_histogram_get                     PORTABLE C      */
+/*                                                           6.4.0        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function copies the ISR slice histogram into the supplied      */
+/*    array of TX_EXECUTION_HISTOGRAM_BINS entries.                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    histogram                             Destination for histogram     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application code                                                    */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_execution_isr_histogram_get(ULONG *histogram)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT            i;
+
+
+    /* Disable interrupts so the histogram is consistent.  */
+    TX_DISABLE
+
+    /* Copy the ISR histogram.  */
+    for (i = 0; i < ((UINT) TX_EXECUTION_HISTOGRAM_BINS); i++)
+    {
+        histogram[i] =  _tx_execution_isr_slice_histogram[i];
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_histogram_reset                       PORTABLE C      */
+/*                                                           6.4.0        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function clears the ISR histogram, the total thread histogram  */
+/*    and the histogram of every created thread.                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application code                                                    */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_execution_histogram_reset(void)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *thread_ptr;
+UINT            total_threads;
+UINT            i;
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Clear the global histograms.  */
+    for (i = 0; i < ((UINT) TX_EXECUTION_HISTOGRAM_BINS); i++)
+    {
+        _tx_execution_thread_slice_histogram[i] =  0;
+        _tx_execution_isr_slice_histogram[i] =     0;
+    }
+
+    /* Loop through threads to clear their histograms.  */
+    total_threads =      _tx_thread_created_count;
+    thread_ptr =         _tx_thread_created_ptr;
+    while (total_threads--)
+    {
+        for (i = 0; i < ((UINT) TX_EXECUTION_HISTOGRAM_BINS); i++)
+        {
+            thread_ptr -> tx_thread_execution_slice_histogram[i] =  0;
+        }
+        thread_ptr =  thread_ptr -> tx_thread_created_next;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+#endif
+
+
 #endif /* #if defined(TX_ENABLE_EXECUTION_CHANGE_NOTIFY) || defined(TX_EXECUTION_PROFILE_ENABLE) */
@@ -50,9 +50,13 @@
    most common configuration.  */
 
 typedef unsigned long long              EXECUTION_TIME;
+#ifndef EXECUTION_TIME_SOURCE_TYPE_DEFINED
 typedef unsigned long                   EXECUTION_TIME_SOURCE_TYPE;
+#endif
 /* For 64-bit time source, the typedef would be:  */
 /* typedef unsigned long long              EXECUTION_TIME_SOURCE_TYPE;  */
+/* Ports that supply their own time source (for example, the Linux port) may define
+   EXECUTION_TIME_SOURCE_TYPE_DEFINED in tx_port.h along with their own typedef.  */
 
 /* Define basic constants for the execution profile kit.  */
 
@@ -69,6 +73,16 @@ typedef unsigned long                   EXECUTION_TIME_SOURCE_TYPE;
 /*#define TX_EXECUTION_MAX_TIME_SOURCE     0xFFFFFFFFFFFFFFFF  */
 
 
+/* Define the number of run-slice histogram bins. Bin n counts the slices whose length, in
+   time source ticks, is in the range [2^n, 2^(n+1)). Bin 0 also counts zero length slices and
+   the last bin also counts all longer slices. The histograms are only kept if the ThreadX
+   library and this kit are built with TX_EXECUTION_PROFILE_HISTOGRAM defined.  */
+
+#ifndef TX_EXECUTION_HISTOGRAM_BINS
+#define TX_EXECUTION_HISTOGRAM_BINS      32
+#endif
+
+
 /* Define APIs of the execution profile kit.  */
 
 struct TX_THREAD_STRUCT;
@@ -85,5 +99,11 @@ UINT  _tx_execution_thread_time_get(struct TX_THREAD_STRUCT *thread_ptr, EXECUTI
 UINT  _tx_execution_thread_total_time_get(EXECUTION_TIME *total_time);
 UINT  _tx_execution_isr_time_get(EXECUTION_TIME *total_time);
 UINT  _tx_execution_idle_time_get(EXECUTION_TIME *total_time);
+#ifdef TX_EXECUTION_PROFILE_HISTOGRAM
+UINT  _tx_execution_thread_histogram_get(struct TX_THREAD_STRUCT *thread_ptr, ULONG *histogram);
+UINT  _tx_execution_thread_total_histogram_get(ULONG *histogram);
+UINT  _tx_execution_isr_histogram_get(ULONG *histogram);
+UINT  _tx_execution_histogram_reset(void);
+#endif
 
 #endif
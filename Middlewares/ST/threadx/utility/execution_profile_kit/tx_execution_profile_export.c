@@ -0,0 +1,321 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Execution Profile Kit - Host Export                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_execution_profile.h"
+#include "tx_execution_profile_export.h"
+
+
+#if defined(TX_EXECUTION_PROFILE_ENABLE) && !defined(TX_ENABLE_EXECUTION_CHANGE_NOTIFY)
+
+/* Externally reference several internal ThreadX variables.  */
+
+extern TX_THREAD                        *_tx_thread_created_ptr;
+extern ULONG                            _tx_thread_created_count;
+
+
+/* Compute the share of the total profiled time, in percent.  */
+
+static double  _tx_execution_export_share(EXECUTION_TIME time, EXECUTION_TIME total_time)
+{
+
+    if (total_time == 0)
+    {
+        return(0.0);
+    }
+
+    return((100.0 * (double) time) / (double) total_time);
+}
+
+
+/* Write a string with the characters that are special to CSV or JSON escaped.  */
+
+static VOID  _tx_execution_export_name(FILE *file, const CHAR *name, UINT format)
+{
+
+const CHAR      *ptr;
+
+
+    /* A thread may have been created without a name.  */
+    if (name == TX_NULL)
+    {
+        name =  "";
+    }
+
+    fputc('"', file);
+    for (ptr = name; *ptr != '\0'; ptr++)
+    {
+
+        if (*ptr == '"')
+        {
+
+            /* CSV doubles quotes, JSON escapes them.  */
+            fputs((format == TX_EXECUTION_EXPORT_CSV) ? "\"\"" : "\\\"", file);
+        }
+        else if ((format == TX_EXECUTION_EXPORT_JSON) && (*ptr == '\\'))
+        {
+            fputs("\\\\", file);
+        }
+        else if ((format == TX_EXECUTION_EXPORT_JSON) && (((UCHAR) *ptr) < 0x20))
+        {
+            fprintf(file, "\\u%04x", (unsigned) ((UCHAR) *ptr));
+        }
+        else
+        {
+            fputc(*ptr, file);
+        }
+    }
+    fputc('"', file);
+}
+
+
+#ifdef TX_EXECUTION_PROFILE_HISTOGRAM
+
+/* Write the histogram bins, as trailing CSV columns or as a JSON array.  */
+
+static VOID  _tx_execution_export_histogram(FILE *file, ULONG *histogram, UINT format)
+{
+
+UINT            i;
+
+
+    if (format == TX_EXECUTION_EXPORT_JSON)
+    {
+        fputs(", \"histogram\": [", file);
+    }
+
+    for (i = 0; i < ((UINT) TX_EXECUTION_HISTOGRAM_BINS); i++)
+    {
+        if (format == TX_EXECUTION_EXPORT_JSON)
+        {
+            fprintf(file, (i == 0) ? "%lu" : ", %lu", (unsigned long) histogram[i]);
+        }
+        else
+        {
+            fprintf(file, ",%lu", (unsigned long) histogram[i]);
+        }
+    }
+
+    if (format == TX_EXECUTION_EXPORT_JSON)
+    {
+        fputc(']', file);
+    }
+}
+#endif
+
+
+/* Write one record: a thread, all threads, ISRs or idle.  */
+
+static VOID  _tx_execution_export_record(FILE *file, UINT format, UINT first, const CHAR *type, const CHAR *name,
+                                         UINT priority, ULONG run_count, EXECUTION_TIME time, EXECUTION_TIME total_time,
+                                         ULONG *histogram)
+{
+
+    if (format == TX_EXECUTION_EXPORT_JSON)
+    {
+        fprintf(file, "%s\n    {\"type\": \"%s\", \"name\": ", (first) ? "" : ",", type);
+        _tx_execution_export_name(file, name, format);
+        fprintf(file, ", \"priority\": %u, \"run_count\": %lu, \"time\": %llu, \"share\": %.3f",
+                priority, (unsigned long) run_count, (unsigned long long) time,
+                _tx_execution_export_share(time, total_time));
+    }
+    else
+    {
+        fprintf(file, "%s,", type);
+        _tx_execution_export_name(file, name, format);
+        fprintf(file, ",%u,%lu,%llu,%.3f",
+                priority, (unsigned long) run_count, (unsigned long long) time,
+                _tx_execution_export_share(time, total_time));
+    }
+
+#ifdef TX_EXECUTION_PROFILE_HISTOGRAM
+    if (histogram != TX_NULL)
+    {
+        _tx_execution_export_histogram(file, histogram, format);
+    }
+#else
+    TX_PARAMETER_NOT_USED(histogram);
+#endif
+
+    if (format == TX_EXECUTION_EXPORT_JSON)
+    {
+        fputc('}', file);
+    }
+    else
+    {
+        fputc('\n', file);
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_profile_export                        PORTABLE C      */
+/*                                                           6.4.0        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function writes the execution profile of every created thread, */
+/*    of ISRs and of idle to the supplied stream, as CSV or as JSON.      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    file                                  Destination stream            */
+/*    format                                TX_EXECUTION_EXPORT_CSV or    */
+/*                                            TX_EXECUTION_EXPORT_JSON    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                            Successful export             */
+/*    TX_PTR_ERROR                          Invalid stream                */
+/*    TX_OPTION_ERROR                       Invalid format                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_execution_thread_time_get         Get thread execution time     */
+/*    _tx_execution_thread_total_time_get   Get all threads' time         */
+/*    _tx_execution_isr_time_get            Get ISR execution time        */
+/*    _tx_execution_idle_time_get           Get idle time                 */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application code                                                    */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_execution_profile_export(FILE *file, UINT format)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD       *thread_ptr;
+ULONG           total_threads;
+EXECUTION_TIME  thread_time;
+EXECUTION_TIME  thread_total_time;
+EXECUTION_TIME  isr_time;
+EXECUTION_TIME  idle_time;
+EXECUTION_TIME  total_time;
+ULONG           *histogram;
+UINT            first;
+#ifdef TX_EXECUTION_PROFILE_HISTOGRAM
+ULONG           histogram_buffer[TX_EXECUTION_HISTOGRAM_BINS];
+UINT            i;
+#endif
+
+
+    /* Check the parameters.  */
+    if (file == TX_NULL)
+    {
+        return(TX_PTR_ERROR);
+    }
+    if ((format != TX_EXECUTION_EXPORT_CSV) && (format != TX_EXECUTION_EXPORT_JSON))
+    {
+        return(TX_OPTION_ERROR);
+    }
+
+    /* Disable interrupts so the snapshot is consistent and the created list is stable.  */
+    TX_DISABLE
+
+    /* Pickup the totals.  */
+    _tx_execution_thread_total_time_get(&thread_total_time);
+    _tx_execution_isr_time_get(&isr_time);
+    _tx_execution_idle_time_get(&idle_time);
+    total_time =  thread_total_time + isr_time + idle_time;
+
+    /* Write the header.  */
+    if (format == TX_EXECUTION_EXPORT_JSON)
+    {
+        fprintf(file, "{\n  \"total_time\": %llu,\n  \"histogram_bins\": %u,\n  \"records\": [",
+                (unsigned long long) total_time,
+#ifdef TX_EXECUTION_PROFILE_HISTOGRAM
+                (UINT) TX_EXECUTION_HISTOGRAM_BINS);
+#else
+                0U);
+#endif
+    }
+    else
+    {
+        fputs("type,name,priority,run_count,time,share", file);
+#ifdef TX_EXECUTION_PROFILE_HISTOGRAM
+        for (i = 0; i < ((UINT) TX_EXECUTION_HISTOGRAM_BINS); i++)
+        {
+            fprintf(file, ",bin_%u", i);
+        }
+#endif
+        fputc('\n', file);
+    }
+
+    /* Loop through the created threads.  */
+    first =          TX_TRUE;
+    histogram =      TX_NULL;
+    total_threads =  _tx_thread_created_count;
+    thread_ptr =     _tx_thread_created_ptr;
+    while (total_threads--)
+    {
+
+        _tx_execution_thread_time_get(thread_ptr, &thread_time);
+#ifdef TX_EXECUTION_PROFILE_HISTOGRAM
+        _tx_execution_thread_histogram_get(thread_ptr, histogram_buffer);
+        histogram =  histogram_buffer;
+#endif
+        _tx_execution_export_record(file, format, first, "thread", thread_ptr -> tx_thread_name,
+                                    thread_ptr -> tx_thread_priority, thread_ptr -> tx_thread_run_count,
+                                    thread_time, total_time, histogram);
+        first =  TX_FALSE;
+
+        thread_ptr =  thread_ptr -> tx_thread_created_next;
+    }
+
+    /* Write all threads, ISRs and idle.  */
+#ifdef TX_EXECUTION_PROFILE_HISTOGRAM
+    _tx_execution_thread_total_histogram_get(histogram_buffer);
+#endif
+    _tx_execution_export_record(file, format, first, "threads", "", 0, 0, thread_total_time, total_time, histogram);
+#ifdef TX_EXECUTION_PROFILE_HISTOGRAM
+    _tx_execution_isr_histogram_get(histogram_buffer);
+#endif
+    _tx_execution_export_record(file, format, TX_FALSE, "isr", "", 0, 0, isr_time, total_time, histogram);
+    _tx_execution_export_record(file, format, TX_FALSE, "idle", "", 0, 0, idle_time, total_time, TX_NULL);
+
+    /* Close the JSON document.  */
+    if (format == TX_EXECUTION_EXPORT_JSON)
+    {
+        fputs("\n  ]\n}\n", file);
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Make sure the snapshot reaches the stream.  */
+    fflush(file);
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+
+#endif /* #if defined(TX_EXECUTION_PROFILE_ENABLE) && !defined(TX_ENABLE_EXECUTION_CHANGE_NOTIFY) */
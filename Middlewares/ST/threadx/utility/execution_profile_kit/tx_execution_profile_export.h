@@ -0,0 +1,54 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Execution Profile Kit - Host Export                                 */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#ifndef TX_EXECUTION_PROFILE_EXPORT_H
+#define TX_EXECUTION_PROFILE_EXPORT_H
+
+
+/*  The export utility writes a snapshot of the data gathered by the execution profile kit to a
+    standard C stream, either as CSV or as JSON. It is intended for host ports such as Linux,
+    where the kit's time source is the monotonic clock and all times are in nanoseconds.
+
+    The snapshot contains, for each created thread, its accumulated execution time and its share
+    of the total profiled time, followed by the same information for ISRs and for idle. The
+    total profiled time is the sum of the thread, ISR and idle times. If the kit is built with
+    TX_EXECUTION_PROFILE_HISTOGRAM, the run-slice histograms of each thread, of all threads
+    and of ISRs are exported as well.
+
+    Interrupts are disabled while the snapshot is written, so the export should be called
+    from a low priority thread or after the measurement is complete.  */
+
+#include <stdio.h>
+
+
+/* Define the export formats.  */
+
+#define TX_EXECUTION_EXPORT_CSV             0
+#define TX_EXECUTION_EXPORT_JSON            1
+
+
+/* Define APIs of the export utility.  */
+
+UINT  _tx_execution_profile_export(FILE *file, UINT format);
+
+#endif
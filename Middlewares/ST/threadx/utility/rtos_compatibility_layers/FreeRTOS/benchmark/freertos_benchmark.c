@@ -0,0 +1,427 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   FreeRTOS compatibility Kit - API Benchmark                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "timers.h"
+
+#include "freertos_benchmark.h"
+
+#define BENCHMARK_WARMUP                100u
+#define BENCHMARK_HEAP_BLOCKS           16u
+
+typedef struct {
+    uint64_t total;
+    uint64_t min;
+    uint64_t max;
+    uint32_t count;
+} benchmark_result_t;
+
+static TaskHandle_t benchmark_task;
+static TaskHandle_t benchmark_echo_task;
+static QueueHandle_t benchmark_queue_ping;
+static QueueHandle_t benchmark_queue_pong;
+static SemaphoreHandle_t benchmark_sem_ping;
+static SemaphoreHandle_t benchmark_sem_pong;
+static TimerHandle_t benchmark_timer;
+
+
+static void benchmark_result_init(benchmark_result_t *p_result)
+{
+    p_result->total = 0u;
+    p_result->min = UINT64_MAX;
+    p_result->max = 0u;
+    p_result->count = 0u;
+}
+
+
+static void benchmark_result_add(benchmark_result_t *p_result, uint64_t start, uint64_t end)
+{
+    uint64_t elapsed;
+
+    elapsed = end - start;
+    p_result->total += elapsed;
+    p_result->count++;
+    if(elapsed < p_result->min) {
+        p_result->min = elapsed;
+    }
+    if(elapsed > p_result->max) {
+        p_result->max = elapsed;
+    }
+}
+
+
+static unsigned long benchmark_ns(uint64_t count)
+{
+    return (unsigned long)((count * 1000000000ull) / (uint64_t)benchmarkTIME_FREQUENCY_HZ);
+}
+
+
+static void benchmark_result_print(const char *p_name, benchmark_result_t *p_result)
+{
+    if(p_result->count == 0u) {
+        benchmarkPRINTF("%s,%s,0,0,0,0\n", benchmarkBACKEND_NAME, p_name);
+        return;
+    }
+
+    benchmarkPRINTF("%s,%s,%lu,%lu,%lu,%lu\n", benchmarkBACKEND_NAME, p_name,
+                    (unsigned long)p_result->count,
+                    benchmark_ns(p_result->total / p_result->count),
+                    benchmark_ns(p_result->min),
+                    benchmark_ns(p_result->max));
+}
+
+
+// Echo tasks of the ping-pong tests, one priority above the benchmark task so every
+// hand-over is a context switch.
+
+static void benchmark_queue_echo(void *p_arg)
+{
+    uint32_t value;
+
+    (void)p_arg;
+
+    for(;;) {
+        (void)xQueueReceive(benchmark_queue_ping, &value, portMAX_DELAY);
+        (void)xQueueSend(benchmark_queue_pong, &value, portMAX_DELAY);
+    }
+}
+
+
+static void benchmark_sem_echo(void *p_arg)
+{
+    (void)p_arg;
+
+    for(;;) {
+        (void)xSemaphoreTake(benchmark_sem_ping, portMAX_DELAY);
+        (void)xSemaphoreGive(benchmark_sem_pong);
+    }
+}
+
+
+static void benchmark_notify_echo(void *p_arg)
+{
+    (void)p_arg;
+
+    for(;;) {
+        (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        (void)xTaskNotifyGive(benchmark_task);
+    }
+}
+
+
+static void benchmark_timer_callback(TimerHandle_t xTimer)
+{
+    (void)xTimer;
+}
+
+
+static BaseType_t benchmark_echo_start(TaskFunction_t echo)
+{
+    return xTaskCreate(echo, "echo", benchmarkTASK_STACK_SIZE, NULL, benchmarkTASK_PRIORITY + 1u,
+                       &benchmark_echo_task);
+}
+
+
+static void benchmark_echo_stop(void)
+{
+    vTaskDelete(benchmark_echo_task);
+    benchmark_echo_task = NULL;
+
+    // Let the idle task free the echo task.
+    vTaskDelay(2u);
+}
+
+
+// Time of an empty iteration, the overhead of the time source.
+static void benchmark_empty(benchmark_result_t *p_result)
+{
+    uint32_t i;
+    uint64_t start;
+
+    for(i = 0u; i < benchmarkITERATIONS; i++) {
+        start = benchmarkTIME_NOW();
+        benchmark_result_add(p_result, start, benchmarkTIME_NOW());
+    }
+}
+
+
+// Send and receive one message on a queue, within the same task.
+static void benchmark_queue_send_receive(benchmark_result_t *p_result)
+{
+    uint32_t i;
+    uint32_t value;
+    uint64_t start;
+
+    for(i = 0u; i < (BENCHMARK_WARMUP + benchmarkITERATIONS); i++) {
+        value = i;
+        start = benchmarkTIME_NOW();
+        (void)xQueueSend(benchmark_queue_ping, &value, portMAX_DELAY);
+        (void)xQueueReceive(benchmark_queue_ping, &value, portMAX_DELAY);
+        if(i >= BENCHMARK_WARMUP) {
+            benchmark_result_add(p_result, start, benchmarkTIME_NOW());
+        }
+    }
+}
+
+
+// Round trip of a message through the queue echo task.
+static void benchmark_queue_pingpong(benchmark_result_t *p_result)
+{
+    uint32_t i;
+    uint32_t value;
+    uint64_t start;
+
+    if(benchmark_echo_start(benchmark_queue_echo) != pdPASS) {
+        return;
+    }
+
+    for(i = 0u; i < (BENCHMARK_WARMUP + benchmarkITERATIONS); i++) {
+        value = i;
+        start = benchmarkTIME_NOW();
+        (void)xQueueSend(benchmark_queue_ping, &value, portMAX_DELAY);
+        (void)xQueueReceive(benchmark_queue_pong, &value, portMAX_DELAY);
+        if(i >= BENCHMARK_WARMUP) {
+            benchmark_result_add(p_result, start, benchmarkTIME_NOW());
+        }
+    }
+
+    benchmark_echo_stop();
+}
+
+
+// Give and take a binary semaphore, within the same task.
+static void benchmark_sem_give_take(benchmark_result_t *p_result)
+{
+    uint32_t i;
+    uint64_t start;
+
+    for(i = 0u; i < (BENCHMARK_WARMUP + benchmarkITERATIONS); i++) {
+        start = benchmarkTIME_NOW();
+        (void)xSemaphoreGive(benchmark_sem_ping);
+        (void)xSemaphoreTake(benchmark_sem_ping, portMAX_DELAY);
+        if(i >= BENCHMARK_WARMUP) {
+            benchmark_result_add(p_result, start, benchmarkTIME_NOW());
+        }
+    }
+}
+
+
+// Round trip through the semaphore echo task.
+static void benchmark_sem_pingpong(benchmark_result_t *p_result)
+{
+    uint32_t i;
+    uint64_t start;
+
+    if(benchmark_echo_start(benchmark_sem_echo) != pdPASS) {
+        return;
+    }
+
+    for(i = 0u; i < (BENCHMARK_WARMUP + benchmarkITERATIONS); i++) {
+        start = benchmarkTIME_NOW();
+        (void)xSemaphoreGive(benchmark_sem_ping);
+        (void)xSemaphoreTake(benchmark_sem_pong, portMAX_DELAY);
+        if(i >= BENCHMARK_WARMUP) {
+            benchmark_result_add(p_result, start, benchmarkTIME_NOW());
+        }
+    }
+
+    benchmark_echo_stop();
+}
+
+
+// Give a notification to the own task and take it.
+static void benchmark_notify_give_take(benchmark_result_t *p_result)
+{
+    uint32_t i;
+    uint64_t start;
+
+    for(i = 0u; i < (BENCHMARK_WARMUP + benchmarkITERATIONS); i++) {
+        start = benchmarkTIME_NOW();
+        (void)xTaskNotifyGive(benchmark_task);
+        (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if(i >= BENCHMARK_WARMUP) {
+            benchmark_result_add(p_result, start, benchmarkTIME_NOW());
+        }
+    }
+}
+
+
+// Round trip of a notification through the notification echo task.
+static void benchmark_notify_pingpong(benchmark_result_t *p_result)
+{
+    uint32_t i;
+    uint64_t start;
+
+    if(benchmark_echo_start(benchmark_notify_echo) != pdPASS) {
+        return;
+    }
+
+    for(i = 0u; i < (BENCHMARK_WARMUP + benchmarkITERATIONS); i++) {
+        start = benchmarkTIME_NOW();
+        (void)xTaskNotifyGive(benchmark_echo_task);
+        (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if(i >= BENCHMARK_WARMUP) {
+            benchmark_result_add(p_result, start, benchmarkTIME_NOW());
+        }
+    }
+
+    benchmark_echo_stop();
+}
+
+
+// Start and stop a software timer. The timer never expires.
+static void benchmark_timer_start_stop(benchmark_result_t *p_result)
+{
+    uint32_t i;
+    uint64_t start;
+
+    for(i = 0u; i < (BENCHMARK_WARMUP + benchmarkITERATIONS); i++) {
+        start = benchmarkTIME_NOW();
+        (void)xTimerStart(benchmark_timer, portMAX_DELAY);
+        (void)xTimerStop(benchmark_timer, portMAX_DELAY);
+        if(i >= BENCHMARK_WARMUP) {
+            benchmark_result_add(p_result, start, benchmarkTIME_NOW());
+        }
+    }
+}
+
+
+// Reset a running software timer, as done for watchdog style timeouts.
+static void benchmark_timer_reset(benchmark_result_t *p_result)
+{
+    uint32_t i;
+    uint64_t start;
+
+    (void)xTimerStart(benchmark_timer, portMAX_DELAY);
+    for(i = 0u; i < (BENCHMARK_WARMUP + benchmarkITERATIONS); i++) {
+        start = benchmarkTIME_NOW();
+        (void)xTimerReset(benchmark_timer, portMAX_DELAY);
+        if(i >= BENCHMARK_WARMUP) {
+            benchmark_result_add(p_result, start, benchmarkTIME_NOW());
+        }
+    }
+    (void)xTimerStop(benchmark_timer, portMAX_DELAY);
+}
+
+
+// Allocate and free blocks of mixed sizes, keeping up to BENCHMARK_HEAP_BLOCKS allocated so the
+// heap is fragmented. One iteration is one allocation and one free.
+static void benchmark_heap_churn(benchmark_result_t *p_result)
+{
+    void *p_blocks[BENCHMARK_HEAP_BLOCKS];
+    uint32_t i;
+    uint32_t slot;
+    uint32_t seed;
+    size_t size;
+    uint64_t start;
+
+    for(i = 0u; i < BENCHMARK_HEAP_BLOCKS; i++) {
+        p_blocks[i] = NULL;
+    }
+
+    seed = 1u;
+    for(i = 0u; i < (BENCHMARK_WARMUP + benchmarkITERATIONS); i++) {
+        seed = (seed * 1103515245u) + 12345u;
+        slot = (seed >> 16) % BENCHMARK_HEAP_BLOCKS;
+        size = 16u + ((seed >> 8) % 497u);
+
+        start = benchmarkTIME_NOW();
+        if(p_blocks[slot] != NULL) {
+            vPortFree(p_blocks[slot]);
+        }
+        p_blocks[slot] = pvPortMalloc(size);
+        if(i >= BENCHMARK_WARMUP) {
+            benchmark_result_add(p_result, start, benchmarkTIME_NOW());
+        }
+    }
+
+    for(i = 0u; i < BENCHMARK_HEAP_BLOCKS; i++) {
+        if(p_blocks[i] != NULL) {
+            vPortFree(p_blocks[i]);
+        }
+    }
+}
+
+
+typedef struct {
+    const char *p_name;
+    void (*p_run)(benchmark_result_t *p_result);
+} benchmark_test_t;
+
+static const benchmark_test_t benchmark_tests[] = {
+    {"empty", benchmark_empty},
+    {"queue_send_receive", benchmark_queue_send_receive},
+    {"queue_pingpong", benchmark_queue_pingpong},
+    {"semaphore_give_take", benchmark_sem_give_take},
+    {"semaphore_pingpong", benchmark_sem_pingpong},
+    {"notify_give_take", benchmark_notify_give_take},
+    {"notify_pingpong", benchmark_notify_pingpong},
+    {"timer_start_stop", benchmark_timer_start_stop},
+    {"timer_reset", benchmark_timer_reset},
+    {"heap_malloc_free", benchmark_heap_churn},
+};
+
+
+static void benchmark_task_entry(void *p_arg)
+{
+    benchmark_result_t result;
+    uint32_t i;
+
+    (void)p_arg;
+
+    benchmark_queue_ping = xQueueCreate(1u, sizeof(uint32_t));
+    benchmark_queue_pong = xQueueCreate(1u, sizeof(uint32_t));
+    benchmark_sem_ping = xSemaphoreCreateBinary();
+    benchmark_sem_pong = xSemaphoreCreateBinary();
+    benchmark_timer = xTimerCreate("benchmark", 1000u, pdFALSE, NULL, benchmark_timer_callback);
+    if((benchmark_queue_ping == NULL) || (benchmark_queue_pong == NULL) ||
+       (benchmark_sem_ping == NULL) || (benchmark_sem_pong == NULL) || (benchmark_timer == NULL)) {
+        benchmarkPRINTF("benchmark: object creation failed\n");
+        vFreeRTOSBenchmarkDone();
+        for(;;) {
+            vTaskDelay(portMAX_DELAY);
+        }
+    }
+
+    benchmarkPRINTF("backend,test,iterations,avg_ns,min_ns,max_ns\n");
+    for(i = 0u; i < (sizeof(benchmark_tests) / sizeof(benchmark_tests[0])); i++) {
+        benchmark_result_init(&result);
+        benchmark_tests[i].p_run(&result);
+        benchmark_result_print(benchmark_tests[i].p_name, &result);
+    }
+
+    vFreeRTOSBenchmarkDone();
+    for(;;) {
+        vTaskDelay(portMAX_DELAY);
+    }
+}
+
+
+BaseType_t xFreeRTOSBenchmarkCreate(void)
+{
+    return xTaskCreate(benchmark_task_entry, "benchmark", benchmarkTASK_STACK_SIZE, NULL,
+                       benchmarkTASK_PRIORITY, &benchmark_task);
+}
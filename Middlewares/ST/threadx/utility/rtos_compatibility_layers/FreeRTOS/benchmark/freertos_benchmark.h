@@ -0,0 +1,75 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   FreeRTOS compatibility Kit - API Benchmark                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#ifndef FREERTOS_BENCHMARK_H
+#define FREERTOS_BENCHMARK_H
+
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+// The benchmark only uses the FreeRTOS API, so the same source measures the native FreeRTOS
+// kernel and the ThreadX adaptation layer. The build provides the following, either in
+// FreeRTOSConfig.h or on the command line:
+//
+//  benchmarkTIME_NOW()             Returns a free running uint64_t count of a high resolution
+//                                  time source, such as a cycle counter or a host clock.
+//  benchmarkTIME_FREQUENCY_HZ      Frequency of the time source, used to report nanoseconds.
+//  benchmarkBACKEND_NAME           Optional, name of the kernel printed with the results.
+//  benchmarkPRINTF                 Optional, printf compatible function used for the results.
+//  benchmarkITERATIONS             Optional, number of measured iterations per test.
+//  benchmarkTASK_PRIORITY          Optional, priority of the benchmark task. The echo task of
+//                                  the ping-pong tests runs one priority higher.
+//
+// The results are printed as CSV, one line per test, with the average, minimum and maximum
+// latency of one iteration in nanoseconds. The "empty" test measures the time source itself.
+
+#ifndef benchmarkBACKEND_NAME
+#define benchmarkBACKEND_NAME           "unknown"
+#endif
+
+#ifndef benchmarkPRINTF
+#include <stdio.h>
+#define benchmarkPRINTF                 printf
+#endif
+
+#ifndef benchmarkITERATIONS
+#define benchmarkITERATIONS             10000u
+#endif
+
+#ifndef benchmarkTASK_PRIORITY
+#define benchmarkTASK_PRIORITY          (tskIDLE_PRIORITY + 2u)
+#endif
+
+#ifndef benchmarkTASK_STACK_SIZE
+#define benchmarkTASK_STACK_SIZE        (configMINIMAL_STACK_SIZE * 4u)
+#endif
+
+// Create the benchmark task. Call before starting the scheduler, or from a task. The task runs
+// every test once, prints the results and then calls vFreeRTOSBenchmarkDone().
+BaseType_t xFreeRTOSBenchmarkCreate(void);
+
+// Called by the benchmark task once all results are printed. Provided by the application, a
+// host build typically exits.
+void vFreeRTOSBenchmarkDone(void);
+
+#endif // FREERTOS_BENCHMARK_H
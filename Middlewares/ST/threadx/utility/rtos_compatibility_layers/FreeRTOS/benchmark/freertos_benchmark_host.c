@@ -0,0 +1,91 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   FreeRTOS compatibility Kit - API Benchmark                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+// Host entry point of the FreeRTOS API benchmark. Built with BENCHMARK_THREADX defined it runs on
+// the ThreadX adaptation layer and the ThreadX Linux port, otherwise on the native FreeRTOS kernel.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "freertos_benchmark.h"
+
+
+uint64_t freertos_benchmark_host_time_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000000ull) + (uint64_t)ts.tv_nsec;
+}
+
+
+void vFreeRTOSBenchmarkDone(void)
+{
+    fflush(stdout);
+    exit(0);
+}
+
+
+#ifdef BENCHMARK_THREADX
+VOID tx_application_define(VOID *first_unused_memory)
+{
+    (void)first_unused_memory;
+
+    if((tx_freertos_init() != TX_SUCCESS) || (xFreeRTOSBenchmarkCreate() != pdPASS)) {
+        printf("benchmark: initialization failed\n");
+        exit(1);
+    }
+}
+
+
+int main(void)
+{
+    tx_kernel_enter();
+
+    return 0;
+}
+#else
+void vAssertCalled(const char *pcFile, int iLine)
+{
+    printf("benchmark: assertion failed at %s:%d\n", pcFile, iLine);
+    fflush(stdout);
+    abort();
+}
+
+
+int main(void)
+{
+    if(xFreeRTOSBenchmarkCreate() != pdPASS) {
+        printf("benchmark: initialization failed\n");
+        return 1;
+    }
+
+    vTaskStartScheduler();
+
+    return 0;
+}
+#endif
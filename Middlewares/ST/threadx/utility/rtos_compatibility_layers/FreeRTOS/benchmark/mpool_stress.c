@@ -0,0 +1,357 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   FreeRTOS compatibility Kit - API Benchmark                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+// Host stress test and benchmark of the CMSIS-RTOS2 memory pools of the FreeRTOS wrapper
+// (CMSIS_RTOS_V2/cmsis_os2.c), on the native FreeRTOS kernel and its POSIX port.
+//
+// - Host threads allocate and free blocks concurrently without timeout, which only uses the
+//   lock-free free list, before the scheduler starts. They are preempted at any instruction,
+//   and run in parallel on a multi-core host.
+// - Kernel tasks of the same priority, time sliced by the tick, allocate with timeouts from a
+//   pool too small for all of them, so they block on the empty pool and are woken by the frees
+//   of the other tasks.
+// - Every allocated block is stamped with its owner and checked before it is freed, so a block
+//   handed out twice is detected.
+//
+// The results are printed as CSV, `native,test,iterations,avg_ns,min_ns,max_ns` as in the API
+// benchmark, followed by `mpool: PASS` or the first failure. The exit status is 0 on success.
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "cmsis_os2.h"
+
+#define MPOOL_BLOCK_COUNT               32u
+#define MPOOL_BLOCK_SIZE                24u
+#define MPOOL_HOST_THREADS              4u
+#define MPOOL_HOST_ITERATIONS           200000u
+#define MPOOL_HOLD_MAX                  4u
+#define MPOOL_TASKS                     4u
+#define MPOOL_TASK_ITERATIONS           1000u
+#define MPOOL_TASK_HOLD_MAX             10u
+#define MPOOL_BENCHMARK_ITERATIONS      100000u
+#define MPOOL_TIMEOUT_TICKS             5u
+
+typedef struct {
+    volatile uint32_t owner;
+    volatile uint32_t sequence;
+} mpool_stamp_t;
+
+static osMemoryPoolId_t mpool_id;
+static volatile uint32_t mpool_failures;
+static const char *mpool_failure;
+static volatile uint32_t mpool_tasks_done;
+static volatile uint32_t mpool_blocked_allocs;
+
+
+static uint64_t mpool_time_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000000ull) + (uint64_t)ts.tv_nsec;
+}
+
+
+static void mpool_fail(const char *p_reason)
+{
+    if(mpool_failures++ == 0u) {
+        mpool_failure = p_reason;
+    }
+}
+
+
+static uint32_t mpool_random(uint32_t *p_state)
+{
+    *p_state = (*p_state * 1103515245u) + 12345u;
+
+    return *p_state >> 16;
+}
+
+
+// Stamps a newly allocated block with its owner, checked again before the block is freed.
+static void mpool_stamp(void *p_block, uint32_t owner, uint32_t sequence)
+{
+    mpool_stamp_t *p_stamp = p_block;
+
+    p_stamp->owner = owner;
+    p_stamp->sequence = sequence;
+}
+
+
+static void mpool_check_and_free(void *p_block, uint32_t owner, uint32_t sequence)
+{
+    mpool_stamp_t *p_stamp = p_block;
+
+    if((p_stamp->owner != owner) || (p_stamp->sequence != sequence)) {
+        mpool_fail("block owned twice");
+    }
+
+    if(osMemoryPoolFree(mpool_id, p_block) != osOK) {
+        mpool_fail("osMemoryPoolFree() failed");
+    }
+}
+
+
+static void mpool_print(const char *p_test, uint32_t count, uint64_t total, uint64_t min, uint64_t max)
+{
+    printf("native,%s,%u,%llu,%llu,%llu\n", p_test, (unsigned)count,
+           (unsigned long long)(count ? (total / count) : 0u), (unsigned long long)(count ? min : 0u),
+           (unsigned long long)max);
+}
+
+
+static void *mpool_host_thread(void *p_arg)
+{
+    uint32_t owner = (uint32_t)(uintptr_t)p_arg;
+    uint32_t state = owner;
+    void *p_held[MPOOL_HOLD_MAX];
+    uint32_t sequence[MPOOL_HOLD_MAX];
+    uint32_t held = 0u;
+    uint32_t i;
+
+    for(i = 0u; i < MPOOL_HOST_ITERATIONS; i++) {
+        if((held < MPOOL_HOLD_MAX) && ((held == 0u) || (mpool_random(&state) & 1u))) {
+            p_held[held] = osMemoryPoolAlloc(mpool_id, 0u);
+            if(p_held[held] != NULL) {
+                sequence[held] = i;
+                mpool_stamp(p_held[held], owner, i);
+                held++;
+            }
+        }
+        else {
+            held--;
+            mpool_check_and_free(p_held[held], owner, sequence[held]);
+        }
+    }
+
+    while(held > 0u) {
+        held--;
+        mpool_check_and_free(p_held[held], owner, sequence[held]);
+    }
+
+    return NULL;
+}
+
+
+// Alloc/free pairs of host threads running concurrently, outside of the kernel.
+static void mpool_host_test(void)
+{
+    pthread_t threads[MPOOL_HOST_THREADS];
+    uint64_t start;
+    uint64_t end;
+    uint32_t i;
+
+    start = mpool_time_now();
+    for(i = 0u; i < MPOOL_HOST_THREADS; i++) {
+        if(pthread_create(&threads[i], NULL, mpool_host_thread, (void *)(uintptr_t)(i + 1u)) != 0) {
+            mpool_fail("pthread_create() failed");
+            return;
+        }
+    }
+    for(i = 0u; i < MPOOL_HOST_THREADS; i++) {
+        (void)pthread_join(threads[i], NULL);
+    }
+    end = mpool_time_now();
+
+    mpool_print("mpool_host_threads", MPOOL_HOST_THREADS * MPOOL_HOST_ITERATIONS, end - start, 0u, 0u);
+
+    if((osMemoryPoolGetCount(mpool_id) != 0u) || (osMemoryPoolGetSpace(mpool_id) != MPOOL_BLOCK_COUNT)) {
+        mpool_fail("blocks lost by the host threads");
+    }
+}
+
+
+static void mpool_worker(void *p_arg)
+{
+    uint32_t owner = (uint32_t)(uintptr_t)p_arg;
+    uint32_t state = owner * 7919u;
+    void *p_held[MPOOL_TASK_HOLD_MAX];
+    uint32_t sequence[MPOOL_TASK_HOLD_MAX];
+    uint32_t held = 0u;
+    uint32_t i;
+
+    for(i = 0u; i < MPOOL_TASK_ITERATIONS; i++) {
+        if((held < MPOOL_TASK_HOLD_MAX) && ((held == 0u) || (mpool_random(&state) % 3u))) {
+            // Up to MPOOL_TASKS * MPOOL_TASK_HOLD_MAX blocks are wanted from a smaller pool, so
+            // the allocations often block until another task frees a block.
+            if(osMemoryPoolGetSpace(mpool_id) == 0u) {
+                mpool_blocked_allocs++;
+            }
+            p_held[held] = osMemoryPoolAlloc(mpool_id, 1u + (mpool_random(&state) % 3u));
+            if(p_held[held] != NULL) {
+                sequence[held] = i;
+                mpool_stamp(p_held[held], owner, i);
+                held++;
+            }
+        }
+        else {
+            held--;
+            mpool_check_and_free(p_held[held], owner, sequence[held]);
+        }
+
+        if((mpool_random(&state) & 15u) == 0u) {
+            (void)osThreadYield();
+        }
+    }
+
+    while(held > 0u) {
+        held--;
+        mpool_check_and_free(p_held[held], owner, sequence[held]);
+    }
+
+    mpool_tasks_done++;
+    (void)osThreadTerminate(osThreadGetId());
+}
+
+
+static void mpool_releaser(void *p_arg)
+{
+    (void)osDelay(2u);
+    mpool_check_and_free(p_arg, 0u, 0u);
+    (void)osThreadTerminate(osThreadGetId());
+}
+
+
+static void mpool_control(void *p_arg)
+{
+    void *p_blocks[MPOOL_BLOCK_COUNT];
+    uint64_t start;
+    uint64_t end;
+    uint64_t total = 0u;
+    uint64_t min = UINT64_MAX;
+    uint64_t max = 0u;
+    uint32_t tick;
+    uint32_t i;
+    void *p_block;
+
+    (void)p_arg;
+
+    // Alloc/free pair latency within one task.
+    for(i = 0u; i < MPOOL_BENCHMARK_ITERATIONS; i++) {
+        start = mpool_time_now();
+        p_block = osMemoryPoolAlloc(mpool_id, 0u);
+        (void)osMemoryPoolFree(mpool_id, p_block);
+        end = mpool_time_now();
+
+        total += end - start;
+        min = (end - start < min) ? end - start : min;
+        max = (end - start > max) ? end - start : max;
+    }
+
+    // An allocation from an empty pool times out.
+    for(i = 0u; i < MPOOL_BLOCK_COUNT; i++) {
+        p_blocks[i] = osMemoryPoolAlloc(mpool_id, 0u);
+        if(p_blocks[i] == NULL) {
+            mpool_fail("pool exhausted early");
+        }
+        mpool_stamp(p_blocks[i], 0u, 0u);
+    }
+    tick = osKernelGetTickCount();
+    if(osMemoryPoolAlloc(mpool_id, MPOOL_TIMEOUT_TICKS) != NULL) {
+        mpool_fail("allocation from an empty pool");
+    }
+    if((osKernelGetTickCount() - tick) < MPOOL_TIMEOUT_TICKS) {
+        mpool_fail("allocation timed out early");
+    }
+
+    // A block freed by another task wakes up a task waiting forever.
+    if(osThreadNew(mpool_releaser, p_blocks[0], NULL) == NULL) {
+        mpool_fail("osThreadNew() failed");
+    }
+    p_block = osMemoryPoolAlloc(mpool_id, osWaitForever);
+    if(p_block != p_blocks[0]) {
+        mpool_fail("waiting task not given the freed block");
+    }
+    p_blocks[0] = p_block;
+    mpool_stamp(p_blocks[0], 0u, 0u);
+    for(i = 0u; i < MPOOL_BLOCK_COUNT; i++) {
+        mpool_check_and_free(p_blocks[i], 0u, 0u);
+    }
+
+    // Tasks time sliced by the tick, blocking on the empty pool.
+    for(i = 0u; i < MPOOL_TASKS; i++) {
+        if(osThreadNew(mpool_worker, (void *)(uintptr_t)(0x100u + i), NULL) == NULL) {
+            mpool_fail("osThreadNew() failed");
+        }
+    }
+    start = mpool_time_now();
+    while(mpool_tasks_done < MPOOL_TASKS) {
+        (void)osDelay(1u);
+    }
+    end = mpool_time_now();
+
+    if((osMemoryPoolGetCount(mpool_id) != 0u) || (osMemoryPoolGetSpace(mpool_id) != MPOOL_BLOCK_COUNT)) {
+        mpool_fail("blocks lost by the tasks");
+    }
+
+    vTaskSuspendAll();
+    mpool_print("mpool_alloc_free", MPOOL_BENCHMARK_ITERATIONS, total, min, max);
+    mpool_print("mpool_tasks", MPOOL_TASKS * MPOOL_TASK_ITERATIONS, end - start, 0u, 0u);
+    printf("mpool: %u allocations from an empty pool\n", (unsigned)mpool_blocked_allocs);
+    (void)xTaskResumeAll();
+
+    vTaskEndScheduler();
+}
+
+
+void vAssertCalled(const char *pcFile, int iLine)
+{
+    printf("mpool: assertion failed at %s:%d\n", pcFile, iLine);
+    fflush(stdout);
+    abort();
+}
+
+
+int main(void)
+{
+    (void)osKernelInitialize();
+
+    mpool_id = osMemoryPoolNew(MPOOL_BLOCK_COUNT, MPOOL_BLOCK_SIZE, NULL);
+    if(mpool_id == NULL) {
+        printf("mpool: initialization failed\n");
+        return 1;
+    }
+
+    mpool_host_test();
+
+    if(osThreadNew(mpool_control, NULL, NULL) == NULL) {
+        printf("mpool: initialization failed\n");
+        return 1;
+    }
+    (void)osKernelStart();
+
+    if(mpool_failures != 0u) {
+        printf("mpool: FAIL, %s (%u failures)\n", mpool_failure, (unsigned)mpool_failures);
+        return 1;
+    }
+
+    printf("mpool: PASS\n");
+
+    return 0;
+}
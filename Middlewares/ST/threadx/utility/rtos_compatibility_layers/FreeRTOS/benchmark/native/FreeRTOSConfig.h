@@ -0,0 +1,85 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   FreeRTOS compatibility Kit - API Benchmark                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+/* Configuration of the native FreeRTOS kernel for the host build of the FreeRTOS API
+   benchmark on the POSIX port. The CMSIS-RTOS2 wrapper is linked in as well, so the
+   configuration also meets its requirements.  */
+
+#include <stdint.h>
+
+#define configUSE_PREEMPTION                       1
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION    0
+#define configUSE_IDLE_HOOK                        0
+#define configUSE_TICK_HOOK                        0
+#define configCPU_CLOCK_HZ                         (100000000u)
+#define configTICK_RATE_HZ                         (100u)
+#define configMAX_PRIORITIES                       (56u)
+#define configMINIMAL_STACK_SIZE                   (256u)
+#define configTOTAL_HEAP_SIZE                      (1024u * 256u)
+#define configMAX_TASK_NAME_LEN                    (16)
+#define configUSE_TRACE_FACILITY                   1
+#define configUSE_16_BIT_TICKS                     0
+#define configIDLE_SHOULD_YIELD                    1
+#define configUSE_MUTEXES                          1
+#define configUSE_RECURSIVE_MUTEXES                1
+#define configUSE_COUNTING_SEMAPHORES              1
+#define configUSE_TASK_NOTIFICATIONS               1
+#define configQUEUE_REGISTRY_SIZE                  8
+#define configCHECK_FOR_STACK_OVERFLOW             0
+#define configUSE_MALLOC_FAILED_HOOK               0
+#define configSUPPORT_STATIC_ALLOCATION            1
+#define configSUPPORT_DYNAMIC_ALLOCATION           1
+#define configSTACK_DEPTH_TYPE                     uint32_t
+
+#define configUSE_TIMERS                           1
+#define configTIMER_TASK_PRIORITY                  (configMAX_PRIORITIES - 1u)
+#define configTIMER_QUEUE_LENGTH                   16
+#define configTIMER_TASK_STACK_DEPTH               (configMINIMAL_STACK_SIZE * 2u)
+
+#define INCLUDE_vTaskPrioritySet                   1
+#define INCLUDE_uxTaskPriorityGet                  1
+#define INCLUDE_vTaskDelete                        1
+#define INCLUDE_vTaskSuspend                       1
+#define INCLUDE_vTaskDelayUntil                    1
+#define INCLUDE_vTaskDelay                         1
+#define INCLUDE_xTaskGetSchedulerState             1
+#define INCLUDE_xTaskGetCurrentTaskHandle          1
+#define INCLUDE_uxTaskGetStackHighWaterMark        1
+#define INCLUDE_xSemaphoreGetMutexHolder           1
+#define INCLUDE_eTaskGetState                      1
+#define INCLUDE_xTimerPendFunctionCall             1
+
+/* Heap used by the build, the CMSIS-RTOS2 wrapper depends on it.  */
+#define USE_FreeRTOS_HEAP_4
+
+#define configASSERT(x)                            if((x) == 0) { vAssertCalled(__FILE__, __LINE__); }
+void vAssertCalled(const char *pcFile, int iLine);
+
+/* Benchmark configuration, see freertos_benchmark.h.  */
+uint64_t freertos_benchmark_host_time_now(void);
+#define benchmarkTIME_NOW()                        freertos_benchmark_host_time_now()
+#define benchmarkTIME_FREQUENCY_HZ                 1000000000u
+#define benchmarkBACKEND_NAME                      "native"
+
+#endif
@@ -0,0 +1,53 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   FreeRTOS compatibility Kit                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+/* Configuration of the ThreadX adaptation layer for the host build of the FreeRTOS API
+   benchmark on the ThreadX Linux port.  */
+
+#include <stdint.h>
+
+#define configTICK_RATE_HZ                         (100u)
+#define configMAX_PRIORITIES                       (32u)
+#define configMINIMAL_STACK_SIZE                   (4096u)
+#define configTOTAL_HEAP_SIZE                      (1024u * 256u)
+#define configUSE_16_BIT_TICKS                      0
+#define configSTACK_DEPTH_TYPE                     uint32_t
+#define INCLUDE_vTaskDelete                        1
+
+#define configASSERT(x)
+#define TX_FREERTOS_ASSERT_FAIL()
+
+/* The Linux port emulates interrupts with a mutex.  */
+#define taskENTER_CRITICAL_FROM_ISR()              _tx_thread_interrupt_disable();
+#define taskEXIT_CRITICAL_FROM_ISR(x)              _tx_thread_interrupt_restore(x);
+#define portDISABLE_INTERRUPTS()                   _tx_thread_interrupt_disable()
+#define portENABLE_INTERRUPTS()                    _tx_thread_interrupt_restore(TX_INT_ENABLE)
+
+/* Benchmark configuration, see freertos_benchmark.h.  */
+uint64_t freertos_benchmark_host_time_now(void);
+#define benchmarkTIME_NOW()                        freertos_benchmark_host_time_now()
+#define benchmarkTIME_FREQUENCY_HZ                 1000000000u
+#define benchmarkBACKEND_NAME                      "threadx"
+
+#endif
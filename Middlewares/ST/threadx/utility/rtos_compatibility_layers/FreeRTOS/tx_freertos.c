@@ -146,6 +146,7 @@ static void txfr_idle_task_entry(ULONG id)
             }
 
             if(p_task->allocated == 1u) {
+                txfr_free(p_task->thread.tx_thread_stack_start);
                 txfr_free(p_task);
             }
         }
@@ -0,0 +1,164 @@
+/* This is a small benchmark of the message queues of the POSIX Compliancy Wrapper.              */
+/* A pthread fills a message queue with messages of mixed priorities and then drains it, for     */
+/* several queue depths, until BENCHMARK_TICKS ThreadX ticks have passed. The number of messages  */
+/* and the ticks spent in mq_send and mq_receive are printed per depth, and the receive order is */
+/* checked against the POSIX rules.                                                               */
+/* Build it once as is and once with PX_MQ_LEGACY_PRIORITY_SEARCH defined to compare the         */
+/* per-priority message lists with the original implementation.                                 */
+
+#include   "pthread.h"
+
+#define     BENCHMARK_STACK_SIZE        4096
+#define     BENCHMARK_MESSAGE_SIZE      16
+#define     BENCHMARK_TICKS             (2 * TX_TIMER_TICKS_PER_SECOND)
+#define     BENCHMARK_DEPTHS            4
+
+/* Define the queue depths to measure.  */
+
+ULONG                   benchmark_depth[BENCHMARK_DEPTHS] = { 8, 32, 64, 100 };
+
+/* Define the POSIX pthread object control block and attributes.  */
+
+pthread_t               benchmark_pthread;
+pthread_attr_t          benchmark_attr;
+
+/* Define the message queue attribute and descriptor.  */
+
+struct mq_attr          benchmark_queue_attr;
+mqd_t                   benchmark_queue;
+
+/* Define the results of the benchmark.  */
+
+ULONG                   benchmark_messages[BENCHMARK_DEPTHS];
+ULONG                   benchmark_send_ticks[BENCHMARK_DEPTHS];
+ULONG                   benchmark_receive_ticks[BENCHMARK_DEPTHS];
+ULONG                   benchmark_order_errors[BENCHMARK_DEPTHS];
+
+/* Define pthread function prototype.  */
+
+VOID    *benchmark_pthread_entry(VOID *);
+
+
+/* Define main entry point.  */
+
+INT main()
+{
+
+    /* Enter the ThreadX kernel.  */
+    tx_kernel_enter();
+}
+
+ULONG free_memory[192*1024 / sizeof(ULONG)];
+/* Define what the initial system looks like.  */
+VOID tx_application_define(VOID *first_unused_memory)
+{
+
+VOID* storage_ptr;
+
+
+struct sched_param  param;
+
+    benchmark_queue_attr.mq_maxmsg  = MQ_MAXMSG;
+    benchmark_queue_attr.mq_msgsize = BENCHMARK_MESSAGE_SIZE;
+
+    /* Init POSIX Wrapper */
+    storage_ptr = (VOID*) posix_initialize(free_memory);
+
+    /* Create the benchmark pthread.  */
+    pthread_attr_init(&benchmark_attr);
+    memset(&param, 0, sizeof(param));
+    param.sched_priority = 10;
+    pthread_attr_setschedparam(&benchmark_attr, &param);
+    pthread_attr_setstackaddr(&benchmark_attr, storage_ptr);
+    pthread_attr_setstacksize(&benchmark_attr, BENCHMARK_STACK_SIZE);
+    pthread_create (&benchmark_pthread, &benchmark_attr, benchmark_pthread_entry, NULL);
+}
+
+
+/* Fill the queue with depth messages and drain it again, until BENCHMARK_TICKS have been spent in
+   mq_send and mq_receive.  Each message carries its priority and a sequence number, so the
+   receive order can be checked: priorities must not increase and messages of the same priority
+   must come out in the order they were sent.  */
+static VOID benchmark_run(ULONG index, ULONG depth)
+{
+
+ULONG   message[BENCHMARK_MESSAGE_SIZE / sizeof(ULONG)];
+ULONG   last_sequence[MQ_PRIO_MAX + 1];
+ULONG   last_priority;
+ULONG   priority;
+ULONG   sequence;
+ULONG   i;
+ULONG   start;
+
+
+    sequence = 0;
+    while ((benchmark_send_ticks[index] + benchmark_receive_ticks[index]) < BENCHMARK_TICKS)
+    {
+
+        /* Fill the queue, with priorities spread over the whole range.  */
+        start = tx_time_get();
+        for (i = 0; i < depth; i++)
+        {
+            sequence++;
+            message[0] = (sequence * 7) % (MQ_PRIO_MAX + 1);
+            message[1] = sequence;
+            mq_send(benchmark_queue, (CHAR *)message, sizeof(message), message[0]);
+        }
+        benchmark_send_ticks[index] += tx_time_get() - start;
+
+        /* Drain the queue.  */
+        for (priority = 0; priority <= MQ_PRIO_MAX; priority++)
+        {
+            last_sequence[priority] = 0;
+        }
+        last_priority = MQ_PRIO_MAX;
+        start = tx_time_get();
+        for (i = 0; i < depth; i++)
+        {
+            mq_receive(benchmark_queue, (CHAR *)message, sizeof(message), &priority);
+            if ((priority != message[0]) || (priority > last_priority) ||
+                (message[1] <= last_sequence[priority]))
+            {
+                benchmark_order_errors[index]++;
+            }
+            last_priority = priority;
+            last_sequence[priority] = message[1];
+        }
+        benchmark_receive_ticks[index] += tx_time_get() - start;
+        benchmark_messages[index] += depth;
+    }
+}
+
+
+VOID    *benchmark_pthread_entry(VOID *pthread0_input)
+{
+
+ULONG   i;
+
+
+    benchmark_queue = mq_open("Benchmark", O_CREAT | O_RDWR, 0, &benchmark_queue_attr);
+    if (benchmark_queue == (mqd_t)ERROR)
+    {
+        printf("mq_open failed, errno %d\n", (INT) posix_errno);
+        return(NULL);
+    }
+
+    for (i = 0; i < BENCHMARK_DEPTHS; i++)
+    {
+        benchmark_run(i, benchmark_depth[i]);
+    }
+
+    printf("depth,messages,send_ticks,receive_ticks,order_errors\n");
+    for (i = 0; i < BENCHMARK_DEPTHS; i++)
+    {
+        printf("%lu,%lu,%lu,%lu,%lu\n", (unsigned long) benchmark_depth[i],
+               (unsigned long) benchmark_messages[i],
+               (unsigned long) benchmark_send_ticks[i], (unsigned long) benchmark_receive_ticks[i],
+               (unsigned long) benchmark_order_errors[i]);
+    }
+
+    mq_close(benchmark_queue);
+    mq_unlink("Benchmark");
+
+    return(NULL);
+}
@@ -143,6 +143,10 @@ ULONG                 posix_arrange_msg( TX_QUEUE * Queue, ULONG * pMsgPrio );
 
 ULONG                 posix_priority_search(mqd_t msgQId ,ULONG priority);
 
+VOID                  posix_mq_message_put(POSIX_MSG_QUEUE * q_ptr, POSIX_MQ_MESSAGE * message);
+
+POSIX_MQ_MESSAGE     *posix_mq_message_get(POSIX_MSG_QUEUE * q_ptr);
+
 VOID                  posix_queue_init(VOID);
 
 VOID                  posix_qattr_init(VOID);
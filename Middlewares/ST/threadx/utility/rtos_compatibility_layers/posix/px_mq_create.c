@@ -64,6 +64,7 @@
 /*    tx_queue_delete                       to delete the queue           */
 /*    posix_putback_queue                   to delete the queue           */
 /*    tx_byte_pool_create                   to create a byte pool         */
+/*    tx_block_pool_create                  to create a block pool        */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -90,6 +91,10 @@ VOID               *bp;
 INT                 retval;
 ULONG               size;
 TX_QUEUE           *TheQ;
+#ifndef PX_MQ_LEGACY_PRIORITY_SEARCH
+ULONG               block_size;
+ULONG               priority;
+#endif
 
     /* Make sure we're calling this routine from a thread context.  */
     if (!posix_in_thread_context())
@@ -151,6 +156,14 @@ TX_QUEUE           *TheQ;
     /* Flags are stored in que descriptor structure and 
        not in mq_att structure.  */
 
+#ifndef PX_MQ_LEGACY_PRIORITY_SEARCH
+    /* Create a block pool for the queue, with one block per message.  Each
+       block holds the message header and the message, the block pool adds
+       one pointer per block and rounds the block size up to a pointer.  */
+    block_size = sizeof(POSIX_MQ_MESSAGE) + msgq_attr->mq_msgsize;
+    block_size = ((block_size + (sizeof(ALIGN_TYPE) - 1)) / sizeof(ALIGN_TYPE)) * sizeof(ALIGN_TYPE);
+    size = msgq_attr->mq_maxmsg * (block_size + sizeof(UCHAR *));
+#else
     /* Create a byte pool for the  queue.  
        Determine how much memory we need to store all messages in this queue.   
        11 bytes are added to counter overhead as well as alignment problem if any.  */
@@ -158,6 +171,7 @@ TX_QUEUE           *TheQ;
 
     if(size < 100)
         size = 100;
+#endif
 
     /* Now attempt to allocate that much memory for the queue.  */
 
@@ -199,9 +213,26 @@ TX_QUEUE           *TheQ;
         /* Return ERROR.  */
         return(TX_NULL);
     }
+#ifndef PX_MQ_LEGACY_PRIORITY_SEARCH
+    /* Create a ThreadX block pool that will provide the message blocks.  */
+    retval = tx_block_pool_create((&(posix_q->vq_message_pool)), "POSIX Queue",
+                                    block_size, bp, size);
+
+    /* Start with no messages at any priority.  */
+    for (priority = 0; priority <= MQ_PRIO_MAX; priority++)
+    {
+        posix_q->vq_message_head[priority] = TX_NULL;
+        posix_q->vq_message_tail[priority] = TX_NULL;
+    }
+    for (priority = 0; priority < PX_MQ_PRIORITY_MAP_SIZE; priority++)
+    {
+        posix_q->vq_priority_map[priority] = 0;
+    }
+#else
     /* Create a ThreadX byte pool that will provide memory needed by the queue.  */
     retval = tx_byte_pool_create((&(posix_q->vq_message_area)), "POSIX Queue",
                                     bp, size);
+#endif
 
     /* Make sure the byte pool was created successfully.  */
     if (retval)
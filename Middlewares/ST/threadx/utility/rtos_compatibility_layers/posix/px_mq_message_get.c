@@ -0,0 +1,107 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** POSIX wrapper for THREADX                                             */
+/**                                                                       */
+/**                                                                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"     /* Threadx API */
+#include "pthread.h"    /* Posix API */
+#include "px_int.h"     /* Posix helper functions */
+#include "tx_thread.h"  /* Lowest set bit calculation */
+
+
+/**************************************************************************/
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    posix_mq_message_get                                PORTABLE C      */
+/*                                                           6.2.0        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This routine removes the oldest message of the highest priority     */
+/*    from the message queue.                                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    q_ptr                  message queue                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    message                the message, or TX_NULL if the queue is empty*/
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    POSIX internal Code                                                 */
+/*                                                                        */
+/**************************************************************************/
+#ifndef PX_MQ_LEGACY_PRIORITY_SEARCH
+POSIX_MQ_MESSAGE * posix_mq_message_get(POSIX_MSG_QUEUE * q_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+POSIX_MQ_MESSAGE    *message;
+ULONG                word;
+ULONG                map;
+ULONG                bit;
+ULONG                priority;
+
+
+    message = TX_NULL;
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Find the first word of the map with a priority set.  */
+    for (word = 0; word < PX_MQ_PRIORITY_MAP_SIZE; word++)
+    {
+        if (q_ptr -> vq_priority_map[word] != 0)
+        {
+
+            /* Its lowest set bit is the highest priority with messages.  */
+            map = q_ptr -> vq_priority_map[word];
+            TX_LOWEST_SET_BIT_CALCULATE(map, bit)
+            priority = MQ_PRIO_MAX - ((word * 32) + bit);
+
+            /* Remove the oldest message of that priority.  */
+            message = q_ptr -> vq_message_head[priority];
+            q_ptr -> vq_message_head[priority] = message -> next;
+            if (message -> next == TX_NULL)
+            {
+                q_ptr -> vq_message_tail[priority] = TX_NULL;
+                q_ptr -> vq_priority_map[word] &= ~(((ULONG) 1) << bit);
+            }
+            break;
+        }
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    return(message);
+}
+#endif
@@ -0,0 +1,94 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** POSIX wrapper for THREADX                                             */
+/**                                                                       */
+/**                                                                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"     /* Threadx API */
+#include "pthread.h"    /* Posix API */
+#include "px_int.h"     /* Posix helper functions */
+
+
+/**************************************************************************/
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    posix_mq_message_put                                PORTABLE C      */
+/*                                                           6.2.0        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This routine appends a message to the FIFO list of its priority and */
+/*    marks the priority in the priority map of the queue.                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    q_ptr                  message queue                                */
+/*    message                message, with its length and priority set    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    POSIX internal Code                                                 */
+/*                                                                        */
+/**************************************************************************/
+#ifndef PX_MQ_LEGACY_PRIORITY_SEARCH
+VOID posix_mq_message_put(POSIX_MSG_QUEUE * q_ptr, POSIX_MQ_MESSAGE * message)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+ULONG                index;
+
+
+    /* Bit n of the map is priority MQ_PRIO_MAX - n, so the lowest set bit is
+       the highest priority.  */
+    index = MQ_PRIO_MAX - message -> priority;
+
+    message -> next = TX_NULL;
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Append the message to the list of its priority.  */
+    if (q_ptr -> vq_message_head[message -> priority] == TX_NULL)
+    {
+        q_ptr -> vq_message_head[message -> priority] = message;
+        q_ptr -> vq_priority_map[index / 32] |= (((ULONG) 1) << (index % 32));
+    }
+    else
+    {
+        q_ptr -> vq_message_tail[message -> priority] -> next = message;
+    }
+    q_ptr -> vq_message_tail[message -> priority] = message;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+}
+#endif
@@ -58,6 +58,8 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    posix_internal_error          Generic error handler                 */
+/*    posix_mq_message_get          Get highest priority message          */
+/*    tx_block_release              Release message block                 */
 /*    tx_queue_receive              ThreadX queue receive                 */
 /*    tx_byte_release               Release bytes                         */
 /*    posix_memory_allocate         Allocate memory                       */
@@ -83,11 +85,16 @@ TX_QUEUE            * Queue;
 POSIX_MSG_QUEUE     * q_ptr;
 INT                   temp1, retval = ERROR;
 ULONG                 wait_option,length_of_message, priority_of_message,mycount;
-ULONG               * my_ptr;
 CHAR                * this_ptr;
 VOID                * msgbuf1;
 UCHAR               * msgbuf2;
+#ifndef PX_MQ_LEGACY_PRIORITY_SEARCH
+ULONG                 msg[TX_POSIX_MESSAGE_SIZE];
+POSIX_MQ_MESSAGE    * message;
+#else
+ULONG               * my_ptr;
 VOID                * message_source;
+#endif
 
     /* Assign a temporary variable for clarity.  */ 
     Queue = &(mqdes->f_data->queue); 
@@ -141,6 +148,7 @@ VOID                * message_source;
             wait_option = TX_WAIT_FOREVER;
 
     
+#ifdef PX_MQ_LEGACY_PRIORITY_SEARCH
     /* Try to get a message from the message queue.  */
     /* Create a temporary buffer to get message pointer and message length.  */
     temp1 = posix_memory_allocate((sizeof(ULONG)) * TX_POSIX_MESSAGE_SIZE, (VOID**)&msgbuf1);
@@ -154,6 +162,10 @@ VOID                * message_source;
     }
     /* Arrange the messages in the queue as per the required priority.  */
     temp1 = posix_arrange_msg( Queue, pMsgPrio );
+#else
+    /* The queue message only counts the message, use a local buffer.  */
+    msgbuf1 = (VOID *)msg;
+#endif
     /* Receive the message */
     temp1 = tx_queue_receive(Queue, msgbuf1, wait_option);
    /* Some ThreadX error codes map to posix error codes.  */
@@ -210,6 +222,51 @@ VOID                * message_source;
         }
     }
    
+#ifndef PX_MQ_LEGACY_PRIORITY_SEARCH
+    if ( temp1 != OK)
+    {
+        /* The queue was deleted while waiting.  */
+        posix_errno = EBADF;
+        posix_set_pthread_errno(EBADF);
+
+        /* Return ERROR.  */
+        return(ERROR);
+    }
+
+    /* Take the oldest message of the highest priority.  Every queue message
+       is sent after its message was added, so there is always one.  */
+    message = posix_mq_message_get(q_ptr);
+    if (message == TX_NULL)
+    {
+        /* return generic error.  */
+        posix_internal_error(100);
+
+        /* Return error.  */
+        return(ERROR);
+    }
+    length_of_message   = message -> length;
+    priority_of_message = message -> priority;
+
+    /* Copy message into supplied buffer.  */
+    this_ptr = (CHAR *)(message + 1);
+    msgbuf2  = (UCHAR *)pMsg;
+    for (mycount = 0; ( (mycount < length_of_message) && (mycount < msgLen)); mycount++)
+    {
+        *(msgbuf2++) = *((UCHAR *)(this_ptr++));
+    }
+
+    /* Release the message block, this lets a waiting sender continue.  */
+    retval = tx_block_release(message);
+
+    if( retval)
+    {
+        /* return generic error.  */
+        posix_internal_error(100);
+
+        /* Return error.  */
+        return(ERROR);
+    }
+#else
     /* Assign a variable for clarity.  */
     my_ptr = ( ULONG *)msgbuf1;
 
@@ -261,6 +318,7 @@ VOID                * message_source;
         /* Return error.  */
         return(ERROR);
     }
+#endif
 
     /* Copy message priority */ 
     if (pMsgPrio) 
@@ -52,6 +52,8 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    tx_byte_pool_delete                   Deletes byte pool             */
+/*    tx_block_pool_delete                  Deletes block pool            */
+/*    posix_memory_release                  Release message memory        */
 /*    posix_internal_error                  Returns generic error         */
 /*                                                                        */
 /*  CALLED BY                                                             */
@@ -79,12 +81,22 @@ VOID posix_reset_queue(POSIX_MSG_QUEUE * q_ptr)
     /* Reset storage */
     q_ptr -> storage = NULL;
 
+#ifndef PX_MQ_LEGACY_PRIORITY_SEARCH
+    /* Delete the message blocks and give their memory back.  */
+    posix_memory_release(q_ptr -> vq_message_pool.tx_block_pool_start);
+    if (tx_block_pool_delete(&(q_ptr -> vq_message_pool)))
+    {
+        /* Internal error.  */
+        posix_internal_error(444);
+    }
+#else
     /* Delete message area.  */
     if (tx_byte_pool_delete(&(q_ptr ->vq_message_area)))
     {
         /* Internal error.  */
         posix_internal_error(444);
     }
+#endif
     /* Reset queue id.  */
     q_ptr -> px_queue_id = 0;
 
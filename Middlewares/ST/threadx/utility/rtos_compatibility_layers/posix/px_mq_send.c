@@ -59,6 +59,8 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    tx_thread_identify                returns currently running thread  */
+/*    tx_block_allocate                 allocate message block            */
+/*    posix_mq_message_put              add message to its priority list  */
 /*    tx_byte_allocate                  allocate memory                   */
 /*    tx_queue_send                     ThreadX queue send                */
 /*    posix_priority_search             search message for same priority  */
@@ -87,9 +89,13 @@ POSIX_MSG_QUEUE    *q_ptr;
 VOID               *bp;
 UCHAR              *source;
 UCHAR              *destination;
-UCHAR              *save_ptr;
 ULONG               mycount;
 ULONG               msg[TX_POSIX_MESSAGE_SIZE];
+#ifndef PX_MQ_LEGACY_PRIORITY_SEARCH
+POSIX_MQ_MESSAGE   *message;
+#else
+UCHAR              *save_ptr;
+#endif
 
     /* Assign a temporary variable for clarity.  */ 
     Queue = &(mqdes->f_data->queue); 
@@ -167,6 +173,39 @@ ULONG               msg[TX_POSIX_MESSAGE_SIZE];
         return(ERROR);
     }
 
+#ifndef PX_MQ_LEGACY_PRIORITY_SEARCH
+    /* Allocate a message block from the queue's block pool.  There is one
+       block per message the queue can hold, so this waits while the queue
+       is full.  */
+    temp1 = tx_block_allocate(&(q_ptr->vq_message_pool), &bp, TX_WAIT_FOREVER);
+    if (temp1 != TX_SUCCESS)
+    {
+        /* POSIX doesn't have error for this, hence give default.  */
+        posix_errno = EINTR ;
+        posix_set_pthread_errno(EINTR);
+
+        /* Return ERROR.  */
+        return(ERROR);
+    }
+
+    /* Copy the message behind the message header.  */
+    message     =  (POSIX_MQ_MESSAGE * ) bp;
+    source      =  (UCHAR * ) msg_ptr;
+    destination =  (UCHAR * ) (message + 1);
+    for ( mycount = 0; mycount < msg_len; mycount++)
+    {
+
+        * destination++ =  * source++;
+    }
+    message -> length   =  msg_len;
+    message -> priority =  msg_prio;
+
+    /* Add the message to the list of its priority.  The ThreadX queue only
+       counts the messages and blocks the receivers, so the content of the
+       queue message is not used.  */
+    posix_mq_message_put(q_ptr, message);
+    msg[0] =  msg_prio;
+#else
     /* Now try to allocate memory to save the message from the 
       queue's byte pool.  */
     temp1 = tx_byte_allocate((TX_BYTE_POOL * )&(q_ptr->vq_message_area), &bp,
@@ -204,6 +243,7 @@ ULONG               msg[TX_POSIX_MESSAGE_SIZE];
     msg[1] =  msg_len;
     msg[2] =  msg_prio;
     msg[3] =  posix_priority_search(mqdes, msg_prio);
+#endif
 #endif
     /* Attempt to post the message to the queue.  */
     temp1 = tx_queue_send(Queue, msg, TX_WAIT_FOREVER);
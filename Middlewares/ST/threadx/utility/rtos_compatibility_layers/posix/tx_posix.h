@@ -68,6 +68,15 @@
 #define  MQ_FLAGS                       0
 #define  MQ_PRIO_MAX                    32              /* Maximum priority of message.    */
 
+/* Messages are kept in a FIFO list per priority, with a bitmap of the priorities that have
+   messages, so mq_send and mq_receive take constant time however many messages are queued.
+   Define PX_MQ_LEGACY_PRIORITY_SEARCH to use the original implementation instead, which keeps
+   the messages in the ThreadX queue and searches it on every send and receive.  */
+/* #define PX_MQ_LEGACY_PRIORITY_SEARCH */
+
+/* Number of ULONGs in the bitmap of message priorities 0 through MQ_PRIO_MAX.  */
+#define PX_MQ_PRIORITY_MAP_SIZE         ((MQ_PRIO_MAX / 32) + 1)
+
 #ifdef TX_64_BIT
 #define TX_POSIX_MESSAGE_SIZE           5
 #define TX_POSIX_QUEUE_PRIORITY_OFFSET  3
@@ -384,6 +393,17 @@ struct mq_attr
     ULONG         mq_flags;
 }; 
 
+/* Define the header of a queued message. The message itself follows the header.  */
+typedef struct posix_mq_message
+{
+    /* Next message of the same priority.  */
+    struct posix_mq_message     * next;
+    /* Length of the message.  */
+    ULONG                         length;
+    /* Priority of the message.  */
+    ULONG                         priority;
+} POSIX_MQ_MESSAGE;
+
 /* Define POSIX message queue structure.  */
 typedef struct msg_que
 {
@@ -401,8 +421,18 @@ typedef struct msg_que
     UINT                          open_count;
     /* Address for variable length message.  */
     VOID                        * storage;
+#ifdef PX_MQ_LEGACY_PRIORITY_SEARCH
     /* Byte pool for variable length message.  */
     TX_BYTE_POOL                  vq_message_area;
+#else
+    /* Block pool of messages, one block per message.  */
+    TX_BLOCK_POOL                 vq_message_pool;
+    /* Oldest and newest message of each priority.  */
+    POSIX_MQ_MESSAGE            * vq_message_head[MQ_PRIO_MAX + 1];
+    POSIX_MQ_MESSAGE            * vq_message_tail[MQ_PRIO_MAX + 1];
+    /* Priorities with messages, bit n of the map is priority MQ_PRIO_MAX - n.  */
+    ULONG                         vq_priority_map[PX_MQ_PRIORITY_MAP_SIZE];
+#endif
     /* POSIX queue ID.  */
     ULONG                         px_queue_id;
 
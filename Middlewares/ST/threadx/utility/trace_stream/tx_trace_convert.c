@@ -0,0 +1,912 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Trace Stream - Chrome/Perfetto Converter                            */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+/*  This is a host utility that converts a ThreadX trace into the Chrome trace event JSON
+    format, which can be opened in Perfetto (ui.perfetto.dev) or chrome://tracing. It reads
+    either a stream written by tx_trace_stream.c or a plain dump of a trace buffer, as
+    written by tx_trace_enable, in either byte order. Build and run with:
+
+        gcc -O2 -o tx_trace_convert tx_trace_convert.c
+        ./tx_trace_convert [-f frequency] trace.bin trace.json
+
+    The time stamps are converted to microseconds with the time source frequency in Hz, which
+    is taken from the stream header. For a buffer dump the frequency defaults to 1 MHz and
+    should be given with -f.
+
+    The JSON contains the following timelines:
+
+        Threads         one track per thread, with a "running" slice for each time the thread
+                        ran and a "ready" slice from the time the thread was resumed until it
+                        ran, which is its scheduling latency. All other events of the thread
+                        are instant events on its track.
+        Idle            the time no thread ran.
+        Interrupts      the ISR_ENTER/ISR_EXIT pairs, and the events inserted from ISRs.
+        Objects         one track per queue, semaphore, mutex, event flags group, pool or
+                        timer, with an instant event for each event that refers to it.
+
+    The running thread is reconstructed from the thread recorded with each event and from the
+    next thread recorded by the resume, suspend and time-slice events.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+
+/* Define the trace IDs.  */
+
+#define TRACE_BUFFER_ID                 0x54585442UL        /* TXTB, plain trace buffer     */
+#define TRACE_STREAM_ID                 0x54585453UL        /* TXTS, trace stream           */
+#define TRACE_STREAM_RECORD_OBJECT      1
+#define TRACE_STREAM_RECORD_EVENTS      2
+
+
+/* Define the special values of the thread pointer of an event.  */
+
+#define TRACE_THREAD_NOT_USED           0x00000000UL
+#define TRACE_THREAD_ISR                0xFFFFFFFFUL
+#define TRACE_THREAD_INITIALIZE         0xF0F0F0F0UL
+#define TRACE_INVALID_EVENT             0xFFFFFFFFUL
+
+
+/* Define the events used to reconstruct the timelines.  */
+
+#define TRACE_THREAD_RESUME             1
+#define TRACE_THREAD_SUSPEND            2
+#define TRACE_ISR_ENTER                 3
+#define TRACE_ISR_EXIT                  4
+#define TRACE_TIME_SLICE                5
+#define TRACE_USER_EVENT_START          4096
+
+
+/* Define the object types of the registry.  */
+
+#define TRACE_OBJECT_TYPE_NOT_VALID     0
+#define TRACE_OBJECT_TYPE_THREAD        1
+
+
+/* Define the fixed tracks.  */
+
+#define TRACK_PROCESS_THREADS           1
+#define TRACK_PROCESS_OBJECTS           2
+#define TRACK_INTERRUPTS                1
+#define TRACK_IDLE                      2
+#define TRACK_INITIALIZE                3
+#define TRACK_FIRST_THREAD              10
+#define TRACK_FIRST_OBJECT              1000
+
+
+/* Define the size of an event and of the header of a registry entry, without its name.  */
+
+#define TRACE_EVENT_SIZE                32
+#define TRACE_OBJECT_HEADER_SIZE        16
+
+
+/* Define the names of the ThreadX events.  */
+
+static const struct
+{
+    uint32_t        id;
+    const char      *name;
+} event_names[] =
+{
+    {  1, "THREAD_RESUME"},
+    {  2, "THREAD_SUSPEND"},
+    {  3, "ISR_ENTER"},
+    {  4, "ISR_EXIT"},
+    {  5, "TIME_SLICE"},
+    {  6, "RUNNING"},
+    { 10, "BLOCK_ALLOCATE"},
+    { 11, "BLOCK_POOL_CREATE"},
+    { 12, "BLOCK_POOL_DELETE"},
+    { 13, "BLOCK_POOL_INFO_GET"},
+    { 14, "BLOCK_POOL_PERFORMANCE_INFO_GET"},
+    { 15, "BLOCK_POOL__PERFORMANCE_SYSTEM_INFO_GET"},
+    { 16, "BLOCK_POOL_PRIORITIZE"},
+    { 17, "BLOCK_RELEASE"},
+    { 20, "BYTE_ALLOCATE"},
+    { 21, "BYTE_POOL_CREATE"},
+    { 22, "BYTE_POOL_DELETE"},
+    { 23, "BYTE_POOL_INFO_GET"},
+    { 24, "BYTE_POOL_PERFORMANCE_INFO_GET"},
+    { 25, "BYTE_POOL__PERFORMANCE_SYSTEM_INFO_GET"},
+    { 26, "BYTE_POOL_PRIORITIZE"},
+    { 27, "BYTE_RELEASE"},
+    { 30, "EVENT_FLAGS_CREATE"},
+    { 31, "EVENT_FLAGS_DELETE"},
+    { 32, "EVENT_FLAGS_GET"},
+    { 33, "EVENT_FLAGS_INFO_GET"},
+    { 34, "EVENT_FLAGS_PERFORMANCE_INFO_GET"},
+    { 35, "EVENT_FLAGS__PERFORMANCE_SYSTEM_INFO_GET"},
+    { 36, "EVENT_FLAGS_SET"},
+    { 37, "EVENT_FLAGS_SET_NOTIFY"},
+    { 40, "INTERRUPT_CONTROL"},
+    { 50, "MUTEX_CREATE"},
+    { 51, "MUTEX_DELETE"},
+    { 52, "MUTEX_GET"},
+    { 53, "MUTEX_INFO_GET"},
+    { 54, "MUTEX_PERFORMANCE_INFO_GET"},
+    { 55, "MUTEX_PERFORMANCE_SYSTEM_INFO_GET"},
+    { 56, "MUTEX_PRIORITIZE"},
+    { 57, "MUTEX_PUT"},
+    { 60, "QUEUE_CREATE"},
+    { 61, "QUEUE_DELETE"},
+    { 62, "QUEUE_FLUSH"},
+    { 63, "QUEUE_FRONT_SEND"},
+    { 64, "QUEUE_INFO_GET"},
+    { 65, "QUEUE_PERFORMANCE_INFO_GET"},
+    { 66, "QUEUE_PERFORMANCE_SYSTEM_INFO_GET"},
+    { 67, "QUEUE_PRIORITIZE"},
+    { 68, "QUEUE_RECEIVE"},
+    { 69, "QUEUE_SEND"},
+    { 70, "QUEUE_SEND_NOTIFY"},
+    { 80, "SEMAPHORE_CEILING_PUT"},
+    { 81, "SEMAPHORE_CREATE"},
+    { 82, "SEMAPHORE_DELETE"},
+    { 83, "SEMAPHORE_GET"},
+    { 84, "SEMAPHORE_INFO_GET"},
+    { 85, "SEMAPHORE_PERFORMANCE_INFO_GET"},
+    { 86, "SEMAPHORE__PERFORMANCE_SYSTEM_INFO_GET"},
+    { 87, "SEMAPHORE_PRIORITIZE"},
+    { 88, "SEMAPHORE_PUT"},
+    { 89, "SEMAPHORE_PUT_NOTIFY"},
+    {100, "THREAD_CREATE"},
+    {101, "THREAD_DELETE"},
+    {102, "THREAD_ENTRY_EXIT_NOTIFY"},
+    {103, "THREAD_IDENTIFY"},
+    {104, "THREAD_INFO_GET"},
+    {105, "THREAD_PERFORMANCE_INFO_GET"},
+    {106, "THREAD_PERFORMANCE_SYSTEM_INFO_GET"},
+    {107, "THREAD_PREEMPTION_CHANGE"},
+    {108, "THREAD_PRIORITY_CHANGE"},
+    {109, "THREAD_RELINQUISH"},
+    {110, "THREAD_RESET"},
+    {111, "THREAD_RESUME_API"},
+    {112, "THREAD_SLEEP"},
+    {113, "THREAD_STACK_ERROR_NOTIFY"},
+    {114, "THREAD_SUSPEND_API"},
+    {115, "THREAD_TERMINATE"},
+    {116, "THREAD_TIME_SLICE_CHANGE"},
+    {117, "THREAD_WAIT_ABORT"},
+    {120, "TIME_GET"},
+    {121, "TIME_SET"},
+    {122, "TIMER_ACTIVATE"},
+    {123, "TIMER_CHANGE"},
+    {124, "TIMER_CREATE"},
+    {125, "TIMER_DEACTIVATE"},
+    {126, "TIMER_DELETE"},
+    {127, "TIMER_INFO_GET"},
+    {128, "TIMER_PERFORMANCE_INFO_GET"},
+    {129, "TIMER_PERFORMANCE_SYSTEM_INFO_GET"},
+};
+
+
+/* Define an object of the registry, with its track.  */
+
+typedef struct OBJECT_STRUCT
+{
+    uint32_t        pointer;
+    uint32_t        type;
+    char            name[64];
+    uint32_t        track;
+    double          ready_since;
+} OBJECT;
+
+
+/* Define the state of the conversion.  */
+
+static FILE         *output;
+static int          swap;
+static int          first_event =  1;
+static OBJECT       *objects;
+static uint32_t     object_count;
+static uint32_t     object_capacity;
+static uint32_t     next_thread_track =  TRACK_FIRST_THREAD;
+static uint32_t     next_object_track =  TRACK_FIRST_OBJECT;
+static double       frequency;
+static uint32_t     time_mask;
+static int          time_valid;
+static uint32_t     time_last;
+static uint64_t     time_ticks;
+static uint32_t     running;
+static int          running_valid;
+static double       running_since;
+static uint32_t     pending;
+static int          pending_valid;
+static uint32_t     isr_nesting;
+static double       last_time;
+static unsigned long events_converted;
+
+
+/* Read a 32-bit value in the byte order of the trace.  */
+
+static uint32_t  read32(const unsigned char *p)
+{
+
+uint32_t    value;
+
+
+    memcpy(&value, p, sizeof(value));
+    if (swap)
+    {
+        value =  ((value & 0xFFU) << 24) | ((value & 0xFF00U) << 8) | ((value >> 8) & 0xFF00U) | (value >> 24);
+    }
+    return(value);
+}
+
+
+/* Write a string as a JSON string.  */
+
+static void  json_string(const char *string)
+{
+
+    fputc('"', output);
+    for (; *string != '\0'; string++)
+    {
+        if ((*string == '"') || (*string == '\\'))
+        {
+            fputc('\\', output);
+            fputc(*string, output);
+        }
+        else if (((unsigned char) *string) < 0x20)
+        {
+            fprintf(output, "\\u%04x", (unsigned) ((unsigned char) *string));
+        }
+        else
+        {
+            fputc(*string, output);
+        }
+    }
+    fputc('"', output);
+}
+
+
+/* Start a new JSON event.  */
+
+static void  json_event_start(void)
+{
+
+    fputs(first_event ? "\n" : ",\n", output);
+    first_event =  0;
+}
+
+
+/* Find an object by its pointer.  */
+
+static OBJECT  *object_find(uint32_t pointer)
+{
+
+uint32_t    i;
+
+
+    for (i = 0; i < object_count; i++)
+    {
+        if (objects[i].pointer == pointer)
+        {
+            return(&objects[i]);
+        }
+    }
+    return(NULL);
+}
+
+
+/* Find an object by its pointer, or add it. Objects that are first seen in an event are
+   threads, unless the registry says otherwise later.  */
+
+static OBJECT  *object_get(uint32_t pointer, uint32_t type)
+{
+
+OBJECT      *object;
+
+
+    object =  object_find(pointer);
+    if (object != NULL)
+    {
+        return(object);
+    }
+
+    if (object_count == object_capacity)
+    {
+        object_capacity =  (object_capacity == 0) ? 64 : (2 * object_capacity);
+        objects =  realloc(objects, object_capacity * sizeof(OBJECT));
+        if (objects == NULL)
+        {
+            fprintf(stderr, "out of memory\n");
+            exit(1);
+        }
+    }
+
+    object =  &objects[object_count++];
+    object -> pointer =      pointer;
+    object -> type =         type;
+    object -> ready_since =  -1.0;
+    snprintf(object -> name, sizeof(object -> name), "%s 0x%08lx",
+             (type == TRACE_OBJECT_TYPE_THREAD) ? "thread" : "object", (unsigned long) pointer);
+    object -> track =  (type == TRACE_OBJECT_TYPE_THREAD) ? next_thread_track++ : next_object_track++;
+    return(object);
+}
+
+
+/* Add a registry entry.  */
+
+static void  object_register(const unsigned char *entry, uint32_t name_size)
+{
+
+OBJECT      *object;
+uint32_t    type;
+uint32_t    pointer;
+uint32_t    length;
+
+
+    type =     entry[1];
+    pointer =  read32(entry + 4);
+    if ((type == TRACE_OBJECT_TYPE_NOT_VALID) || (pointer == 0))
+    {
+        return;
+    }
+
+    /* A thread track stays a thread track, even if the pointer is reused.  */
+    object =  object_get(pointer, type);
+    if (object -> type != TRACE_OBJECT_TYPE_THREAD)
+    {
+        object -> type =  type;
+    }
+
+    length =  name_size;
+    if (length >= sizeof(object -> name))
+    {
+        length =  sizeof(object -> name) - 1;
+    }
+    memcpy(object -> name, entry + TRACE_OBJECT_HEADER_SIZE, length);
+    object -> name[length] =  '\0';
+    if (object -> name[0] == '\0')
+    {
+        snprintf(object -> name, sizeof(object -> name), "0x%08lx", (unsigned long) pointer);
+    }
+}
+
+
+/* Return the name of an event.  */
+
+static const char  *event_name(uint32_t id, char *buffer, size_t size)
+{
+
+size_t      i;
+
+
+    for (i = 0; i < (sizeof(event_names) / sizeof(event_names[0])); i++)
+    {
+        if (event_names[i].id == id)
+        {
+            return(event_names[i].name);
+        }
+    }
+
+    if (id >= TRACE_USER_EVENT_START)
+    {
+        snprintf(buffer, size, "USER_EVENT_%lu", (unsigned long) id);
+    }
+    else
+    {
+        snprintf(buffer, size, "EVENT_%lu", (unsigned long) id);
+    }
+    return(buffer);
+}
+
+
+/* Return the track of the thread, idle if none.  */
+
+static uint32_t  thread_track(uint32_t thread)
+{
+
+    if (thread == 0)
+    {
+        return(TRACK_IDLE);
+    }
+    return(object_get(thread, TRACE_OBJECT_TYPE_THREAD) -> track);
+}
+
+
+/* Write a complete event.  */
+
+static void  slice_write(uint32_t track, const char *name, const char *category, double start, double end)
+{
+
+    json_event_start();
+    fprintf(output, "{\"ph\": \"X\", \"pid\": %d, \"tid\": %lu, \"ts\": %.3f, \"dur\": %.3f, \"cat\": \"%s\", \"name\": ",
+            TRACK_PROCESS_THREADS, (unsigned long) track, start, end - start, category);
+    json_string(name);
+    fputc('}', output);
+}
+
+
+/* Switch the running thread at the supplied time.  */
+
+static void  thread_switch(uint32_t thread, double time)
+{
+
+OBJECT      *object;
+
+
+    if (running_valid && (thread == running))
+    {
+        return;
+    }
+
+    /* Close the slice of the thread that ran.  */
+    if (running_valid)
+    {
+        slice_write(thread_track(running), (running == 0) ? "idle" : "running", "sched", running_since, time);
+    }
+
+    /* Close the ready slice of the new thread, which is its scheduling latency.  */
+    if (thread != 0)
+    {
+        object =  object_get(thread, TRACE_OBJECT_TYPE_THREAD);
+        if (object -> ready_since >= 0.0)
+        {
+            slice_write(object -> track, "ready", "latency", object -> ready_since, time);
+            object -> ready_since =  -1.0;
+        }
+    }
+
+    running =        thread;
+    running_valid =  1;
+    running_since =  time;
+}
+
+
+/* Convert the time stamp of an event to microseconds. The time stamp only has the bits of the
+   time mask, so the time is accumulated from the differences. A small step back, from events
+   that were stamped out of order, does not move the time.  */
+
+static double  event_time(uint32_t stamp)
+{
+
+uint32_t    delta;
+
+
+    stamp =  stamp & time_mask;
+    if (!time_valid)
+    {
+        time_valid =  1;
+        time_last =   stamp;
+        time_ticks =  0;
+    }
+
+    delta =  (stamp - time_last) & time_mask;
+    if (delta <= (time_mask >> 1))
+    {
+        time_ticks =  time_ticks + delta;
+        time_last =   stamp;
+    }
+
+    return((((double) time_ticks) * 1000000.0) / frequency);
+}
+
+
+/* Convert one event.  */
+
+static void  event_convert(const unsigned char *entry)
+{
+
+uint32_t    thread;
+uint32_t    id;
+uint32_t    info[4];
+double      time;
+uint32_t    track;
+OBJECT      *object;
+const char  *name;
+char        name_buffer[32];
+int         i;
+
+
+    thread =  read32(entry);
+    id =      read32(entry + 8);
+    if ((thread == TRACE_THREAD_NOT_USED) || (id == TRACE_INVALID_EVENT))
+    {
+        return;
+    }
+    for (i = 0; i < 4; i++)
+    {
+        info[i] =  read32(entry + 16 + (4 * i));
+    }
+
+    time =       event_time(read32(entry + 12));
+    last_time =  time;
+    events_converted++;
+
+    if (thread == TRACE_THREAD_ISR)
+    {
+        track =  TRACK_INTERRUPTS;
+    }
+    else if (thread == TRACE_THREAD_INITIALIZE)
+    {
+        track =  TRACK_INITIALIZE;
+    }
+    else
+    {
+
+        /* Back in a thread, any switch decided in an ISR has happened.  */
+        if (pending_valid)
+        {
+            thread_switch(pending, time);
+            pending_valid =  0;
+        }
+        thread_switch(thread, time);
+        track =  thread_track(thread);
+    }
+
+    switch (id)
+    {
+
+    case TRACE_ISR_ENTER:
+
+        isr_nesting++;
+        json_event_start();
+        fprintf(output, "{\"ph\": \"B\", \"pid\": %d, \"tid\": %d, \"ts\": %.3f, \"cat\": \"isr\", \"name\": \"ISR %lu\"}",
+                TRACK_PROCESS_THREADS, TRACK_INTERRUPTS, time, (unsigned long) info[1]);
+        return;
+
+    case TRACE_ISR_EXIT:
+
+        json_event_start();
+        fprintf(output, "{\"ph\": \"E\", \"pid\": %d, \"tid\": %d, \"ts\": %.3f}",
+                TRACK_PROCESS_THREADS, TRACK_INTERRUPTS, time);
+        if (isr_nesting > 0)
+        {
+            isr_nesting--;
+        }
+        if ((isr_nesting == 0) && pending_valid)
+        {
+            thread_switch(pending, time);
+            pending_valid =  0;
+        }
+        return;
+
+    case TRACE_THREAD_RESUME:
+
+        /* A resumed thread is ready until it runs.  */
+        object =  object_get(info[0], TRACE_OBJECT_TYPE_THREAD);
+        if ((!running_valid || (running != info[0])) && (object -> ready_since < 0.0))
+        {
+            object -> ready_since =  time;
+        }
+        break;
+
+    case TRACE_THREAD_SUSPEND:
+
+        object_get(info[0], TRACE_OBJECT_TYPE_THREAD) -> ready_since =  -1.0;
+        break;
+
+    default:
+        break;
+    }
+
+    /* Write the event as an instant event on its track.  */
+    name =  event_name(id, name_buffer, sizeof(name_buffer));
+    object =  (info[0] != 0) ? object_find(info[0]) : NULL;
+    json_event_start();
+    fprintf(output, "{\"ph\": \"i\", \"s\": \"t\", \"pid\": %d, \"tid\": %lu, \"ts\": %.3f, \"cat\": \"%s\", \"name\": ",
+            TRACK_PROCESS_THREADS, (unsigned long) track, time, (id >= TRACE_USER_EVENT_START) ? "user" : "api");
+    json_string(name);
+    fprintf(output, ", \"args\": {\"priority\": \"0x%08lx\", \"info_1\": \"0x%08lx\", \"info_2\": \"0x%08lx\", \"info_3\": \"0x%08lx\", \"info_4\": \"0x%08lx\"",
+            (unsigned long) read32(entry + 4), (unsigned long) info[0], (unsigned long) info[1], (unsigned long) info[2], (unsigned long) info[3]);
+    if (object != NULL)
+    {
+        fputs(", \"object\": ", output);
+        json_string(object -> name);
+    }
+    fputs("}}", output);
+
+    /* Also show events on objects on the object's track.  */
+    if ((object != NULL) && (object -> type != TRACE_OBJECT_TYPE_THREAD))
+    {
+        json_event_start();
+        fprintf(output, "{\"ph\": \"i\", \"s\": \"t\", \"pid\": %d, \"tid\": %lu, \"ts\": %.3f, \"cat\": \"object\", \"name\": ",
+                TRACK_PROCESS_OBJECTS, (unsigned long) object -> track, time);
+        json_string(name);
+        fputc('}', output);
+    }
+
+    /* The next thread of the scheduling events runs when the thread or ISR that caused the
+       event is done.  */
+    if ((id == TRACE_THREAD_RESUME) || (id == TRACE_THREAD_SUSPEND) || (id == TRACE_TIME_SLICE))
+    {
+        pending =        (id == TRACE_TIME_SLICE) ? info[0] : info[3];
+        pending_valid =  1;
+        if (thread != TRACE_THREAD_ISR)
+        {
+            thread_switch(pending, time);
+            pending_valid =  0;
+        }
+    }
+}
+
+
+/* Write the names of the processes and tracks.  */
+
+static void  metadata_write(void)
+{
+
+uint32_t    i;
+uint32_t    pid;
+
+
+    json_event_start();
+    fprintf(output, "{\"ph\": \"M\", \"pid\": %d, \"name\": \"process_name\", \"args\": {\"name\": \"ThreadX\"}}", TRACK_PROCESS_THREADS);
+    json_event_start();
+    fprintf(output, "{\"ph\": \"M\", \"pid\": %d, \"name\": \"process_name\", \"args\": {\"name\": \"ThreadX objects\"}}", TRACK_PROCESS_OBJECTS);
+    json_event_start();
+    fprintf(output, "{\"ph\": \"M\", \"pid\": %d, \"tid\": %d, \"name\": \"thread_name\", \"args\": {\"name\": \"Interrupts\"}}", TRACK_PROCESS_THREADS, TRACK_INTERRUPTS);
+    json_event_start();
+    fprintf(output, "{\"ph\": \"M\", \"pid\": %d, \"tid\": %d, \"name\": \"thread_name\", \"args\": {\"name\": \"Idle\"}}", TRACK_PROCESS_THREADS, TRACK_IDLE);
+    json_event_start();
+    fprintf(output, "{\"ph\": \"M\", \"pid\": %d, \"tid\": %d, \"name\": \"thread_name\", \"args\": {\"name\": \"Initialization\"}}", TRACK_PROCESS_THREADS, TRACK_INITIALIZE);
+
+    for (i = 0; i < object_count; i++)
+    {
+        pid =  (objects[i].track >= TRACK_FIRST_OBJECT) ? TRACK_PROCESS_OBJECTS : TRACK_PROCESS_THREADS;
+        json_event_start();
+        fprintf(output, "{\"ph\": \"M\", \"pid\": %lu, \"tid\": %lu, \"name\": \"thread_name\", \"args\": {\"name\": ",
+                (unsigned long) pid, (unsigned long) objects[i].track);
+        json_string(objects[i].name);
+        fputs("}}", output);
+    }
+}
+
+
+/* Convert a stream written by tx_trace_stream.c.  */
+
+static int  stream_convert(const unsigned char *data, size_t size)
+{
+
+size_t      offset;
+uint32_t    object_size;
+uint32_t    event_size;
+uint32_t    type;
+uint32_t    count;
+uint32_t    i;
+
+
+    if (size < 24)
+    {
+        fprintf(stderr, "stream header is truncated\n");
+        return(1);
+    }
+    time_mask =    read32(data + 8);
+    if (frequency == 0.0)
+    {
+        frequency =  (double) read32(data + 12);
+    }
+    object_size =  read32(data + 16);
+    event_size =   read32(data + 20);
+    if ((object_size <= TRACE_OBJECT_HEADER_SIZE) || (event_size != TRACE_EVENT_SIZE))
+    {
+        fprintf(stderr, "unsupported entry sizes %lu and %lu\n", (unsigned long) object_size, (unsigned long) event_size);
+        return(1);
+    }
+
+    offset =  24;
+    while ((offset + 8) <= size)
+    {
+
+        type =    read32(data + offset);
+        count =   read32(data + offset + 4);
+        offset =  offset + 8;
+        for (i = 0; i < count; i++)
+        {
+            if (type == TRACE_STREAM_RECORD_OBJECT)
+            {
+                if ((offset + object_size) > size)
+                {
+                    break;
+                }
+                object_register(data + offset, object_size - TRACE_OBJECT_HEADER_SIZE);
+                offset =  offset + object_size;
+            }
+            else if (type == TRACE_STREAM_RECORD_EVENTS)
+            {
+                if ((offset + event_size) > size)
+                {
+                    break;
+                }
+                event_convert(data + offset);
+                offset =  offset + event_size;
+            }
+            else
+            {
+                fprintf(stderr, "unknown record type %lu at offset %lu\n", (unsigned long) type, (unsigned long) offset);
+                return(1);
+            }
+        }
+    }
+
+    /* A stream that was not stopped may end in the middle of a record.  */
+    if (offset != size)
+    {
+        fprintf(stderr, "warning: stream is truncated, %lu bytes ignored\n", (unsigned long) (size - offset));
+    }
+    return(0);
+}
+
+
+/* Convert a dump of a trace buffer, starting with the oldest event.  */
+
+static int  buffer_convert(const unsigned char *data, size_t size)
+{
+
+uint32_t    base;
+uint32_t    registry_start;
+uint32_t    registry_end;
+uint32_t    name_size;
+uint32_t    buffer_start;
+uint32_t    buffer_end;
+uint32_t    current;
+uint32_t    object_size;
+uint32_t    offset;
+int         pass;
+
+
+    if (size < 48)
+    {
+        fprintf(stderr, "buffer header is truncated\n");
+        return(1);
+    }
+    time_mask =       read32(data + 4);
+    base =            read32(data + 8);
+    registry_start =  read32(data + 12) - base;
+    name_size =       swap ? (((uint32_t) data[18] << 8) | data[19]) : (((uint32_t) data[19] << 8) | data[18]);
+    registry_end =    read32(data + 20) - base;
+    buffer_start =    read32(data + 24) - base;
+    buffer_end =      read32(data + 28) - base;
+    current =         read32(data + 32) - base;
+    if (frequency == 0.0)
+    {
+        frequency =  1000000.0;
+    }
+
+    object_size =  TRACE_OBJECT_HEADER_SIZE + name_size;
+    if ((registry_end > size) || (buffer_end > size) || (buffer_start > buffer_end) || (current < buffer_start) ||
+        (current > buffer_end) || (((buffer_end - buffer_start) % TRACE_EVENT_SIZE) != 0))
+    {
+        fprintf(stderr, "buffer header is not valid\n");
+        return(1);
+    }
+
+    for (offset = registry_start; (offset + object_size) <= registry_end; offset =  offset + object_size)
+    {
+        object_register(data + offset, name_size);
+    }
+
+    /* The oldest event is at the current pointer.  */
+    for (pass = 0; pass < 2; pass++)
+    {
+        for (offset = (pass == 0) ? current : buffer_start; offset < ((pass == 0) ? buffer_end : current); offset =  offset + TRACE_EVENT_SIZE)
+        {
+            event_convert(data + offset);
+        }
+    }
+    return(0);
+}
+
+
+int  main(int argc, char **argv)
+{
+
+FILE            *input;
+unsigned char   *data;
+size_t          size;
+size_t          capacity;
+size_t          bytes;
+uint32_t        id;
+int             status;
+int             arg;
+
+
+    arg =  1;
+    if ((argc > 2) && (strcmp(argv[1], "-f") == 0))
+    {
+        frequency =  strtod(argv[2], NULL);
+        arg =  3;
+    }
+    if ((argc - arg) != 2)
+    {
+        fprintf(stderr, "usage: %s [-f frequency] trace.bin trace.json\n", argv[0]);
+        return(2);
+    }
+
+    input =  fopen(argv[arg], "rb");
+    if (input == NULL)
+    {
+        perror(argv[arg]);
+        return(1);
+    }
+    data =      NULL;
+    size =      0;
+    capacity =  0;
+    do
+    {
+        if (size == capacity)
+        {
+            capacity =  (capacity == 0) ? 65536 : (2 * capacity);
+            data =  realloc(data, capacity);
+            if (data == NULL)
+            {
+                fprintf(stderr, "out of memory\n");
+                return(1);
+            }
+        }
+        bytes =  fread(data + size, 1, capacity - size, input);
+        size =   size + bytes;
+    } while (bytes != 0);
+    fclose(input);
+
+    if (size < 4)
+    {
+        fprintf(stderr, "%s is not a ThreadX trace\n", argv[arg]);
+        return(1);
+    }
+
+    output =  fopen(argv[arg + 1], "w");
+    if (output == NULL)
+    {
+        perror(argv[arg + 1]);
+        return(1);
+    }
+    fputs("{\"displayTimeUnit\": \"ns\", \"traceEvents\": [", output);
+
+    /* The ID tells both the format and the byte order.  */
+    memcpy(&id, data, sizeof(id));
+    swap =  ((id != TRACE_STREAM_ID) && (id != TRACE_BUFFER_ID));
+    id =    read32(data);
+    if (id == TRACE_STREAM_ID)
+    {
+        status =  stream_convert(data, size);
+    }
+    else if (id == TRACE_BUFFER_ID)
+    {
+        status =  buffer_convert(data, size);
+    }
+    else
+    {
+        fprintf(stderr, "%s is not a ThreadX trace\n", argv[arg]);
+        status =  1;
+    }
+
+    /* Close the slice of the thread that ran last.  */
+    if (running_valid)
+    {
+        slice_write(thread_track(running), (running == 0) ? "idle" : "running", "sched", running_since, last_time);
+    }
+    metadata_write();
+    fputs("\n]}\n", output);
+    fclose(output);
+    free(data);
+    free(objects);
+
+    if (status == 0)
+    {
+        printf("%lu events, %lu objects\n", events_converted, (unsigned long) object_count);
+    }
+    return(status);
+}
@@ -0,0 +1,478 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Trace Stream                                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_trace_stream.h"
+#include <string.h>
+
+
+#ifdef TX_ENABLE_EVENT_TRACE
+
+/* Define the state of the stream.  */
+
+static FILE                     *_tx_trace_stream_file;
+static TX_TRACE_BUFFER_ENTRY    *_tx_trace_stream_read_ptr;
+static ULONG                    _tx_trace_stream_events;
+static TX_TRACE_OBJECT_ENTRY    _tx_trace_stream_registry[TX_TRACE_STREAM_MAX_REGISTRY_ENTRIES];
+static TX_THREAD                _tx_trace_stream_thread;
+static UINT                     _tx_trace_stream_thread_created;
+static ULONG                    _tx_trace_stream_period;
+
+
+/* Write the registry entries that changed since they were last written. Interrupts must be
+   disabled by the caller.  */
+
+static VOID  _tx_trace_stream_registry_write(VOID)
+{
+
+TX_TRACE_STREAM_RECORD  record;
+TX_TRACE_OBJECT_ENTRY   *entry_ptr;
+ULONG                   i;
+
+
+    /* The registry is gone once the trace is disabled.  */
+    if (_tx_trace_registry_start_ptr == TX_NULL)
+    {
+        return;
+    }
+
+    record.tx_trace_stream_record_type =   TX_TRACE_STREAM_RECORD_OBJECT;
+    record.tx_trace_stream_record_count =  1;
+    for (i = 0; i < _tx_trace_total_registry_entries; i++)
+    {
+
+        entry_ptr =  &_tx_trace_registry_start_ptr[i];
+
+        /* Entries that were never used are not written.  */
+        if ((entry_ptr -> tx_trace_object_entry_type != TX_TRACE_OBJECT_TYPE_NOT_VALID) &&
+            (memcmp(entry_ptr, &_tx_trace_stream_registry[i], sizeof(TX_TRACE_OBJECT_ENTRY)) != 0))
+        {
+
+            fwrite(&record, sizeof(record), 1, _tx_trace_stream_file);
+            fwrite(entry_ptr, sizeof(TX_TRACE_OBJECT_ENTRY), 1, _tx_trace_stream_file);
+            _tx_trace_stream_registry[i] =  *entry_ptr;
+        }
+    }
+}
+
+
+/* Write the events from the read pointer up to the supplied end. Interrupts must be disabled
+   by the caller.  */
+
+static VOID  _tx_trace_stream_events_write(TX_TRACE_BUFFER_ENTRY *end_ptr)
+{
+
+TX_TRACE_STREAM_RECORD  record;
+ULONG                   count;
+
+
+    if (end_ptr > _tx_trace_stream_read_ptr)
+    {
+
+        count =  (ULONG) (end_ptr - _tx_trace_stream_read_ptr);
+        record.tx_trace_stream_record_type =   TX_TRACE_STREAM_RECORD_EVENTS;
+        record.tx_trace_stream_record_count =  count;
+        fwrite(&record, sizeof(record), 1, _tx_trace_stream_file);
+        fwrite(_tx_trace_stream_read_ptr, sizeof(TX_TRACE_BUFFER_ENTRY), (size_t) count, _tx_trace_stream_file);
+        _tx_trace_stream_events =  _tx_trace_stream_events + count;
+    }
+    _tx_trace_stream_read_ptr =  end_ptr;
+}
+
+
+/* Buffer full notification. It is called from the trace insert, after the last entry of the
+   buffer was written and the current pointer wrapped, so the rest of the buffer is written
+   before it is overwritten.  */
+
+static VOID  _tx_trace_stream_full_notify(VOID *buffer)
+{
+
+    TX_PARAMETER_NOT_USED(buffer);
+
+    if (_tx_trace_stream_file != TX_NULL)
+    {
+
+        _tx_trace_stream_registry_write();
+        _tx_trace_stream_events_write(_tx_trace_buffer_end_ptr);
+        _tx_trace_stream_read_ptr =  _tx_trace_buffer_start_ptr;
+    }
+}
+
+
+/* Drain thread, writes the new events periodically.  */
+
+static VOID  _tx_trace_stream_thread_entry(ULONG thread_input)
+{
+
+    TX_PARAMETER_NOT_USED(thread_input);
+
+    while (1)
+    {
+        _tx_thread_sleep(_tx_trace_stream_period);
+        _tx_trace_stream_flush();
+    }
+}
+#endif
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_trace_stream_start                              PORTABLE C      */
+/*                                                           6.4.0        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function enables the event trace in the supplied buffer and    */
+/*    starts streaming it to the supplied file. If a stack is supplied, a */
+/*    drain thread is created that writes the new events every "period"   */
+/*    ticks.                                                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    file                                  Destination stream            */
+/*    trace_buffer_start                    Start of trace buffer         */
+/*    trace_buffer_size                     Size of trace buffer          */
+/*    registry_entries                      Number of object registry     */
+/*                                            entries                     */
+/*    stack_start                           Drain thread stack, or NULL   */
+/*    stack_size                            Drain thread stack size       */
+/*    priority                              Drain thread priority         */
+/*    period                                Drain period in ticks         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                            Successful start              */
+/*    TX_PTR_ERROR                          Invalid stream                */
+/*    TX_SIZE_ERROR                         Too many registry entries or  */
+/*                                            buffer too small            */
+/*    TX_OPTION_ERROR                       Invalid drain period          */
+/*    TX_NOT_DONE                           Trace already enabled         */
+/*    TX_FEATURE_NOT_ENABLED                Event trace is not enabled    */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_trace_enable                      Enable the event trace        */
+/*    _tx_trace_buffer_full_notify          Install full notification     */
+/*    _tx_thread_create                     Create the drain thread       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application code                                                    */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_trace_stream_start(FILE *file, VOID *trace_buffer_start, ULONG trace_buffer_size, ULONG registry_entries,
+                             VOID *stack_start, ULONG stack_size, UINT priority, ULONG period)
+{
+
+#ifdef TX_ENABLE_EVENT_TRACE
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_TRACE_STREAM_HEADER  header;
+UINT                    status;
+
+
+    /* Check the parameters.  */
+    if (file == TX_NULL)
+    {
+        return(TX_PTR_ERROR);
+    }
+    if (registry_entries > ((ULONG) TX_TRACE_STREAM_MAX_REGISTRY_ENTRIES))
+    {
+        return(TX_SIZE_ERROR);
+    }
+    if ((stack_start != TX_NULL) && (period == ((ULONG) 0)))
+    {
+        return(TX_OPTION_ERROR);
+    }
+
+    /* Enable the trace. This also registers the objects that already exist.  */
+    status =  _tx_trace_enable(trace_buffer_start, trace_buffer_size, registry_entries);
+    if (status != TX_SUCCESS)
+    {
+        return(status);
+    }
+
+    /* Disable interrupts while the stream is set up.  */
+    TX_DISABLE
+
+    _tx_trace_stream_file =      file;
+    _tx_trace_stream_read_ptr =  _tx_trace_buffer_start_ptr;
+    _tx_trace_stream_events =    0;
+    TX_MEMSET(_tx_trace_stream_registry, 0, sizeof(_tx_trace_stream_registry));
+
+    /* Write the stream header.  */
+    header.tx_trace_stream_header_id =                     TX_TRACE_STREAM_ID;
+    header.tx_trace_stream_header_version =                TX_TRACE_STREAM_VERSION;
+    header.tx_trace_stream_header_timer_valid_mask =       TX_TRACE_TIME_MASK;
+    header.tx_trace_stream_header_time_source_frequency =  TX_TRACE_STREAM_TIME_SOURCE_FREQUENCY;
+    header.tx_trace_stream_header_object_entry_size =      (ULONG) sizeof(TX_TRACE_OBJECT_ENTRY);
+    header.tx_trace_stream_header_event_entry_size =       (ULONG) sizeof(TX_TRACE_BUFFER_ENTRY);
+    fwrite(&header, sizeof(header), 1, file);
+
+    /* From now on, the buffer is written whenever it wraps.  */
+    _tx_trace_buffer_full_notify(_tx_trace_stream_full_notify);
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Create the drain thread, if requested.  */
+    _tx_trace_stream_thread_created =  TX_FALSE;
+    if (stack_start != TX_NULL)
+    {
+
+        _tx_trace_stream_period =  period;
+        status =  _tx_thread_create(&_tx_trace_stream_thread, "trace stream", _tx_trace_stream_thread_entry, 0,
+                                    stack_start, stack_size, priority, priority, TX_NO_TIME_SLICE, TX_AUTO_START);
+        if (status != TX_SUCCESS)
+        {
+
+            /* Undo the start.  */
+            _tx_trace_stream_stop();
+            return(status);
+        }
+        _tx_trace_stream_thread_created =  TX_TRUE;
+    }
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+
+#else
+
+    TX_PARAMETER_NOT_USED(file);
+    TX_PARAMETER_NOT_USED(trace_buffer_start);
+    TX_PARAMETER_NOT_USED(trace_buffer_size);
+    TX_PARAMETER_NOT_USED(registry_entries);
+    TX_PARAMETER_NOT_USED(stack_start);
+    TX_PARAMETER_NOT_USED(stack_size);
+    TX_PARAMETER_NOT_USED(priority);
+    TX_PARAMETER_NOT_USED(period);
+
+    /* Trace not enabled, return an error.  */
+    return(TX_FEATURE_NOT_ENABLED);
+#endif
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_trace_stream_flush                              PORTABLE C      */
+/*                                                           6.4.0        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function writes the registry changes and the trace events that */
+/*    were added since the last write to the stream.                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                            Successful flush              */
+/*    TX_NOT_DONE                           Stream not started            */
+/*    TX_FEATURE_NOT_ENABLED                Event trace is not enabled    */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application code                                                    */
+/*    _tx_trace_stream_thread_entry         Drain thread                  */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_trace_stream_flush(VOID)
+{
+
+#ifdef TX_ENABLE_EVENT_TRACE
+
+TX_INTERRUPT_SAVE_AREA
+
+FILE    *file;
+
+
+    /* Disable interrupts, so no event is added while the buffer is written.  */
+    TX_DISABLE
+
+    file =  _tx_trace_stream_file;
+    if ((file == TX_NULL) || (_tx_trace_buffer_current_ptr == TX_NULL))
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        return(TX_NOT_DONE);
+    }
+
+    _tx_trace_stream_registry_write();
+    _tx_trace_stream_events_write(_tx_trace_buffer_current_ptr);
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Make sure the events reach the file.  */
+    fflush(file);
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+
+#else
+
+    /* Trace not enabled, return an error.  */
+    return(TX_FEATURE_NOT_ENABLED);
+#endif
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_trace_stream_stop                               PORTABLE C      */
+/*                                                           6.4.0        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function writes the remaining trace events, disables the event */
+/*    trace and deletes the drain thread. The stream is not closed.       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                            Successful stop               */
+/*    TX_NOT_DONE                           Stream not started            */
+/*    TX_FEATURE_NOT_ENABLED                Event trace is not enabled    */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_thread_terminate                  Terminate the drain thread    */
+/*    _tx_thread_delete                     Delete the drain thread       */
+/*    _tx_trace_stream_flush                Write the remaining events    */
+/*    _tx_trace_buffer_full_notify          Remove full notification      */
+/*    _tx_trace_disable                     Disable the event trace       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application code                                                    */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_trace_stream_stop(VOID)
+{
+
+#ifdef TX_ENABLE_EVENT_TRACE
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    if (_tx_trace_stream_file == TX_NULL)
+    {
+        return(TX_NOT_DONE);
+    }
+
+    /* Delete the drain thread first, so it does not flush a stopped stream.  */
+    if (_tx_trace_stream_thread_created == TX_TRUE)
+    {
+        _tx_thread_terminate(&_tx_trace_stream_thread);
+        _tx_thread_delete(&_tx_trace_stream_thread);
+        _tx_trace_stream_thread_created =  TX_FALSE;
+    }
+
+    /* Write what is left.  */
+    _tx_trace_stream_flush();
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    _tx_trace_buffer_full_notify(TX_NULL);
+    _tx_trace_disable();
+    _tx_trace_stream_file =  TX_NULL;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+
+#else
+
+    /* Trace not enabled, return an error.  */
+    return(TX_FEATURE_NOT_ENABLED);
+#endif
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_trace_stream_events_written                     PORTABLE C      */
+/*                                                           6.4.0        */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the number of trace events written to the     */
+/*    stream since it was started.                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Number of events written                                            */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application code                                                    */
+/*                                                                        */
+/**************************************************************************/
+ULONG  _tx_trace_stream_events_written(VOID)
+{
+
+#ifdef TX_ENABLE_EVENT_TRACE
+
+    return(_tx_trace_stream_events);
+#else
+
+    return((ULONG) 0);
+#endif
+}
@@ -0,0 +1,116 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Trace Stream                                                        */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+#ifndef TX_TRACE_STREAM_H
+#define TX_TRACE_STREAM_H
+
+
+/*  The trace stream drains the ThreadX event trace buffer to a standard C stream while the
+    system runs, so a trace is no longer limited to the size of the circular buffer. It is
+    intended for host ports such as Linux.
+
+    _tx_trace_stream_start enables the trace in the supplied buffer and installs a buffer full
+    notification. Whenever the trace wraps, the notification writes the events that have not
+    been written yet, before they are overwritten, so no event is dropped however long the
+    stream runs. Between wraps, _tx_trace_stream_flush writes the new events. If a stack is
+    supplied to _tx_trace_stream_start, a drain thread calls it periodically, so the file is
+    written continuously. _tx_trace_stream_stop writes the remaining events and disables the
+    trace.
+
+    The stream is written in the byte order of the host and has the following format:
+
+            [Stream Header              ]   TX_TRACE_STREAM_HEADER
+            [Record Header              ]   TX_TRACE_STREAM_RECORD
+            [Record Entries             ]   "count" object registry entries or trace events
+                    ...
+
+    An object record is written for each registry entry that has changed since it was last
+    written, ahead of the events of the same flush. The utility tx_trace_convert.c turns a
+    stream, or a plain dump of a trace buffer, into Chrome/Perfetto JSON.
+
+    The stream uses the buffer full notification, so the application must not install its own
+    while the stream is active.  */
+
+#include <stdio.h>
+
+
+/* Define the maximum number of registry entries that can be tracked by the stream.  */
+
+#ifndef TX_TRACE_STREAM_MAX_REGISTRY_ENTRIES
+#define TX_TRACE_STREAM_MAX_REGISTRY_ENTRIES        64
+#endif
+
+
+/* Define the frequency of the trace time source in Hz, recorded in the stream header. The
+   Linux port time stamps events with the low 32 bits of a nanosecond clock.  */
+
+#ifndef TX_TRACE_STREAM_TIME_SOURCE_FREQUENCY
+#define TX_TRACE_STREAM_TIME_SOURCE_FREQUENCY       1000000000UL
+#endif
+
+
+/* Define the stream ID (TXTS) and version.  */
+
+#define TX_TRACE_STREAM_ID                          0x54585453UL
+#define TX_TRACE_STREAM_VERSION                     1
+
+
+/* Define the record types.  */
+
+#define TX_TRACE_STREAM_RECORD_OBJECT               1       /* TX_TRACE_OBJECT_ENTRY entries follow     */
+#define TX_TRACE_STREAM_RECORD_EVENTS               2       /* TX_TRACE_BUFFER_ENTRY entries follow     */
+
+
+/* Define the stream header.  */
+
+typedef struct TX_TRACE_STREAM_HEADER_STRUCT
+{
+
+    ULONG                                           tx_trace_stream_header_id;
+    ULONG                                           tx_trace_stream_header_version;
+    ULONG                                           tx_trace_stream_header_timer_valid_mask;
+    ULONG                                           tx_trace_stream_header_time_source_frequency;
+    ULONG                                           tx_trace_stream_header_object_entry_size;
+    ULONG                                           tx_trace_stream_header_event_entry_size;
+} TX_TRACE_STREAM_HEADER;
+
+
+/* Define the record header.  */
+
+typedef struct TX_TRACE_STREAM_RECORD_STRUCT
+{
+
+    ULONG                                           tx_trace_stream_record_type;
+    ULONG                                           tx_trace_stream_record_count;
+} TX_TRACE_STREAM_RECORD;
+
+
+/* Define APIs of the trace stream.  */
+
+UINT  _tx_trace_stream_start(FILE *file, VOID *trace_buffer_start, ULONG trace_buffer_size, ULONG registry_entries,
+                             VOID *stack_start, ULONG stack_size, UINT priority, ULONG period);
+UINT  _tx_trace_stream_flush(VOID);
+UINT  _tx_trace_stream_stop(VOID);
+ULONG _tx_trace_stream_events_written(VOID);
+
+#endif
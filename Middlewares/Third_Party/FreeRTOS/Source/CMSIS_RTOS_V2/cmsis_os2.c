@@ -1375,7 +1375,7 @@ osMutexId_t osMutexNew (const osMutexAttr_t *attr) {
       #endif
 
       if ((hMutex != NULL) && (rmtx != 0U)) {
-        hMutex = (SemaphoreHandle_t)((uint32_t)hMutex | 1U);
+        hMutex = (SemaphoreHandle_t)((uintptr_t)hMutex | 1U);
       }
     }
   }
@@ -1388,9 +1388,9 @@ osStatus_t osMutexAcquire (osMutexId_t mutex_id, uint32_t timeout) {
   osStatus_t stat;
   uint32_t rmtx;
 
-  hMutex = (SemaphoreHandle_t)((uint32_t)mutex_id & ~1U);
+  hMutex = (SemaphoreHandle_t)((uintptr_t)mutex_id & ~(uintptr_t)1U);
 
-  rmtx = (uint32_t)mutex_id & 1U;
+  rmtx = (uint32_t)((uintptr_t)mutex_id & 1U);
 
   stat = osOK;
 
@@ -1431,9 +1431,9 @@ osStatus_t osMutexRelease (osMutexId_t mutex_id) {
   osStatus_t stat;
   uint32_t rmtx;
 
-  hMutex = (SemaphoreHandle_t)((uint32_t)mutex_id & ~1U);
+  hMutex = (SemaphoreHandle_t)((uintptr_t)mutex_id & ~(uintptr_t)1U);
 
-  rmtx = (uint32_t)mutex_id & 1U;
+  rmtx = (uint32_t)((uintptr_t)mutex_id & 1U);
 
   stat = osOK;
 
@@ -1465,7 +1465,7 @@ osThreadId_t osMutexGetOwner (osMutexId_t mutex_id) {
   SemaphoreHandle_t hMutex;
   osThreadId_t owner;
 
-  hMutex = (SemaphoreHandle_t)((uint32_t)mutex_id & ~1U);
+  hMutex = (SemaphoreHandle_t)((uintptr_t)mutex_id & ~(uintptr_t)1U);
 
   if (IS_IRQ() || (hMutex == NULL)) {
     owner = NULL;
@@ -1481,7 +1481,7 @@ osStatus_t osMutexDelete (osMutexId_t mutex_id) {
 #ifndef USE_FreeRTOS_HEAP_1
   SemaphoreHandle_t hMutex;
 
-  hMutex = (SemaphoreHandle_t)((uint32_t)mutex_id & ~1U);
+  hMutex = (SemaphoreHandle_t)((uintptr_t)mutex_id & ~(uintptr_t)1U);
 
   if (IS_IRQ()) {
     stat = osErrorISR;
@@ -1945,9 +1945,202 @@ osStatus_t osMessageQueueDelete (osMessageQueueId_t mq_id) {
 #ifdef FREERTOS_MPOOL_H_
 
 /* Static memory pool functions */
-static void  FreeBlock   (MemPool_t *mp, void *block);
+static void  FreeBlock   (MemPool_t *mp, uint32_t index);
 static void *AllocBlock  (MemPool_t *mp);
-static void *CreateBlock (MemPool_t *mp);
+static void  InitBlocks  (MemPool_t *mp);
+
+/* Free list head: block index in the low half, tag in the high half */
+#define MPOOL_HEAD_SHIFT          (sizeof(MemPoolHeadValue_t) * 4U)
+#define MPOOL_HEAD_INDEX_MASK     0xFFFFU
+
+/*
+  Get the address of a block given its index.
+*/
+__STATIC_INLINE MemPoolBlock_t *GetBlock (MemPool_t *mp, uint32_t index) {
+  return ((MemPoolBlock_t *)(void *)(mp->mem_arr + (MEMPOOL_BLOCK_SIZE(mp->bl_sz) * index)));
+}
+
+/*
+  Get the first block of a free list head, and build a new head with the tag incremented.
+*/
+__STATIC_INLINE uint32_t HeadIndex (MemPoolHeadValue_t head) {
+  return ((uint32_t)(head & MPOOL_HEAD_INDEX_MASK));
+}
+
+__STATIC_INLINE MemPoolHeadValue_t HeadUpdate (MemPoolHeadValue_t head, uint32_t index) {
+  return ((((head >> MPOOL_HEAD_SHIFT) + 1U) << MPOOL_HEAD_SHIFT) | index);
+}
+
+/*
+  Atomic operations on the free list and the counters:
+  - MemPool_Load:     read a counter
+  - MemPool_Add:      add a value to a counter
+  - MemPool_Reserve:  decrement a counter unless it is zero, return 0 if it is zero
+  - MemPool_Pop:      remove the first block of the free list, return its index
+  - MemPool_Push:     insert a block at the start of the free list
+*/
+#if defined(MPOOL_ATOMIC_EXCLUSIVE)
+/*
+  An exception taken between LDREX and STREX clears the exclusive monitor, so
+  the free list head cannot be updated from an outdated value.
+*/
+__STATIC_INLINE uint32_t MemPool_Load (MemPoolAtomic_t *p) {
+  return (*p);
+}
+
+__STATIC_INLINE void MemPool_Add (MemPoolAtomic_t *p, uint32_t val) {
+  uint32_t res;
+
+  __DMB();
+  do {
+    res = __STREXW (__LDREXW (p) + val, p);
+  } while (res != 0U);
+  __DMB();
+}
+
+__STATIC_INLINE uint32_t MemPool_Reserve (MemPoolAtomic_t *p) {
+  uint32_t n;
+
+  __DMB();
+  do {
+    n = __LDREXW (p);
+    if (n == 0U) {
+      __CLREX();
+      return (0U);
+    }
+  } while (__STREXW (n - 1U, p) != 0U);
+  __DMB();
+
+  return (1U);
+}
+
+__STATIC_INLINE uint32_t MemPool_Pop (MemPool_t *mp) {
+  uint32_t head, index;
+
+  __DMB();
+  do {
+    head  = __LDREXW (&mp->head);
+    index = HeadIndex (head);
+    if (index == MPOOL_INDEX_NONE) {
+      __CLREX();
+      break;
+    }
+  } while (__STREXW (HeadUpdate (head, GetBlock(mp, index)->next), &mp->head) != 0U);
+  __DMB();
+
+  return (index);
+}
+
+__STATIC_INLINE void MemPool_Push (MemPool_t *mp, uint32_t index) {
+  uint32_t head;
+
+  __DMB();
+  do {
+    head = __LDREXW (&mp->head);
+    GetBlock(mp, index)->next = HeadIndex (head);
+  } while (__STREXW (HeadUpdate (head, index), &mp->head) != 0U);
+  __DMB();
+}
+#elif defined(MPOOL_ATOMIC_C11)
+/*
+  The free list head is only replaced if it did not change since it was read,
+  the tag detects a head that changed and came back to the same block.
+*/
+__STATIC_INLINE uint32_t MemPool_Load (MemPoolAtomic_t *p) {
+  return (atomic_load (p));
+}
+
+__STATIC_INLINE void MemPool_Add (MemPoolAtomic_t *p, uint32_t val) {
+  (void)atomic_fetch_add (p, val);
+}
+
+__STATIC_INLINE uint32_t MemPool_Reserve (MemPoolAtomic_t *p) {
+  uint32_t n = atomic_load (p);
+
+  do {
+    if (n == 0U) {
+      return (0U);
+    }
+  } while (!atomic_compare_exchange_weak (p, &n, n - 1U));
+
+  return (1U);
+}
+
+__STATIC_INLINE uint32_t MemPool_Pop (MemPool_t *mp) {
+  MemPoolHeadValue_t head = atomic_load (&mp->head);
+  uint32_t index;
+
+  do {
+    index = HeadIndex (head);
+    if (index == MPOOL_INDEX_NONE) {
+      break;
+    }
+  } while (!atomic_compare_exchange_weak (&mp->head, &head, HeadUpdate (head, ((volatile MemPoolBlock_t *)GetBlock(mp, index))->next)));
+
+  return (index);
+}
+
+__STATIC_INLINE void MemPool_Push (MemPool_t *mp, uint32_t index) {
+  MemPoolHeadValue_t head = atomic_load (&mp->head);
+
+  do {
+    ((volatile MemPoolBlock_t *)GetBlock(mp, index))->next = HeadIndex (head);
+  } while (!atomic_compare_exchange_weak (&mp->head, &head, HeadUpdate (head, index)));
+}
+#else
+/*
+  Without atomic instructions, the operations run with interrupts disabled.
+*/
+__STATIC_INLINE uint32_t MemPool_Load (MemPoolAtomic_t *p) {
+  return (*p);
+}
+
+__STATIC_INLINE void MemPool_Add (MemPoolAtomic_t *p, uint32_t val) {
+  uint32_t isrm;
+
+  isrm = taskENTER_CRITICAL_FROM_ISR();
+  *p += val;
+  taskEXIT_CRITICAL_FROM_ISR(isrm);
+}
+
+__STATIC_INLINE uint32_t MemPool_Reserve (MemPoolAtomic_t *p) {
+  uint32_t isrm;
+  uint32_t ok = 0U;
+
+  isrm = taskENTER_CRITICAL_FROM_ISR();
+  if (*p != 0U) {
+    *p -= 1U;
+    ok  = 1U;
+  }
+  taskEXIT_CRITICAL_FROM_ISR(isrm);
+
+  return (ok);
+}
+
+__STATIC_INLINE uint32_t MemPool_Pop (MemPool_t *mp) {
+  uint32_t isrm;
+  uint32_t index;
+
+  isrm  = taskENTER_CRITICAL_FROM_ISR();
+  index = HeadIndex (mp->head);
+  if (index != MPOOL_INDEX_NONE) {
+    mp->head = HeadUpdate (mp->head, GetBlock(mp, index)->next);
+  }
+  taskEXIT_CRITICAL_FROM_ISR(isrm);
+
+  return (index);
+}
+
+__STATIC_INLINE void MemPool_Push (MemPool_t *mp, uint32_t index) {
+  uint32_t isrm;
+
+  isrm = taskENTER_CRITICAL_FROM_ISR();
+  GetBlock(mp, index)->next = HeadIndex (mp->head);
+  mp->head = HeadUpdate (mp->head, index);
+  taskEXIT_CRITICAL_FROM_ISR(isrm);
+}
+#endif
+
 
 osMemoryPoolId_t osMemoryPoolNew (uint32_t block_count, uint32_t block_size, const osMemoryPoolAttr_t *attr) {
   MemPool_t *mp;
@@ -1958,7 +2151,7 @@ osMemoryPoolId_t osMemoryPoolNew (uint32_t block_count, uint32_t block_size, con
   if (IS_IRQ()) {
     mp = NULL;
   }
-  else if ((block_count == 0U) || (block_size == 0U)) {
+  else if ((block_count == 0U) || (block_size == 0U) || (block_count > MPOOL_INDEX_NONE)) {
     mp = NULL;
   }
   else {
@@ -1990,7 +2183,7 @@ osMemoryPoolId_t osMemoryPoolNew (uint32_t block_count, uint32_t block_size, con
       else {
         if (attr->mp_mem != NULL) {
           /* Check if array is 4-byte aligned */
-          if (((uint32_t)attr->mp_mem & 3U) == 0U) {
+          if (((uintptr_t)attr->mp_mem & 3U) == 0U) {
             /* Check if array big enough */
             if (attr->mp_size >= sz) {
               /* Static memory pool array is provided */
@@ -2013,11 +2206,11 @@ osMemoryPoolId_t osMemoryPoolNew (uint32_t block_count, uint32_t block_size, con
     }
 
     if (mp != NULL) {
-      /* Create a semaphore (max count == initial count == block_count) */
+      /* Create a semaphore waking up tasks waiting for a block (max count == block_count, initial count == 0) */
       #if (configSUPPORT_STATIC_ALLOCATION == 1)
-        mp->sem = xSemaphoreCreateCountingStatic (block_count, block_count, &mp->mem_sem);
+        mp->sem = xSemaphoreCreateCountingStatic (block_count, 0U, &mp->mem_sem);
       #elif (configSUPPORT_DYNAMIC_ALLOCATION == 1)
-        mp->sem = xSemaphoreCreateCounting (block_count, block_count);
+        mp->sem = xSemaphoreCreateCounting (block_count, 0U);
       #else
         mp->sem == NULL;
       #endif
@@ -2034,12 +2227,13 @@ osMemoryPoolId_t osMemoryPoolNew (uint32_t block_count, uint32_t block_size, con
 
     if ((mp != NULL) && (mp->mem_arr != NULL)) {
       /* Memory pool can be created */
-      mp->head    = NULL;
       mp->mem_sz  = sz;
       mp->name    = name;
       mp->bl_sz   = block_size;
       mp->bl_cnt  = block_count;
-      mp->n       = 0U;
+
+      /* Put all the blocks on the list of free blocks */
+      InitBlocks (mp);
 
       /* Set heap allocated memory flags */
       mp->status = MPOOL_STATUS;
@@ -2086,7 +2280,8 @@ const char *osMemoryPoolGetName (osMemoryPoolId_t mp_id) {
 void *osMemoryPoolAlloc (osMemoryPoolId_t mp_id, uint32_t timeout) {
   MemPool_t *mp;
   void *block;
-  uint32_t isrm;
+  TimeOut_t tmo;
+  TickType_t ticks;
 
   if (mp_id == NULL) {
     /* Invalid input parameters */
@@ -2098,40 +2293,31 @@ void *osMemoryPoolAlloc (osMemoryPoolId_t mp_id, uint32_t timeout) {
     mp = (MemPool_t *)mp_id;
 
     if ((mp->status & MPOOL_STATUS) == MPOOL_STATUS) {
-      if (IS_IRQ()) {
-        if (timeout == 0U) {
-          if (xSemaphoreTakeFromISR (mp->sem, NULL) == pdTRUE) {
-            if ((mp->status & MPOOL_STATUS) == MPOOL_STATUS) {
-              isrm  = taskENTER_CRITICAL_FROM_ISR();
-
-              /* Get a block from the free-list */
-              block = AllocBlock(mp);
-
-              if (block == NULL) {
-                /* List of free blocks is empty, 'create' new block */
-                block = CreateBlock(mp);
-              }
+      /* Get a block from the free-list, without locking */
+      block = AllocBlock(mp);
 
-              taskEXIT_CRITICAL_FROM_ISR(isrm);
-            }
-          }
-        }
-      }
-      else {
-        if (xSemaphoreTake (mp->sem, (TickType_t)timeout) == pdTRUE) {
-          if ((mp->status & MPOOL_STATUS) == MPOOL_STATUS) {
-            taskENTER_CRITICAL();
+      if ((block == NULL) && (timeout != 0U) && !IS_IRQ()) {
+        /* Pool is empty, wait until a block is freed or timeout expires */
+        ticks = (TickType_t)timeout;
+        vTaskSetTimeOutState (&tmo);
 
-            /* Get a block from the free-list */
-            block = AllocBlock(mp);
+        /* Blocks freed from now on wake up a waiting task */
+        MemPool_Add (&mp->wait_cnt, 1U);
 
-            if (block == NULL) {
-              /* List of free blocks is empty, 'create' new block */
-              block = CreateBlock(mp);
-            }
+        for (;;) {
+          block = AllocBlock(mp);
 
-            taskEXIT_CRITICAL();
+          if ((block != NULL) || ((mp->status & MPOOL_STATUS) != MPOOL_STATUS)) {
+            break;
+          }
+          if (xTaskCheckForTimeOut (&tmo, &ticks) != pdFALSE) {
+            break;
           }
+          (void)xSemaphoreTake (mp->sem, ticks);
+        }
+
+        if ((mp->status & MPOOL_STATUS) == MPOOL_STATUS) {
+          MemPool_Add (&mp->wait_cnt, (uint32_t)-1);
         }
       }
     }
@@ -2143,7 +2329,7 @@ void *osMemoryPoolAlloc (osMemoryPoolId_t mp_id, uint32_t timeout) {
 osStatus_t osMemoryPoolFree (osMemoryPoolId_t mp_id, void *block) {
   MemPool_t *mp;
   osStatus_t stat;
-  uint32_t isrm;
+  uint32_t offs;
   BaseType_t yield;
 
   if ((mp_id == NULL) || (block == NULL)) {
@@ -2162,38 +2348,32 @@ osStatus_t osMemoryPoolFree (osMemoryPoolId_t mp_id, void *block) {
       stat = osErrorParameter;
     }
     else {
-      stat = osOK;
-
-      if (IS_IRQ()) {
-        if (uxSemaphoreGetCountFromISR (mp->sem) == mp->bl_cnt) {
-          stat = osErrorResource;
-        }
-        else {
-          isrm = taskENTER_CRITICAL_FROM_ISR();
+      offs = (uint32_t)((uint8_t *)block - mp->mem_arr);
 
-          /* Add block to the list of free blocks */
-          FreeBlock(mp, block);
-
-          taskEXIT_CRITICAL_FROM_ISR(isrm);
-
-          yield = pdFALSE;
-          xSemaphoreGiveFromISR (mp->sem, &yield);
-          portYIELD_FROM_ISR (yield);
-        }
+      if ((offs % MEMPOOL_BLOCK_SIZE(mp->bl_sz)) != 0U) {
+        /* Block pointer not at the start of a block */
+        stat = osErrorParameter;
+      }
+      else if (MemPool_Load (&mp->free_cnt) == mp->bl_cnt) {
+        /* All blocks are already free */
+        stat = osErrorResource;
       }
       else {
-        if (uxSemaphoreGetCount (mp->sem) == mp->bl_cnt) {
-          stat = osErrorResource;
-        }
-        else {
-          taskENTER_CRITICAL();
-
-          /* Add block to the list of free blocks */
-          FreeBlock(mp, block);
+        stat = osOK;
 
-          taskEXIT_CRITICAL();
+        /* Add block to the list of free blocks, without locking */
+        FreeBlock(mp, offs / MEMPOOL_BLOCK_SIZE(mp->bl_sz));
 
-          xSemaphoreGive (mp->sem);
+        if (MemPool_Load (&mp->wait_cnt) != 0U) {
+          /* Wake-up a task waiting for a block */
+          if (IS_IRQ()) {
+            yield = pdFALSE;
+            (void)xSemaphoreGiveFromISR (mp->sem, &yield);
+            portYIELD_FROM_ISR (yield);
+          }
+          else {
+            (void)xSemaphoreGive (mp->sem);
+          }
         }
       }
     }
@@ -2266,13 +2446,7 @@ uint32_t osMemoryPoolGetCount (osMemoryPoolId_t mp_id) {
       n = 0U;
     }
     else {
-      if (IS_IRQ()) {
-        n = uxSemaphoreGetCountFromISR (mp->sem);
-      } else {
-        n = uxSemaphoreGetCount        (mp->sem);
-      }
-
-      n = mp->bl_cnt - n;
+      n = mp->bl_cnt - MemPool_Load (&mp->free_cnt);
     }
   }
 
@@ -2296,11 +2470,7 @@ uint32_t osMemoryPoolGetSpace (osMemoryPoolId_t mp_id) {
       n = 0U;
     }
     else {
-      if (IS_IRQ()) {
-        n = uxSemaphoreGetCountFromISR (mp->sem);
-      } else {
-        n = uxSemaphoreGetCount        (mp->sem);
-      }
+      n = MemPool_Load (&mp->free_cnt);
     }
   }
 
@@ -2330,8 +2500,9 @@ osStatus_t osMemoryPoolDelete (osMemoryPoolId_t mp_id) {
     /* Wake-up tasks waiting for pool semaphore */
     while (xSemaphoreGive (mp->sem) == pdTRUE);
 
-    mp->head    = NULL;
-    mp->bl_sz   = 0U;
+    mp->head     = MPOOL_INDEX_NONE;
+    mp->free_cnt = 0U;
+    mp->bl_sz    = 0U;
     mp->bl_cnt  = 0U;
 
     if ((mp->status & 2U) != 0U) {
@@ -2352,34 +2523,34 @@ osStatus_t osMemoryPoolDelete (osMemoryPoolId_t mp_id) {
 }
 
 /*
-  Create new block given according to the current block index.
+  Link all the blocks of the memory array into the list of free blocks.
 */
-static void *CreateBlock (MemPool_t *mp) {
-  MemPoolBlock_t *p = NULL;
-
-  if (mp->n < mp->bl_cnt) {
-    /* Unallocated blocks exist, set pointer to new block */
-    p = (void *)(mp->mem_arr + (mp->bl_sz * mp->n));
+static void InitBlocks (MemPool_t *mp) {
+  uint32_t i;
 
-    /* Increment block index */
-    mp->n += 1U;
+  for (i = 0U; i < mp->bl_cnt; i++) {
+    GetBlock(mp, i)->next = ((i + 1U) < mp->bl_cnt) ? (i + 1U) : MPOOL_INDEX_NONE;
   }
 
-  return (p);
+  mp->head     = 0U;
+  mp->free_cnt = mp->bl_cnt;
+  mp->wait_cnt = 0U;
 }
 
 /*
   Allocate a block by reading the list of free blocks.
 */
 static void *AllocBlock (MemPool_t *mp) {
-  MemPoolBlock_t *p = NULL;
+  void *p = NULL;
+  uint32_t index;
 
-  if (mp->head != NULL) {
-    /* List of free block exists, get head block */
-    p = mp->head;
+  /* Reserve a free block first, the list then holds at least one block for the caller */
+  if (MemPool_Reserve (&mp->free_cnt) != 0U) {
+    index = MemPool_Pop (mp);
 
-    /* Head block is now next on the list */
-    mp->head = p->next;
+    if (index != MPOOL_INDEX_NONE) {
+      p = GetBlock(mp, index);
+    }
   }
 
   return (p);
@@ -2388,14 +2559,11 @@ static void *AllocBlock (MemPool_t *mp) {
 /*
   Free block by putting it to the list of free blocks.
 */
-static void FreeBlock (MemPool_t *mp, void *block) {
-  MemPoolBlock_t *p = block;
-
-  /* Store current head into block memory space */
-  p->next = mp->head;
+static void FreeBlock (MemPool_t *mp, uint32_t index) {
+  MemPool_Push (mp, index);
 
-  /* Store current block as new head */
-  mp->head = p;
+  /* Block can now be reserved */
+  MemPool_Add (&mp->free_cnt, 1U);
 }
 #endif /* FREERTOS_MPOOL_H_ */
 /*---------------------------------------------------------------------------*/
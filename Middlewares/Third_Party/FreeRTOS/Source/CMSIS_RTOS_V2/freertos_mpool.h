@@ -30,21 +30,55 @@
 /* Memory Pool implementation definitions */
 #define MPOOL_STATUS              0x5EED0000U
 
+/*
+  The free list is a lock-free stack. Its head holds the index of the first free
+  block and a tag incremented on each update, so an update based on an outdated
+  head fails even if the same block is at the head again.
+
+  Atomic operations use LDREX/STREX on cores that have them, C11 atomics on other
+  targets that provide them, such as host builds, and critical sections otherwise.
+*/
+#if ((defined(__ARM_ARCH_7M__)       && (__ARM_ARCH_7M__       == 1)) || \
+     (defined(__ARM_ARCH_7EM__)      && (__ARM_ARCH_7EM__      == 1)) || \
+     (defined(__ARM_ARCH_8M_BASE__)  && (__ARM_ARCH_8M_BASE__  == 1)) || \
+     (defined(__ARM_ARCH_8M_MAIN__)  && (__ARM_ARCH_8M_MAIN__  == 1)))
+  #define MPOOL_ATOMIC_EXCLUSIVE  1
+  typedef volatile uint32_t MemPoolAtomic_t;
+  typedef volatile uint32_t MemPoolHead_t;
+  typedef uint32_t          MemPoolHeadValue_t;
+#elif (defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__) && \
+       !defined(__cplusplus) && !(defined(__ARM_ARCH_6M__) && (__ARM_ARCH_6M__ == 1)))
+  #include <stdatomic.h>
+  #define MPOOL_ATOMIC_C11        1
+  typedef _Atomic uint32_t MemPoolAtomic_t;
+  /* Wider head, so the tag cannot wrap around while an update is preempted */
+  typedef _Atomic uint64_t MemPoolHead_t;
+  typedef uint64_t          MemPoolHeadValue_t;
+#else
+  typedef volatile uint32_t MemPoolAtomic_t;
+  typedef volatile uint32_t MemPoolHead_t;
+  typedef uint32_t          MemPoolHeadValue_t;
+#endif
+
+/* Index marking the end of the free list, also the maximum number of blocks */
+#define MPOOL_INDEX_NONE          0xFFFFU
+
 /* Memory Block header */
 typedef struct {
-  void *next;                   /* Pointer to next block  */
+  uint32_t next;                /* Index of next free block */
 } MemPoolBlock_t;
 
 /* Memory Pool control block */
 typedef struct MemPoolDef_t {
-  MemPoolBlock_t    *head;      /* Pointer to head block   */
+  MemPoolHead_t      head;      /* Free list head (tag and block index) */
+  MemPoolAtomic_t    free_cnt;  /* Number of free blocks   */
+  MemPoolAtomic_t    wait_cnt;  /* Number of waiting tasks */
   SemaphoreHandle_t  sem;       /* Pool semaphore handle   */
   uint8_t           *mem_arr;   /* Pool memory array       */
   uint32_t           mem_sz;    /* Pool memory array size  */
   const char        *name;      /* Pointer to name string  */
   uint32_t           bl_sz;     /* Size of a single block  */
   uint32_t           bl_cnt;    /* Number of blocks        */
-  uint32_t           n;         /* Block allocation index  */
   volatile uint32_t  status;    /* Object status flags     */
 #if (configSUPPORT_STATIC_ALLOCATION == 1)
   StaticSemaphore_t  mem_sem;   /* Semaphore object memory */
@@ -57,7 +91,10 @@ typedef struct MemPoolDef_t {
 /* Define memory pool control block size */
 #define MEMPOOL_CB_SIZE         (sizeof(StaticMemPool_t))
 
+/* Define size of a block in the memory array, blocks are 4-byte aligned */
+#define MEMPOOL_BLOCK_SIZE(bl_size) ((((bl_size) + (4 - 1)) / 4) * 4)
+
 /* Define size of the byte array required to create count of blocks of given size */
-#define MEMPOOL_ARR_SIZE(bl_count, bl_size) (((((bl_size) + (4 - 1)) / 4) * 4)*(bl_count))
+#define MEMPOOL_ARR_SIZE(bl_count, bl_size) (MEMPOOL_BLOCK_SIZE(bl_size)*(bl_count))
 
 #endif /* FREERTOS_MPOOL_H_ */
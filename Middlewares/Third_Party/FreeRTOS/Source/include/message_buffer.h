@@ -599,6 +599,105 @@ BaseType_t xHigherPriorityTaskWoken = pdFALSE;  // Initialised to pdFALSE.
  */
 #define xMessageBufferReceiveFromISR( xMessageBuffer, pvRxData, xBufferLengthBytes, pxHigherPriorityTaskWoken ) xStreamBufferReceiveFromISR( ( StreamBufferHandle_t ) xMessageBuffer, pvRxData, xBufferLengthBytes, pxHigherPriorityTaskWoken )
 
+/**
+ * message_buffer.h
+ *
+<pre>
+size_t xMessageBufferSendReserve( MessageBufferHandle_t xMessageBuffer,
+                                  size_t xDataLengthBytes,
+                                  StreamBufferSpans_t * const pxSpans,
+                                  TickType_t xTicksToWait );
+size_t xMessageBufferSendReserveFromISR( MessageBufferHandle_t xMessageBuffer,
+                                         size_t xDataLengthBytes,
+                                         StreamBufferSpans_t * const pxSpans );
+</pre>
+ *
+ * Reserves the space for a message of xDataLengthBytes bytes so the message
+ * can be written straight into the message buffer instead of having it copied
+ * in by xMessageBufferSend().  The whole message is reserved or nothing is,
+ * the space to store the message length is reserved as well but is not part
+ * of *pxSpans.  See xStreamBufferSendReserve() for details.
+ *
+ * @return xDataLengthBytes if the space was reserved, otherwise 0.
+ *
+ * \defgroup xMessageBufferSendReserve xMessageBufferSendReserve
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferSendReserve( xMessageBuffer, xDataLengthBytes, pxSpans, xTicksToWait ) xStreamBufferSendReserve( ( StreamBufferHandle_t ) xMessageBuffer, xDataLengthBytes, pxSpans, xTicksToWait )
+#define xMessageBufferSendReserveFromISR( xMessageBuffer, xDataLengthBytes, pxSpans ) xStreamBufferSendReserveFromISR( ( StreamBufferHandle_t ) xMessageBuffer, xDataLengthBytes, pxSpans )
+
+/**
+ * message_buffer.h
+ *
+<pre>
+size_t xMessageBufferSendCommit( MessageBufferHandle_t xMessageBuffer,
+                                 size_t xDataLengthBytes );
+size_t xMessageBufferSendCommitFromISR( MessageBufferHandle_t xMessageBuffer,
+                                        size_t xDataLengthBytes,
+                                        BaseType_t * const pxHigherPriorityTaskWoken );
+</pre>
+ *
+ * Stores the length of the message written to the space returned by
+ * xMessageBufferSendReserve() and makes the message available to the reader.
+ * The message can be shorter than the reserved space.  Committing 0 bytes
+ * drops the reservation.  See xStreamBufferSendCommit() for details.
+ *
+ * @return The length of the message, xDataLengthBytes.
+ *
+ * \defgroup xMessageBufferSendCommit xMessageBufferSendCommit
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferSendCommit( xMessageBuffer, xDataLengthBytes ) xStreamBufferSendCommit( ( StreamBufferHandle_t ) xMessageBuffer, xDataLengthBytes )
+#define xMessageBufferSendCommitFromISR( xMessageBuffer, xDataLengthBytes, pxHigherPriorityTaskWoken ) xStreamBufferSendCommitFromISR( ( StreamBufferHandle_t ) xMessageBuffer, xDataLengthBytes, pxHigherPriorityTaskWoken )
+
+/**
+ * message_buffer.h
+ *
+<pre>
+size_t xMessageBufferReceiveAcquire( MessageBufferHandle_t xMessageBuffer,
+                                     StreamBufferSpans_t * const pxSpans,
+                                     TickType_t xTicksToWait );
+size_t xMessageBufferReceiveAcquireFromISR( MessageBufferHandle_t xMessageBuffer,
+                                            StreamBufferSpans_t * const pxSpans );
+</pre>
+ *
+ * Gives the reader access to the next message where it is stored in the
+ * message buffer, instead of having it copied out by xMessageBufferReceive().
+ * The message stays in the buffer until it is released.  See
+ * xStreamBufferReceiveAcquire() for details.
+ *
+ * @return The length of the next message, or 0 if the buffer is empty.
+ *
+ * \defgroup xMessageBufferReceiveAcquire xMessageBufferReceiveAcquire
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferReceiveAcquire( xMessageBuffer, pxSpans, xTicksToWait ) xStreamBufferReceiveAcquire( ( StreamBufferHandle_t ) xMessageBuffer, pxSpans, xTicksToWait )
+#define xMessageBufferReceiveAcquireFromISR( xMessageBuffer, pxSpans ) xStreamBufferReceiveAcquireFromISR( ( StreamBufferHandle_t ) xMessageBuffer, pxSpans )
+
+/**
+ * message_buffer.h
+ *
+<pre>
+size_t xMessageBufferReceiveRelease( MessageBufferHandle_t xMessageBuffer,
+                                     size_t xDataLengthBytes );
+size_t xMessageBufferReceiveReleaseFromISR( MessageBufferHandle_t xMessageBuffer,
+                                            size_t xDataLengthBytes,
+                                            BaseType_t * const pxHigherPriorityTaskWoken );
+</pre>
+ *
+ * Removes the message returned by xMessageBufferReceiveAcquire() from the
+ * message buffer.  A message is always released as a whole: xDataLengthBytes
+ * must be the length returned by the acquisition.  See
+ * xStreamBufferReceiveRelease() for details.
+ *
+ * @return The length of the message removed, xDataLengthBytes.
+ *
+ * \defgroup xMessageBufferReceiveRelease xMessageBufferReceiveRelease
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferReceiveRelease( xMessageBuffer, xDataLengthBytes ) xStreamBufferReceiveRelease( ( StreamBufferHandle_t ) xMessageBuffer, xDataLengthBytes )
+#define xMessageBufferReceiveReleaseFromISR( xMessageBuffer, xDataLengthBytes, pxHigherPriorityTaskWoken ) xStreamBufferReceiveReleaseFromISR( ( StreamBufferHandle_t ) xMessageBuffer, xDataLengthBytes, pxHigherPriorityTaskWoken )
+
 /**
  * message_buffer.h
  *
@@ -147,6 +147,10 @@ only for ports that are using the MPU. */
 		equivalents. */
 		#define xStreamBufferSend						MPU_xStreamBufferSend
 		#define xStreamBufferReceive					MPU_xStreamBufferReceive
+		#define xStreamBufferSendReserve				MPU_xStreamBufferSendReserve
+		#define xStreamBufferSendCommit					MPU_xStreamBufferSendCommit
+		#define xStreamBufferReceiveAcquire				MPU_xStreamBufferReceiveAcquire
+		#define xStreamBufferReceiveRelease				MPU_xStreamBufferReceiveRelease
 		#define xStreamBufferNextMessageLengthBytes		MPU_xStreamBufferNextMessageLengthBytes
 		#define vStreamBufferDelete						MPU_vStreamBufferDelete
 		#define xStreamBufferIsFull						MPU_xStreamBufferIsFull
@@ -68,6 +68,21 @@ extern "C" {
 struct StreamBufferDef_t;
 typedef struct StreamBufferDef_t * StreamBufferHandle_t;
 
+/**
+ * Type used by the zero copy API functions, such as xStreamBufferSendReserve()
+ * and xStreamBufferReceiveAcquire(), to describe an area of the buffer's
+ * storage area.  The area is contiguous unless it wraps back to the start of
+ * the storage area, in which case it continues with the second span.  Unused
+ * spans have a NULL pointer and a length of 0.
+ */
+typedef struct StreamBufferSpans_t
+{
+	uint8_t *pucFirst;			/* Start of the first span. */
+	size_t xFirstLengthBytes;	/* Length of the first span. */
+	uint8_t *pucSecond;			/* Start of the second span, always the start of the storage area. */
+	size_t xSecondLengthBytes;	/* Length of the second span. */
+} StreamBufferSpans_t;
+
 
 /**
  * message_buffer.h
@@ -590,6 +605,311 @@ size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer,
 									size_t xBufferLengthBytes,
 									BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferSendReserve( StreamBufferHandle_t xStreamBuffer,
+                                 size_t xDataLengthBytes,
+                                 StreamBufferSpans_t * const pxSpans,
+                                 TickType_t xTicksToWait );
+</pre>
+ *
+ * Reserves free space in a stream buffer so the writer, or a DMA transfer it
+ * starts, can write data straight into the buffer instead of having it copied
+ * in by xStreamBufferSend().  Nothing is written to the buffer and the reader
+ * does not see the reserved space until xStreamBufferSendCommit() is called.
+ *
+ * The reserved space is described by *pxSpans.  It is contiguous, unless it
+ * wraps back to the start of the buffer's storage area, in which case it is
+ * made of two spans.  Calling xStreamBufferSendReserve() again before the data
+ * is committed returns the same space.
+ *
+ * The same single writer and single reader restrictions as
+ * xStreamBufferSend() apply: the reservation and the commit are write
+ * operations.  Use xStreamBufferSendReserveFromISR() to reserve space from an
+ * interrupt service routine (ISR).
+ *
+ * @param xStreamBuffer The handle of the stream buffer in which space is
+ * reserved.
+ *
+ * @param xDataLengthBytes The maximum number of bytes to reserve.
+ *
+ * @param pxSpans Receives the location of the reserved space.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for xDataLengthBytes bytes to become free, in the same
+ * way as xStreamBufferSend().  If the task times out it still reserves as many
+ * bytes as possible.
+ *
+ * @return The number of bytes reserved, which can be less than
+ * xDataLengthBytes, or 0 if there is no free space.
+ *
+ * Example use:
+<pre>
+void vAFunction( StreamBufferHandle_t xStreamBuffer )
+{
+StreamBufferSpans_t xSpans;
+size_t xReserved;
+
+    // Reserve space for up to 256 bytes, blocking for a maximum of 100ms to
+    // wait for that much space to be free.
+    xReserved = xStreamBufferSendReserve( xStreamBuffer, 256, &xSpans, pdMS_TO_TICKS( 100 ) );
+
+    if( xReserved > 0 )
+    {
+        // Start a DMA transfer into the first span, and into the second span
+        // if the space wraps.  The DMA complete interrupt handler then calls
+        // xStreamBufferSendCommitFromISR( xStreamBuffer, xReserved, ... ).
+        vStartDma( xSpans.pucFirst, xSpans.xFirstLengthBytes,
+                   xSpans.pucSecond, xSpans.xSecondLengthBytes );
+    }
+}
+</pre>
+ * \defgroup xStreamBufferSendReserve xStreamBufferSendReserve
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferSendReserve( StreamBufferHandle_t xStreamBuffer,
+								 size_t xDataLengthBytes,
+								 StreamBufferSpans_t * const pxSpans,
+								 TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferSendReserveFromISR( StreamBufferHandle_t xStreamBuffer,
+                                        size_t xDataLengthBytes,
+                                        StreamBufferSpans_t * const pxSpans );
+</pre>
+ *
+ * Interrupt safe version of xStreamBufferSendReserve(), which returns
+ * immediately.
+ *
+ * @param xStreamBuffer The handle of the stream buffer in which space is
+ * reserved.
+ *
+ * @param xDataLengthBytes The maximum number of bytes to reserve.
+ *
+ * @param pxSpans Receives the location of the reserved space.
+ *
+ * @return The number of bytes reserved, which can be less than
+ * xDataLengthBytes, or 0 if there is no free space.
+ *
+ * \defgroup xStreamBufferSendReserveFromISR xStreamBufferSendReserveFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferSendReserveFromISR( StreamBufferHandle_t xStreamBuffer,
+										size_t xDataLengthBytes,
+										StreamBufferSpans_t * const pxSpans ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferSendCommit( StreamBufferHandle_t xStreamBuffer,
+                                size_t xDataLengthBytes );
+</pre>
+ *
+ * Makes the first xDataLengthBytes bytes of the space returned by
+ * xStreamBufferSendReserve() or xStreamBufferSendReserveFromISR() available to
+ * the reader, as if they had been sent with xStreamBufferSend().  A task
+ * blocked on the buffer waiting for data is unblocked when the trigger level
+ * is reached.
+ *
+ * xDataLengthBytes must not be greater than the number of bytes reserved.
+ * Committing 0 bytes drops the reservation.  Use
+ * xStreamBufferSendCommitFromISR() to commit data from an interrupt service
+ * routine (ISR).
+ *
+ * @param xStreamBuffer The handle of the stream buffer the data was written
+ * to.
+ *
+ * @param xDataLengthBytes The number of bytes written to the reserved space.
+ *
+ * @return The number of bytes committed, which is xDataLengthBytes.
+ *
+ * \defgroup xStreamBufferSendCommit xStreamBufferSendCommit
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferSendCommit( StreamBufferHandle_t xStreamBuffer,
+								size_t xDataLengthBytes ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferSendCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+                                       size_t xDataLengthBytes,
+                                       BaseType_t * const pxHigherPriorityTaskWoken );
+</pre>
+ *
+ * Interrupt safe version of xStreamBufferSendCommit().
+ *
+ * @param xStreamBuffer The handle of the stream buffer the data was written
+ * to.
+ *
+ * @param xDataLengthBytes The number of bytes written to the reserved space.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if committing the data
+ * unblocked a task that has a priority above the priority of the currently
+ * running task, as with xStreamBufferSendFromISR().
+ *
+ * @return The number of bytes committed, which is xDataLengthBytes.
+ *
+ * \defgroup xStreamBufferSendCommitFromISR xStreamBufferSendCommitFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferSendCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+									   size_t xDataLengthBytes,
+									   BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferReceiveAcquire( StreamBufferHandle_t xStreamBuffer,
+                                    StreamBufferSpans_t * const pxSpans,
+                                    TickType_t xTicksToWait );
+</pre>
+ *
+ * Gives the reader access to the data in a stream buffer where it is stored,
+ * instead of having it copied out by xStreamBufferReceive().  The data stays
+ * in the buffer, and the space it uses is not available to the writer, until
+ * xStreamBufferReceiveRelease() is called.
+ *
+ * The data is described by *pxSpans.  It is contiguous, unless it wraps back
+ * to the start of the buffer's storage area, in which case it is made of two
+ * spans.
+ *
+ * The same single writer and single reader restrictions as
+ * xStreamBufferReceive() apply: acquiring and releasing data are read
+ * operations.  Use xStreamBufferReceiveAcquireFromISR() to acquire data from
+ * an interrupt service routine (ISR).
+ *
+ * @param xStreamBuffer The handle of the stream buffer from which data is
+ * acquired.
+ *
+ * @param pxSpans Receives the location of the data.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for data, in the same way as xStreamBufferReceive().
+ *
+ * @return The number of bytes acquired, which is all the bytes in the buffer,
+ * or 0 if the buffer is empty.
+ *
+ * Example use:
+<pre>
+void vAFunction( StreamBufferHandle_t xStreamBuffer )
+{
+StreamBufferSpans_t xSpans;
+size_t xAcquired;
+
+    // Wait for data to arrive, then process it in place.
+    xAcquired = xStreamBufferReceiveAcquire( xStreamBuffer, &xSpans, portMAX_DELAY );
+
+    if( xAcquired > 0 )
+    {
+        vProcess( xSpans.pucFirst, xSpans.xFirstLengthBytes );
+        vProcess( xSpans.pucSecond, xSpans.xSecondLengthBytes );
+
+        // Free the space for the writer.
+        xStreamBufferReceiveRelease( xStreamBuffer, xAcquired );
+    }
+}
+</pre>
+ * \defgroup xStreamBufferReceiveAcquire xStreamBufferReceiveAcquire
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReceiveAcquire( StreamBufferHandle_t xStreamBuffer,
+									StreamBufferSpans_t * const pxSpans,
+									TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferReceiveAcquireFromISR( StreamBufferHandle_t xStreamBuffer,
+                                           StreamBufferSpans_t * const pxSpans );
+</pre>
+ *
+ * Interrupt safe version of xStreamBufferReceiveAcquire(), which returns
+ * immediately.
+ *
+ * @param xStreamBuffer The handle of the stream buffer from which data is
+ * acquired.
+ *
+ * @param pxSpans Receives the location of the data.
+ *
+ * @return The number of bytes acquired, which is all the bytes in the buffer,
+ * or 0 if the buffer is empty.
+ *
+ * \defgroup xStreamBufferReceiveAcquireFromISR xStreamBufferReceiveAcquireFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReceiveAcquireFromISR( StreamBufferHandle_t xStreamBuffer,
+										   StreamBufferSpans_t * const pxSpans ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferReceiveRelease( StreamBufferHandle_t xStreamBuffer,
+                                    size_t xDataLengthBytes );
+</pre>
+ *
+ * Removes the first xDataLengthBytes bytes of the data returned by
+ * xStreamBufferReceiveAcquire() or xStreamBufferReceiveAcquireFromISR() from
+ * the buffer, as if they had been read with xStreamBufferReceive().  A task
+ * blocked on the buffer waiting for space is unblocked.
+ *
+ * xDataLengthBytes must not be greater than the number of bytes acquired, the
+ * bytes that are not released are returned again by the next acquisition.  Use
+ * xStreamBufferReceiveReleaseFromISR() to release data from an interrupt
+ * service routine (ISR).
+ *
+ * @param xStreamBuffer The handle of the stream buffer the data was acquired
+ * from.
+ *
+ * @param xDataLengthBytes The number of bytes to remove from the buffer.
+ *
+ * @return The number of bytes released, which is xDataLengthBytes.
+ *
+ * \defgroup xStreamBufferReceiveRelease xStreamBufferReceiveRelease
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReceiveRelease( StreamBufferHandle_t xStreamBuffer,
+									size_t xDataLengthBytes ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+<pre>
+size_t xStreamBufferReceiveReleaseFromISR( StreamBufferHandle_t xStreamBuffer,
+                                           size_t xDataLengthBytes,
+                                           BaseType_t * const pxHigherPriorityTaskWoken );
+</pre>
+ *
+ * Interrupt safe version of xStreamBufferReceiveRelease().
+ *
+ * @param xStreamBuffer The handle of the stream buffer the data was acquired
+ * from.
+ *
+ * @param xDataLengthBytes The number of bytes to remove from the buffer.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if releasing the data
+ * unblocked a task that has a priority above the priority of the currently
+ * running task, as with xStreamBufferReceiveFromISR().
+ *
+ * @return The number of bytes released, which is xDataLengthBytes.
+ *
+ * \defgroup xStreamBufferReceiveReleaseFromISR xStreamBufferReceiveReleaseFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReceiveReleaseFromISR( StreamBufferHandle_t xStreamBuffer,
+										   size_t xDataLengthBytes,
+										   BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
 /**
  * stream_buffer.h
  *
@@ -0,0 +1,109 @@
+/*
+ * FreeRTOS Kernel V10.3.1
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * Host replacement of the CMSIS-Core compiler and core definitions used by the
+ * CMSIS-RTOS2 wrapper (CMSIS_RTOS_V2/cmsis_os2.c), so the wrapper builds
+ * unmodified on top of the POSIX port.  The port directory must come before
+ * the CMSIS include directory in the include path of a host build.
+ *
+ * The processor state is emulated by the port: the interrupt mask blocks the
+ * tick signal, the IPSR reads as the SysTick exception while the emulated tick
+ * interrupt runs, and the SysTick registers are updated by the port tick.
+ */
+
+#ifndef __CMSIS_COMPILER_H
+#define __CMSIS_COMPILER_H
+
+#include <stdint.h>
+
+#ifndef   __ASM
+	#define __ASM						__asm
+#endif
+#ifndef   __INLINE
+	#define __INLINE					inline
+#endif
+#ifndef   __STATIC_INLINE
+	#define __STATIC_INLINE				static inline
+#endif
+#ifndef   __STATIC_FORCEINLINE
+	#define __STATIC_FORCEINLINE		__attribute__((always_inline)) static inline
+#endif
+#ifndef   __NO_RETURN
+	#define __NO_RETURN					__attribute__((__noreturn__))
+#endif
+#ifndef   __USED
+	#define __USED						__attribute__((used))
+#endif
+#ifndef   __WEAK
+	#define __WEAK						__attribute__((weak))
+#endif
+#ifndef   __PACKED
+	#define __PACKED					__attribute__((packed, aligned(1)))
+#endif
+#ifndef   __ALIGNED
+	#define __ALIGNED(x)				__attribute__((aligned(x)))
+#endif
+
+/* Exception and interrupt numbers.  Only the core exceptions referenced by
+the CMSIS-RTOS2 wrapper are listed. */
+typedef enum
+{
+	SVCall_IRQn		= -5,
+	PendSV_IRQn		= -2,
+	SysTick_IRQn	= -1
+} IRQn_Type;
+
+/* SysTick registers, updated by the POSIX port. */
+typedef struct
+{
+	volatile uint32_t CTRL;
+	volatile uint32_t LOAD;
+	volatile uint32_t VAL;
+	volatile uint32_t CALIB;
+} SysTick_Type;
+
+extern SysTick_Type xPortSysTick;
+#define SysTick		( &xPortSysTick )
+
+/* Processor state, implemented by the POSIX port. */
+extern uint32_t ulPortGetIPSR( void );
+extern uint32_t ulPortGetPRIMASK( void );
+extern void vPortDisableInterrupts( void );
+extern void vPortEnableInterrupts( void );
+
+#define __get_IPSR()				ulPortGetIPSR()
+#define __get_PRIMASK()				ulPortGetPRIMASK()
+#define __get_BASEPRI()				( 0UL )
+#define __disable_irq()				vPortDisableInterrupts()
+#define __enable_irq()				vPortEnableInterrupts()
+
+/* Interrupt priorities do not exist on the host. */
+#define NVIC_SetPriority( IRQn, priority )	do { ( void ) ( IRQn ); ( void ) ( priority ); } while( 0 )
+
+#endif /* __CMSIS_COMPILER_H */
+
@@ -0,0 +1,544 @@
+/*
+ * FreeRTOS Kernel V10.3.1
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*-----------------------------------------------------------
+ * Implementation of functions defined in portable.h for the POSIX port.
+ *
+ * Each task runs in its own host thread, but only the thread of the task
+ * selected by the scheduler is allowed to run.  Every other task thread waits
+ * on its own condition variable, so the kernel data is never accessed by two
+ * threads at once.  The tick interrupt is emulated with the signal of a host
+ * interval timer.
+ *
+ * Masking interrupts only sets a flag, as PRIMASK does on target, so critical
+ * sections cost no system call.  A tick signal received while interrupts are
+ * masked is held pending and processed when they are unmasked again.  The
+ * signal mask of the threads is only changed around context switches, so the
+ * signal never reaches a thread that is waiting for its turn.
+ *----------------------------------------------------------*/
+
+#include <pthread.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/time.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Host replacement of the CMSIS-Core definitions, for the emulated SysTick. */
+#include "cmsis_compiler.h"
+
+/* The signal used to emulate the tick interrupt. */
+#define portTICK_SIGNAL						SIGALRM
+
+/* Number of the SysTick exception, returned by ulPortGetIPSR() while the
+emulated tick interrupt runs. */
+#define portSYSTICK_EXCEPTION_NUMBER		( 15UL )
+
+#define portMICROSECONDS_PER_SECOND			( 1000000UL )
+
+/* Host thread of a task.  The structure is kept at the top of the task stack,
+which is otherwise unused as the thread runs on a stack allocated by the host
+C library. */
+typedef struct THREAD
+{
+	pthread_t xThread;
+	pthread_mutex_t xMutex;
+	pthread_cond_t xCond;
+	TaskFunction_t pxCode;
+	void *pvParameters;
+	BaseType_t xResumed;
+	BaseType_t xDying;
+} Thread_t;
+
+/*
+ * Setup the host interval timer to generate the tick interrupts.  The
+ * implementation in this file is weak to allow application writers to change
+ * the timer used to generate the tick interrupt.
+ */
+void vPortSetupTimerInterrupt( void );
+
+/*
+ * Emulated tick interrupt.
+ */
+void xPortSysTickHandler( void );
+
+/*
+ * Entry point of the task threads.
+ */
+static void *prvThreadEntry( void *pvParameters );
+
+/*
+ * Used to catch tasks that attempt to return from their implementing function.
+ */
+static void prvTaskExitError( void );
+
+/*
+ * Signal handler of the tick signal.
+ */
+static void prvTickSignalHandler( int iSignal );
+
+/*
+ * Select the next task and hand the execution over to its thread.  Called
+ * with interrupts masked.
+ */
+static void prvSwitchContext( void );
+
+/*
+ * Unmask interrupts, after processing the tick interrupts and the context
+ * switches held pending while they were masked.
+ */
+static void prvUnmaskInterrupts( void );
+
+/*
+ * Allow the thread of a task to run, and wait until the calling thread is
+ * allowed to run again.
+ */
+static void prvResumeThread( Thread_t *pxThread );
+static void prvSuspendThread( Thread_t *pxThread );
+
+/*
+ * Block or unblock the tick signal in the calling thread.
+ */
+static void prvMaskTickSignal( int iHow );
+
+/*-----------------------------------------------------------*/
+
+/* The TCB of the running task.  The first member of a TCB is its top of stack,
+which points to the Thread_t structure of the task. */
+extern void * volatile pxCurrentTCB;
+
+/* Each task maintains its own interrupt status in the critical nesting
+variable.  Context switches only happen outside of critical sections, so a
+single variable is sufficient. */
+static volatile UBaseType_t uxCriticalNesting = 0;
+
+/* Emulated processor state: interrupts masked, inside the tick interrupt, a
+tick interrupt pending, and a context switch pending until interrupts are
+unmasked, like the PendSV exception of the Cortex-M ports. */
+static volatile BaseType_t xInterruptsMasked = pdFALSE;
+static volatile BaseType_t xInsideInterrupt = pdFALSE;
+static volatile BaseType_t xTickPending = pdFALSE;
+static volatile BaseType_t xSwitchPending = pdFALSE;
+
+/* vTaskEndScheduler() wakes up the thread that started the scheduler. */
+static pthread_mutex_t xSchedulerMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t xSchedulerCond = PTHREAD_COND_INITIALIZER;
+static BaseType_t xSchedulerEnd = pdFALSE;
+
+/* Emulated SysTick registers, read by the CMSIS-RTOS2 wrapper.  The counter
+is only updated at every tick. */
+SysTick_Type xPortSysTick = { 0UL, 0UL, 0UL, 0UL };
+
+/*-----------------------------------------------------------*/
+
+static Thread_t *prvGetThread( void *pxTCB )
+{
+	return ( Thread_t * ) *( ( StackType_t ** ) pxTCB );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * See header file for description.
+ */
+StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pvParameters )
+{
+Thread_t *pxThread;
+sigset_t xSignals, xOldSignals;
+int iReturn;
+
+	/* Keep the thread structure at the top of the task stack. */
+	pxThread = ( Thread_t * ) ( ( ( portPOINTER_SIZE_TYPE ) ( pxTopOfStack + 1 ) - sizeof( Thread_t ) ) & ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) );
+
+	memset( pxThread, 0, sizeof( Thread_t ) );
+	pxThread->pxCode = pxCode;
+	pxThread->pvParameters = pvParameters;
+	pthread_mutex_init( &( pxThread->xMutex ), NULL );
+	pthread_cond_init( &( pxThread->xCond ), NULL );
+
+	/* The new thread inherits the signal mask, it must never receive the tick
+	signal before the scheduler lets it run. */
+	sigemptyset( &xSignals );
+	sigaddset( &xSignals, portTICK_SIGNAL );
+	pthread_sigmask( SIG_BLOCK, &xSignals, &xOldSignals );
+	iReturn = pthread_create( &( pxThread->xThread ), NULL, prvThreadEntry, pxThread );
+	pthread_sigmask( SIG_SETMASK, &xOldSignals, NULL );
+	configASSERT( iReturn == 0 );
+	( void ) iReturn;
+
+	return ( StackType_t * ) pxThread;
+}
+/*-----------------------------------------------------------*/
+
+static void *prvThreadEntry( void *pvParameters )
+{
+Thread_t *pxThread = ( Thread_t * ) pvParameters;
+
+	/* Wait for the scheduler to select the task for the first time.  The task
+	starts with interrupts unmasked. */
+	prvSuspendThread( pxThread );
+	prvMaskTickSignal( SIG_UNBLOCK );
+	prvUnmaskInterrupts();
+
+	pxThread->pxCode( pxThread->pvParameters );
+	prvTaskExitError();
+
+	return NULL;
+}
+/*-----------------------------------------------------------*/
+
+static void prvTaskExitError( void )
+{
+	/* A function that implements a task must not exit or attempt to return to
+	its caller as there is nothing to return to.  If a task wants to exit it
+	should instead call vTaskDelete( NULL ).
+
+	Artificially force an assert() to be triggered if configASSERT() is
+	defined, then delete the task so the host thread ends. */
+	configASSERT( uxCriticalNesting == ~0UL );
+	vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvMaskTickSignal( int iHow )
+{
+sigset_t xSignals;
+
+	sigemptyset( &xSignals );
+	sigaddset( &xSignals, portTICK_SIGNAL );
+	pthread_sigmask( iHow, &xSignals, NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvResumeThread( Thread_t *pxThread )
+{
+	pthread_mutex_lock( &( pxThread->xMutex ) );
+	pxThread->xResumed = pdTRUE;
+	pthread_cond_signal( &( pxThread->xCond ) );
+	pthread_mutex_unlock( &( pxThread->xMutex ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSuspendThread( Thread_t *pxThread )
+{
+BaseType_t xDying;
+
+	pthread_mutex_lock( &( pxThread->xMutex ) );
+	while( pxThread->xResumed == pdFALSE )
+	{
+		pthread_cond_wait( &( pxThread->xCond ), &( pxThread->xMutex ) );
+	}
+	pxThread->xResumed = pdFALSE;
+	xDying = pxThread->xDying;
+	pthread_mutex_unlock( &( pxThread->xMutex ) );
+
+	/* The task was deleted while its thread was waiting, the thread must not
+	touch the kernel data anymore. */
+	if( xDying != pdFALSE )
+	{
+		pthread_exit( NULL );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvSwitchContext( void )
+{
+Thread_t *pxOldThread, *pxNewThread;
+sigset_t xSignals, xOldSignals;
+
+	xSwitchPending = pdFALSE;
+
+	pxOldThread = prvGetThread( pxCurrentTCB );
+	vTaskSwitchContext();
+	pxNewThread = prvGetThread( pxCurrentTCB );
+
+	if( pxNewThread != pxOldThread )
+	{
+		/* The tick signal must only reach the running thread.  Within the
+		signal handler it is blocked already, and restoring the previous mask
+		leaves it blocked. */
+		sigemptyset( &xSignals );
+		sigaddset( &xSignals, portTICK_SIGNAL );
+		pthread_sigmask( SIG_BLOCK, &xSignals, &xOldSignals );
+
+		prvResumeThread( pxNewThread );
+		prvSuspendThread( pxOldThread );
+
+		pthread_sigmask( SIG_SETMASK, &xOldSignals, NULL );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvUnmaskInterrupts( void )
+{
+	for( ;; )
+	{
+		xInterruptsMasked = pdFALSE;
+		portMEMORY_BARRIER();
+
+		/* From here a tick signal is processed by the signal handler. */
+		if( ( xTickPending == pdFALSE ) && ( xSwitchPending == pdFALSE ) )
+		{
+			break;
+		}
+
+		xInterruptsMasked = pdTRUE;
+		portMEMORY_BARRIER();
+
+		if( xTickPending != pdFALSE )
+		{
+			xTickPending = pdFALSE;
+			xPortSysTickHandler();
+		}
+
+		if( xSwitchPending != pdFALSE )
+		{
+			prvSwitchContext();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * See header file for description.
+ */
+BaseType_t xPortStartScheduler( void )
+{
+struct sigaction xAction;
+
+	/* The thread starting the scheduler never runs a task, so it keeps the
+	tick signal blocked. */
+	prvMaskTickSignal( SIG_BLOCK );
+
+	memset( &xAction, 0, sizeof( xAction ) );
+	xAction.sa_handler = prvTickSignalHandler;
+	xAction.sa_flags = SA_RESTART;
+	sigemptyset( &xAction.sa_mask );
+	sigaction( portTICK_SIGNAL, &xAction, NULL );
+
+	/* Start the timer that generates the tick interrupt. */
+	vPortSetupTimerInterrupt();
+
+	/* Initialise the critical nesting count ready for the first task, the
+	interrupts were masked by vTaskStartScheduler(). */
+	uxCriticalNesting = 0;
+
+	/* Start the first task. */
+	prvResumeThread( prvGetThread( pxCurrentTCB ) );
+
+	/* Wait for vTaskEndScheduler(). */
+	pthread_mutex_lock( &xSchedulerMutex );
+	while( xSchedulerEnd == pdFALSE )
+	{
+		pthread_cond_wait( &xSchedulerCond, &xSchedulerMutex );
+	}
+	pthread_mutex_unlock( &xSchedulerMutex );
+
+	return 0;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+struct itimerval xTimer;
+
+	/* Stop the tick. */
+	memset( &xTimer, 0, sizeof( xTimer ) );
+	setitimer( ITIMER_REAL, &xTimer, NULL );
+
+	pthread_mutex_lock( &xSchedulerMutex );
+	xSchedulerEnd = pdTRUE;
+	pthread_cond_signal( &xSchedulerCond );
+	pthread_mutex_unlock( &xSchedulerMutex );
+
+	/* Execution continues after vTaskStartScheduler(), the calling task never
+	runs again. */
+	prvMaskTickSignal( SIG_BLOCK );
+	prvSuspendThread( prvGetThread( pxCurrentTCB ) );
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+	xSwitchPending = pdTRUE;
+
+	/* Otherwise the context switch is pended until interrupts are unmasked. */
+	if( ( xInsideInterrupt == pdFALSE ) && ( xInterruptsMasked == pdFALSE ) )
+	{
+		xInterruptsMasked = pdTRUE;
+		prvUnmaskInterrupts();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortDisableInterrupts( void )
+{
+	xInterruptsMasked = pdTRUE;
+	portMEMORY_BARRIER();
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnableInterrupts( void )
+{
+	/* Interrupts stay masked until the tick interrupt returns. */
+	if( xInsideInterrupt == pdFALSE )
+	{
+		prvUnmaskInterrupts();
+	}
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxPortSetInterruptMask( void )
+{
+UBaseType_t uxReturn;
+
+	uxReturn = ( UBaseType_t ) xInterruptsMasked;
+	vPortDisableInterrupts();
+
+	return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortClearInterruptMask( UBaseType_t uxMask )
+{
+	if( uxMask == ( UBaseType_t ) pdFALSE )
+	{
+		vPortEnableInterrupts();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+	vPortDisableInterrupts();
+	uxCriticalNesting++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+	configASSERT( uxCriticalNesting );
+	uxCriticalNesting--;
+	if( uxCriticalNesting == 0 )
+	{
+		vPortEnableInterrupts();
+	}
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortIsInsideInterrupt( void )
+{
+	return xInsideInterrupt;
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulPortGetIPSR( void )
+{
+	return ( xInsideInterrupt != pdFALSE ) ? portSYSTICK_EXCEPTION_NUMBER : 0UL;
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulPortGetPRIMASK( void )
+{
+	return ( xInterruptsMasked != pdFALSE ) ? 1UL : 0UL;
+}
+/*-----------------------------------------------------------*/
+
+void xPortSysTickHandler( void )
+{
+	xInsideInterrupt = pdTRUE;
+
+	/* Increment the RTOS tick. */
+	if( xTaskIncrementTick() != pdFALSE )
+	{
+		/* A context switch is required.  Context switching is performed when
+		the interrupt returns. */
+		xSwitchPending = pdTRUE;
+	}
+
+	xInsideInterrupt = pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+static void prvTickSignalHandler( int iSignal )
+{
+	( void ) iSignal;
+
+	xPortSysTick.VAL = xPortSysTick.LOAD;
+	xTickPending = pdTRUE;
+
+	/* With interrupts unmasked the tick is processed now, otherwise when they
+	get unmasked. */
+	if( xInterruptsMasked == pdFALSE )
+	{
+		xInterruptsMasked = pdTRUE;
+		prvUnmaskInterrupts();
+	}
+}
+/*-----------------------------------------------------------*/
+
+/*-----------------------------------------------------------*/
+
+void vPortCancelThread( void *pxTaskToDelete )
+{
+Thread_t *pxThread = prvGetThread( pxTaskToDelete );
+
+	/* Wake the thread up so it exits, then wait for it to be gone before the
+	kernel frees the stack that holds its structure. */
+	pthread_mutex_lock( &( pxThread->xMutex ) );
+	pxThread->xDying = pdTRUE;
+	pxThread->xResumed = pdTRUE;
+	pthread_cond_signal( &( pxThread->xCond ) );
+	pthread_mutex_unlock( &( pxThread->xMutex ) );
+
+	pthread_join( pxThread->xThread, NULL );
+	pthread_cond_destroy( &( pxThread->xCond ) );
+	pthread_mutex_destroy( &( pxThread->xMutex ) );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Setup the host interval timer to generate the tick interrupts at the
+ * required frequency.
+ */
+__attribute__(( weak )) void vPortSetupTimerInterrupt( void )
+{
+struct itimerval xTimer;
+
+	/* Emulated SysTick, counting down from the reload value once per tick. */
+	xPortSysTick.LOAD = ( uint32_t ) ( configCPU_CLOCK_HZ / configTICK_RATE_HZ ) - 1UL;
+	xPortSysTick.VAL = xPortSysTick.LOAD;
+	xPortSysTick.CTRL = 0x7UL;
+
+	xTimer.it_interval.tv_sec = 0;
+	xTimer.it_interval.tv_usec = portMICROSECONDS_PER_SECOND / configTICK_RATE_HZ;
+	xTimer.it_value = xTimer.it_interval;
+	setitimer( ITIMER_REAL, &xTimer, NULL );
+}
+/*-----------------------------------------------------------*/
+
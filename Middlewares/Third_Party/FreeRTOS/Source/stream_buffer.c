@@ -202,6 +202,95 @@ static size_t prvReadBytesFromBuffer( StreamBuffer_t *pxStreamBuffer,
 									  size_t xMaxCount,
 									  size_t xBytesAvailable ) PRIVILEGED_FUNCTION;
 
+/*
+ * Blocks the calling task until xRequiredSpace bytes are free in the buffer or
+ * xTicksToWait ticks have passed.  Returns the number of free bytes.
+ */
+static size_t prvWaitForSpace( StreamBuffer_t * const pxStreamBuffer,
+							   size_t xRequiredSpace,
+							   TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * Blocks the calling task until more than xBytesToStoreMessageLength bytes are
+ * in the buffer or xTicksToWait ticks have passed.  Returns the number of bytes
+ * in the buffer.
+ */
+static size_t prvWaitForData( StreamBuffer_t * const pxStreamBuffer,
+							  size_t xBytesToStoreMessageLength,
+							  TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * Describes the xCount bytes of the buffer's data storage area that start at
+ * xIndex as one span, or as two spans if they wrap back to the start of the
+ * storage area.
+ */
+static void prvGetSpans( const StreamBuffer_t * const pxStreamBuffer,
+						 size_t xIndex,
+						 size_t xCount,
+						 StreamBufferSpans_t * const pxSpans ) PRIVILEGED_FUNCTION;
+
+/*
+ * Copy xCount bytes between pucData and the buffer's data storage area, starting
+ * at xIndex in the storage area, without moving the head or the tail.
+ */
+static void prvCopyToBuffer( StreamBuffer_t * const pxStreamBuffer,
+							 size_t xIndex,
+							 const uint8_t *pucData,
+							 size_t xCount ) PRIVILEGED_FUNCTION;
+static void prvCopyFromBuffer( const StreamBuffer_t * const pxStreamBuffer,
+							   size_t xIndex,
+							   uint8_t *pucData,
+							   size_t xCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the length of the message that starts at xIndex in a message buffer,
+ * without removing it from the buffer.
+ */
+static size_t prvPeekMessageLength( const StreamBuffer_t * const pxStreamBuffer,
+									size_t xIndex ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns xIndex moved xCount bytes forward in the buffer's data storage area.
+ */
+static size_t prvAdvanceIndex( const StreamBuffer_t * const pxStreamBuffer,
+							   size_t xIndex,
+							   size_t xCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Common part of xStreamBufferSendReserve() and
+ * xStreamBufferSendReserveFromISR().  Describes the free space the next
+ * message or the next bytes can be written to, without writing to the buffer.
+ */
+static size_t prvReserveSpans( StreamBuffer_t * const pxStreamBuffer,
+							   size_t xDataLengthBytes,
+							   size_t xSpace,
+							   StreamBufferSpans_t * const pxSpans ) PRIVILEGED_FUNCTION;
+
+/*
+ * Common part of xStreamBufferSendCommit() and
+ * xStreamBufferSendCommitFromISR().  Writes the message length if the stream
+ * buffer is used as a message buffer, then moves the head past the data.
+ */
+static size_t prvCommitSpans( StreamBuffer_t * const pxStreamBuffer,
+							  size_t xDataLengthBytes ) PRIVILEGED_FUNCTION;
+
+/*
+ * Common part of xStreamBufferReceiveAcquire() and
+ * xStreamBufferReceiveAcquireFromISR().  Describes the next message or the
+ * bytes in the buffer, without removing them from the buffer.
+ */
+static size_t prvAcquireSpans( StreamBuffer_t * const pxStreamBuffer,
+							   size_t xBytesAvailable,
+							   StreamBufferSpans_t * const pxSpans ) PRIVILEGED_FUNCTION;
+
+/*
+ * Common part of xStreamBufferReceiveRelease() and
+ * xStreamBufferReceiveReleaseFromISR().  Moves the tail past the next message
+ * or past xDataLengthBytes bytes.
+ */
+static size_t prvReleaseSpans( StreamBuffer_t * const pxStreamBuffer,
+							   size_t xDataLengthBytes ) PRIVILEGED_FUNCTION;
+
 /*
  * Called by both pxStreamBufferCreate() and pxStreamBufferCreateStatic() to
  * initialise the members of the newly created stream buffer structure.
@@ -509,9 +598,8 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
 						  TickType_t xTicksToWait )
 {
 StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
-size_t xReturn, xSpace = 0;
+size_t xReturn, xSpace;
 size_t xRequiredSpace = xDataLengthBytes;
-TimeOut_t xTimeOut;
 
 	configASSERT( pvTxData );
 	configASSERT( pxStreamBuffer );
@@ -532,55 +620,7 @@ TimeOut_t xTimeOut;
 		mtCOVERAGE_TEST_MARKER();
 	}
 
-	if( xTicksToWait != ( TickType_t ) 0 )
-	{
-		vTaskSetTimeOutState( &xTimeOut );
-
-		do
-		{
-			/* Wait until the required number of bytes are free in the message
-			buffer. */
-			taskENTER_CRITICAL();
-			{
-				xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
-
-				if( xSpace < xRequiredSpace )
-				{
-					/* Clear notification state as going to wait for space. */
-					( void ) xTaskNotifyStateClear( NULL );
-
-					/* Should only be one writer. */
-					configASSERT( pxStreamBuffer->xTaskWaitingToSend == NULL );
-					pxStreamBuffer->xTaskWaitingToSend = xTaskGetCurrentTaskHandle();
-				}
-				else
-				{
-					taskEXIT_CRITICAL();
-					break;
-				}
-			}
-			taskEXIT_CRITICAL();
-
-			traceBLOCKING_ON_STREAM_BUFFER_SEND( xStreamBuffer );
-			( void ) xTaskNotifyWait( ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
-			pxStreamBuffer->xTaskWaitingToSend = NULL;
-
-		} while( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE );
-	}
-	else
-	{
-		mtCOVERAGE_TEST_MARKER();
-	}
-
-	if( xSpace == ( size_t ) 0 )
-	{
-		xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
-	}
-	else
-	{
-		mtCOVERAGE_TEST_MARKER();
-	}
-
+	xSpace = prvWaitForSpace( pxStreamBuffer, xRequiredSpace, xTicksToWait );
 	xReturn = prvWriteMessageToBuffer( pxStreamBuffer, pvTxData, xDataLengthBytes, xSpace, xRequiredSpace );
 
 	if( xReturn > ( size_t ) 0 )
@@ -735,54 +775,7 @@ size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
 		xBytesToStoreMessageLength = 0;
 	}
 
-	if( xTicksToWait != ( TickType_t ) 0 )
-	{
-		/* Checking if there is data and clearing the notification state must be
-		performed atomically. */
-		taskENTER_CRITICAL();
-		{
-			xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
-
-			/* If this function was invoked by a message buffer read then
-			xBytesToStoreMessageLength holds the number of bytes used to hold
-			the length of the next discrete message.  If this function was
-			invoked by a stream buffer read then xBytesToStoreMessageLength will
-			be 0. */
-			if( xBytesAvailable <= xBytesToStoreMessageLength )
-			{
-				/* Clear notification state as going to wait for data. */
-				( void ) xTaskNotifyStateClear( NULL );
-
-				/* Should only be one reader. */
-				configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
-				pxStreamBuffer->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
-			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
-			}
-		}
-		taskEXIT_CRITICAL();
-
-		if( xBytesAvailable <= xBytesToStoreMessageLength )
-		{
-			/* Wait for data to be available. */
-			traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( xStreamBuffer );
-			( void ) xTaskNotifyWait( ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
-			pxStreamBuffer->xTaskWaitingToReceive = NULL;
-
-			/* Recheck the data available after blocking. */
-			xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
-		}
-		else
-		{
-			mtCOVERAGE_TEST_MARKER();
-		}
-	}
-	else
-	{
-		xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
-	}
+	xBytesAvailable = prvWaitForData( pxStreamBuffer, xBytesToStoreMessageLength, xTicksToWait );
 
 	/* Whether receiving a discrete message (where xBytesToStoreMessageLength
 	holds the number of bytes used to store the message length) or a stream of
@@ -967,173 +960,523 @@ configMESSAGE_BUFFER_LENGTH_TYPE xTempNextMessageLength;
 }
 /*-----------------------------------------------------------*/
 
-BaseType_t xStreamBufferIsEmpty( StreamBufferHandle_t xStreamBuffer )
+size_t xStreamBufferSendReserve( StreamBufferHandle_t xStreamBuffer,
+								 size_t xDataLengthBytes,
+								 StreamBufferSpans_t * const pxSpans,
+								 TickType_t xTicksToWait )
 {
-const StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
-BaseType_t xReturn;
-size_t xTail;
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+size_t xReturn, xSpace;
+size_t xRequiredSpace = xDataLengthBytes;
 
+	configASSERT( pxSpans );
 	configASSERT( pxStreamBuffer );
 
-	/* True if no bytes are available. */
-	xTail = pxStreamBuffer->xTail;
-	if( pxStreamBuffer->xHead == xTail )
+	/* As when sending, a message buffer also needs the space to store the
+	length of the message. */
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
 	{
-		xReturn = pdTRUE;
+		xRequiredSpace += sbBYTES_TO_STORE_MESSAGE_LENGTH;
+
+		/* Overflow? */
+		configASSERT( xRequiredSpace > xDataLengthBytes );
 	}
 	else
 	{
-		xReturn = pdFALSE;
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	xSpace = prvWaitForSpace( pxStreamBuffer, xRequiredSpace, xTicksToWait );
+	xReturn = prvReserveSpans( pxStreamBuffer, xDataLengthBytes, xSpace, pxSpans );
+
+	if( xReturn == ( size_t ) 0 )
+	{
+		traceSTREAM_BUFFER_SEND_FAILED( xStreamBuffer );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
 	}
 
 	return xReturn;
 }
 /*-----------------------------------------------------------*/
 
-BaseType_t xStreamBufferIsFull( StreamBufferHandle_t xStreamBuffer )
+size_t xStreamBufferSendReserveFromISR( StreamBufferHandle_t xStreamBuffer,
+										size_t xDataLengthBytes,
+										StreamBufferSpans_t * const pxSpans )
 {
-BaseType_t xReturn;
-size_t xBytesToStoreMessageLength;
-const StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+size_t xSpace;
 
+	configASSERT( pxSpans );
 	configASSERT( pxStreamBuffer );
 
-	/* This generic version of the receive function is used by both message
-	buffers, which store discrete messages, and stream buffers, which store a
-	continuous stream of bytes.  Discrete messages include an additional
-	sbBYTES_TO_STORE_MESSAGE_LENGTH bytes that hold the length of the message. */
-	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
-	{
-		xBytesToStoreMessageLength = sbBYTES_TO_STORE_MESSAGE_LENGTH;
-	}
-	else
-	{
-		xBytesToStoreMessageLength = 0;
-	}
-
-	/* True if the available space equals zero. */
-	if( xStreamBufferSpacesAvailable( xStreamBuffer ) <= xBytesToStoreMessageLength )
-	{
-		xReturn = pdTRUE;
-	}
-	else
-	{
-		xReturn = pdFALSE;
-	}
+	xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
 
-	return xReturn;
+	return prvReserveSpans( pxStreamBuffer, xDataLengthBytes, xSpace, pxSpans );
 }
 /*-----------------------------------------------------------*/
 
-BaseType_t xStreamBufferSendCompletedFromISR( StreamBufferHandle_t xStreamBuffer, BaseType_t *pxHigherPriorityTaskWoken )
+size_t xStreamBufferSendCommit( StreamBufferHandle_t xStreamBuffer,
+								size_t xDataLengthBytes )
 {
 StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
-BaseType_t xReturn;
-UBaseType_t uxSavedInterruptStatus;
+size_t xReturn;
 
 	configASSERT( pxStreamBuffer );
 
-	uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+	xReturn = prvCommitSpans( pxStreamBuffer, xDataLengthBytes );
+
+	if( xReturn > ( size_t ) 0 )
 	{
-		if( ( pxStreamBuffer )->xTaskWaitingToReceive != NULL )
+		traceSTREAM_BUFFER_SEND( xStreamBuffer, xReturn );
+
+		/* Was a task waiting for the data? */
+		if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
 		{
-			( void ) xTaskNotifyFromISR( ( pxStreamBuffer )->xTaskWaitingToReceive,
-										 ( uint32_t ) 0,
-										 eNoAction,
-										 pxHigherPriorityTaskWoken );
-			( pxStreamBuffer )->xTaskWaitingToReceive = NULL;
-			xReturn = pdTRUE;
+			sbSEND_COMPLETED( pxStreamBuffer );
 		}
 		else
 		{
-			xReturn = pdFALSE;
+			mtCOVERAGE_TEST_MARKER();
 		}
 	}
-	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
 
 	return xReturn;
 }
 /*-----------------------------------------------------------*/
 
-BaseType_t xStreamBufferReceiveCompletedFromISR( StreamBufferHandle_t xStreamBuffer, BaseType_t *pxHigherPriorityTaskWoken )
+size_t xStreamBufferSendCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+									   size_t xDataLengthBytes,
+									   BaseType_t * const pxHigherPriorityTaskWoken )
 {
 StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
-BaseType_t xReturn;
-UBaseType_t uxSavedInterruptStatus;
+size_t xReturn;
 
 	configASSERT( pxStreamBuffer );
 
-	uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+	xReturn = prvCommitSpans( pxStreamBuffer, xDataLengthBytes );
+
+	if( xReturn > ( size_t ) 0 )
 	{
-		if( ( pxStreamBuffer )->xTaskWaitingToSend != NULL )
+		/* Was a task waiting for the data? */
+		if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
 		{
-			( void ) xTaskNotifyFromISR( ( pxStreamBuffer )->xTaskWaitingToSend,
-										 ( uint32_t ) 0,
-										 eNoAction,
-										 pxHigherPriorityTaskWoken );
-			( pxStreamBuffer )->xTaskWaitingToSend = NULL;
-			xReturn = pdTRUE;
+			sbSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
 		}
 		else
 		{
-			xReturn = pdFALSE;
+			mtCOVERAGE_TEST_MARKER();
 		}
 	}
-	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xReturn );
 
 	return xReturn;
 }
 /*-----------------------------------------------------------*/
 
-static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer, const uint8_t *pucData, size_t xCount )
+static size_t prvReserveSpans( StreamBuffer_t * const pxStreamBuffer,
+							   size_t xDataLengthBytes,
+							   size_t xSpace,
+							   StreamBufferSpans_t * const pxSpans )
 {
-size_t xNextHead, xFirstLength;
+size_t xReturn, xIndex;
 
-	configASSERT( xCount > ( size_t ) 0 );
-
-	xNextHead = pxStreamBuffer->xHead;
-
-	/* Calculate the number of bytes that can be added in the first write -
-	which may be less than the total number of bytes that need to be added if
-	the buffer will wrap back to the beginning. */
-	xFirstLength = configMIN( pxStreamBuffer->xLength - xNextHead, xCount );
+	xIndex = pxStreamBuffer->xHead;
 
-	/* Write as many bytes as can be written in the first write. */
-	configASSERT( ( xNextHead + xFirstLength ) <= pxStreamBuffer->xLength );
-	( void ) memcpy( ( void* ) ( &( pxStreamBuffer->pucBuffer[ xNextHead ] ) ), ( const void * ) pucData, xFirstLength ); /*lint !e9087 memcpy() requires void *. */
-
-	/* If the number of bytes written was less than the number that could be
-	written in the first write... */
-	if( xCount > xFirstLength )
+	if( xSpace == ( size_t ) 0 )
 	{
-		/* ...then write the remaining bytes to the start of the buffer. */
-		configASSERT( ( xCount - xFirstLength ) <= pxStreamBuffer->xLength );
-		( void ) memcpy( ( void * ) pxStreamBuffer->pucBuffer, ( const void * ) &( pucData[ xFirstLength ] ), xCount - xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+		xReturn = 0;
 	}
-	else
+	else if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 )
 	{
-		mtCOVERAGE_TEST_MARKER();
+		/* A stream buffer reserves as many bytes as possible. */
+		xReturn = configMIN( xDataLengthBytes, xSpace );
 	}
-
-	xNextHead += xCount;
-	if( xNextHead >= pxStreamBuffer->xLength )
+	else if( ( xSpace - sbBYTES_TO_STORE_MESSAGE_LENGTH ) >= xDataLengthBytes )
 	{
-		xNextHead -= pxStreamBuffer->xLength;
+		/* A message buffer reserves the whole message.  The message length is
+		only written when the message is committed, the message itself starts
+		after it. */
+		xIndex = prvAdvanceIndex( pxStreamBuffer, xIndex, sbBYTES_TO_STORE_MESSAGE_LENGTH );
+		xReturn = xDataLengthBytes;
 	}
 	else
 	{
-		mtCOVERAGE_TEST_MARKER();
+		/* There is space available, but not enough space. */
+		xReturn = 0;
 	}
 
-	pxStreamBuffer->xHead = xNextHead;
+	prvGetSpans( pxStreamBuffer, xIndex, xReturn, pxSpans );
 
-	return xCount;
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvCommitSpans( StreamBuffer_t * const pxStreamBuffer,
+							  size_t xDataLengthBytes )
+{
+size_t xHead, xRequiredSpace = xDataLengthBytes;
+configMESSAGE_BUFFER_LENGTH_TYPE xTempMessageLength;
+
+	/* Committing 0 bytes releases the reservation without writing anything. */
+	if( xDataLengthBytes > ( size_t ) 0 )
+	{
+		xHead = pxStreamBuffer->xHead;
+
+		if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+		{
+			xRequiredSpace += sbBYTES_TO_STORE_MESSAGE_LENGTH;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Only data written to reserved space can be committed. */
+		configASSERT( xRequiredSpace <= xStreamBufferSpacesAvailable( pxStreamBuffer ) );
+
+		if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+		{
+			/* The message was written after the space left for its length,
+			write the length now. */
+			xTempMessageLength = ( configMESSAGE_BUFFER_LENGTH_TYPE ) xDataLengthBytes;
+			configASSERT( ( size_t ) xTempMessageLength == xDataLengthBytes );
+			prvCopyToBuffer( pxStreamBuffer, xHead, ( const uint8_t * ) &xTempMessageLength, sbBYTES_TO_STORE_MESSAGE_LENGTH );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* The length and the data become visible to the reader together. */
+		pxStreamBuffer->xHead = prvAdvanceIndex( pxStreamBuffer, xHead, xRequiredSpace );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xDataLengthBytes;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceiveAcquire( StreamBufferHandle_t xStreamBuffer,
+									StreamBufferSpans_t * const pxSpans,
+									TickType_t xTicksToWait )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+size_t xReturn, xBytesAvailable, xBytesToStoreMessageLength;
+
+	configASSERT( pxSpans );
+	configASSERT( pxStreamBuffer );
+
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+	{
+		xBytesToStoreMessageLength = sbBYTES_TO_STORE_MESSAGE_LENGTH;
+	}
+	else
+	{
+		xBytesToStoreMessageLength = 0;
+	}
+
+	xBytesAvailable = prvWaitForData( pxStreamBuffer, xBytesToStoreMessageLength, xTicksToWait );
+	xReturn = prvAcquireSpans( pxStreamBuffer, xBytesAvailable, pxSpans );
+
+	if( xReturn == ( size_t ) 0 )
+	{
+		traceSTREAM_BUFFER_RECEIVE_FAILED( xStreamBuffer );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceiveAcquireFromISR( StreamBufferHandle_t xStreamBuffer,
+										   StreamBufferSpans_t * const pxSpans )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+	configASSERT( pxSpans );
+	configASSERT( pxStreamBuffer );
+
+	return prvAcquireSpans( pxStreamBuffer, prvBytesInBuffer( pxStreamBuffer ), pxSpans );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceiveRelease( StreamBufferHandle_t xStreamBuffer,
+									size_t xDataLengthBytes )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+size_t xReturn;
+
+	configASSERT( pxStreamBuffer );
+
+	xReturn = prvReleaseSpans( pxStreamBuffer, xDataLengthBytes );
+
+	/* Was a task waiting for space in the buffer? */
+	if( xReturn != ( size_t ) 0 )
+	{
+		traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xReturn );
+		sbRECEIVE_COMPLETED( pxStreamBuffer );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceiveReleaseFromISR( StreamBufferHandle_t xStreamBuffer,
+										   size_t xDataLengthBytes,
+										   BaseType_t * const pxHigherPriorityTaskWoken )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+size_t xReturn;
+
+	configASSERT( pxStreamBuffer );
+
+	xReturn = prvReleaseSpans( pxStreamBuffer, xDataLengthBytes );
+
+	/* Was a task waiting for space in the buffer? */
+	if( xReturn != ( size_t ) 0 )
+	{
+		sbRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xReturn );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvAcquireSpans( StreamBuffer_t * const pxStreamBuffer,
+							   size_t xBytesAvailable,
+							   StreamBufferSpans_t * const pxSpans )
+{
+size_t xReturn, xIndex;
+
+	xIndex = pxStreamBuffer->xTail;
+
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 )
+	{
+		/* A stream buffer gives access to all the bytes it holds. */
+		xReturn = xBytesAvailable;
+	}
+	else if( xBytesAvailable > sbBYTES_TO_STORE_MESSAGE_LENGTH )
+	{
+		/* A message buffer gives access to the next message, which follows its
+		length.  The tail is not moved so the message stays in the buffer until
+		it is released. */
+		xReturn = prvPeekMessageLength( pxStreamBuffer, xIndex );
+		configASSERT( xReturn <= ( xBytesAvailable - sbBYTES_TO_STORE_MESSAGE_LENGTH ) );
+		xIndex = prvAdvanceIndex( pxStreamBuffer, xIndex, sbBYTES_TO_STORE_MESSAGE_LENGTH );
+	}
+	else
+	{
+		xReturn = 0;
+	}
+
+	prvGetSpans( pxStreamBuffer, xIndex, xReturn, pxSpans );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvReleaseSpans( StreamBuffer_t * const pxStreamBuffer,
+							   size_t xDataLengthBytes )
+{
+size_t xBytesAvailable, xBytesToRemove;
+
+	xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 )
+	{
+		/* Only bytes that were acquired can be released. */
+		configASSERT( xDataLengthBytes <= xBytesAvailable );
+		xBytesToRemove = xDataLengthBytes;
+	}
+	else if( xBytesAvailable > sbBYTES_TO_STORE_MESSAGE_LENGTH )
+	{
+		/* A message is always released as a whole, together with its
+		length. */
+		configASSERT( xDataLengthBytes == prvPeekMessageLength( pxStreamBuffer, pxStreamBuffer->xTail ) );
+		xBytesToRemove = xDataLengthBytes + sbBYTES_TO_STORE_MESSAGE_LENGTH;
+	}
+	else
+	{
+		configASSERT( xDataLengthBytes == ( size_t ) 0 );
+		xBytesToRemove = 0;
+	}
+
+	if( xBytesToRemove > ( size_t ) 0 )
+	{
+		pxStreamBuffer->xTail = prvAdvanceIndex( pxStreamBuffer, pxStreamBuffer->xTail, xBytesToRemove );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xDataLengthBytes;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferIsEmpty( StreamBufferHandle_t xStreamBuffer )
+{
+const StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+BaseType_t xReturn;
+size_t xTail;
+
+	configASSERT( pxStreamBuffer );
+
+	/* True if no bytes are available. */
+	xTail = pxStreamBuffer->xTail;
+	if( pxStreamBuffer->xHead == xTail )
+	{
+		xReturn = pdTRUE;
+	}
+	else
+	{
+		xReturn = pdFALSE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferIsFull( StreamBufferHandle_t xStreamBuffer )
+{
+BaseType_t xReturn;
+size_t xBytesToStoreMessageLength;
+const StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+	configASSERT( pxStreamBuffer );
+
+	/* This generic version of the receive function is used by both message
+	buffers, which store discrete messages, and stream buffers, which store a
+	continuous stream of bytes.  Discrete messages include an additional
+	sbBYTES_TO_STORE_MESSAGE_LENGTH bytes that hold the length of the message. */
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+	{
+		xBytesToStoreMessageLength = sbBYTES_TO_STORE_MESSAGE_LENGTH;
+	}
+	else
+	{
+		xBytesToStoreMessageLength = 0;
+	}
+
+	/* True if the available space equals zero. */
+	if( xStreamBufferSpacesAvailable( xStreamBuffer ) <= xBytesToStoreMessageLength )
+	{
+		xReturn = pdTRUE;
+	}
+	else
+	{
+		xReturn = pdFALSE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferSendCompletedFromISR( StreamBufferHandle_t xStreamBuffer, BaseType_t *pxHigherPriorityTaskWoken )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+BaseType_t xReturn;
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( pxStreamBuffer );
+
+	uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		if( ( pxStreamBuffer )->xTaskWaitingToReceive != NULL )
+		{
+			( void ) xTaskNotifyFromISR( ( pxStreamBuffer )->xTaskWaitingToReceive,
+										 ( uint32_t ) 0,
+										 eNoAction,
+										 pxHigherPriorityTaskWoken );
+			( pxStreamBuffer )->xTaskWaitingToReceive = NULL;
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			xReturn = pdFALSE;
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferReceiveCompletedFromISR( StreamBufferHandle_t xStreamBuffer, BaseType_t *pxHigherPriorityTaskWoken )
+{
+StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+BaseType_t xReturn;
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( pxStreamBuffer );
+
+	uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		if( ( pxStreamBuffer )->xTaskWaitingToSend != NULL )
+		{
+			( void ) xTaskNotifyFromISR( ( pxStreamBuffer )->xTaskWaitingToSend,
+										 ( uint32_t ) 0,
+										 eNoAction,
+										 pxHigherPriorityTaskWoken );
+			( pxStreamBuffer )->xTaskWaitingToSend = NULL;
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			xReturn = pdFALSE;
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer, const uint8_t *pucData, size_t xCount )
+{
+size_t xNextHead;
+
+	configASSERT( xCount > ( size_t ) 0 );
+
+	xNextHead = pxStreamBuffer->xHead;
+	prvCopyToBuffer( pxStreamBuffer, xNextHead, pucData, xCount );
+	pxStreamBuffer->xHead = prvAdvanceIndex( pxStreamBuffer, xNextHead, xCount );
+
+	return xCount;
 }
 /*-----------------------------------------------------------*/
 
 static size_t prvReadBytesFromBuffer( StreamBuffer_t *pxStreamBuffer, uint8_t *pucData, size_t xMaxCount, size_t xBytesAvailable )
 {
-size_t xCount, xFirstLength, xNextTail;
+size_t xCount, xNextTail;
 
 	/* Use the minimum of the wanted bytes and the available bytes. */
 	xCount = configMIN( xBytesAvailable, xMaxCount );
@@ -1141,48 +1484,238 @@ size_t xCount, xFirstLength, xNextTail;
 	if( xCount > ( size_t ) 0 )
 	{
 		xNextTail = pxStreamBuffer->xTail;
+		prvCopyFromBuffer( pxStreamBuffer, xNextTail, pucData, xCount );
 
-		/* Calculate the number of bytes that can be read - which may be
-		less than the number wanted if the data wraps around to the start of
+		/* Move the tail pointer to effectively remove the data read from
 		the buffer. */
-		xFirstLength = configMIN( pxStreamBuffer->xLength - xNextTail, xCount );
+		pxStreamBuffer->xTail = prvAdvanceIndex( pxStreamBuffer, xNextTail, xCount );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xCount;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCopyToBuffer( StreamBuffer_t * const pxStreamBuffer, size_t xIndex, const uint8_t *pucData, size_t xCount )
+{
+StreamBufferSpans_t xSpans;
+
+	prvGetSpans( pxStreamBuffer, xIndex, xCount, &xSpans );
+
+	/* Write as many bytes as can be written in the first write, then the
+	remaining bytes to the start of the buffer if the data wraps. */
+	( void ) memcpy( ( void * ) xSpans.pucFirst, ( const void * ) pucData, xSpans.xFirstLengthBytes ); /*lint !e9087 memcpy() requires void *. */
+
+	if( xSpans.xSecondLengthBytes > ( size_t ) 0 )
+	{
+		( void ) memcpy( ( void * ) xSpans.pucSecond, ( const void * ) &( pucData[ xSpans.xFirstLengthBytes ] ), xSpans.xSecondLengthBytes ); /*lint !e9087 memcpy() requires void *. */
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvCopyFromBuffer( const StreamBuffer_t * const pxStreamBuffer, size_t xIndex, uint8_t *pucData, size_t xCount )
+{
+StreamBufferSpans_t xSpans;
+
+	prvGetSpans( pxStreamBuffer, xIndex, xCount, &xSpans );
+
+	/* Read as many bytes as can be read in the first read, then the remaining
+	bytes from the start of the buffer if the data wraps. */
+	( void ) memcpy( ( void * ) pucData, ( const void * ) xSpans.pucFirst, xSpans.xFirstLengthBytes ); /*lint !e9087 memcpy() requires void *. */
+
+	if( xSpans.xSecondLengthBytes > ( size_t ) 0 )
+	{
+		( void ) memcpy( ( void * ) &( pucData[ xSpans.xFirstLengthBytes ] ), ( const void * ) xSpans.pucSecond, xSpans.xSecondLengthBytes ); /*lint !e9087 memcpy() requires void *. */
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvPeekMessageLength( const StreamBuffer_t * const pxStreamBuffer, size_t xIndex )
+{
+configMESSAGE_BUFFER_LENGTH_TYPE xTempNextMessageLength;
+
+	prvCopyFromBuffer( pxStreamBuffer, xIndex, ( uint8_t * ) &xTempNextMessageLength, sbBYTES_TO_STORE_MESSAGE_LENGTH );
+
+	return ( size_t ) xTempNextMessageLength;
+}
+/*-----------------------------------------------------------*/
+
+static void prvGetSpans( const StreamBuffer_t * const pxStreamBuffer, size_t xIndex, size_t xCount, StreamBufferSpans_t * const pxSpans )
+{
+size_t xFirstLength;
+
+	configASSERT( xIndex < pxStreamBuffer->xLength );
+	configASSERT( xCount <= pxStreamBuffer->xLength );
+
+	/* Calculate the number of bytes before the end of the storage area -
+	which may be less than the total number of bytes if the data wraps back
+	to the beginning. */
+	xFirstLength = configMIN( pxStreamBuffer->xLength - xIndex, xCount );
+
+	if( xFirstLength > ( size_t ) 0 )
+	{
+		pxSpans->pucFirst = &( pxStreamBuffer->pucBuffer[ xIndex ] );
+	}
+	else
+	{
+		pxSpans->pucFirst = NULL;
+	}
+
+	pxSpans->xFirstLengthBytes = xFirstLength;
+
+	if( xCount > xFirstLength )
+	{
+		pxSpans->pucSecond = pxStreamBuffer->pucBuffer;
+		pxSpans->xSecondLengthBytes = xCount - xFirstLength;
+	}
+	else
+	{
+		pxSpans->pucSecond = NULL;
+		pxSpans->xSecondLengthBytes = 0;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvAdvanceIndex( const StreamBuffer_t * const pxStreamBuffer, size_t xIndex, size_t xCount )
+{
+	xIndex += xCount;
+
+	if( xIndex >= pxStreamBuffer->xLength )
+	{
+		xIndex -= pxStreamBuffer->xLength;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xIndex;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvWaitForSpace( StreamBuffer_t * const pxStreamBuffer, size_t xRequiredSpace, TickType_t xTicksToWait )
+{
+size_t xSpace = 0;
+TimeOut_t xTimeOut;
 
-		/* Obtain the number of bytes it is possible to obtain in the first
-		read.  Asserts check bounds of read and write. */
-		configASSERT( xFirstLength <= xMaxCount );
-		configASSERT( ( xNextTail + xFirstLength ) <= pxStreamBuffer->xLength );
-		( void ) memcpy( ( void * ) pucData, ( const void * ) &( pxStreamBuffer->pucBuffer[ xNextTail ] ), xFirstLength ); /*lint !e9087 memcpy() requires void *. */
+	if( xTicksToWait != ( TickType_t ) 0 )
+	{
+		vTaskSetTimeOutState( &xTimeOut );
 
-		/* If the total number of wanted bytes is greater than the number
-		that could be read in the first read... */
-		if( xCount > xFirstLength )
+		do
 		{
-			/*...then read the remaining bytes from the start of the buffer. */
-			configASSERT( xCount <= xMaxCount );
-			( void ) memcpy( ( void * ) &( pucData[ xFirstLength ] ), ( void * ) ( pxStreamBuffer->pucBuffer ), xCount - xFirstLength ); /*lint !e9087 memcpy() requires void *. */
-		}
-		else
+			/* Wait until the required number of bytes are free in the message
+			buffer. */
+			taskENTER_CRITICAL();
+			{
+				xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
+
+				if( xSpace < xRequiredSpace )
+				{
+					/* Clear notification state as going to wait for space. */
+					( void ) xTaskNotifyStateClear( NULL );
+
+					/* Should only be one writer. */
+					configASSERT( pxStreamBuffer->xTaskWaitingToSend == NULL );
+					pxStreamBuffer->xTaskWaitingToSend = xTaskGetCurrentTaskHandle();
+				}
+				else
+				{
+					taskEXIT_CRITICAL();
+					break;
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			traceBLOCKING_ON_STREAM_BUFFER_SEND( pxStreamBuffer );
+			( void ) xTaskNotifyWait( ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+			pxStreamBuffer->xTaskWaitingToSend = NULL;
+
+		} while( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( xSpace == ( size_t ) 0 )
+	{
+		xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xSpace;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvWaitForData( StreamBuffer_t * const pxStreamBuffer, size_t xBytesToStoreMessageLength, TickType_t xTicksToWait )
+{
+size_t xBytesAvailable;
+
+	if( xTicksToWait != ( TickType_t ) 0 )
+	{
+		/* Checking if there is data and clearing the notification state must be
+		performed atomically. */
+		taskENTER_CRITICAL();
 		{
-			mtCOVERAGE_TEST_MARKER();
+			xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+
+			/* If this function was invoked by a message buffer read then
+			xBytesToStoreMessageLength holds the number of bytes used to hold
+			the length of the next discrete message.  If this function was
+			invoked by a stream buffer read then xBytesToStoreMessageLength will
+			be 0. */
+			if( xBytesAvailable <= xBytesToStoreMessageLength )
+			{
+				/* Clear notification state as going to wait for data. */
+				( void ) xTaskNotifyStateClear( NULL );
+
+				/* Should only be one reader. */
+				configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
+				pxStreamBuffer->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
+		taskEXIT_CRITICAL();
 
-		/* Move the tail pointer to effectively remove the data read from
-		the buffer. */
-		xNextTail += xCount;
+		if( xBytesAvailable <= xBytesToStoreMessageLength )
+		{
+			/* Wait for data to be available. */
+			traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( pxStreamBuffer );
+			( void ) xTaskNotifyWait( ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+			pxStreamBuffer->xTaskWaitingToReceive = NULL;
 
-		if( xNextTail >= pxStreamBuffer->xLength )
+			/* Recheck the data available after blocking. */
+			xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+		}
+		else
 		{
-			xNextTail -= pxStreamBuffer->xLength;
+			mtCOVERAGE_TEST_MARKER();
 		}
-
-		pxStreamBuffer->xTail = xNextTail;
 	}
 	else
 	{
-		mtCOVERAGE_TEST_MARKER();
+		xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
 	}
 
-	return xCount;
+	return xBytesAvailable;
 }
 /*-----------------------------------------------------------*/
 
@@ -22,29 +22,88 @@ To use this module, the following steps should be followed :
 1- in the _OS_Config.h file (ex. FreeRTOSConfig.h) enable the following macros :
       - #define configUSE_IDLE_HOOK        1
       - #define configUSE_TICK_HOOK        1
+      - #define configUSE_TRACE_FACILITY   1
+   the task number (vTaskSetTaskNumber()) is used by this module.
 
 2- in the _OS_Config.h define the following macros :
       - #define traceTASK_SWITCHED_IN()  extern void StartIdleMonitor(void); \
                                          StartIdleMonitor()
       - #define traceTASK_SWITCHED_OUT() extern void EndIdleMonitor(void); \
                                          EndIdleMonitor()
+   and optionally, to reuse the slot of a deleted task :
+      - #define traceTASK_DELETE(pxTCB)  extern void osCPU_TaskDeleted(void *pvTask); \
+                                         osCPU_TaskDeleted(pxTCB)
+
+3- the time is measured with the DWT cycle counter, enabled by this module.
+   Another 32-bit time source, e.g. a host clock, is selected by defining
+   cpuutilsTIME_NOW() and cpuutilsTIME_FREQUENCY_HZ in the _OS_Config.h.
+   The accounting window shall be shorter than the wrap period of the counter.
+
+4- the time spent in an interrupt handler is accounted to the handler instead
+   of the preempted task when the handler calls osCPU_EnterISR() on entry and
+   osCPU_ExitISR() on exit. The handler priority shall not be above
+   configMAX_SYSCALL_INTERRUPT_PRIORITY.
+
+The utilization of each task and interrupt handler is computed over windows of
+CALCULATION_PERIOD ticks. The utilization of the idle task is what the other
+tasks and handlers leave, so the time spent in low power mode, when the time
+source may be stopped, is accounted to the idle task.
 *******************************************************************************/
 
 
 /* Includes ------------------------------------------------------------------*/
+#include <string.h>
 #include "cpu_utils.h"
 
+#if (configUSE_TRACE_FACILITY != 1)
+#error "cpu_utils requires configUSE_TRACE_FACILITY set to 1"
+#endif
+
 /* Private typedef -----------------------------------------------------------*/
+typedef struct
+{
+  void        *pvOwner;     /* Task handle, or the context itself for an interrupt handler, NULL when free */
+  const char  *pcName;
+  uint64_t    ullTotal;
+  uint32_t    ulWindow;     /* Run time in the current window */
+  uint32_t    ulUsage;      /* Utilization during the last window, in 1/100 % */
+  uint32_t    ulSlice;      /* Run time of the current slice */
+  uint32_t    ulMaxSlice;
+  uint32_t    ulSlices;
+  uint32_t    ulHistogram[CPU_UTILS_HISTOGRAM_BINS];
+} osCPU_Context_t;
+
 /* Private define ------------------------------------------------------------*/
+/* Utilization of a context running during the whole window */
+#define CPU_USAGE_FULL          10000U
+
+/* Task slot accounting the tasks that did not get their own slot */
+#define CPU_OTHER_TASKS         CPU_UTILS_MAX_TASKS
+
 /* Private macro -------------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+static void osCPU_Start (void);
+static void osCPU_Charge (void);
+static void osCPU_EndSlice (osCPU_Context_t *pxContext);
+static void osCPU_EndWindow (void);
+static osCPU_Context_t *osCPU_GetTaskContext (TaskHandle_t xTask);
+static void osCPU_CopyStats (osCPU_Stats_t *pxStats, const osCPU_Context_t *pxContext, TaskHandle_t xTask);
+
 /* Private variables ---------------------------------------------------------*/
 
-xTaskHandle    xIdleHandle = NULL;
-__IO uint32_t  osCPU_Usage = 0;
-uint32_t       osCPU_IdleStartTime = 0;
-uint32_t       osCPU_IdleSpentTime = 0;
-uint32_t       osCPU_TotalIdleTime = 0;
+xTaskHandle       xIdleHandle = NULL;
+volatile uint32_t osCPU_Usage = 0;
+
+static osCPU_Context_t  osCPU_Tasks[CPU_UTILS_MAX_TASKS + 1];
+static osCPU_Context_t  osCPU_ISRs[CPU_UTILS_MAX_ISRS];
+static osCPU_Context_t  *osCPU_Current = NULL;
+static osCPU_Context_t  *osCPU_Preempted[CPU_UTILS_MAX_ISR_NESTING];
+static uint32_t         osCPU_Nesting = 0;
+static uint32_t         osCPU_Started = 0;
+static uint32_t         osCPU_LastTime = 0;
+static uint32_t         osCPU_Frequency = 0;
+static uint32_t         osCPU_BinLimit[CPU_UTILS_HISTOGRAM_BINS];
+static TickType_t       osCPU_WindowStart = 0;
 
 /* Private functions ---------------------------------------------------------*/
 /**
@@ -62,7 +121,7 @@ void vApplicationIdleHook(void)
 }
 
 /**
-  * @brief  Application Idle Hook
+  * @brief  Application Tick Hook
   * @param  None
   * @retval None
   */
@@ -74,49 +133,428 @@ void vApplicationTickHook (void)
   {
     tick = 0;
 
-    if(osCPU_TotalIdleTime > 1000)
+    if(osCPU_Started != 0)
     {
-      osCPU_TotalIdleTime = 1000;
+      osCPU_EndWindow();
     }
-    osCPU_Usage = (100 - (osCPU_TotalIdleTime * 100) / CALCULATION_PERIOD);
-    osCPU_TotalIdleTime = 0;
   }
 }
 
 /**
   * @brief  Start Idle monitor
+  * @note   Called when a task is switched in, the following run time is accounted to this task
   * @param  None
   * @retval None
   */
 void StartIdleMonitor (void)
 {
-  if( xTaskGetCurrentTaskHandle() == xIdleHandle )
+  if(osCPU_Started == 0)
   {
-    osCPU_IdleStartTime = xTaskGetTickCountFromISR();
+    osCPU_Start();
   }
+
+  osCPU_Charge();
+  osCPU_Current = osCPU_GetTaskContext(xTaskGetCurrentTaskHandle());
 }
 
 /**
   * @brief  Stop Idle monitor
+  * @note   Called when a task is switched out, ends its run slice
   * @param  None
   * @retval None
   */
 void EndIdleMonitor (void)
 {
-  if( xTaskGetCurrentTaskHandle() == xIdleHandle )
+  if(osCPU_Started != 0)
   {
-    /* Store the handle to the idle task. */
-    osCPU_IdleSpentTime = xTaskGetTickCountFromISR() - osCPU_IdleStartTime;
-    osCPU_TotalIdleTime += osCPU_IdleSpentTime;
+    osCPU_Charge();
+    osCPU_EndSlice(osCPU_Current);
+    osCPU_Current = NULL;
   }
 }
 
 /**
-  * @brief  Stop Idle monitor
+  * @brief  Release the accounting slot of a deleted task
+  * @param  pvTask: handle of the deleted task
+  * @retval None
+  */
+void osCPU_TaskDeleted (void *pvTask)
+{
+  uint32_t i;
+
+  for(i = 0; i < CPU_UTILS_MAX_TASKS; i++)
+  {
+    if(osCPU_Tasks[i].pvOwner == pvTask)
+    {
+      if(osCPU_Current == &osCPU_Tasks[i])
+      {
+        osCPU_Current = NULL;
+      }
+      osCPU_Tasks[i].pvOwner = NULL;
+      break;
+    }
+  }
+}
+
+/**
+  * @brief  Name an interrupt handler in the statistics
+  * @param  ulIsrId: identifier of the handler, lower than CPU_UTILS_MAX_ISRS
+  * @param  pcName: name of the handler
+  * @retval None
+  */
+void osCPU_SetISRName (uint32_t ulIsrId, const char *pcName)
+{
+  if(ulIsrId < CPU_UTILS_MAX_ISRS)
+  {
+    osCPU_ISRs[ulIsrId].pcName = pcName;
+    osCPU_ISRs[ulIsrId].pvOwner = &osCPU_ISRs[ulIsrId];
+  }
+}
+
+/**
+  * @brief  Account the following run time to an interrupt handler
+  * @note   Called on entry of the handler
+  * @param  ulIsrId: identifier of the handler, lower than CPU_UTILS_MAX_ISRS
+  * @retval None
+  */
+void osCPU_EnterISR (uint32_t ulIsrId)
+{
+  UBaseType_t mask;
+
+  mask = portSET_INTERRUPT_MASK_FROM_ISR();
+
+  if(osCPU_Started != 0)
+  {
+    osCPU_Charge();
+  }
+
+  if(osCPU_Nesting < CPU_UTILS_MAX_ISR_NESTING)
+  {
+    osCPU_Preempted[osCPU_Nesting] = osCPU_Current;
+
+    if(ulIsrId < CPU_UTILS_MAX_ISRS)
+    {
+      osCPU_ISRs[ulIsrId].pvOwner = &osCPU_ISRs[ulIsrId];
+      osCPU_Current = &osCPU_ISRs[ulIsrId];
+    }
+    else
+    {
+      osCPU_Current = NULL;
+    }
+  }
+  osCPU_Nesting++;
+
+  portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+}
+
+/**
+  * @brief  Account the following run time back to the preempted task or handler
+  * @note   Called on exit of the handler
   * @param  None
   * @retval None
   */
+void osCPU_ExitISR (void)
+{
+  UBaseType_t mask;
+
+  mask = portSET_INTERRUPT_MASK_FROM_ISR();
+
+  if(osCPU_Nesting > 0)
+  {
+    osCPU_Nesting--;
+
+    if(osCPU_Nesting < CPU_UTILS_MAX_ISR_NESTING)
+    {
+      if(osCPU_Started != 0)
+      {
+        osCPU_Charge();
+        osCPU_EndSlice(osCPU_Current);
+      }
+      osCPU_Current = osCPU_Preempted[osCPU_Nesting];
+    }
+  }
+
+  portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+}
+
+/**
+  * @brief  Return the CPU usage during the last window
+  * @param  None
+  * @retval CPU usage in %, the time not spent in the idle task
+  */
 uint16_t osGetCPUUsage (void)
 {
   return (uint16_t)osCPU_Usage;
 }
+
+/**
+  * @brief  Return the frequency of the time source of the statistics
+  * @param  None
+  * @retval Frequency in Hz, 0 before the scheduler is started
+  */
+uint32_t osGetCPUTimeFrequency (void)
+{
+  return osCPU_Frequency;
+}
+
+/**
+  * @brief  Return the statistics of the tasks and of the interrupt handlers
+  * @note   Called from a task
+  * @param  pxStats: array filled with the statistics
+  * @param  ulMaxEntries: number of entries of the array
+  * @retval Number of entries filled
+  */
+uint32_t osGetCPUStats (osCPU_Stats_t *pxStats, uint32_t ulMaxEntries)
+{
+  uint32_t i;
+  uint32_t n = 0;
+
+  taskENTER_CRITICAL();
+
+  for(i = 0; (i < CPU_UTILS_MAX_TASKS) && (n < ulMaxEntries); i++)
+  {
+    if(osCPU_Tasks[i].pvOwner != NULL)
+    {
+      osCPU_CopyStats(&pxStats[n++], &osCPU_Tasks[i], (TaskHandle_t)osCPU_Tasks[i].pvOwner);
+    }
+  }
+
+  if((osCPU_Tasks[CPU_OTHER_TASKS].ullTotal != 0) && (n < ulMaxEntries))
+  {
+    osCPU_CopyStats(&pxStats[n++], &osCPU_Tasks[CPU_OTHER_TASKS], NULL);
+  }
+
+  for(i = 0; (i < CPU_UTILS_MAX_ISRS) && (n < ulMaxEntries); i++)
+  {
+    if(osCPU_ISRs[i].pvOwner != NULL)
+    {
+      osCPU_CopyStats(&pxStats[n++], &osCPU_ISRs[i], NULL);
+    }
+  }
+
+  taskEXIT_CRITICAL();
+
+  return n;
+}
+
+/**
+  * @brief  Start the accounting
+  * @note   Called when the first task is switched in
+  * @param  None
+  * @retval None
+  */
+static void osCPU_Start (void)
+{
+  uint32_t i;
+
+#if defined(CPU_UTILS_TIME_SOURCE_DWT)
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+  osCPU_Frequency = cpuutilsTIME_FREQUENCY_HZ;
+
+  /* Bin n counts the slices shorter than 2^(n+1) us, the last bin counts all the longer slices */
+  for(i = 0; i < CPU_UTILS_HISTOGRAM_BINS; i++)
+  {
+    osCPU_BinLimit[i] = (uint32_t)((((uint64_t)osCPU_Frequency << (i + 1)) + 999999U) / 1000000U);
+  }
+
+  osCPU_Tasks[CPU_OTHER_TASKS].pcName = "other tasks";
+  osCPU_WindowStart = xTaskGetTickCountFromISR();
+  osCPU_LastTime = cpuutilsTIME_NOW();
+  osCPU_Started = 1;
+}
+
+/**
+  * @brief  Account the time elapsed since the last event to the running task or handler
+  * @param  None
+  * @retval None
+  */
+static void osCPU_Charge (void)
+{
+  uint32_t now;
+  uint32_t elapsed;
+
+  now = cpuutilsTIME_NOW();
+  elapsed = now - osCPU_LastTime;
+  osCPU_LastTime = now;
+
+  if(osCPU_Current != NULL)
+  {
+    osCPU_Current->ullTotal += elapsed;
+    osCPU_Current->ulWindow += elapsed;
+    osCPU_Current->ulSlice += elapsed;
+  }
+}
+
+/**
+  * @brief  End the run slice of a task or handler
+  * @param  pxContext: context of the task or handler
+  * @retval None
+  */
+static void osCPU_EndSlice (osCPU_Context_t *pxContext)
+{
+  uint32_t bin;
+
+  if(pxContext != NULL)
+  {
+    for(bin = 0; bin < (CPU_UTILS_HISTOGRAM_BINS - 1); bin++)
+    {
+      if(pxContext->ulSlice < osCPU_BinLimit[bin])
+      {
+        break;
+      }
+    }
+
+    if(pxContext->ulHistogram[bin] != UINT32_MAX)
+    {
+      pxContext->ulHistogram[bin]++;
+    }
+
+    if(pxContext->ulSlice > pxContext->ulMaxSlice)
+    {
+      pxContext->ulMaxSlice = pxContext->ulSlice;
+    }
+
+    pxContext->ulSlices++;
+    pxContext->ulSlice = 0;
+  }
+}
+
+/**
+  * @brief  Compute the utilization of the tasks and handlers over the window that ends
+  * @note   Called from the tick interrupt
+  * @param  None
+  * @retval None
+  */
+static void osCPU_EndWindow (void)
+{
+  UBaseType_t mask;
+  osCPU_Context_t *idle = NULL;
+  osCPU_Context_t *context;
+  TickType_t now;
+  uint64_t window;
+  uint32_t busy = 0;
+  uint32_t i, bin;
+
+  mask = portSET_INTERRUPT_MASK_FROM_ISR();
+
+  osCPU_Charge();
+
+  /**
+   * The window length is measured with the tick count, that also counts the time spent in low power mode
+   */
+  now = xTaskGetTickCountFromISR();
+  window = (((uint64_t)(now - osCPU_WindowStart)) * osCPU_Frequency) / configTICK_RATE_HZ;
+  osCPU_WindowStart = now;
+
+  for(i = 0; i < (CPU_UTILS_MAX_TASKS + 1 + CPU_UTILS_MAX_ISRS); i++)
+  {
+    context = (i <= CPU_UTILS_MAX_TASKS) ? &osCPU_Tasks[i] : &osCPU_ISRs[i - CPU_UTILS_MAX_TASKS - 1];
+
+    if((context->pvOwner == xIdleHandle) && (xIdleHandle != NULL))
+    {
+      idle = context;
+    }
+    else
+    {
+      if(window == 0)
+      {
+        context->ulUsage = 0;
+      }
+      else if(context->ulWindow >= window)
+      {
+        context->ulUsage = CPU_USAGE_FULL;
+      }
+      else
+      {
+        context->ulUsage = (uint32_t)(((uint64_t)context->ulWindow * CPU_USAGE_FULL) / window);
+      }
+      busy += context->ulUsage;
+    }
+
+    context->ulWindow = 0;
+
+    /* The histograms are halved at every window, so they reflect the recent slices */
+    for(bin = 0; bin < CPU_UTILS_HISTOGRAM_BINS; bin++)
+    {
+      context->ulHistogram[bin] >>= 1;
+    }
+  }
+
+  if(busy > CPU_USAGE_FULL)
+  {
+    busy = CPU_USAGE_FULL;
+  }
+
+  if(idle != NULL)
+  {
+    idle->ulUsage = CPU_USAGE_FULL - busy;
+  }
+
+  osCPU_Usage = busy / 100U;
+
+  portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+}
+
+/**
+  * @brief  Return the accounting context of a task, allocating a slot to a new task
+  * @param  xTask: handle of the task
+  * @retval Context of the task
+  */
+static osCPU_Context_t *osCPU_GetTaskContext (TaskHandle_t xTask)
+{
+  UBaseType_t number;
+  uint32_t i;
+
+  /* The task number holds the slot index plus one, 0 for a task without slot */
+  number = uxTaskGetTaskNumber(xTask);
+
+  if((number != 0) && (number <= (CPU_UTILS_MAX_TASKS + 1)) && ((number == (CPU_OTHER_TASKS + 1)) ||
+     (osCPU_Tasks[number - 1].pvOwner == xTask)))
+  {
+    return &osCPU_Tasks[number - 1];
+  }
+
+  for(i = 0; i < CPU_UTILS_MAX_TASKS; i++)
+  {
+    if(osCPU_Tasks[i].pvOwner == NULL)
+    {
+      memset(&osCPU_Tasks[i], 0, sizeof(osCPU_Tasks[i]));
+      osCPU_Tasks[i].pvOwner = xTask;
+      osCPU_Tasks[i].pcName = pcTaskGetName(xTask);
+      vTaskSetTaskNumber(xTask, i + 1);
+      return &osCPU_Tasks[i];
+    }
+  }
+
+  vTaskSetTaskNumber(xTask, CPU_OTHER_TASKS + 1);
+
+  return &osCPU_Tasks[CPU_OTHER_TASKS];
+}
+
+/**
+  * @brief  Copy the statistics of a context
+  * @param  pxStats: statistics to fill
+  * @param  pxContext: context of the task or handler
+  * @param  xTask: handle of the task, NULL for a handler
+  * @retval None
+  */
+static void osCPU_CopyStats (osCPU_Stats_t *pxStats, const osCPU_Context_t *pxContext, TaskHandle_t xTask)
+{
+  uint32_t bin;
+
+  pxStats->pcName = pxContext->pcName;
+  pxStats->xTask = xTask;
+  pxStats->ulUsage = pxContext->ulUsage;
+  pxStats->ullTotalTime = pxContext->ullTotal;
+  pxStats->ulMaxSlice = pxContext->ulMaxSlice;
+  pxStats->ulSlices = pxContext->ulSlices;
+
+  for(bin = 0; bin < CPU_UTILS_HISTOGRAM_BINS; bin++)
+  {
+    pxStats->ulHistogram[bin] = pxContext->ulHistogram[bin];
+  }
+}
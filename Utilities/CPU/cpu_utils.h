@@ -25,16 +25,77 @@
 #endif
 
 /* Includes ------------------------------------------------------------------*/
+#include "FreeRTOS.h"
+#include "task.h"
+
+#ifndef cpuutilsTIME_NOW
 #include "main.h"
+#endif
 
-/* Exported types ------------------------------------------------------------*/
 /* Exported constants --------------------------------------------------------*/
-/* Exported variables --------------------------------------------------------*/
-/* Exported macro ------------------------------------------------------------*/
+/* Number of ticks of the accounting window */
+#ifndef CALCULATION_PERIOD
 #define CALCULATION_PERIOD    1000
+#endif
+
+/* Number of tasks accounted separately, the time of the other tasks is accounted together */
+#ifndef CPU_UTILS_MAX_TASKS
+#define CPU_UTILS_MAX_TASKS           16
+#endif
+
+/* Number of interrupt handlers that can be accounted with osCPU_EnterISR()/osCPU_ExitISR() */
+#ifndef CPU_UTILS_MAX_ISRS
+#define CPU_UTILS_MAX_ISRS            8
+#endif
+
+/* Maximum nesting of the accounted interrupt handlers */
+#ifndef CPU_UTILS_MAX_ISR_NESTING
+#define CPU_UTILS_MAX_ISR_NESTING     4
+#endif
+
+/* Number of bins of the run slice histograms, bin n counts the slices shorter than 2^(n+1) us */
+#ifndef CPU_UTILS_HISTOGRAM_BINS
+#define CPU_UTILS_HISTOGRAM_BINS      16
+#endif
+
+/**
+  * Time source of the accounting, 32-bit counter and its frequency in Hz. The default is the DWT cycle
+  * counter of the Cortex-M core, a host build defines both macros in FreeRTOSConfig.h.
+  */
+#ifndef cpuutilsTIME_NOW
+#define CPU_UTILS_TIME_SOURCE_DWT
+#define cpuutilsTIME_NOW()            (DWT->CYCCNT)
+#define cpuutilsTIME_FREQUENCY_HZ     (SystemCoreClock)
+#endif
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief Accounting of a task or an interrupt handler
+  * @note  The times are in ticks of the time source, the utilization is in 1/100 %
+  */
+typedef struct
+{
+  const char    *pcName;        /*!< Task name, interrupt handler name, or NULL */
+  TaskHandle_t  xTask;          /*!< Task handle, NULL for an interrupt handler */
+  uint32_t      ulUsage;        /*!< Utilization during the last window */
+  uint64_t      ullTotalTime;   /*!< Run time since the accounting started */
+  uint32_t      ulMaxSlice;     /*!< Longest time run without being preempted or switched out */
+  uint32_t      ulSlices;       /*!< Number of run slices */
+  uint32_t      ulHistogram[CPU_UTILS_HISTOGRAM_BINS];  /*!< Run slice durations, halved at every window */
+} osCPU_Stats_t;
 
 /* Exported functions ------------------------------------------------------- */
 uint16_t osGetCPUUsage (void);
+uint32_t osGetCPUStats (osCPU_Stats_t *pxStats, uint32_t ulMaxEntries);
+uint32_t osGetCPUTimeFrequency (void);
+
+void osCPU_SetISRName (uint32_t ulIsrId, const char *pcName);
+void osCPU_EnterISR (uint32_t ulIsrId);
+void osCPU_ExitISR (void);
+
+void StartIdleMonitor (void);
+void EndIdleMonitor (void);
+void osCPU_TaskDeleted (void *pvTask);
 
 #ifdef __cplusplus
 }